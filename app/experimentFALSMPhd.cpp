@@ -6,6 +6,7 @@
 #include <index/falsmtree.hpp>
 #include <index/lsmtree.hpp>
 #include <threadPool/dbThreadPool.hpp>
+#include <experiment/parameterSweep.hpp>
 
 #include <random>
 #include <iostream>
@@ -15,12 +16,14 @@
 
 #define FALSM_SANDBOX_DIRECTORY_PATH          "../experimentResults/phd/falsm/sandbox"
 #define FALSM_REAL_EXPERIMENTS_DIRECTORY_PATH "../experimentResults/phd/falsm/real"
+#define FALSM_SWEEP_CACHE_DIRECTORY_PATH      "../experimentResults/phd/falsm/cache"
+#define FALSM_CHECKPOINT_DIRECTORY_PATH       "../experimentResults/phd/falsm/checkpoint"
 
 #define MY_LUCKY_SEED 235111741 // euler lucky numbers 2, 3, 5, 11, 7, 41
 
-[[maybe_unused]] static void ex_phd_basic_bulkloadAndRSearchRandomSel_step(const std::string& exName, Disk* disk, DBTable* table, size_t startingEntriesInIndex, size_t entriesToInsert, size_t minRandom, size_t maxRandom, size_t rsearches, double sel, size_t ssTableSize, size_t bufferSize, size_t levelRatio)
+[[maybe_unused]] static Workload* ex_phd_basic_bulkloadAndRSearchRandomSel_workload(const std::string& exName, const Disk* disk, const DBTable* table, size_t startingEntriesInIndex, size_t entriesToInsert, size_t minRandom, size_t maxRandom, size_t rsearches, double sel, size_t ssTableSize, size_t bufferSize, size_t levelRatio, std::vector<DBIndex*>& indexes)
 {
-    std::vector<std::string> names {"1", "2", "3", "4", "5", "10", "15", "20", "25", "50", "LSM"};
+    static const std::vector<std::string> names {"1", "2", "3", "4", "5", "10", "15", "20", "25", "50", "LSM"};
 
     DBIndex* falsm1 = new FALSMTree(names[0].c_str(), disk->clone(), table->getKeySize(), table->getDataSize(), ssTableSize, bufferSize, levelRatio, 1);
     DBIndex* falsm2 = new FALSMTree(names[1].c_str(), disk->clone(), table->getKeySize(), table->getDataSize(), ssTableSize, bufferSize, levelRatio, 2);
@@ -34,21 +37,7 @@
     DBIndex* falsm50 = new FALSMTree(names[9].c_str(), disk->clone(), table->getKeySize(), table->getDataSize(), ssTableSize, bufferSize, levelRatio, 50);
     DBIndex* lsmClassic = new LSMTree(names[10].c_str(), disk->clone(), table->getKeySize(), table->getDataSize(), ssTableSize, bufferSize, levelRatio, LSMTree::BULKLOAD_FEATURE_OFF);
 
-    // std::string label = std::string("Bacic FALSM PHD ") + exName + std::string(" :") +
-    //                     std::string(" startingEntriesInIndex = ") + std::to_string(startingEntriesInIndex) +
-    //                     std::string(" entriesToInsert = ") + std::to_string(entriesToInsert) +
-    //                     std::string(" bulkloadPackageNumEntries = [") + std::to_string(minRandom) + std::string(" - ") + std::to_string(maxRandom) + std::string("]") +
-    //                     std::string(" rsearches = ") + std::to_string(rsearches) +
-    //                     std::string(" sel = ") + std::to_string(sel) +
-    //                     std::string(" indexesParams = {") +
-    //                     std::string(" bufferSize = ") + std::to_string(bufferSize) +
-    //                     std::string(" ssTableSize = ") + std::to_string(ssTableSize) +
-    //                     std::string(" levelRatio = ") + std::to_string(levelRatio) + std::string(" }") +
-    //                     std::string(" table = ") + table->toString();
-
-    LOGGER_LOG_INFO("PHD {} started", exName);
-
-    std::vector<DBIndex*> indexes {falsm1, falsm2, falsm3, falsm4, falsm5, falsm10, falsm15, falsm20, falsm25, falsm50, lsmClassic};
+    indexes = std::vector<DBIndex*>{falsm1, falsm2, falsm3, falsm4, falsm5, falsm10, falsm15, falsm20, falsm25, falsm50, lsmClassic};
     if (startingEntriesInIndex > 0)
     {
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -73,18 +62,39 @@
         steps.push_back(new WorkloadStepRSearch(sel, rsearches));
     }
 
-    Workload workload(indexes, steps);
-    workload.run();
+    return new Workload(indexes, steps);
+}
+
+[[maybe_unused]] static std::string ex_phd_basic_bulkloadAndRSearchRandomSel_result(const std::string& exName, const Disk* disk, const DBTable* table, size_t startingEntriesInIndex, size_t entriesToInsert, size_t minRandom, size_t maxRandom, size_t rsearches, double sel, size_t ssTableSize, size_t bufferSize, size_t levelRatio)
+{
+    // std::string label = std::string("Bacic FALSM PHD ") + exName + std::string(" :") +
+    //                     std::string(" startingEntriesInIndex = ") + std::to_string(startingEntriesInIndex) +
+    //                     std::string(" entriesToInsert = ") + std::to_string(entriesToInsert) +
+    //                     std::string(" bulkloadPackageNumEntries = [") + std::to_string(minRandom) + std::string(" - ") + std::to_string(maxRandom) + std::string("]") +
+    //                     std::string(" rsearches = ") + std::to_string(rsearches) +
+    //                     std::string(" sel = ") + std::to_string(sel) +
+    //                     std::string(" indexesParams = {") +
+    //                     std::string(" bufferSize = ") + std::to_string(bufferSize) +
+    //                     std::string(" ssTableSize = ") + std::to_string(ssTableSize) +
+    //                     std::string(" levelRatio = ") + std::to_string(levelRatio) + std::string(" }") +
+    //                     std::string(" table = ") + table->toString();
+
+    LOGGER_LOG_INFO("PHD {} started", exName);
+
+    std::vector<DBIndex*> indexes;
+    Workload* workload = ex_phd_basic_bulkloadAndRSearchRandomSel_workload(exName, disk, table, startingEntriesInIndex, entriesToInsert, minRandom, maxRandom, rsearches, sel, ssTableSize, bufferSize, levelRatio, indexes);
+    workload->setCheckpointPath(std::string(FALSM_CHECKPOINT_DIRECTORY_PATH) + std::string("/") + exName + std::string(".ckpt"));
+    workload->run();
 
     std::string toPrint("");
 
     toPrint += std::string("T\tCzas wstawiania\tCzas wyszukiwania\tCałkowity czas\tCałkowity czas LSM\n");
 
-    const std::vector<WorkloadCounters>& totalCounters = workload.getAllTotalCounters();
-    double lsmTotalTime = totalCounters[names.size() - 1].getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME);
-    for (size_t i = 0; i < names.size() - 1; ++i) // last is lsmtree
+    const std::vector<WorkloadCounters>& totalCounters = workload->getAllTotalCounters();
+    double lsmTotalTime = totalCounters[indexes.size() - 1].getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME);
+    for (size_t i = 0; i < indexes.size() - 1; ++i) // last is lsmtree
     {
-        toPrint += names[i]; // 1 or 2 or  .... this is T parameter
+        toPrint += indexes[i]->getName(); // 1 or 2 or  .... this is T parameter
 
         toPrint += std::string("\t") + std::to_string(totalCounters[i].getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_BULKLOAD_TOTAL_TIME)) +
                    std::string("\t") + std::to_string(totalCounters[i].getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_RSEARCH_TOTAL_TIME)) +
@@ -93,6 +103,17 @@
                    std::string("\n");
     }
 
+    delete workload;
+    for (size_t i = 0; i < indexes.size(); ++i)
+        delete indexes[i];
+
+    return toPrint;
+}
+
+[[maybe_unused]] static void ex_phd_basic_bulkloadAndRSearchRandomSel_step(const std::string& exName, Disk* disk, DBTable* table, size_t startingEntriesInIndex, size_t entriesToInsert, size_t minRandom, size_t maxRandom, size_t rsearches, double sel, size_t ssTableSize, size_t bufferSize, size_t levelRatio)
+{
+    const std::string toPrint = ex_phd_basic_bulkloadAndRSearchRandomSel_result(exName, disk, table, startingEntriesInIndex, entriesToInsert, minRandom, maxRandom, rsearches, sel, ssTableSize, bufferSize, levelRatio);
+
     DBThreadPool::mutex.lock();
 
     std::ofstream outfile;
@@ -107,9 +128,6 @@
     delete disk;
     delete table;
 
-    for (size_t i = 0; i < indexes.size(); ++i)
-        delete indexes[i];
-
     LOGGER_LOG_INFO("PHD {} finished", exName);
 }
 
@@ -180,6 +198,7 @@
             steps.push_back(new WorkloadStepDelete(wexperiments[i].qdelete));
         }
         Workload workload(indexes, steps);
+        workload.setCheckpointPath(std::string(FALSM_CHECKPOINT_DIRECTORY_PATH) + std::string("/") + exName + std::string("_") + wexperiments[i].name + std::string(".ckpt"));
 
         for (size_t j = 0; j < indexes.size(); ++j)
             indexes[j]->createTopologyAfterInsert(startingEntries);
@@ -326,6 +345,7 @@
             steps.push_back(new WorkloadStepDelete(wexperiments[i].qdelete));
         }
         Workload workload(indexes, steps);
+        workload.setCheckpointPath(std::string(FALSM_CHECKPOINT_DIRECTORY_PATH) + std::string("/") + exName + std::string("_") + wexperiments[i].name + std::string(".ckpt"));
 
         for (size_t j = 0; j < indexes.size(); ++j)
             indexes[j]->createTopologyAfterInsert(startingEntries);
@@ -471,6 +491,7 @@
             steps.push_back(new WorkloadStepDelete(wexperiments[i].qdelete));
         }
         Workload workload(indexes, steps);
+        workload.setCheckpointPath(std::string(FALSM_CHECKPOINT_DIRECTORY_PATH) + std::string("/") + exName + std::string("_") + wexperiments[i].name + std::string(".ckpt"));
 
         for (size_t j = 0; j < indexes.size(); ++j)
             indexes[j]->createTopologyAfterInsert(startingEntries);
@@ -632,6 +653,7 @@
             steps.push_back(new WorkloadStepDelete(wexperiments[i].qdelete));
         }
         Workload workload(indexes, steps);
+        workload.setCheckpointPath(std::string(FALSM_CHECKPOINT_DIRECTORY_PATH) + std::string("/") + exName + std::string("_") + wexperiments[i].name + std::string(".ckpt"));
 
         for (size_t j = 0; j < indexes.size(); ++j)
             indexes[j]->createTopologyAfterInsert(startingEntries);
@@ -811,6 +833,122 @@
     }
 }
 
+static Disk* ex_phd_create_disk(const std::string& name)
+{
+    if (name == std::string("toshiba"))
+        return new DiskSSD_ToshibaVX500();
+
+    if (name == std::string("intel"))
+        return new DiskSSD_IntelDCP4511();
+
+    return new DiskSSD_Samsung840();
+}
+
+static DBTable* ex_phd_create_table(const std::string& name)
+{
+    if (name == std::string("neworder"))
+        return new DBTable_TPCC_NewOrder();
+
+    if (name == std::string("customer"))
+        return new DBTable_TPCC_Customer();
+
+    return new DBTable_TPCC_Warehouse();
+}
+
+// the same points as ex_phd_basic_batch, but finished points are taken from cache
+[[maybe_unused]] static void ex_phd_basic_sweep()
+{
+    auto getExName = [](const ParameterSweep::Point& point)
+    {
+        return std::string("ex0_") + point.get("rsearches") + std::string("rsearches_") + point.get("disk") + std::string("_") + point.get("table");
+    };
+
+    auto buildWorkload = [getExName](const ParameterSweep::Point& point, std::vector<DBIndex*>& indexes)
+    {
+        Disk* disk = ex_phd_create_disk(point.get("disk"));
+        DBTable* table = ex_phd_create_table(point.get("table"));
+
+        Workload* workload = ex_phd_basic_bulkloadAndRSearchRandomSel_workload(getExName(point), disk, table, 0, point.getSizeT("entries"), point.getSizeT("bulkloadMin"), point.getSizeT("bulkloadMax"), point.getSizeT("rsearches"), point.getDouble("sel"), point.getSizeT("ssTableSize"), point.getSizeT("bufferSize"), point.getSizeT("levelRatio"), indexes);
+
+        delete disk;
+        delete table;
+
+        return workload;
+    };
+
+    auto pointFunction = [getExName](const ParameterSweep::Point& point)
+    {
+        Disk* disk = ex_phd_create_disk(point.get("disk"));
+        DBTable* table = ex_phd_create_table(point.get("table"));
+
+        const std::string result = ex_phd_basic_bulkloadAndRSearchRandomSel_result(getExName(point), disk, table, 0, point.getSizeT("entries"), point.getSizeT("bulkloadMin"), point.getSizeT("bulkloadMax"), point.getSizeT("rsearches"), point.getDouble("sel"), point.getSizeT("ssTableSize"), point.getSizeT("bufferSize"), point.getSizeT("levelRatio"));
+
+        delete disk;
+        delete table;
+
+        return result;
+    };
+
+    // cache key has steps and full description of indexes (with disks) which point function runs
+    auto configFunction = [buildWorkload](const ParameterSweep::Point& point)
+    {
+        std::vector<DBIndex*> indexes;
+        Workload* workload = buildWorkload(point, indexes);
+
+        const std::string config = workload->toStringFull();
+
+        delete workload;
+        for (size_t i = 0; i < indexes.size(); ++i)
+            delete indexes[i];
+
+        return config;
+    };
+
+    // time grows with size of entries and number of range searches
+    auto costFunction = [](const ParameterSweep::Point& point)
+    {
+        DBTable* table = ex_phd_create_table(point.get("table"));
+        const double cost = static_cast<double>(table->getDataSize()) * static_cast<double>(point.getSizeT("rsearches"));
+
+        delete table;
+
+        return cost;
+    };
+
+    // values which are the same for every point are parameters too, so they are visible in point key
+    const std::vector<std::pair<std::string, std::string>> fixedParams = {{"entries", "10000000"}, {"bulkloadMin", "50000"}, {"bulkloadMax", "100000"}, {"sel", "0.01"}, {"ssTableSize", std::to_string(1 << 21)}, {"bufferSize", std::to_string(1 << 21)}, {"levelRatio", "5"}};
+
+    ParameterSweep sweep("ex_phd_basic_bulkloadAndRSearchRandomSel", FALSM_SWEEP_CACHE_DIRECTORY_PATH, pointFunction, costFunction, configFunction);
+    sweep.addParameter("disk", std::vector<std::string>{"samsung", "toshiba", "intel"});
+    sweep.addParameter("table", std::vector<std::string>{"warehouse"});
+    sweep.addParameter("rsearches", std::vector<size_t>{20, 40, 100, 250});
+    for (const auto& param : fixedParams)
+        sweep.addParameter(param.first, std::vector<std::string>{param.second});
+
+    for (const auto& table : std::vector<std::string>{"neworder", "customer"})
+        for (const auto& rsearches : std::vector<std::string>{"20", "40", "100", "250"})
+        {
+            ParameterSweep::Point point(fixedParams);
+            point.set("disk", "samsung");
+            point.set("table", table);
+            point.set("rsearches", rsearches);
+
+            sweep.addPoint(point);
+        }
+
+    sweep.run();
+
+    for (const auto& point : sweep.getPoints())
+    {
+        std::ofstream outfile;
+        std::string path(FALSM_REAL_EXPERIMENTS_DIRECTORY_PATH);
+        path += std::string("/") + getExName(point) + std::string(".txt");
+        outfile.open(path);
+
+        outfile << sweep.getResult(point) << std::flush;
+    }
+}
+
 [[maybe_unused]] static void ex_phd_extendend_tparam_batch(std::vector<std::future<bool>>& futures)
 {
     {
@@ -919,6 +1057,9 @@ void experimentPhdFALSMTree()
     LOGGER_LOG_INFO("Starting FALSMTree PHD experiments");
 
     std::filesystem::create_directories(FALSM_REAL_EXPERIMENTS_DIRECTORY_PATH);
+    std::filesystem::create_directories(FALSM_CHECKPOINT_DIRECTORY_PATH);
+
+    // ex_phd_basic_sweep();
 
     std::vector<std::future<bool>> futures;
 
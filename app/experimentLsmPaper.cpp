@@ -64,6 +64,7 @@
     }
 
     Workload workload(indexes, steps);
+    workload.setKeepStepCounters(false);
     workload.run();
 
     for (size_t i = 0; i < indexes.size(); ++i)
@@ -157,6 +158,7 @@
         }
 
         Workload workload(indexes, steps);
+        workload.setKeepStepCounters(false);
         workload.run();
 
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -274,6 +276,7 @@
         }
 
         Workload workload(indexes, steps);
+        workload.setKeepStepCounters(false);
         workload.run();
 
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -390,6 +393,7 @@
         }
 
         Workload workload(indexes, steps);
+        workload.setKeepStepCounters(false);
         workload.run();
 
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -508,6 +512,7 @@
         }
 
         Workload workload(indexes, steps);
+        workload.setKeepStepCounters(false);
         workload.run();
 
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -618,6 +623,7 @@
     }
 
     Workload workload(indexes, steps);
+    workload.setKeepStepCounters(false);
     workload.run();
 
     for (size_t i = 0; i < indexes.size(); ++i)
@@ -721,6 +727,7 @@
     }
 
     Workload workload(indexes, steps);
+    workload.setKeepStepCounters(false);
     workload.run();
 
     for (size_t i = 0; i < indexes.size(); ++i)
@@ -841,6 +848,7 @@
         }
 
         Workload workload(indexes, steps);
+        workload.setKeepStepCounters(false);
         workload.run();
 
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -1007,6 +1015,7 @@
         }
 
         Workload workload(indexes, steps);
+        workload.setKeepStepCounters(false);
         workload.run();
 
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -1172,6 +1181,7 @@
         }
 
         Workload workload(indexes, steps);
+        workload.setKeepStepCounters(false);
         workload.run();
 
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -1337,6 +1347,7 @@
         }
 
         Workload workload(indexes, steps);
+        workload.setKeepStepCounters(false);
         workload.run();
 
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -1500,6 +1511,7 @@
         }
 
         Workload workload(indexes, steps);
+        workload.setKeepStepCounters(false);
         workload.run();
 
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -1644,6 +1656,7 @@
     }
 
     Workload workload(indexes, steps);
+    workload.setKeepStepCounters(false);
     workload.run();
 
     for (size_t i = 0; i < indexes.size(); ++i)
@@ -1758,6 +1771,7 @@
         }
 
         Workload workload(indexes, steps);
+        workload.setKeepStepCounters(false);
         workload.run();
 
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -1875,6 +1889,7 @@
         }
 
         Workload workload(indexes, steps);
+        workload.setKeepStepCounters(false);
         workload.run();
 
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -1991,6 +2006,7 @@
         }
 
         Workload workload(indexes, steps);
+        workload.setKeepStepCounters(false);
         workload.run();
 
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -2109,6 +2125,7 @@
         }
 
         Workload workload(indexes, steps);
+        workload.setKeepStepCounters(false);
         workload.run();
 
         for (size_t i = 0; i < indexes.size(); ++i)
@@ -3,6 +3,7 @@
 #include <table/dbTableTPCC.hpp>
 #include <disk/diskPCM.hpp>
 #include <workload/workloadLib.hpp>
+#include <workload/analyzer/analyzerStepWearDistribution.hpp>
 #include <index/bptree.hpp>
 #include <index/bbptree.hpp>
 #include <index/cbptree.hpp>
@@ -29,6 +30,25 @@
 
 #define MY_LUCKY_SEED 235111741 // euler lucky numbers 2, 3, 5, 11, 7, 41
 
+#define PAM_PCM_CAPACITY            (16UL << 30) // 16GB is enough for 10m entries of TPCC tables
+#define PAM_PCM_WEAR_SAMPLE_RATE    256 // keep wear of every 256-th line
+#define PAM_PCM_ENDURANCE           100000000 // PCM line dies after ~10^8 writes
+
+/**
+ * @brief Create PCM disk with start-gap wear leveling and wear tracking, so lifetime of PCM can be reported
+ *
+ * @return new PCM disk
+ */
+static Disk* createPAMDisk()
+{
+    DiskPCM* disk = new DiskPCM_DefaultModel();
+
+    disk->setWearLeveling(MemoryModelPCM::WEAR_LEVELING_START_GAP, PAM_PCM_CAPACITY);
+    disk->enableWearTracking(PAM_PCM_CAPACITY + disk->getLowLevelController().getPageSize(), PAM_PCM_WEAR_SAMPLE_RATE);
+
+    return disk;
+}
+
 [[maybe_unused]] static void ex1_phd_basic_step(const std::string& exName, Disk* disk, const DBTable* table, size_t startingEntries, const double sel)
 {
     // const size_t nodeSize =  disk->getLowLevelController().getPageSize() * 10;
@@ -142,6 +162,24 @@
     }
 
 
+    // PCM lifetime with start-gap wear leveling
+    {
+        WorkloadAnalyzerStepWearDistribution analyzer(PAM_PCM_ENDURANCE);
+        const std::string toPrint = analyzer.analyzeWorkloadCounters(*w);
+
+        LOGGER_LOG_INFO("PHD {}: TO PRINT PCM LIFETIME\n{}", exName, toPrint);
+        DBThreadPool::mutex.lock();
+
+        std::ofstream outfile;
+        std::string path(PAM_REAL_EXPERIMENTS_DIRECTORY_PATH);
+        path += std::string("/") + exName + std::string("_lifetime") +  std::string(".txt");
+        outfile.open(path);
+
+        outfile << toPrint << std::flush;
+
+        DBThreadPool::mutex.unlock();
+    }
+
     // REAL memory wearout
     {
         std::string toPrint = "";
@@ -244,6 +282,7 @@
 
     std::vector<Workload> workloads;
     std::vector<std::string> names {"Adaptive Merging", "extendend Adaptive Merging", "PCM Adaptive Merging"};
+    std::string lifetimeToPrint = "";
     for (size_t i = 0; i < wexperiments.size(); ++i)
     {
         // const size_t nodeSize =  disk->getLowLevelController().getPageSize() * 10;
@@ -279,6 +318,10 @@
 
         workloads.push_back(workload);
 
+        // disks are deleted with indexes, so lifetime has to be taken now
+        WorkloadAnalyzerStepWearDistribution analyzer(PAM_PCM_ENDURANCE);
+        lifetimeToPrint += wexperiments[i].name + std::string("\n") + analyzer.analyzeWorkloadCounters(workload);
+
         for (size_t j = 0; j < indexes.size(); ++j)
             delete indexes[j];
 
@@ -344,6 +387,21 @@
         DBThreadPool::mutex.unlock();
     }
 
+    // PCM lifetime with start-gap wear leveling
+    {
+        LOGGER_LOG_INFO("PHD {}: TO PRINT PCM LIFETIME\n{}", exName, lifetimeToPrint);
+        DBThreadPool::mutex.lock();
+
+        std::ofstream outfile;
+        std::string path(PAM_REAL_EXPERIMENTS_DIRECTORY_PATH);
+        path += std::string("/") + exName + std::string("_lifetime") +  std::string(".txt");
+        outfile.open(path);
+
+        outfile << lifetimeToPrint << std::flush;
+
+        DBThreadPool::mutex.unlock();
+    }
+
     // REAL memory wearout
     {
         std::string toPrint = "Workload\t";
@@ -413,25 +471,25 @@
 {
     {
         DBTable* table = new DBTable_TPCC_Warehouse();
-        Disk* disk = new DiskPCM_DefaultModel();
+        Disk* disk = createPAMDisk();
         futures.push_back(DBThreadPool::threadPool.submit(ex1_phd_basic_step, "ex1_basic_pcmdefault_tpcc_warehouse_1", disk, table, 10000000, 0.01));
     }
 
     {
         DBTable* table = new DBTable_TPCC_Warehouse();
-        Disk* disk = new DiskPCM_DefaultModel();
+        Disk* disk = createPAMDisk();
         futures.push_back(DBThreadPool::threadPool.submit(ex1_phd_basic_step, "ex1_basic_pcmdefault_tpcc_warehouse_5", disk, table, 10000000, 0.05));
     }
 
     {
         DBTable* table = new DBTable_TPCC_Customer();
-        Disk* disk = new DiskPCM_DefaultModel();
+        Disk* disk = createPAMDisk();
         futures.push_back(DBThreadPool::threadPool.submit(ex1_phd_basic_step, "ex1_basic_pcmdefault_tpcc_customer_1", disk, table, 10000000, 0.01));
     }
 
     {
         DBTable* table = new DBTable_TPCC_Customer();
-        Disk* disk = new DiskPCM_DefaultModel();
+        Disk* disk = createPAMDisk();
         futures.push_back(DBThreadPool::threadPool.submit(ex1_phd_basic_step, "ex1_basic_pcmdefault_tpcc_customer_5", disk, table, 10000000, 0.05));
     }
 
@@ -441,25 +499,25 @@
 {
     {
         DBTable* table = new DBTable_TPCC_Warehouse();
-        Disk* disk = new DiskPCM_DefaultModel();
+        Disk* disk = createPAMDisk();
         futures.push_back(DBThreadPool::threadPool.submit(ex2_phd_extendend_step, "ex2_extendend_pcmdefault_tpcc_warehouse_1", disk, table, 0.01));
     }
 
     {
         DBTable* table = new DBTable_TPCC_Warehouse();
-        Disk* disk = new DiskPCM_DefaultModel();
+        Disk* disk = createPAMDisk();
         futures.push_back(DBThreadPool::threadPool.submit(ex2_phd_extendend_step, "ex2_extendend_pcmdefault_tpcc_warehouse_5", disk, table, 0.05));
     }
 
     {
         DBTable* table = new DBTable_TPCC_Customer();
-        Disk* disk = new DiskPCM_DefaultModel();
+        Disk* disk = createPAMDisk();
         futures.push_back(DBThreadPool::threadPool.submit(ex2_phd_extendend_step, "ex2_extendend_pcmdefault_tpcc_customer_1", disk, table, 0.01));
     }
 
     {
         DBTable* table = new DBTable_TPCC_Customer();
-        Disk* disk = new DiskPCM_DefaultModel();
+        Disk* disk = createPAMDisk();
         futures.push_back(DBThreadPool::threadPool.submit(ex2_phd_extendend_step, "ex2_extendend_pcmdefault_tpcc_customer_5", disk, table, 0.05));
     }
 }
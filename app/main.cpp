@@ -31,5 +31,7 @@ int main()
 
     DBThreadPool::threadPool.wait_for_tasks();
 
+    loggerStop();
+
     return 0;
 }
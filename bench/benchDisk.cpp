@@ -0,0 +1,85 @@
+#include <disk/diskSSD.hpp>
+#include <disk/diskFlashNandFTL.hpp>
+#include <disk/diskFlashNandRaw.hpp>
+#include <disk/diskPCM.hpp>
+
+#include <benchmark/benchmark.h>
+
+// Disk hot paths: every index operation ends in this code, so slowdown here is visible everywhere
+
+template <typename DiskType>
+static void BM_DiskReadBytes(benchmark::State& state)
+{
+    DiskType disk;
+    const size_t bytes = static_cast<size_t>(state.range(0));
+    const uintptr_t addr = disk.getLowLevelController().getPageSize();
+    uintptr_t offset = 0;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(disk.readBytes(addr + offset, bytes));
+
+        // do not hit the same pages all the time
+        offset = (offset + bytes) % (1 << 30);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes));
+}
+
+template <typename DiskType>
+static void BM_DiskWriteBytes(benchmark::State& state)
+{
+    DiskType disk;
+    const size_t bytes = static_cast<size_t>(state.range(0));
+    const uintptr_t addr = disk.getLowLevelController().getPageSize();
+    uintptr_t offset = 0;
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(disk.writeBytes(addr + offset, bytes));
+        offset = (offset + bytes) % (1 << 30);
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes));
+}
+
+template <typename DiskType>
+static void BM_DiskOverwriteBytes(benchmark::State& state)
+{
+    DiskType disk;
+    const size_t bytes = static_cast<size_t>(state.range(0));
+    const uintptr_t addr = disk.getLowLevelController().getPageSize();
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(disk.overwriteBytes(addr, bytes));
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes));
+}
+
+template <typename DiskType>
+static void BM_DiskFlushCache(benchmark::State& state)
+{
+    DiskType disk;
+    const size_t bytes = static_cast<size_t>(state.range(0));
+    const uintptr_t addr = disk.getLowLevelController().getPageSize();
+
+    // each iteration fills cache with a few not aligned writes and flushes it
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < 8; ++i)
+            disk.writeBytes(addr + i * (bytes + 1), bytes);
+
+        benchmark::DoNotOptimize(disk.flushCache());
+    }
+}
+
+#define BENCH_DISK_ALL_OPS(diskType) \
+    BENCHMARK_TEMPLATE(BM_DiskReadBytes, diskType)->RangeMultiplier(8)->Range(64, 1 << 20); \
+    BENCHMARK_TEMPLATE(BM_DiskWriteBytes, diskType)->RangeMultiplier(8)->Range(64, 1 << 20); \
+    BENCHMARK_TEMPLATE(BM_DiskOverwriteBytes, diskType)->RangeMultiplier(8)->Range(64, 1 << 20); \
+    BENCHMARK_TEMPLATE(BM_DiskFlushCache, diskType)->Arg(64)->Arg(4096)
+
+BENCH_DISK_ALL_OPS(DiskSSD_Samsung840);
+BENCH_DISK_ALL_OPS(DiskFlashNandFTL_SamsungK9F1G08U0D);
+BENCH_DISK_ALL_OPS(DiskFlashNandRaw_SamsungK9F1G08U0D);
+BENCH_DISK_ALL_OPS(DiskPCM_DefaultModel);
@@ -0,0 +1,185 @@
+#include <disk/diskSSD.hpp>
+#include <disk/diskFlashNandFTL.hpp>
+#include <disk/diskPCM.hpp>
+#include <index/bptree.hpp>
+#include <index/fatree.hpp>
+#include <index/fdtree.hpp>
+#include <index/lsmtree.hpp>
+#include <index/falsmtree.hpp>
+
+#include <memory>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+// Index x Disk x Operation matrix. Measured is wall time of simulator code, not simulated time.
+// Simulated time of the last call is reported as counter, so accuracy regressions are visible as well.
+
+static constexpr size_t benchKeySize = 8;
+static constexpr size_t benchDataSize = 64;
+static constexpr size_t benchStartingEntries = 1 << 20;
+
+// PCM page is smaller than record, tree nodes need at least a few records (like in experimentPAMPhd)
+static constexpr size_t benchMinNodeSize = (benchKeySize + benchDataSize) * 10 + 10;
+
+static size_t benchNodeSize(const Disk* disk)
+{
+    return std::max(disk->getLowLevelController().getPageSize(), benchMinNodeSize);
+}
+
+template <typename IndexType>
+static DBIndex* newIndex(Disk* disk)
+{
+    return new IndexType(disk, benchKeySize, benchDataSize);
+}
+
+template <>
+DBIndex* newIndex<BPTree>(Disk* disk)
+{
+    return new BPTree(disk, benchKeySize, benchDataSize, benchNodeSize(disk));
+}
+
+template <>
+DBIndex* newIndex<FATree>(Disk* disk)
+{
+    return new FATree(disk, benchKeySize, benchDataSize, benchNodeSize(disk), benchNodeSize(disk), 10);
+}
+
+template <>
+DBIndex* newIndex<FDTree>(Disk* disk)
+{
+    return new FDTree(disk, benchKeySize, benchDataSize, benchNodeSize(disk), benchNodeSize(disk), 10);
+}
+
+template <typename IndexType, typename DiskType>
+static std::unique_ptr<DBIndex> createIndex(size_t startingEntries)
+{
+    std::unique_ptr<DBIndex> index(newIndex<IndexType>(new DiskType()));
+
+    if (startingEntries > 0)
+        index->createTopologyAfterInsert(startingEntries);
+
+    return index;
+}
+
+template <typename IndexType, typename DiskType>
+static void BM_IndexInsert(benchmark::State& state)
+{
+    const size_t entries = static_cast<size_t>(state.range(0));
+    std::unique_ptr<DBIndex> index = createIndex<IndexType, DiskType>(0);
+    double simulatedTime = 0.0;
+
+    for (auto _ : state)
+    {
+        // keep index size bounded, otherwise later iterations measure bigger index
+        if (index->getNumEntries() >= benchStartingEntries)
+        {
+            state.PauseTiming();
+            index = createIndex<IndexType, DiskType>(0);
+            state.ResumeTiming();
+        }
+
+        simulatedTime += index->insertEntries(entries);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(entries));
+    state.counters["simulatedTime"] = benchmark::Counter(simulatedTime, benchmark::Counter::kAvgIterations);
+}
+
+template <typename IndexType, typename DiskType>
+static void BM_IndexBulkload(benchmark::State& state)
+{
+    const size_t entries = static_cast<size_t>(state.range(0));
+    std::unique_ptr<DBIndex> index = createIndex<IndexType, DiskType>(0);
+    double simulatedTime = 0.0;
+
+    if (!index->isBulkloadSupported())
+    {
+        state.SkipWithError("Bulkload is unsupported");
+        return;
+    }
+
+    for (auto _ : state)
+    {
+        if (index->getNumEntries() >= benchStartingEntries)
+        {
+            state.PauseTiming();
+            index = createIndex<IndexType, DiskType>(0);
+            state.ResumeTiming();
+        }
+
+        simulatedTime += index->bulkloadEntries(entries);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(entries));
+    state.counters["simulatedTime"] = benchmark::Counter(simulatedTime, benchmark::Counter::kAvgIterations);
+}
+
+template <typename IndexType, typename DiskType>
+static void BM_IndexDelete(benchmark::State& state)
+{
+    const size_t entries = static_cast<size_t>(state.range(0));
+    std::unique_ptr<DBIndex> index = createIndex<IndexType, DiskType>(benchStartingEntries);
+    double simulatedTime = 0.0;
+
+    for (auto _ : state)
+    {
+        if (index->getNumEntries() < benchStartingEntries / 2)
+        {
+            state.PauseTiming();
+            index = createIndex<IndexType, DiskType>(benchStartingEntries);
+            state.ResumeTiming();
+        }
+
+        simulatedTime += index->deleteEntries(entries);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(entries));
+    state.counters["simulatedTime"] = benchmark::Counter(simulatedTime, benchmark::Counter::kAvgIterations);
+}
+
+template <typename IndexType, typename DiskType>
+static void BM_IndexPSearch(benchmark::State& state)
+{
+    const size_t queries = static_cast<size_t>(state.range(0));
+    std::unique_ptr<DBIndex> index = createIndex<IndexType, DiskType>(benchStartingEntries);
+    double simulatedTime = 0.0;
+
+    for (auto _ : state)
+        simulatedTime += index->findPointEntries(queries);
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(queries));
+    state.counters["simulatedTime"] = benchmark::Counter(simulatedTime, benchmark::Counter::kAvgIterations);
+}
+
+template <typename IndexType, typename DiskType>
+static void BM_IndexRSearch(benchmark::State& state)
+{
+    const size_t entries = static_cast<size_t>(state.range(0));
+    std::unique_ptr<DBIndex> index = createIndex<IndexType, DiskType>(benchStartingEntries);
+    double simulatedTime = 0.0;
+
+    for (auto _ : state)
+        simulatedTime += index->findRangeEntries(entries);
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(entries));
+    state.counters["simulatedTime"] = benchmark::Counter(simulatedTime, benchmark::Counter::kAvgIterations);
+}
+
+#define BENCH_INDEX_ALL_OPS(indexType, diskType) \
+    BENCHMARK_TEMPLATE(BM_IndexInsert, indexType, diskType)->Arg(1)->Arg(1000); \
+    BENCHMARK_TEMPLATE(BM_IndexBulkload, indexType, diskType)->Arg(1000)->Arg(100000); \
+    BENCHMARK_TEMPLATE(BM_IndexDelete, indexType, diskType)->Arg(1)->Arg(1000); \
+    BENCHMARK_TEMPLATE(BM_IndexPSearch, indexType, diskType)->Arg(1)->Arg(100); \
+    BENCHMARK_TEMPLATE(BM_IndexRSearch, indexType, diskType)->Arg(100)->Arg(100000)
+
+#define BENCH_INDEX_ALL_DISKS(indexType) \
+    BENCH_INDEX_ALL_OPS(indexType, DiskSSD_Samsung840); \
+    BENCH_INDEX_ALL_OPS(indexType, DiskFlashNandFTL_SamsungK9F1G08U0D); \
+    BENCH_INDEX_ALL_OPS(indexType, DiskPCM_DefaultModel)
+
+BENCH_INDEX_ALL_DISKS(BPTree);
+BENCH_INDEX_ALL_DISKS(FATree);
+BENCH_INDEX_ALL_DISKS(FDTree);
+BENCH_INDEX_ALL_DISKS(LSMTree);
+BENCH_INDEX_ALL_DISKS(FALSMTree);
@@ -0,0 +1,298 @@
+#include <table/dbTable.hpp>
+#include <table/dbTableTPCC.hpp>
+#include <disk/diskSSD.hpp>
+#include <disk/diskFlashNandFTL.hpp>
+#include <disk/diskPCM.hpp>
+#include <workload/workloadLib.hpp>
+#include <index/bptree.hpp>
+#include <index/bbptree.hpp>
+#include <index/ubptree.hpp>
+#include <index/fatree.hpp>
+#include <index/fdtree.hpp>
+#include <index/lsmtree.hpp>
+#include <index/falsmtree.hpp>
+#include <index/cfdtree.hpp>
+#include <index/fbdsm.hpp>
+#include <index/dbIndexRawToColumnWrapper.hpp>
+#include <adaptiveMerging/adaptiveMerging.hpp>
+#include <adaptiveMerging/eAdaptiveMerging.hpp>
+#include <adaptiveMerging/lazyAdaptiveMerging.hpp>
+#include <adaptiveMerging/pcmAdaptiveMerging.hpp>
+
+#include <random>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+// Workload::run and reduced versions of app/experiment*.cpp scenarios.
+// Indexes, steps and sizes are the same as in experiments, only number of queries and entries is reduced.
+
+#define MY_LUCKY_SEED 235111741 // euler lucky numbers 2, 3, 5, 11, 7, 41
+
+static double totalWorkloadTime(const Workload& workload)
+{
+    double time = 0.0;
+    for (const auto& counters : workload.getAllTotalCounters())
+        time += counters.getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME);
+
+    return time;
+}
+
+static void deleteIndexes(const std::vector<DBIndex*>& indexes)
+{
+    for (size_t i = 0; i < indexes.size(); ++i)
+        delete indexes[i];
+}
+
+static void deleteIndexes(const std::vector<DBIndexColumn*>& indexes)
+{
+    for (size_t i = 0; i < indexes.size(); ++i)
+        delete indexes[i];
+}
+
+static void BM_WorkloadRun(benchmark::State& state)
+{
+    const size_t queries = static_cast<size_t>(state.range(0));
+    std::unique_ptr<DBTable> table(new DBTable_TPCC_Warehouse());
+    std::unique_ptr<Disk> disk(new DiskSSD_Samsung840());
+    double simulatedTime = 0.0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<DBIndex*> indexes {new BPTree(disk->clone(), table->getKeySize(), table->getDataSize()),
+                                       new LSMTree(disk->clone(), table->getKeySize(), table->getDataSize())};
+
+        for (size_t i = 0; i < indexes.size(); ++i)
+            indexes[i]->createTopologyAfterInsert(1 << 16);
+
+        std::vector<WorkloadStep*> steps;
+        for (size_t i = 0; i < queries; ++i)
+        {
+            steps.push_back(new WorkloadStepInsert(10));
+            steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(1)));
+            steps.push_back(new WorkloadStepRSearch(0.001));
+            steps.push_back(new WorkloadStepDelete(5));
+        }
+
+        Workload workload(indexes, steps);
+        state.ResumeTiming();
+
+        workload.run();
+
+        state.PauseTiming();
+        simulatedTime += totalWorkloadTime(workload);
+        deleteIndexes(indexes);
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(queries) * 4 * 2);
+    state.counters["simulatedTime"] = benchmark::Counter(simulatedTime, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_WorkloadRun)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+
+// experimentLsmPaper: random bulkloads into LSM variants
+static void BM_ExperimentLsmPaper(benchmark::State& state)
+{
+    std::unique_ptr<DBTable> table(new DBTable_TPCC_Warehouse());
+    std::unique_ptr<Disk> disk(new DiskSSD_Samsung840());
+    const size_t ssTableSize = disk->getLowLevelController().getBlockSize();
+    const size_t bufferSize = disk->getLowLevelController().getBlockSize();
+    const size_t levelRatio = 5;
+    const size_t entriesToInsert = 1 << 18;
+    double simulatedTime = 0.0;
+
+    for (auto _ : state)
+    {
+        std::vector<DBIndex*> indexes {new FALSMTree(disk->clone(), table->getKeySize(), table->getDataSize(), ssTableSize, bufferSize, levelRatio),
+                                       new LSMTree(disk->clone(), table->getKeySize(), table->getDataSize(), ssTableSize, bufferSize, levelRatio, LSMTree::BULKLOAD_FEATURE_OFF),
+                                       new LSMTree(disk->clone(), table->getKeySize(), table->getDataSize(), ssTableSize, bufferSize, levelRatio, LSMTree::BULKLOAD_ACCORDING_TO_CURRENT_CAPACITY),
+                                       new LSMTree(disk->clone(), table->getKeySize(), table->getDataSize(), ssTableSize, bufferSize, levelRatio, LSMTree::BULKLOAD_ACCORDING_TO_MAX_CAPACITY)};
+
+        std::mt19937 rng(MY_LUCKY_SEED);
+        std::uniform_int_distribution<size_t> randomizer(1000, 10000);
+
+        std::vector<WorkloadStep*> steps;
+        size_t entriesLeft = entriesToInsert;
+        while (entriesLeft > 0)
+        {
+            const size_t n = std::min(entriesLeft, randomizer(rng));
+            steps.push_back(new WorkloadStepBulkload(n));
+
+            entriesLeft -= n;
+        }
+
+        Workload workload(indexes, steps);
+        workload.run();
+
+        simulatedTime += totalWorkloadTime(workload);
+        deleteIndexes(indexes);
+    }
+
+    state.counters["simulatedTime"] = benchmark::Counter(simulatedTime, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ExperimentLsmPaper)->Unit(benchmark::kMillisecond);
+
+// experimentFAPhd: B+-Tree, LSM and FA-Tree on raw flash with FTL
+static void BM_ExperimentFAPhd(benchmark::State& state)
+{
+    std::unique_ptr<DBTable> table(new DBTable_TPCC_Warehouse());
+    std::unique_ptr<Disk> disk(new DiskFlashNandFTL_SamsungK9F1G08U0D());
+    const size_t queries = 1000;
+    double simulatedTime = 0.0;
+
+    for (auto _ : state)
+    {
+        std::vector<DBIndex*> indexes {new BPTree(disk->clone(), table->getKeySize(), table->getDataSize(), disk->getLowLevelController().getPageSize() * 2),
+                                       new LSMTree(disk->clone(), table->getKeySize(), table->getDataSize(), 1 << 22, disk->getLowLevelController().getBlockSize(), 5, LSMTree::BULKLOAD_FEATURE_OFF),
+                                       new FATree(disk->clone(), table->getKeySize(), table->getDataSize(), disk->getLowLevelController().getBlockSize(), disk->getLowLevelController().getBlockSize(), 5)};
+
+        std::vector<WorkloadStep*> steps;
+        steps.push_back(new WorkloadStepBulkload(1 << 16));
+        steps.push_back(new WorkloadStepInsert(queries));
+        steps.push_back(new WorkloadStepPSearch(queries));
+        steps.push_back(new WorkloadStepRSearch(0.001, queries / 10));
+        steps.push_back(new WorkloadStepDelete(queries / 10));
+
+        Workload workload(indexes, steps);
+        workload.run();
+
+        simulatedTime += totalWorkloadTime(workload);
+        deleteIndexes(indexes);
+    }
+
+    state.counters["simulatedTime"] = benchmark::Counter(simulatedTime, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ExperimentFAPhd)->Unit(benchmark::kMillisecond);
+
+// experimentFALSMPhd: FALSM with different capacity ratios vs classic LSM
+static void BM_ExperimentFALSMPhd(benchmark::State& state)
+{
+    std::unique_ptr<DBTable> table(new DBTable_TPCC_Warehouse());
+    std::unique_ptr<Disk> disk(new DiskSSD_Samsung840());
+    const size_t ssTableSize = disk->getLowLevelController().getBlockSize();
+    const size_t bufferSize = disk->getLowLevelController().getBlockSize();
+    const size_t levelRatio = 5;
+    const size_t queries = 1000;
+    double simulatedTime = 0.0;
+
+    for (auto _ : state)
+    {
+        std::vector<DBIndex*> indexes {new FALSMTree(disk->clone(), table->getKeySize(), table->getDataSize(), ssTableSize, bufferSize, levelRatio, 1),
+                                       new FALSMTree(disk->clone(), table->getKeySize(), table->getDataSize(), ssTableSize, bufferSize, levelRatio, 5),
+                                       new FALSMTree(disk->clone(), table->getKeySize(), table->getDataSize(), ssTableSize, bufferSize, levelRatio, 20),
+                                       new LSMTree(disk->clone(), table->getKeySize(), table->getDataSize(), ssTableSize, bufferSize, levelRatio)};
+
+        for (size_t i = 0; i < indexes.size(); ++i)
+            indexes[i]->createTopologyAfterInsert(1 << 18);
+
+        std::vector<WorkloadStep*> steps;
+        steps.push_back(new WorkloadStepInsert(queries * 10));
+        steps.push_back(new WorkloadStepRSearch(0.001, queries / 10));
+        steps.push_back(new WorkloadStepDelete(queries));
+
+        Workload workload(indexes, steps);
+        workload.run();
+
+        simulatedTime += totalWorkloadTime(workload);
+        deleteIndexes(indexes);
+    }
+
+    state.counters["simulatedTime"] = benchmark::Counter(simulatedTime, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ExperimentFALSMPhd)->Unit(benchmark::kMillisecond);
+
+// experimentCFD: FD-Tree wrapper, FBDSM and CFD-Tree fetching growing number of columns
+static void BM_ExperimentCFD(benchmark::State& state)
+{
+    std::unique_ptr<DBTable> table(new DBTable_TPCC_Warehouse());
+    std::unique_ptr<Disk> disk(new DiskSSD_Samsung840());
+    const size_t queries = 1000;
+    double simulatedTime = 0.0;
+
+    for (auto _ : state)
+    {
+        for (size_t col = 1; col < table->getNumColumns(); ++col)
+        {
+            DBIndex* fdtree_raw = new FDTree(disk->clone(), table->getKeySize(), table->getDataSize(), disk->getLowLevelController().getBlockSize(), disk->getLowLevelController().getBlockSize(), 5);
+            std::vector<DBIndexColumn*> indexes {new DBIndexRawToColumnWrapper(fdtree_raw, table->getAllColumnSize()),
+                                                 new FBDSM(disk->clone(), table->getAllColumnSize()),
+                                                 new CFDTree(disk->clone(), table->getAllColumnSize(), disk->getLowLevelController().getBlockSize(), disk->getLowLevelController().getBlockSize(), 5)};
+
+            std::vector<size_t> cols;
+            for (size_t j = 0; j <= col; ++j)
+                cols.push_back(j);
+
+            std::vector<WorkloadStep*> steps;
+            steps.push_back(new WorkloadStepInsert(queries));
+            steps.push_back(new WorkloadStepPSearch(queries / 10, cols));
+            steps.push_back(new WorkloadStepDelete(queries / 10));
+
+            Workload workload(indexes, steps);
+            workload.run();
+
+            simulatedTime += totalWorkloadTime(workload);
+            deleteIndexes(indexes);
+        }
+    }
+
+    state.counters["simulatedTime"] = benchmark::Counter(simulatedTime, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ExperimentCFD)->Unit(benchmark::kMillisecond);
+
+// experimentLAMPhd: Adaptive Merging vs Lazy Adaptive Merging on FD-Tree
+static void BM_ExperimentLAMPhd(benchmark::State& state)
+{
+    std::unique_ptr<DBTable> table(new DBTable_TPCC_Warehouse());
+    std::unique_ptr<Disk> disk(new DiskSSD_Samsung840());
+    const size_t startingEntries = 1 << 16;
+    const size_t paritionSize = 1 << 20;
+    const double sel = 0.05;
+    double simulatedTime = 0.0;
+
+    for (auto _ : state)
+    {
+        DBIndex* fdtree_am = new FDTree(disk->clone(), table->getKeySize(), table->getDataSize(), disk->getLowLevelController().getBlockSize(), disk->getLowLevelController().getBlockSize(), 5);
+        DBIndex* fdtree_lam = new FDTree(disk->clone(), table->getKeySize(), table->getDataSize(), disk->getLowLevelController().getBlockSize(), disk->getLowLevelController().getBlockSize(), 5);
+
+        std::vector<DBIndex*> indexes {new AdaptiveMerging(fdtree_am, startingEntries, paritionSize),
+                                       new LazyAdaptiveMerging(fdtree_lam, startingEntries, paritionSize, 400, 40, 0.25)};
+
+        WorkloadAdaptiveMerging workload(indexes, sel);
+        workload.run();
+
+        simulatedTime += totalWorkloadTime(workload);
+        deleteIndexes(indexes);
+    }
+
+    state.counters["simulatedTime"] = benchmark::Counter(simulatedTime, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ExperimentLAMPhd)->Unit(benchmark::kMillisecond);
+
+// experimentPAMPhd: Adaptive Merging variants for PCM
+static void BM_ExperimentPAMPhd(benchmark::State& state)
+{
+    std::unique_ptr<DBTable> table(new DBTable_TPCC_Warehouse());
+    std::unique_ptr<Disk> disk(new DiskPCM_DefaultModel());
+    const size_t nodeSize = table->getRecordSize() * 10 + 10;
+    const size_t startingEntries = 1 << 14;
+    const size_t paritionSize = nodeSize * 100;
+    const double sel = 0.05;
+    double simulatedTime = 0.0;
+
+    for (auto _ : state)
+    {
+        std::vector<DBIndex*> indexes {new AdaptiveMerging(new BPTree(disk->clone(), table->getKeySize(), table->getDataSize(), nodeSize), startingEntries, paritionSize),
+                                       new EAdaptiveMerging(new UBPTree(disk->clone(), table->getKeySize(), table->getDataSize(), nodeSize), startingEntries, paritionSize),
+                                       new PCMAdaptiveMerging(new BBPTree(disk->clone(), table->getKeySize(), table->getDataSize(), nodeSize, true), startingEntries, paritionSize)};
+
+        WorkloadAdaptiveMerging workload(indexes, sel);
+        workload.run();
+
+        simulatedTime += totalWorkloadTime(workload);
+        deleteIndexes(indexes);
+    }
+
+    state.counters["simulatedTime"] = benchmark::Counter(simulatedTime, benchmark::Counter::kAvgIterations);
+}
+BENCHMARK(BM_ExperimentPAMPhd)->Unit(benchmark::kMillisecond);
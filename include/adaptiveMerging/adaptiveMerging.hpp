@@ -4,6 +4,7 @@
 #include <adaptiveMerging/adaptiveMergingFramework.hpp>
 
 #include <vector>
+#include <algorithm>
 
 class AdaptiveMerging : public AdaptiveMergingFramework
 {
@@ -64,6 +65,17 @@ public:
     protected:
         std::vector<AMPartition> partitions;
         size_t partitionSize;
+        size_t loadingStreams; // partitions are loaded by this many parallel I/O streams
+        std::mt19937 rng; // order in which query touches partitions
+
+        /**
+         * @brief Take entries from partitions. Partitions are visited in random order,
+         *        each non-empty partition gives the same share of entries (at least 1 entry)
+         *
+         * @param[in] numEntries - how many entries take
+         * @return how many entries were taken from each partition
+         */
+        std::vector<size_t> takeEntriesFromPartitions(size_t numEntries) noexcept(true);
     public:
         /**
          * @brief Construct a new AMUnsortedMemoryManager object
@@ -85,6 +97,27 @@ public:
             return partitions;
         }
 
+        /**
+         * @brief Get number of parallel loading streams
+         *
+         * @return loading streams
+         */
+        virtual size_t getLoadingStreams() const noexcept(true)
+        {
+            return loadingStreams;
+        }
+
+        /**
+         * @brief Set number of parallel loading streams. Partition i is loaded by stream i % streams.
+         *        Loading time is time of the slowest stream
+         *
+         * @param[in] streams - number of streams, 0 is treated as 1
+         */
+        virtual void setLoadingStreams(size_t streams) noexcept(true)
+        {
+            loadingStreams = std::max(streams, static_cast<size_t>(1));
+        }
+
         /**
          * @brief Created brief snapshot of AMPartitionManager as a string
          *
@@ -142,6 +175,29 @@ protected:
     virtual double deleteEntriesHelper(size_t numOperations) noexcept(true);
     static size_t constexpr copyTreshold = 1000;
 public:
+    /**
+     * @brief Set number of parallel streams used to load partitions.
+     *        With more than 1 stream index search runs in parallel with partition loading
+     *
+     * @param[in] streams - number of streams (threads / devices)
+     */
+    virtual void setLoadingStreams(size_t streams) noexcept(true)
+    {
+        AMPartitionManager* manager = dynamic_cast<AMPartitionManager*>(memoryManager.get());
+        if (manager != nullptr)
+            manager->setLoadingStreams(streams);
+    }
+
+    /**
+     * @brief Get number of parallel streams used to load partitions
+     *
+     * @return loading streams
+     */
+    virtual size_t getLoadingStreams() const noexcept(true)
+    {
+        const AMPartitionManager* manager = dynamic_cast<const AMPartitionManager*>(memoryManager.get());
+        return manager != nullptr ? manager->getLoadingStreams() : 1;
+    }
 
     /**
      * @brief Create AdaptiveMerging
@@ -27,6 +27,8 @@ public:
         size_t recordSize;
         enum AMUnsortedMemoryInvalidation invalidationType;
 
+        bool backgroundInvalidation{false}; // invalidation is executed by background job, not by query
+
     public:
         /**
          * @brief Construct a new AMUnsortedMemoryManager object
@@ -59,6 +61,16 @@ public:
             return invalidationType;
         }
 
+        /**
+         * @brief Is invalidation moved to background?
+         *
+         * @return true if invalidation time is not charged to queries
+         */
+        virtual bool isBackgroundInvalidation() const noexcept(true)
+        {
+            return backgroundInvalidation;
+        }
+
         /**
          * @brief Get the Counters object
          *
@@ -107,7 +119,8 @@ public:
         }
 
         /**
-         * @brief Invalid entries from unsorted part
+         * @brief Invalid entries from unsorted part. In background mode time is counted
+         *        in invalidation counters, but 0.0 is returned to the query
          *
          * @param[in] disk - pointer to disk
          * @param[in] numEntries - how many entries invalid
@@ -182,8 +195,23 @@ public:
      */
     virtual void resetState() noexcept(true)
     {
+        const bool background = memoryManager->isBackgroundInvalidation();
+
         index->resetState();
         memoryManager.reset(new AMUnsortedMemoryManager(startingEntries, getRecordSize(), memoryManager->getInvalidationType()));
+        memoryManager->backgroundInvalidation = background;
+    }
+
+    /**
+     * @brief Move invalidation of loaded entries (reorganization of unsorted part) into background.
+     *        Queries pay only for loading, invalidation time and operations are reported
+     *        by INDEX_COUNTER_RW_BACKGROUND_* counters
+     *
+     * @param[in] backgroundInvalidation - true to execute invalidation in background
+     */
+    void setBackgroundInvalidation(bool backgroundInvalidation) noexcept(true)
+    {
+        memoryManager->backgroundInvalidation = backgroundInvalidation;
     }
 
     /**
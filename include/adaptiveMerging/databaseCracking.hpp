@@ -0,0 +1,324 @@
+#ifndef DATABASE_CRACKING_HPP
+#define DATABASE_CRACKING_HPP
+
+#include <adaptiveMerging/adaptiveMergingFramework.hpp>
+
+#include <vector>
+
+class DatabaseCracking : public AdaptiveMergingFramework
+{
+public:
+    class CrackerColumnManager : public AdaptiveMergingFramework::AMUnsortedMemoryManager
+    {
+    protected:
+        std::vector<size_t> pieces; // entries in not converged pieces, in column order
+        size_t minPieceSize; // piece with less bytes than this is treated as sorted
+        bool isStochastic;
+        size_t numCracks;
+
+        std::mt19937 rng;
+
+        static size_t constexpr pagesInScanChunk = 1024;
+
+        /**
+         * @brief Read bytes from column and overwrite some of them. Long scans are split into chunks
+         *
+         * @param[in] disk - pointer to disk
+         * @param[in] bytes - bytes to read
+         * @param[in] bytesToSwap - bytes to overwrite
+         * @return time
+         */
+        double scanBytes(Disk* disk, size_t bytes, size_t bytesToSwap) noexcept(true);
+
+        /**
+         * @brief Crack piece at position inside piece. Piece is read and reorganized in place
+         *
+         * @param[in] disk - pointer to disk
+         * @param[in] pieceIndex - index of piece in pieces
+         * @param[in] offset - number of entries which go to the left piece
+         * @return time
+         */
+        double crackPiece(Disk* disk, size_t pieceIndex, size_t offset) noexcept(true);
+
+        /**
+         * @brief Crack column at entry position, stochastic variant adds random crack before
+         *
+         * @param[in] disk - pointer to disk
+         * @param[in] pos - position in column (in entries)
+         * @return time
+         */
+        double crackAt(Disk* disk, size_t pos) noexcept(true);
+
+        /**
+         * @brief Remove pieces smaller than minPieceSize, they are sorted now
+         *
+         * @return number of entries in removed pieces
+         */
+        size_t removeConvergedPieces() noexcept(true);
+
+    public:
+        /**
+         * @brief Construct a new CrackerColumnManager object
+         *
+         * @param[in] numEntries - how many entries go int unsorted column
+         * @param[in] recordSize - entry (record) size
+         * @param[in] minPieceSize - piece smaller than this (in bytes) is treated as sorted
+         * @param[in] isStochastic - add random crack before each query crack
+         *
+         * @return CrackerColumnManager object
+         */
+        CrackerColumnManager(size_t numEntries, size_t recordSize, size_t minPieceSize, bool isStochastic);
+
+        /**
+        * @brief Virtual constructor idiom implemented as clone function. This function creates new AMUnsortedMemoryManager
+        *
+        * @return new AMUnsortedMemoryManager
+        */
+        virtual AMUnsortedMemoryManager* clone() const noexcept(true) override
+        {
+            return new CrackerColumnManager(*this);
+        }
+
+        /**
+         * @brief Get the Pieces Ref object
+         *
+         * @return const std::vector<size_t>& - entries in not converged pieces
+         */
+        virtual const std::vector<size_t>& getPiecesRef() const noexcept(true)
+        {
+            return pieces;
+        }
+
+        /**
+         * @brief Get number of cracks done so far
+         *
+         * @return number of cracks (entries in cracker index)
+         */
+        virtual size_t getNumCracks() const noexcept(true)
+        {
+            return numCracks;
+        }
+
+        /**
+         * @brief Get size of cracker index in bytes. Each crack is stored as pair (key, position)
+         *
+         * @param[in] keySize - size of key
+         * @return size of cracker index in bytes
+         */
+        virtual size_t getCrackerIndexSize(size_t keySize) const noexcept(true)
+        {
+            return numCracks * (keySize + sizeof(uintptr_t));
+        }
+
+        /**
+         * @brief Range query on unsorted column. Pieces on query bounds are cracked, pieces inside query are scanned
+         *
+         * @param[in] disk - pointer to disk
+         * @param[in] numEntries - how many entries query returns
+         * @param[out] convergedEntries - entries from pieces which are sorted after this query
+         * @return time
+         */
+        virtual double crackEntries(Disk* disk, size_t numEntries, size_t& convergedEntries) noexcept(true);
+
+        /**
+         * @brief Sort remaining pieces, used when column is too small to crack it further
+         *
+         * @param[in] disk - pointer to disk
+         * @return time
+         */
+        virtual double sortRemainingEntries(Disk* disk) noexcept(true);
+
+        /**
+         * @brief Load entries from unsorted part (delete entries from column)
+         *
+         * @param[in] disk - pointer to disk
+         * @param[in] numEntries - how many entries load
+         * @return time
+         */
+        virtual double loadEntries(Disk *disk, size_t numEntries) noexcept(true) override;
+
+        /**
+         * @brief Created brief snapshot of CrackerColumnManager as a string
+         *
+         * @param[in] oneLine - create string as 1 line or not? By default Yes
+         * @return brief edscription of CrackerColumnManager
+         */
+        virtual std::string toString(bool oneLine = true) const noexcept(true) override;
+
+        /**
+         * @brief Created full snapshot of CrackerColumnManager as a string
+         *
+         * @param[in] oneLine - create string as 1 line or not? By default Yes
+         * @return Full edscription of CrackerColumnManager
+         */
+        virtual std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+        virtual ~CrackerColumnManager() = default;
+        CrackerColumnManager() = default;
+        CrackerColumnManager(const CrackerColumnManager&) = default;
+        CrackerColumnManager& operator=(const CrackerColumnManager&) = default;
+        CrackerColumnManager(CrackerColumnManager &&) = default;
+        CrackerColumnManager& operator=(CrackerColumnManager &&) = default;
+
+        friend class DatabaseCracking;
+    };
+
+protected:
+    static size_t constexpr sortTreshold = 1000;
+
+    /**
+     * @brief Move converged (sorted) entries into index. Cracking is in place, so pieces are not copied, only topology is updated
+     *
+     * @param[in] convergedEntries - entries from sorted pieces
+     */
+    virtual void moveConvergedEntries(size_t convergedEntries) noexcept(true);
+
+    virtual double findEntriesHelper(size_t numEntries, size_t numOperations) noexcept(true);
+    virtual double deleteEntriesHelper(size_t numOperations) noexcept(true);
+
+    /**
+     * @brief Create DatabaseCracking
+     *
+     * @param[in] name - Index name
+     * @param[in] index - pointer to DBIndex (keeps converged, sorted pieces)
+     * @param[in] startingEntries - starting unsorted entries in Table
+     * @param[in] minPieceSize - piece smaller than this (in bytes) is treated as sorted
+     * @param[in] isStochastic - add random crack before each query crack
+     *
+     * @return DatabaseCracking object
+     */
+    DatabaseCracking(const char* name, DBIndex* index, size_t startingEntries, size_t minPieceSize, bool isStochastic);
+
+public:
+    /**
+     * @brief Get size of cracker index in bytes
+     *
+     * @return size of cracker index in bytes
+     */
+    virtual size_t getCrackerIndexSize() const noexcept(true)
+    {
+        return dynamic_cast<const CrackerColumnManager*>(memoryManager.get())->getCrackerIndexSize(getKeySize());
+    }
+
+    /**
+     * @brief Reset non-const values to default value
+     *
+     */
+    virtual void resetState() noexcept(true) override;
+
+    /**
+     * @brief Created brief snapshot of DatabaseCracking as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of DatabaseCracking
+     */
+    virtual std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of DatabaseCracking as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of DatabaseCracking
+     */
+    virtual std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Insert new entries to the DatabaseCracking
+     *        Method get number of operations but evaluates operation one by one
+     *        So there is no buffering here.
+     *        Cost of operation(3) is always equal to 3x operation(1)
+     *
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double insertEntries(size_t numOperations = 1) noexcept(true) override;
+
+    /**
+     * @brief Insert new entries to the DatabaseCracking by using bulkload
+     *        If bulkload is not supported this function does nothing and returns 0.0
+     *
+     * @param[in] numEntries - entries to insert via bulkload
+     *
+     * @return time needed to evaluates the operation
+     */
+    virtual double bulkloadEntries(size_t numEntries = 1) noexcept(true) override;
+
+    /**
+     * @brief Delete entries from the DatabaseCracking
+     *        Method get number of operations but evaluates operation one by one
+     *        So there is no buffering here.
+     *        Cost of operation(3) is always equal to 3x operation(1)
+     *
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double deleteEntries(size_t numOperations = 1) noexcept(true) override;
+
+    /**
+     * @brief Find entries from the DatabaseCracking using point search (point seek)
+     *        Method get number of operations but evaluates operation one by one
+     *        So there is no buffering here.
+     *        Cost of operation(3) is always equal to 3x operation(1)
+     *
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findPointEntries(size_t numOperations = 1)  noexcept(true) override;
+
+    /**
+     * @brief Find entries from the DatabaseCracking using point search (point seek)
+     *        Method get number of operations but evaluates operation one by one
+     *        So there is no buffering here.
+     *        Cost of operation(3) is always equal to 3x operation(1)
+     *
+     * @param[in] selectivity - number from range [0;1]. Find entries = selectivity * index.numEntries
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findPointEntries(double selectivity, size_t numOperations = 1) noexcept(true) override;
+
+    /**
+     * @brief Find entries from the DatabaseCracking using range search (range seek)
+     *        This method finds all contiguous entries using 1 operation (range seek)
+     *
+     * @param[in] numEntries - number of entries to seek
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findRangeEntries(size_t numEntries, size_t numOperations = 1)  noexcept(true) override;
+
+    /**
+     * @brief Find entries from the DatabaseCracking using range search (range seek)
+     *        This method finds all contiguous entries using 1 operation (range seek)
+     *
+     * @param[in] selectivity - number from range [0;1]. Find entries = selectivity * index.numEntries
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findRangeEntries(double selectivity, size_t numOperations = 1) noexcept(true) override;
+
+    /**
+     * @brief Fake the insert of numEntries entries to create a topology in fastest way.
+     *        This should be used only to test non-empty index in workloads, so this is a total fakeout.
+     *        No low-level simulation is done here. We are simulating only insert index code without involving disk simulator.
+     *        Counters wouldnt be pegged
+     *
+     * @param[in] numEntries - how entries to insert to create a topology
+     */
+    virtual void createTopologyAfterInsert(size_t numEntries = 1) noexcept(true) override;
+
+    virtual ~DatabaseCracking() = default;
+    DatabaseCracking() = default;
+    DatabaseCracking(const DatabaseCracking&) = default;
+    DatabaseCracking& operator=(const DatabaseCracking&) = default;
+    DatabaseCracking(DatabaseCracking &&) = default;
+    DatabaseCracking& operator=(DatabaseCracking &&) = default;
+};
+
+#endif
\ No newline at end of file
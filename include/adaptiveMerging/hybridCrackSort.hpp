@@ -0,0 +1,141 @@
+#ifndef HYBRID_CRACK_SORT_HPP
+#define HYBRID_CRACK_SORT_HPP
+
+#include <adaptiveMerging/adaptiveMerging.hpp>
+
+#include <vector>
+
+class HybridCrackSort : public AdaptiveMerging
+{
+public:
+    class HCSPartitionManager : public AdaptiveMerging::AMPartitionManager
+    {
+    protected:
+        std::vector<size_t> cracks; // cracks in each partition, partitions are not sorted on creation
+
+        /**
+         * @brief Crack partitions touched by query. In each partition piece with qualifying entries is reorganized in place
+         *
+         * @param[in] disk - pointer to disk
+         * @param[in] loadedEntries - how many entries query loaded from each partition
+         * @return time
+         */
+        virtual double crackPartitions(Disk* disk, const std::vector<size_t>& loadedEntries) noexcept(true);
+
+    public:
+        /**
+         * @brief Construct a new HCSPartitionManager object
+         *
+         * @param[in] numEntries - how many entries go int unsorted area
+         * @param[in] recordSize - entry (record) size
+         * @param[in] partitionSize - size of single partition in bytes
+         *
+         * @return HCSPartitionManager object
+         */
+        HCSPartitionManager(size_t numEntries, size_t recordSize, size_t partitionSize);
+
+        /**
+         * @brief Get the Cracks Ref object
+         *
+         * @return const std::vector<size_t>& - cracks in each partition
+         */
+        virtual const std::vector<size_t>& getCracksRef() const noexcept(true)
+        {
+            return cracks;
+        }
+
+        /**
+         * @brief Get size of cracker index in bytes. Each crack is stored as pair (key, position)
+         *
+         * @param[in] keySize - size of key
+         * @return size of cracker index in bytes
+         */
+        virtual size_t getCrackerIndexSize(size_t keySize) const noexcept(true);
+
+        /**
+        * @brief Virtual constructor idiom implemented as clone function. This function creates new AMUnsortedMemoryManager
+        *
+        * @return new AMUnsortedMemoryManager
+        */
+        virtual AMUnsortedMemoryManager* clone() const noexcept(true) override
+        {
+            return new HCSPartitionManager(*this);
+        }
+
+        /**
+         * @brief Load entries from unsorted part. Partitions are cracked before loading
+         *
+         * @param[in] disk - pointer to disk
+         * @param[in] numEntries - how many entries load
+         * @return time
+         */
+        virtual double loadEntries(Disk *disk, size_t numEntries) noexcept(true) override;
+
+        virtual ~HCSPartitionManager() = default;
+        HCSPartitionManager() = default;
+        HCSPartitionManager(const HCSPartitionManager&) = default;
+        HCSPartitionManager& operator=(const HCSPartitionManager&) = default;
+        HCSPartitionManager(HCSPartitionManager &&) = default;
+        HCSPartitionManager& operator=(HCSPartitionManager &&) = default;
+
+        friend class HybridCrackSort;
+    };
+
+    /**
+     * @brief Create HybridCrackSort
+     *
+     * @param[in] name - Index name
+     * @param[in] index - pointer to DBIndex
+     * @param[in] startingEntries - starting unsorted entries in Table
+     * @param[in] partitionSize - size of single partition in bytes
+     *
+     * @return HybridCrackSort object
+     */
+    HybridCrackSort(const char* name, DBIndex* index, size_t startingEntries, size_t partitionSize);
+
+    /**
+     * @brief Create HybridCrackSort
+     *
+     * @param[in] index - pointer to DBIndex
+     * @param[in] startingEntries - starting unsorted entries in Table
+     * @param[in] partitionSize - size of single partition in bytes
+     *
+     * @return HybridCrackSort object
+     */
+    HybridCrackSort(DBIndex* index, size_t startingEntries, size_t partitionSize);
+
+    /**
+     * @brief Get size of cracker index in bytes
+     *
+     * @return size of cracker index in bytes
+     */
+    virtual size_t getCrackerIndexSize() const noexcept(true)
+    {
+        return dynamic_cast<const HCSPartitionManager*>(memoryManager.get())->getCrackerIndexSize(getKeySize());
+    }
+
+    /**
+     * @brief Reset non-const values to default value
+     *
+     */
+    virtual void resetState() noexcept(true) override;
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new AdaptiveMergingFramework
+    *
+    * @return new AdaptiveMergingFramework
+    */
+    virtual AdaptiveMergingFramework* clone() const noexcept(true) override
+    {
+        return new HybridCrackSort(*this);
+    }
+
+    virtual ~HybridCrackSort() = default;
+    HybridCrackSort() = default;
+    HybridCrackSort(const HybridCrackSort&) = default;
+    HybridCrackSort& operator=(const HybridCrackSort&) = default;
+    HybridCrackSort(HybridCrackSort &&) = default;
+    HybridCrackSort& operator=(HybridCrackSort &&) = default;
+};
+
+#endif
\ No newline at end of file
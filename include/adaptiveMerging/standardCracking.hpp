@@ -0,0 +1,50 @@
+#ifndef STANDARD_CRACKING_HPP
+#define STANDARD_CRACKING_HPP
+
+#include <adaptiveMerging/databaseCracking.hpp>
+
+class StandardCracking : public DatabaseCracking
+{
+public:
+    /**
+     * @brief Create StandardCracking
+     *
+     * @param[in] name - Index name
+     * @param[in] index - pointer to DBIndex
+     * @param[in] startingEntries - starting unsorted entries in Table
+     * @param[in] minPieceSize - piece smaller than this (in bytes) is treated as sorted
+     *
+     * @return StandardCracking object
+     */
+    StandardCracking(const char* name, DBIndex* index, size_t startingEntries, size_t minPieceSize);
+
+    /**
+     * @brief Create StandardCracking
+     *
+     * @param[in] index - pointer to DBIndex
+     * @param[in] startingEntries - starting unsorted entries in Table
+     * @param[in] minPieceSize - piece smaller than this (in bytes) is treated as sorted
+     *
+     * @return StandardCracking object
+     */
+    StandardCracking(DBIndex* index, size_t startingEntries, size_t minPieceSize);
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new AdaptiveMergingFramework
+    *
+    * @return new AdaptiveMergingFramework
+    */
+    virtual AdaptiveMergingFramework* clone() const noexcept(true) override
+    {
+        return new StandardCracking(*this);
+    }
+
+    virtual ~StandardCracking() = default;
+    StandardCracking() = default;
+    StandardCracking(const StandardCracking&) = default;
+    StandardCracking& operator=(const StandardCracking&) = default;
+    StandardCracking(StandardCracking &&) = default;
+    StandardCracking& operator=(StandardCracking &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+#ifndef STOCHASTIC_CRACKING_HPP
+#define STOCHASTIC_CRACKING_HPP
+
+#include <adaptiveMerging/databaseCracking.hpp>
+
+class StochasticCracking : public DatabaseCracking
+{
+public:
+    /**
+     * @brief Create StochasticCracking
+     *
+     * @param[in] name - Index name
+     * @param[in] index - pointer to DBIndex
+     * @param[in] startingEntries - starting unsorted entries in Table
+     * @param[in] minPieceSize - piece smaller than this (in bytes) is treated as sorted
+     *
+     * @return StochasticCracking object
+     */
+    StochasticCracking(const char* name, DBIndex* index, size_t startingEntries, size_t minPieceSize);
+
+    /**
+     * @brief Create StochasticCracking
+     *
+     * @param[in] index - pointer to DBIndex
+     * @param[in] startingEntries - starting unsorted entries in Table
+     * @param[in] minPieceSize - piece smaller than this (in bytes) is treated as sorted
+     *
+     * @return StochasticCracking object
+     */
+    StochasticCracking(DBIndex* index, size_t startingEntries, size_t minPieceSize);
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new AdaptiveMergingFramework
+    *
+    * @return new AdaptiveMergingFramework
+    */
+    virtual AdaptiveMergingFramework* clone() const noexcept(true) override
+    {
+        return new StochasticCracking(*this);
+    }
+
+    virtual ~StochasticCracking() = default;
+    StochasticCracking() = default;
+    StochasticCracking(const StochasticCracking&) = default;
+    StochasticCracking& operator=(const StochasticCracking&) = default;
+    StochasticCracking(StochasticCracking &&) = default;
+    StochasticCracking& operator=(StochasticCracking &&) = default;
+};
+
+#endif
\ No newline at end of file
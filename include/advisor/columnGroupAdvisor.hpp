@@ -0,0 +1,198 @@
+#ifndef COLUMN_GROUP_ADVISOR_HPP
+#define COLUMN_GROUP_ADVISOR_HPP
+
+#include <disk/disk.hpp>
+#include <index/dbIndexColumn.hpp>
+#include <table/dbTable.hpp>
+#include <workload/workloadStep.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Physical design advisor for column tables. Searches partitions of table columns into groups by hill-climbing.
+ *        Each candidate layout is priced by executing workload steps on index built for this layout (cost model as an oracle).
+ *        Group is kept like 1 column with size equal to sum of its columns, so layout with 1 group is NSM and layout with 1 column per group is DSM.
+ *        Candidates of each hill-climbing iteration are evaluated in parallel on DBThreadPool.
+ *
+ */
+class ColumnGroupAdvisor
+{
+public:
+    enum LayoutModel
+    {
+        LAYOUT_MODEL_DSM, // each group in own file
+        LAYOUT_MODEL_PAX, // each group as a minipage of PAX page
+    };
+
+    using ColumnGroups = std::vector<std::vector<size_t>>;
+
+private:
+    std::vector<size_t> columnsSize;
+    std::unique_ptr<Disk> disk;
+    std::vector<std::unique_ptr<WorkloadStep>> steps;
+    size_t numEntries; // entries in table before workload
+    enum LayoutModel layoutModel;
+    size_t maxIterations; // per hill-climbing start
+
+    std::map<ColumnGroups, double> evaluatedLayouts;
+    ColumnGroups bestLayout;
+    double bestTime;
+    size_t numIterations;
+
+    /**
+     * @brief Sort columns in groups and groups by first column, so key group is always the first one
+     *
+     * @param[in, out] groups - layout to normalize
+     */
+    static void normalizeLayout(ColumnGroups& groups) noexcept(true);
+
+    /**
+     * @brief Create string from layout like { {0,1},{2} }
+     *
+     * @param[in] groups - layout
+     * @return layout as a string
+     */
+    static std::string layoutToString(const ColumnGroups& groups) noexcept(true);
+
+    /**
+     * @brief Check if each column of table is in exactly 1 group
+     *
+     * @param[in] groups - layout to check
+     * @return true if layout is a partition of table columns
+     */
+    bool isValidLayout(const ColumnGroups& groups) const noexcept(true);
+
+    /**
+     * @brief Get all layouts created by moving 1 column to other (or new) group or by merging 2 groups
+     *
+     * @param[in] groups - normalized layout
+     * @return normalized neighbour layouts without duplicates
+     */
+    std::vector<ColumnGroups> getNeighbourLayouts(const ColumnGroups& groups) const noexcept(true);
+
+    /**
+     * @brief Create index for layout model, layout with 1 group is stored row by row
+     *
+     * @param[in] disk - pointer to disk (index takes ownership)
+     * @param[in] groupsSize - size of each group, [0] - key group
+     * @return new index
+     */
+    DBIndexColumn* createIndex(Disk* disk, const std::vector<size_t>& groupsSize) const noexcept(true);
+
+    /**
+     * @brief Execute workload on fresh index with given layout. Function does not modify advisor, so it can be called from many threads
+     *
+     * @param[in] groups - normalized and valid layout
+     * @return simulated workload time
+     */
+    double simulateLayout(const ColumnGroups& groups) const noexcept(true);
+
+    /**
+     * @brief Get workload time of each layout. New layouts are simulated in parallel, known layouts are taken from cache
+     *
+     * @param[in] layouts - normalized and valid layouts
+     * @return workload time of each layout
+     */
+    std::vector<double> evaluateLayouts(const std::vector<ColumnGroups>& layouts) noexcept(true);
+
+public:
+    /**
+     * @brief Construct a new ColumnGroupAdvisor object
+     *
+     * @param[in] table - table to partition
+     * @param[in] disk - disk used by oracle (advisor keeps own clone)
+     * @param[in] numEntries - entries in table before workload
+     * @param[in] steps - workload steps with columns to search (advisor keeps own clones)
+     * @param[in] layoutModel - how groups are kept on disk
+     * @param[in] maxIterations - max number of hill-climbing iterations for each start layout
+     *
+     * @return ColumnGroupAdvisor object
+     */
+    ColumnGroupAdvisor(const DBTable& table, const Disk* disk, size_t numEntries, const std::vector<WorkloadStep*>& steps, enum LayoutModel layoutModel = LAYOUT_MODEL_DSM, size_t maxIterations = 100);
+
+    /**
+     * @brief Get layout with all columns in 1 group
+     *
+     * @param[in] numColumns - number of columns in table
+     * @return NSM layout
+     */
+    static ColumnGroups getNSMLayout(size_t numColumns) noexcept(true);
+
+    /**
+     * @brief Get layout with 1 group per column
+     *
+     * @param[in] numColumns - number of columns in table
+     * @return DSM layout
+     */
+    static ColumnGroups getDSMLayout(size_t numColumns) noexcept(true);
+
+    /**
+     * @brief Simulate workload on given layout
+     *
+     * @param[in] groups - layout (partition of table columns)
+     * @return simulated workload time, 0.0 for invalid layout
+     */
+    double evaluateLayout(const ColumnGroups& groups) noexcept(true);
+
+    /**
+     * @brief Search for the best layout. Hill-climbing starts from DSM and NSM layouts and moves to the best neighbour until time improves
+     *
+     * @return simulated workload time of the best layout
+     */
+    double findBestLayout() noexcept(true);
+
+    const ColumnGroups& getBestLayout() const noexcept(true)
+    {
+        return bestLayout;
+    }
+
+    double getBestTime() const noexcept(true)
+    {
+        return bestTime;
+    }
+
+    size_t getNumEvaluatedLayouts() const noexcept(true)
+    {
+        return evaluatedLayouts.size();
+    }
+
+    size_t getNumIterations() const noexcept(true)
+    {
+        return numIterations;
+    }
+
+    enum LayoutModel getLayoutModel() const noexcept(true)
+    {
+        return layoutModel;
+    }
+
+    /**
+     * @brief Created brief snapshot of ColumnGroupAdvisor as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of ColumnGroupAdvisor
+     */
+    std::string toString(bool oneLine = true) const noexcept(true);
+
+    /**
+     * @brief Created full snapshot of ColumnGroupAdvisor as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of ColumnGroupAdvisor
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true);
+
+    virtual ~ColumnGroupAdvisor() = default;
+    ColumnGroupAdvisor() = default;
+
+    ColumnGroupAdvisor(const ColumnGroupAdvisor&);
+    ColumnGroupAdvisor& operator=(const ColumnGroupAdvisor&);
+
+    ColumnGroupAdvisor(ColumnGroupAdvisor &&) = default;
+    ColumnGroupAdvisor& operator=(ColumnGroupAdvisor &&) = default;
+};
+
+#endif
\ No newline at end of file
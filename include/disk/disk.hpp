@@ -51,6 +51,32 @@ public:
      */
     double flushCache() noexcept(true);
 
+    /**
+     * @brief Tell disk which data group (for example LSM level) next requests touch.
+     *        Hint goes to memory model, plain devices ignore it, tiered devices use it to choose device
+     *
+     * @param[in] hint - placement hint
+     * @param[in] hintBytes - how many bytes are kept under this hint now
+     *
+     * @return time needed to prepare data (for example migration between devices)
+     */
+    virtual double setPlacementHint(size_t hint, size_t hintBytes = 0) noexcept(true);
+
+    /**
+     * @brief Ask device to keep data of each placement hint in separate space (for example ZNS zone per LSM level)
+     *
+     * @param[in] isolation - true if hints should not share space
+     */
+    void setPlacementIsolation(bool isolation) noexcept(true);
+
+    /**
+     * @brief Track wear of each block (memory line) of device, so wear distribution and lifetime can be reported
+     *
+     * @param[in] capacity - device capacity in bytes
+     * @param[in] sampleRate - track every sampleRate-th unit, use it for big devices
+     */
+    void enableWearTracking(size_t capacity, size_t sampleRate = 1) noexcept(true);
+
     /**
      * @brief Read contiguous bytes from memory from address @addr
      *
@@ -76,10 +102,11 @@ public:
      *
      * @param[in] addr - start address
      * @param[in] bytes - bytes to overwrite
+     * @param[in] bitChangeRatio - expected fraction of bits changed in overwritten bytes, by default new data is random
      *
      * @return time required for operation, could be 0 if there is no cache miss
      */
-    double overwriteBytes(uintptr_t addr, size_t bytes) noexcept(true);
+    double overwriteBytes(uintptr_t addr, size_t bytes, double bitChangeRatio = MemoryController::defaultBitChangeRatio) noexcept(true);
 
     /**
      * @brief Get Counter as a pair
@@ -0,0 +1,106 @@
+#ifndef DISK_COMPRESSED_HPP
+#define DISK_COMPRESSED_HPP
+
+#include <disk/disk.hpp>
+#include <storage/memoryControllerCompressed.hpp>
+#include <table/dbTable.hpp>
+
+/**
+ * @brief Disk with transparent block compression. Device gets compressed pages, every request pays CPU time for (de)compression.
+ *        Placement hint chooses compression ratio, so column indexes can have ratio per column.
+ *
+ */
+class DiskCompressed : public Disk
+{
+public:
+    DiskCompressed(MemoryControllerCompressed* controller);
+
+    /**
+     * @brief Construct a new DiskCompressed object with the same ratio for all data (per index)
+     *
+     * @param[in] disk - device, compressed disk uses fresh copy of its memory model
+     * @param[in] compressionRatio - compressed size / raw size from range (0, 1]
+     * @param[in] compressThroughput - compression speed in raw bytes per second, 0 means free compression
+     * @param[in] decompressThroughput - decompression speed in raw bytes per second, 0 means free decompression
+     *
+     * @return DiskCompressed object
+     */
+    DiskCompressed(const Disk& disk, double compressionRatio, double compressThroughput, double decompressThroughput);
+
+    /**
+     * @brief Construct a new DiskCompressed object with ratio of each table column (hint i means column i),
+     *        other hints use compression ratio of whole record
+     *
+     * @param[in] disk - device, compressed disk uses fresh copy of its memory model
+     * @param[in] table - table with compressibility hint of each column
+     * @param[in] compressThroughput - compression speed in raw bytes per second, 0 means free compression
+     * @param[in] decompressThroughput - decompression speed in raw bytes per second, 0 means free decompression
+     *
+     * @return DiskCompressed object
+     */
+    DiskCompressed(const Disk& disk, const DBTable& table, double compressThroughput, double decompressThroughput);
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new Disk
+    *
+    * @return new Disk
+    */
+    virtual Disk* clone() const noexcept(true) override
+    {
+        return new DiskCompressed(*this);
+    }
+
+    /**
+     * @brief Tell disk which data group next requests touch, ratio of this group is used from now.
+     *        Pages in cache are flushed with ratio of previous group
+     *
+     * @param[in] hint - placement hint
+     * @param[in] hintBytes - how many bytes are kept under this hint now
+     *
+     * @return time needed to flush cache
+     */
+    virtual double setPlacementHint(size_t hint, size_t hintBytes = 0) noexcept(true) override;
+
+    /**
+     * @brief Set compression ratio used for data under placement hint
+     *
+     * @param[in] hint - placement hint
+     * @param[in] ratio - compressed size / raw size from range (0, 1]
+     */
+    void setHintCompressionRatio(size_t hint, double ratio) noexcept(true);
+
+    /**
+     * @brief Get compressed model, use it to read compression stats
+     *
+     * @return const reference to compressed model
+     */
+    const MemoryModelCompressed& getCompressedModel() const noexcept(true)
+    {
+        return dynamic_cast<const MemoryModelCompressed&>(memoryController->getMemoryModel());
+    }
+
+    /**
+     * @brief Created brief snapshot of Disk as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of Disk
+     */
+    virtual std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of Disk as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of Disk
+     */
+    virtual std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    DiskCompressed() = default;
+    virtual ~DiskCompressed() = default;
+    DiskCompressed(const DiskCompressed&) = default;
+    DiskCompressed& operator=(const DiskCompressed&) = default;
+    DiskCompressed(DiskCompressed &&) = default;
+    DiskCompressed& operator=(DiskCompressed &&) = default;
+};
+
+#endif
\ No newline at end of file
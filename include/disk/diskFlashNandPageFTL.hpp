@@ -0,0 +1,81 @@
+#ifndef DISK_FLASH_NAND_PAGE_FTL_HPP
+#define DISK_FLASH_NAND_PAGE_FTL_HPP
+
+#include <disk/disk.hpp>
+#include <storage/memoryControllerFlashNandPageFTL.hpp>
+
+/**
+ * @brief Flash Nand disk with page-mapping FTL, garbage collection and wear leveling
+ *
+ */
+class DiskFlashNandPageFTL : public Disk
+{
+public:
+    DiskFlashNandPageFTL(MemoryControllerFlashNandPageFTL* controller);
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new Disk
+    *
+    * @return new Disk
+    */
+    virtual Disk* clone() const noexcept(true) override
+    {
+        return new DiskFlashNandPageFTL(*this);
+    }
+
+    /**
+     * @brief Get page-mapping FTL model, use it to read GC stats and write amplification
+     *
+     * @return const reference to flash model
+     */
+    const MemoryModelFlashNandPageFTL& getPageFTLModel() const noexcept(true)
+    {
+        return dynamic_cast<const MemoryModelFlashNandPageFTL&>(memoryController->getMemoryModel());
+    }
+
+    /**
+     * @brief Created brief snapshot of Disk as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of Disk
+     */
+    virtual std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of Disk as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of Disk
+     */
+    virtual std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    DiskFlashNandPageFTL() = default;
+    virtual ~DiskFlashNandPageFTL() = default;
+    DiskFlashNandPageFTL(const DiskFlashNandPageFTL&) = default;
+    DiskFlashNandPageFTL& operator=(const DiskFlashNandPageFTL&) = default;
+    DiskFlashNandPageFTL(DiskFlashNandPageFTL &&) = default;
+    DiskFlashNandPageFTL& operator=(DiskFlashNandPageFTL &&) = default;
+};
+
+class DiskFlashNandPageFTL_SamsungK9F1G08U0D : public DiskFlashNandPageFTL
+{
+public:
+    DiskFlashNandPageFTL_SamsungK9F1G08U0D()
+    : DiskFlashNandPageFTL(new MemoryControllerFlashNandPageFTL(new MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D()))
+    {
+
+    }
+
+    Disk* clone() const noexcept(true) override
+    {
+        return new DiskFlashNandPageFTL_SamsungK9F1G08U0D(*this);
+    }
+
+    ~DiskFlashNandPageFTL_SamsungK9F1G08U0D() = default;
+    DiskFlashNandPageFTL_SamsungK9F1G08U0D(const DiskFlashNandPageFTL_SamsungK9F1G08U0D&) = default;
+    DiskFlashNandPageFTL_SamsungK9F1G08U0D& operator=(const DiskFlashNandPageFTL_SamsungK9F1G08U0D&) = default;
+    DiskFlashNandPageFTL_SamsungK9F1G08U0D(DiskFlashNandPageFTL_SamsungK9F1G08U0D &&) = default;
+    DiskFlashNandPageFTL_SamsungK9F1G08U0D& operator=(DiskFlashNandPageFTL_SamsungK9F1G08U0D &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -9,6 +9,35 @@ class DiskPCM : public Disk
 public:
     DiskPCM(MemoryControllerPCM* controller);
 
+    /**
+     * @brief Flush cache and turn on wear leveling layer (start-gap or security refresh) of PCM
+     *
+     * @param[in] wearLeveling - wear leveling algorithm
+     * @param[in] capacity - capacity in bytes covered by wear leveling
+     * @param[in] interval - line writes between leveling moves
+     * @return time of flush
+     */
+    double setWearLeveling(enum MemoryModelPCM::WearLeveling wearLeveling, size_t capacity, size_t interval = 100) noexcept(true);
+
+    /**
+     * @brief Flush cache and choose how PCM overwrites lines (all bits, DCW or Flip-N-Write).
+     *        Use bitChangeRatio of overwriteBytes to give expected changes of each operation
+     *
+     * @param[in] differentialWrite - differential write mode
+     * @return time of flush
+     */
+    double setDifferentialWrite(enum MemoryModelPCM::DifferentialWrite differentialWrite) noexcept(true);
+
+    /**
+     * @brief Get PCM model, use it to read wear leveling stats
+     *
+     * @return const reference to PCM model
+     */
+    const MemoryModelPCM& getPCMModel() const noexcept(true)
+    {
+        return dynamic_cast<const MemoryModelPCM&>(memoryController->getMemoryModel());
+    }
+
     /**
      * @brief Created brief snapshot of Disk as a string
      *
@@ -2,6 +2,7 @@
 #define DISK_SSD_HPP
 
 #include <disk/disk.hpp>
+#include <disk/staticDisk.hpp>
 #include <storage/memoryControllerSSD.hpp>
 
 class DiskSSD : public Disk
@@ -106,4 +107,9 @@ public:
     DiskSSD_ToshibaVX500& operator=(DiskSSD_ToshibaVX500 &&) = default;
 };
 
+// SSD presets with controller and model known at compile time, see StaticDisk
+using StaticDiskSSD_Samsung840 = StaticDisk<MemoryControllerSSD, MemoryModelSSD_Samsung840>;
+using StaticDiskSSD_IntelDCP4511 = StaticDisk<MemoryControllerSSD, MemoryModelSSD_IntelDCP4511>;
+using StaticDiskSSD_ToshibaVX500 = StaticDisk<MemoryControllerSSD, MemoryModelSSD_ToshibaVX500>;
+
 #endif
\ No newline at end of file
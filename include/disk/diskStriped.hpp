@@ -0,0 +1,73 @@
+#ifndef DISK_STRIPED_HPP
+#define DISK_STRIPED_HPP
+
+#include <disk/disk.hpp>
+#include <storage/memoryControllerStriped.hpp>
+
+/**
+ * @brief Disk made of several identical devices (RAID-0, or RAID-10 when mirrored).
+ *        Requests are split by stripe unit and executed on all devices in parallel.
+ *
+ */
+class DiskStriped : public Disk
+{
+public:
+    DiskStriped(MemoryControllerStriped* controller);
+
+    /**
+     * @brief Construct a new DiskStriped object from several copies of disk
+     *
+     * @param[in] disk - single device, stripe uses fresh copies of its memory model
+     * @param[in] numDisks - number of devices in stripe
+     * @param[in] stripeUnit - stripe unit in bytes, rounded up to page size
+     * @param[in] isMirrored - keep mirror of each device (RAID-10)
+     *
+     * @return DiskStriped object
+     */
+    DiskStriped(const Disk& disk, size_t numDisks, size_t stripeUnit, bool isMirrored = false);
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new Disk
+    *
+    * @return new Disk
+    */
+    virtual Disk* clone() const noexcept(true) override
+    {
+        return new DiskStriped(*this);
+    }
+
+    /**
+     * @brief Get model of striped devices, use it to read counters and wear-out of each member
+     *
+     * @return const reference to striped model
+     */
+    const MemoryModelStriped& getStripedModel() const noexcept(true)
+    {
+        return dynamic_cast<const MemoryModelStriped&>(memoryController->getMemoryModel());
+    }
+
+    /**
+     * @brief Created brief snapshot of Disk as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of Disk
+     */
+    virtual std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of Disk as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of Disk
+     */
+    virtual std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    DiskStriped() = default;
+    virtual ~DiskStriped() = default;
+    DiskStriped(const DiskStriped&) = default;
+    DiskStriped& operator=(const DiskStriped&) = default;
+    DiskStriped(DiskStriped &&) = default;
+    DiskStriped& operator=(DiskStriped &&) = default;
+};
+
+#endif
\ No newline at end of file
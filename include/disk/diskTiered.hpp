@@ -0,0 +1,107 @@
+#ifndef DISK_TIERED_HPP
+#define DISK_TIERED_HPP
+
+#include <disk/disk.hpp>
+#include <storage/memoryControllerTiered.hpp>
+
+#include <vector>
+
+/**
+ * @brief Disk made of devices of different types, for example PCM for hot data and Flash for cold data.
+ *        Index chooses data group by placement hints, migration policy decides on which device group lives.
+ *
+ */
+class DiskTiered : public Disk
+{
+private:
+    /**
+     * @brief Create tiered model from models of disks
+     *
+     * @param[in] tiers - disks from the fastest one
+     * @param[in] tiersCapacity - capacity of each tier in bytes, 0 means unlimited
+     * @param[in] policy - migration policy
+     * @return new tiered model
+     */
+    static MemoryModelTiered* createModel(const std::vector<const Disk*>& tiers, const std::vector<size_t>& tiersCapacity, MemoryModelTiered::MigrationPolicy* policy) noexcept(true);
+
+public:
+    DiskTiered(MemoryControllerTiered* controller);
+
+    /**
+     * @brief Construct a new DiskTiered object
+     *
+     * @param[in] tiers - disks from the fastest one, tiers use fresh copies of their memory models
+     * @param[in] tiersCapacity - capacity of each tier in bytes, 0 means unlimited
+     * @param[in] policy - migration policy, DiskTiered takes ownership
+     *
+     * @return DiskTiered object
+     */
+    DiskTiered(const std::vector<const Disk*>& tiers, const std::vector<size_t>& tiersCapacity, MemoryModelTiered::MigrationPolicy* policy);
+
+    /**
+     * @brief Construct a new DiskTiered object with 2 tiers
+     *
+     * @param[in] fast - hot tier
+     * @param[in] slow - cold tier, without capacity limit
+     * @param[in] fastCapacity - capacity of hot tier in bytes, 0 means unlimited
+     * @param[in] policy - migration policy, DiskTiered takes ownership
+     *
+     * @return DiskTiered object
+     */
+    DiskTiered(const Disk& fast, const Disk& slow, size_t fastCapacity, MemoryModelTiered::MigrationPolicy* policy);
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new Disk
+    *
+    * @return new Disk
+    */
+    virtual Disk* clone() const noexcept(true) override
+    {
+        return new DiskTiered(*this);
+    }
+
+    /**
+     * @brief Flush cache and switch tier for next requests
+     *
+     * @param[in] hint - placement hint
+     * @param[in] hintBytes - how many bytes are kept under this hint now
+     *
+     * @return time of flush and migrations between tiers
+     */
+    virtual double setPlacementHint(size_t hint, size_t hintBytes = 0) noexcept(true) override;
+
+    /**
+     * @brief Get model of tiered devices, use it to read counters and wear-out of each tier
+     *
+     * @return const reference to tiered model
+     */
+    const MemoryModelTiered& getTieredModel() const noexcept(true)
+    {
+        return dynamic_cast<const MemoryModelTiered&>(memoryController->getMemoryModel());
+    }
+
+    /**
+     * @brief Created brief snapshot of Disk as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of Disk
+     */
+    virtual std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of Disk as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of Disk
+     */
+    virtual std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    DiskTiered() = default;
+    virtual ~DiskTiered() = default;
+    DiskTiered(const DiskTiered&) = default;
+    DiskTiered& operator=(const DiskTiered&) = default;
+    DiskTiered(DiskTiered &&) = default;
+    DiskTiered& operator=(DiskTiered &&) = default;
+};
+
+#endif
\ No newline at end of file
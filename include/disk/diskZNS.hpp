@@ -0,0 +1,91 @@
+#ifndef DISK_ZNS_HPP
+#define DISK_ZNS_HPP
+
+#include <disk/disk.hpp>
+#include <storage/memoryControllerZNS.hpp>
+
+/**
+ * @brief Zoned Namespace SSD, data of placement hints goes to zones
+ *
+ */
+class DiskZNS : public Disk
+{
+public:
+    DiskZNS(MemoryControllerZNS* controller);
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new Disk
+    *
+    * @return new Disk
+    */
+    virtual Disk* clone() const noexcept(true) override
+    {
+        return new DiskZNS(*this);
+    }
+
+    /**
+     * @brief Flush cache and switch hint for next requests
+     *
+     * @param[in] hint - placement hint
+     * @param[in] hintBytes - how many bytes are kept under this hint now
+     *
+     * @return time of flush and zone resets
+     */
+    virtual double setPlacementHint(size_t hint, size_t hintBytes = 0) noexcept(true) override;
+
+    /**
+     * @brief Get ZNS model, use it to read zone state, GC stats and write amplification
+     *
+     * @return const reference to ZNS model
+     */
+    const MemoryModelZNS& getZNSModel() const noexcept(true)
+    {
+        return dynamic_cast<const MemoryModelZNS&>(memoryController->getMemoryModel());
+    }
+
+    /**
+     * @brief Created brief snapshot of Disk as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of Disk
+     */
+    virtual std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of Disk as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of Disk
+     */
+    virtual std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    DiskZNS() = default;
+    virtual ~DiskZNS() = default;
+    DiskZNS(const DiskZNS&) = default;
+    DiskZNS& operator=(const DiskZNS&) = default;
+    DiskZNS(DiskZNS &&) = default;
+    DiskZNS& operator=(DiskZNS &&) = default;
+};
+
+class DiskZNS_SamsungK9F1G08U0D : public DiskZNS
+{
+public:
+    DiskZNS_SamsungK9F1G08U0D()
+    : DiskZNS(new MemoryControllerZNS(new MemoryModelZNS_SamsungK9F1G08U0D()))
+    {
+
+    }
+
+    Disk* clone() const noexcept(true) override
+    {
+        return new DiskZNS_SamsungK9F1G08U0D(*this);
+    }
+
+    ~DiskZNS_SamsungK9F1G08U0D() = default;
+    DiskZNS_SamsungK9F1G08U0D(const DiskZNS_SamsungK9F1G08U0D&) = default;
+    DiskZNS_SamsungK9F1G08U0D& operator=(const DiskZNS_SamsungK9F1G08U0D&) = default;
+    DiskZNS_SamsungK9F1G08U0D(DiskZNS_SamsungK9F1G08U0D &&) = default;
+    DiskZNS_SamsungK9F1G08U0D& operator=(DiskZNS_SamsungK9F1G08U0D &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,215 @@
+#ifndef STATIC_DISK_HPP
+#define STATIC_DISK_HPP
+
+#include <disk/disk.hpp>
+#include <storage/memoryController.hpp>
+#include <storage/memoryModel.hpp>
+
+#include <type_traits>
+
+/**
+ * @brief Disk with controller and model types known at compile time.
+ *        Hot functions (read / write / overwrite / flush) call controller of exact type Controller directly,
+ *        so there is no virtual dispatch between Disk and MemoryController and compiler can inline these calls.
+ *        StaticDisk is still a Disk, so it can be used by every index via Disk* (then it works like a normal Disk).
+ *        Fast path is used when caller knows StaticDisk type (for example template code instantiated with StaticDisk).
+ *
+ * @tparam Controller - concrete memory controller, has to be constructible from Model*
+ * @tparam Model - concrete memory model, has to be default constructible (for example MemoryModelSSD_Samsung840)
+ */
+template<typename Controller, typename Model>
+class StaticDisk final : public Disk
+{
+    static_assert(std::is_base_of_v<MemoryController, Controller>, "Controller has to derive from MemoryController");
+    static_assert(std::is_base_of_v<MemoryModel, Model>, "Model has to derive from MemoryModel");
+    static_assert(std::is_default_constructible_v<Model>, "Model has to be default constructible");
+    static_assert(std::is_constructible_v<Controller, Model*>, "Controller has to be constructible from Model*");
+
+private:
+    Controller* controller; // memoryController with exact type, owned by Disk
+
+    void pegDiskCounters(enum MemoryCounters::MemoryCountersD timeId,
+                         enum MemoryCounters::MemoryCountersL opsId,
+                         enum MemoryCounters::MemoryCountersL bytesId,
+                         double time,
+                         size_t bytes) noexcept(true)
+    {
+        diskCounters.pegCounter(timeId, time);
+        diskCounters.pegCounter(opsId, 1);
+        diskCounters.pegCounter(bytesId, bytes);
+    }
+
+public:
+    StaticDisk()
+    : Disk(new Controller(new Model())), controller{static_cast<Controller*>(memoryController.get())}
+    {
+
+    }
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new Disk
+    *
+    * @return new Disk
+    */
+    Disk* clone() const noexcept(true) override
+    {
+        return new StaticDisk(*this);
+    }
+
+    /**
+     * @brief Get controller with exact type
+     *
+     * @return const reference to controller
+     */
+    const Controller& getController() const noexcept(true)
+    {
+        return *controller;
+    }
+
+    /**
+     * @brief Get memory model with exact type
+     *
+     * @return const reference to memory model
+     */
+    const Model& getModel() const noexcept(true)
+    {
+        return static_cast<const Model&>(controller->Controller::getMemoryModel());
+    }
+
+    /**
+     * @brief Flush cache, write down all pages in QUEUE, clear cache
+     *
+     * @return time needed to write down all pages from QUEUE
+     */
+    double flushCache() noexcept(true)
+    {
+        // the same counters as Disk::flushCache
+        const double writeTimeCounter = controller->getCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_TIME).second;
+        const double overwriteTimeCounter = controller->getCounter(MemoryCounters::MEMORY_COUNTER_RW_OVERWRITE_TOTAL_TIME).second;
+
+        const double flushTime = controller->Controller::flushCache();
+
+        diskCounters.pegCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_TIME, controller->getCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_TIME).second - writeTimeCounter);
+        diskCounters.pegCounter(MemoryCounters::MEMORY_COUNTER_RW_OVERWRITE_TOTAL_TIME, controller->getCounter(MemoryCounters::MEMORY_COUNTER_RW_OVERWRITE_TOTAL_TIME).second - overwriteTimeCounter);
+
+        return flushTime;
+    }
+
+    /**
+     * @brief Read contiguous bytes from memory from address @addr
+     *
+     * @param[in] addr - start address
+     * @param[in] bytes - bytes to read
+     *
+     * @return time required for operation, could be 0 if there is no cache miss
+     */
+    double readBytes(uintptr_t addr, size_t bytes) noexcept(true)
+    {
+        const double time = controller->Controller::readBytes(addr, bytes);
+
+        pegDiskCounters(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES, time, bytes);
+
+        return time;
+    }
+
+    /**
+     * @brief Write contiguous bytes to memory from address @addr
+     *
+     * @param[in] addr - start address
+     * @param[in] bytes - bytes to write
+     *
+     * @return time required for operation, could be 0 if there is no cache miss
+     */
+    double writeBytes(uintptr_t addr, size_t bytes) noexcept(true)
+    {
+        const double time = controller->Controller::writeBytes(addr, bytes);
+
+        pegDiskCounters(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_TIME, MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_OPERATIONS, MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES, time, bytes);
+
+        return time;
+    }
+
+    /**
+     * @brief Overwrite contiguous bytes to memory from address @addr
+     *
+     * @param[in] addr - start address
+     * @param[in] bytes - bytes to overwrite
+     * @param[in] bitChangeRatio - expected fraction of bits changed in overwritten bytes, by default new data is random
+     *
+     * @return time required for operation, could be 0 if there is no cache miss
+     */
+    double overwriteBytes(uintptr_t addr, size_t bytes, double bitChangeRatio = MemoryController::defaultBitChangeRatio) noexcept(true)
+    {
+        controller->setBitChangeRatio(bitChangeRatio);
+        const double time = controller->Controller::overwriteBytes(addr, bytes);
+
+        pegDiskCounters(MemoryCounters::MEMORY_COUNTER_RW_OVERWRITE_TOTAL_TIME, MemoryCounters::MEMORY_COUNTER_RW_OVERWRITE_TOTAL_OPERATIONS, MemoryCounters::MEMORY_COUNTER_RW_OVERWRITE_TOTAL_BYTES, time, bytes);
+
+        return time;
+    }
+
+    /**
+     * @brief Created brief snapshot of Disk as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of Disk
+     */
+    std::string toString(bool oneLine = true) const noexcept(true) override
+    {
+        if (oneLine)
+            return std::string(std::string("StaticDisk {") +
+                               std::string(" .memoryController = ") + controller->toString() +
+                               std::string(" .diskCounters = ") + diskCounters.toString() +
+                               std::string(" }"));
+        else
+            return std::string(std::string("StaticDisk {\n") +
+                               std::string("\t.memoryController = ") + controller->toString() + std::string("\n") +
+                               std::string("\t.diskCounters = ") + diskCounters.toString() + std::string("\n") +
+                               std::string("}"));
+    }
+
+    /**
+     * @brief Created full snapshot of Disk as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of Disk
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true) override
+    {
+        if (oneLine)
+            return std::string(std::string("StaticDisk {") +
+                               std::string(" .memoryController = ") + controller->toStringFull() +
+                               std::string(" .diskCounters = ") + diskCounters.toStringFull() +
+                               std::string(" }"));
+        else
+            return std::string(std::string("StaticDisk {\n") +
+                               std::string("\t.memoryController = ") + controller->toStringFull() + std::string("\n") +
+                               std::string("\t.diskCounters = ") + diskCounters.toStringFull() + std::string("\n") +
+                               std::string("}"));
+    }
+
+    ~StaticDisk() = default;
+
+    StaticDisk(const StaticDisk& other)
+    : Disk(new Controller(*other.controller)), controller{static_cast<Controller*>(memoryController.get())}
+    {
+        diskCounters = other.diskCounters;
+    }
+
+    StaticDisk& operator=(const StaticDisk& other)
+    {
+        if (this == &other)
+            return *this;
+
+        diskCounters = other.diskCounters;
+        memoryController.reset(new Controller(*other.controller));
+        controller = static_cast<Controller*>(memoryController.get());
+
+        return *this;
+    }
+
+    StaticDisk(StaticDisk &&) = default;
+    StaticDisk& operator=(StaticDisk &&) = default;
+};
+
+#endif
\ No newline at end of file
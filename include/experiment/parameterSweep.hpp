@@ -0,0 +1,274 @@
+#ifndef PARAMETER_SWEEP_HPP
+#define PARAMETER_SWEEP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Run experiment for every point of Cartesian product of parameters (index config, disk preset, table, workload ...).
+ *        Result of each point is stored in cache directory under hash of point parameters and full configuration
+ *        of experiment built for point (see ConfigFunction), so reruns skip completed points and every sweep
+ *        which builds the same experiment reuses its result. Sweep name is only a label.
+ *        Points are executed on own thread pool of run, the most expensive points are submitted first.
+ *
+ */
+class ParameterSweep
+{
+public:
+    /**
+     * @brief Single point of sweep, parameters are kept sorted by name, so order of setting them does not change the point
+     *
+     */
+    class Point
+    {
+    private:
+        std::map<std::string, std::string> params;
+
+    public:
+        Point() = default;
+
+        /**
+         * @brief Construct a new Point object
+         *
+         * @param[in] params - pairs (name, value)
+         *
+         * @return Point object
+         */
+        Point(const std::vector<std::pair<std::string, std::string>>& params);
+
+        /**
+         * @brief Set value of parameter, old value is replaced
+         *
+         * @param[in] name - parameter name
+         * @param[in] value - parameter value
+         */
+        void set(const std::string& name, const std::string& value) noexcept(true);
+
+        bool has(const std::string& name) const noexcept(true)
+        {
+            return params.find(name) != params.end();
+        }
+
+        /**
+         * @brief Get value of parameter
+         *
+         * @param[in] name - parameter name
+         * @return value or empty string when point does not have this parameter
+         */
+        std::string get(const std::string& name) const noexcept(true);
+
+        size_t getSizeT(const std::string& name) const noexcept(true);
+        double getDouble(const std::string& name) const noexcept(true);
+
+        const std::map<std::string, std::string>& getParams() const noexcept(true)
+        {
+            return params;
+        }
+
+        /**
+         * @brief Get canonical description of point "name1=value1;name2=value2"
+         *
+         * @return point key
+         */
+        std::string getKey() const noexcept(true);
+
+        bool operator==(const Point& other) const noexcept(true)
+        {
+            return params == other.params;
+        }
+
+        ~Point() = default;
+        Point(const Point&) = default;
+        Point& operator=(const Point&) = default;
+        Point(Point &&) = default;
+        Point& operator=(Point &&) = default;
+    };
+
+    using PointFunction = std::function<std::string(const Point&)>; // runs experiment and returns result to cache
+    using CostFunction = std::function<double(const Point&)>; // estimated time of point
+    using ConfigFunction = std::function<std::string(const Point&)>; // full description of experiment built for point (steps, indexes toStringFull ...) in 1 line
+
+private:
+    std::string name;
+    std::string cacheDirectory;
+    PointFunction pointFunction;
+    CostFunction costFunction;
+    ConfigFunction configFunction;
+
+    std::vector<std::pair<std::string, std::vector<std::string>>> parameters; // in order of adding
+    std::vector<Point> extraPoints; // points outside of Cartesian product
+
+    std::map<std::string, std::string> results; // point key -> result, config is a function of point so point key is enough
+
+    size_t numCachedPoints;
+    size_t numExecutedPoints;
+
+    /**
+     * @brief Get path of cache file of key
+     *
+     * @param[in] cacheKey - cache key of point
+     * @return path of cache file
+     */
+    std::string getCachePath(const std::string& cacheKey) const noexcept(true);
+
+    /**
+     * @brief Load result of point from cache
+     *
+     * @param[in] point - point
+     * @param[out] result - cached result
+     * @return true if result was in cache
+     */
+    bool loadResult(const Point& point, std::string& result) const noexcept(true);
+
+    /**
+     * @brief Store result of point in cache. File is renamed after writing, so killed run never leaves half of result
+     *
+     * @param[in] cacheKey - cache key of point
+     * @param[in] result - result of point
+     */
+    void storeResult(const std::string& cacheKey, const std::string& result) const noexcept(true);
+
+    /**
+     * @brief Get key of point in cache: point parameters and full configuration of experiment.
+     *        Values hardcoded in experiment are part of configuration, so changing them does not reuse old results
+     *
+     * @param[in] point - point
+     * @return cache key
+     */
+    std::string getCacheKey(const Point& point) const noexcept(true);
+
+public:
+    /**
+     * @brief Construct a new ParameterSweep object
+     *
+     * @param[in] name - sweep name used in logs, it is not a part of cache key
+     * @param[in] cacheDirectory - directory with cached results, created if needed
+     * @param[in] pointFunction - function which runs experiment for point and returns its result
+     * @param[in] costFunction - estimated cost of point, by default all points cost the same
+     * @param[in] configFunction - full configuration of experiment built for point, by default point has to describe everything
+     *
+     * @return ParameterSweep object
+     */
+    ParameterSweep(const std::string& name, const std::string& cacheDirectory, PointFunction pointFunction, CostFunction costFunction = CostFunction(), ConfigFunction configFunction = ConfigFunction());
+
+    /**
+     * @brief Add parameter to Cartesian product, duplicated values are ignored
+     *
+     * @param[in] name - parameter name
+     * @param[in] values - values of parameter
+     */
+    void addParameter(const std::string& name, const std::vector<std::string>& values) noexcept(true);
+    void addParameter(const std::string& name, const std::vector<size_t>& values) noexcept(true);
+    void addParameter(const std::string& name, const std::vector<double>& values) noexcept(true);
+
+    /**
+     * @brief Add point outside of Cartesian product
+     *
+     * @param[in] point - point to add
+     */
+    void addPoint(const Point& point) noexcept(true);
+
+    /**
+     * @brief Get all points of sweep (Cartesian product and extra points) without duplicates
+     *
+     * @return points in order of adding
+     */
+    std::vector<Point> getPoints() const noexcept(true);
+
+    /**
+     * @brief Get points which are not cached yet in order of execution (the most expensive first)
+     *
+     * @return pending points
+     */
+    std::vector<Point> getPendingPoints() const noexcept(true);
+
+    /**
+     * @brief Run all points which are not cached yet and wait for them.
+     *        Points are executed on thread pool created by this call (as many threads as DBThreadPool::threadPool),
+     *        so run does not wait for its own tasks when it is called from task of DBThreadPool::threadPool
+     *
+     */
+    void run() noexcept(true);
+
+    /**
+     * @brief Check if result of point is known (after run)
+     *
+     * @param[in] point - point
+     * @return true if result is known
+     */
+    bool hasResult(const Point& point) const noexcept(true);
+
+    /**
+     * @brief Get result of point
+     *
+     * @param[in] point - point
+     * @return result or empty string when result is not known
+     */
+    std::string getResult(const Point& point) const noexcept(true);
+
+    /**
+     * @brief Hash of key, FNV-1a, so hash is the same in every run and on every machine
+     *
+     * @param[in] key - key to hash
+     * @return 64 bit hash
+     */
+    static uint64_t hashKey(const std::string& key) noexcept(true);
+
+    /**
+     * @brief Convert value to the shortest string which keeps the same value
+     *
+     * @param[in] value - value
+     * @return value as a string
+     */
+    static std::string valueToString(double value) noexcept(true);
+
+    const std::string& getName() const noexcept(true)
+    {
+        return name;
+    }
+
+    const std::string& getCacheDirectory() const noexcept(true)
+    {
+        return cacheDirectory;
+    }
+
+    size_t getNumCachedPoints() const noexcept(true)
+    {
+        return numCachedPoints;
+    }
+
+    size_t getNumExecutedPoints() const noexcept(true)
+    {
+        return numExecutedPoints;
+    }
+
+    /**
+     * @brief Created brief snapshot of ParameterSweep as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of ParameterSweep
+     */
+    std::string toString(bool oneLine = true) const noexcept(true);
+
+    /**
+     * @brief Created full snapshot of ParameterSweep as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of ParameterSweep
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true);
+
+    ~ParameterSweep() = default;
+    ParameterSweep() = default;
+    ParameterSweep(const ParameterSweep&) = default;
+    ParameterSweep& operator=(const ParameterSweep&) = default;
+    ParameterSweep(ParameterSweep &&) = default;
+    ParameterSweep& operator=(ParameterSweep &&) = default;
+};
+
+#endif
\ No newline at end of file
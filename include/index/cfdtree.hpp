@@ -5,6 +5,7 @@
 #include <index/fdtree.hpp>
 #include <disk/diskColumnOverlay.hpp>
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -18,6 +19,21 @@ private:
     size_t headTreeSize;
     size_t lvlRatio;
 
+    IndexCounters overlappedCounters; // time of columns hidden by concurrent execution (sum of columns time - critical path)
+
+    /**
+     * @brief Execute operation on FD-trees of columns. When columns are processed concurrently,
+     *        each column is maintained on index thread pool (each column has own disk) and time is the critical path
+     *
+     * @param[in] columns - indexes of columns
+     * @param[in] op - operation on single FD-tree, returns time
+     * @param[in] timeId - time counter of this operation, overlapped time is pegged here
+     * @return time of operation on all columns
+     */
+    double executeOnColumns(const std::vector<size_t>& columns,
+                            const std::function<double(FDTree&)>& op,
+                            enum IndexCounters::IndexCountersD timeId) noexcept(true);
+
 public:
     /**
      * @brief Create CFDTree
@@ -0,0 +1,295 @@
+#ifndef COLUMN_LSM_TREE_HPP
+#define COLUMN_LSM_TREE_HPP
+
+#include <index/dbIndexColumn.hpp>
+#include <index/lsmtree.hpp>
+#include <disk/diskColumnOverlay.hpp>
+
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Column-group LSM-tree. Entries are buffered in row-oriented memtable (in RAM),
+ *        full memtable is split by column groups and each group is flushed as a sorted run of its own LSM-tree.
+ *        Each group has own disk and leveled compaction, sorted runs of each group keep key next to group columns.
+ *        One group per column is a pure column store, one group with all columns is a row store.
+ *
+ */
+class ColumnLSMTree : public DBIndexColumn
+{
+private:
+    std::vector<std::vector<size_t>> columnGroups; // [0] - group with key column
+    std::vector<LSMTree> lsmGroups;
+
+    std::unique_ptr<DiskColumnOverlay> disk;
+    size_t nodeSize;
+    size_t memtableSize;
+    size_t lvlRatio;
+
+    /**
+     * @brief Check if each column is in exactly 1 group. Key column is moved to the first group
+     *
+     * @param[in] groups - column groups to check
+     * @return true if groups are valid, false otherwise
+     */
+    bool normalizeColumnGroups(std::vector<std::vector<size_t>>& groups) const noexcept(true);
+
+    /**
+     * @brief Get groups which keep any of requested columns
+     *
+     * @param[in] columnsToFetch - requested columns
+     * @return indexes of groups
+     */
+    std::vector<size_t> getGroupsToFetch(const std::vector<size_t>& columnsToFetch) const noexcept(true);
+
+    double insertEntriesHelper(size_t numOperations) noexcept(true);
+    double deleteEntriesHelper(size_t numOperations) noexcept(true);
+    double findEntriesHelper(const std::vector<size_t>& columnsToFetch, size_t numEntries, size_t numOperations, bool isPointSearch) noexcept(true);
+public:
+    /**
+     * @brief Create ColumnLSMTree
+     *
+     * @param[in] name -     dbIndex name
+     * @param[in] disk - pointer to disk
+     * @param[in] columnsSize - vector with size of each columns [0] - key (for example DBTable::getAllColumnSize())
+     * @param[in] columnGroups - indexes of columns kept together, each column has to be in exactly 1 group.
+     *                           Invalid or empty groups mean 1 group per column
+     * @param[in] nodeSize - node is a virtual contiguous area,
+     *                       each node has a pointer into him in a lvl upper
+     * @param[in] memtableSize - size of row-oriented memtable in bytes
+     * @param[in] lvlRatio - nextLvl.size = lvl.size * lvlRatio, lvl0.size = memtable.size * lvlRatio
+     *
+     * @return ColumnLSMTree object
+     */
+    ColumnLSMTree(const char* name, Disk* disk, const std::vector<size_t>& columnsSize, const std::vector<std::vector<size_t>>& columnGroups, size_t nodeSize, size_t memtableSize, size_t lvlRatio);
+
+    /**
+     * @brief Create ColumnLSMTree
+     *
+     * @param[in] disk - pointer to disk
+     * @param[in] columnsSize - vector with size of each columns [0] - key (for example DBTable::getAllColumnSize())
+     * @param[in] columnGroups - indexes of columns kept together, each column has to be in exactly 1 group.
+     *                           Invalid or empty groups mean 1 group per column
+     * @param[in] nodeSize - node is a virtual contiguous area,
+     *                       each node has a pointer into him in a lvl upper
+     * @param[in] memtableSize - size of row-oriented memtable in bytes
+     * @param[in] lvlRatio - nextLvl.size = lvl.size * lvlRatio, lvl0.size = memtable.size * lvlRatio
+     *
+     * @return ColumnLSMTree object
+     */
+    ColumnLSMTree(Disk* disk, const std::vector<size_t>& columnsSize, const std::vector<std::vector<size_t>>& columnGroups, size_t nodeSize, size_t memtableSize, size_t lvlRatio);
+
+    /**
+     * @brief Create ColumnLSMTree with default LSM parameters
+     *
+     * @param[in] disk - pointer to disk
+     * @param[in] columnsSize - vector with size of each columns [0] - key (for example DBTable::getAllColumnSize())
+     * @param[in] columnGroups - indexes of columns kept together, each column has to be in exactly 1 group.
+     *                           Invalid or empty groups mean 1 group per column
+     *
+     * @return ColumnLSMTree object
+     */
+    ColumnLSMTree(Disk* disk, const std::vector<size_t>& columnsSize, const std::vector<std::vector<size_t>>& columnGroups);
+
+    /**
+     * @brief Create ColumnLSMTree with default LSM parameters and 1 group per column
+     *
+     * @param[in] disk - pointer to disk
+     * @param[in] columnsSize - vector with size of each columns [0] - key (for example DBTable::getAllColumnSize())
+     *
+     * @return ColumnLSMTree object
+     */
+    ColumnLSMTree(Disk* disk, const std::vector<size_t>& columnsSize);
+
+    /**
+     * @brief Create ColumnLSMTree with default LSM parameters and 1 group per column
+     *
+     * @param[in] name -     dbIndex name
+     * @param[in] disk - pointer to disk
+     * @param[in] columnsSize - vector with size of each columns [0] - key (for example DBTable::getAllColumnSize())
+     *
+     * @return ColumnLSMTree object
+     */
+    ColumnLSMTree(const char* name, Disk* disk, const std::vector<size_t>& columnsSize);
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new DBIndexColumn
+    *
+    * @return new DBIndexColumn
+    */
+    DBIndexColumn* clone() const noexcept(true) override
+    {
+        return new ColumnLSMTree(*this);
+    }
+
+    /**
+     * @brief Created brief snapshot of DBIndex as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of DBIndex
+     */
+    virtual std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of DBIndex as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of DBIndex
+     */
+    virtual std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Get Disk as a const reference. Stats of disks of all groups are merged here
+     *
+     * @return Const reference to disk
+     */
+    virtual const Disk& getDisk() const noexcept(true) override;
+
+    /**
+     * @brief Get number of entries
+     *
+     * @return number of entries in DBIndex
+     */
+    virtual size_t getNumEntries() const noexcept(true) override;
+
+    /**
+     * @brief Get Height (number of levels written on disk). When memtable was not flushed yet then height = 0
+     *
+     * @return height
+     */
+    size_t getHeight() const noexcept(true);
+
+    size_t getNumOfGroups() const noexcept(true)
+    {
+        return columnGroups.size();
+    }
+
+    const std::vector<size_t>& getColumnGroup(size_t groupIndex) const noexcept(true)
+    {
+        return columnGroups[groupIndex];
+    }
+
+    /**
+     * @brief Get LSM Lvl of group const reference to see lvl snapshot
+     *
+     * @param[in] lvl - LSM LVL, 0 = part of memtable, 1 = first LSMLvl written on disk, Height = last lvl
+     * @param[in] groupIndex - index of column group (0 - group with key column)
+     *
+     * @return const reference to LSMLvl
+     */
+    const LSMTree::LSMLvl& getColumnLSMLvl(size_t lvl, size_t groupIndex) const noexcept(true);
+
+     /**
+     * @brief Check if bulkload operation is supported
+     *
+     * @return true if bulkload is supported
+     *         false otherwise
+     */
+    virtual bool isBulkloadSupported() const noexcept(true) override;
+
+    /**
+     * @brief Insert new entries to the DBIndexColumn
+     *        Method get number of operations but evaluates operation one by one
+     *        So there is no buffering here.
+     *        Cost of operation(3) is always equal to 3x operation(1)
+     *
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double insertEntries(size_t numOperations = 1) noexcept(true) override;
+
+    /**
+     * @brief Insert new entries to the DBIndexColumn by using bulkload
+     *        If bulkload is not supported this function does nothing and returns 0.0
+     *
+     * @param[in] numEntries - entries to insert via bulkload
+     *
+     * @return time needed to evaluates the operation
+     */
+    virtual double bulkloadEntries(size_t numEntries = 1) noexcept(true) override;
+
+    /**
+     * @brief Delete entries from the DBIndexColumn
+     *        Method get number of operations but evaluates operation one by one
+     *        So there is no buffering here.
+     *        Cost of operation(3) is always equal to 3x operation(1)
+     *
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double deleteEntries(size_t numOperations = 1) noexcept(true) override;
+
+    /**
+     * @brief Find entries from the DBIndexColumn using point search (point seek)
+     *        Method get number of operations but evaluates operation one by one
+     *        So there is no buffering here.
+     *        Cost of operation(3) is always equal to 3x operation(1)
+     *
+     * @param[in] columnsToFetch - sorted vector with number of columns
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findPointEntries(const std::vector<size_t>& columnsToFetch, size_t numOperations = 1)  noexcept(true) override;
+
+    /**
+     * @brief Find entries from the DBIndex using point search (point seek)
+     *        Method get number of operations but evaluates operation one by one
+     *        So there is no buffering here.
+     *        Cost of operation(3) is always equal to 3x operation(1)
+     *
+     * @param[in] columnsToFetch - sorted vector with number of columns
+     * @param[in] selectivity - number from range [0;1]. Find entries = selectivity * index.numEntries
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findPointEntries(const std::vector<size_t>& columnsToFetch, double selectivity, size_t numOperations = 1) noexcept(true) override;
+
+    /**
+     * @brief Find entries from the DBIndex using range search (range seek)
+     *        This method finds all contiguous entries using 1 operation (range seek)
+     *
+     * @param[in] columnsToFetch - sorted vector with number of columns
+     * @param[in] numEntries - number of entries to seek
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findRangeEntries(const std::vector<size_t>& columnsToFetch, size_t numEntries, size_t numOperations = 1)  noexcept(true) override;
+
+    /**
+     * @brief Find entries from the DBIndex using range search (range seek)
+     *        This method finds all contiguous entries using 1 operation (range seek)
+     *
+     * @param[in] columnsToFetch - sorted vector with number of columns
+     * @param[in] selectivity - number from range [0;1]. Find entries = selectivity * index.numEntries
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findRangeEntries(const std::vector<size_t>& columnsToFetch, double selectivity, size_t numOperations = 1) noexcept(true) override;
+
+    /**
+     * @brief Fake the insert of numEntries entries to create a topology in fastest way.
+     *        This should be used only to test non-empty index in workloads, so this is a total fakeout.
+     *        No low-level simulation is done here. We are simulating only insert index code without involving disk simulator.
+     *        Counters wouldnt be pegged
+     *
+     * @param[in] numEntries - how entries to insert to create a topology
+     */
+    virtual void createTopologyAfterInsert(size_t numEntries = 1) noexcept(true) override;
+
+    virtual ~ColumnLSMTree() = default;
+    ColumnLSMTree() = default;
+
+    ColumnLSMTree(const ColumnLSMTree&);
+    ColumnLSMTree& operator=(const ColumnLSMTree&);
+
+    ColumnLSMTree(ColumnLSMTree &&) = default;
+    ColumnLSMTree& operator=(ColumnLSMTree &&) = default;
+};
+
+#endif
\ No newline at end of file
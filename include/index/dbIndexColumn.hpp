@@ -18,6 +18,17 @@ protected:
     size_t sizeData;  // columnsSize[1 ... n]
     size_t sizeRecord; // columnsSize[0 ... n]
     size_t numEntries;
+    size_t columnsParallelism; // how many columns are processed at the same time, 1 - one after another, 0 - all columns at once
+
+    /**
+     * @brief Get time of operation executed on several columns.
+     *        Columns are processed one after another (sum of times) or concurrently, then time is the critical path.
+     *        When parallelism is limited, columns are given to the least loaded device channel from the longest one
+     *
+     * @param[in] columnsTime - time of operation on each column
+     * @return time of operation on all columns
+     */
+    double getColumnsTime(const std::vector<double>& columnsTime) const noexcept(true);
 
 public:
     /**
@@ -294,6 +305,20 @@ public:
      */
     virtual double findRangeEntries(const std::vector<size_t>& columnsToFetch, double selectivity, size_t numOperations = 1) noexcept(true) = 0;
 
+    /**
+     * @brief Find entries from the DBIndex using scan with predicate on key column (analytic query).
+     *        Qualifying entries do not have to be contiguous, clustering says how close they are to each other.
+     *        By default index does not know how to use it, so this is a range search of selectivity * index.numEntries entries
+     *
+     * @param[in] columnsToFetch - sorted vector with number of columns
+     * @param[in] selectivity - number from range [0;1]. Qualifying entries = selectivity * index.numEntries
+     * @param[in] clustering - number from range [0;1]. 1 - qualifying entries are contiguous, 0 - they are spread uniformly
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findPredicateEntries(const std::vector<size_t>& columnsToFetch, double selectivity, double clustering, size_t numOperations = 1) noexcept(true);
+
     /**
      * @brief Fake the insert of numEntries entries to create a topology in fastest way.
      *        This should be used only to test non-empty index in workloads, so this is a total fakeout.
@@ -304,6 +329,21 @@ public:
      */
     virtual void createTopologyAfterInsert(size_t numEntries = 1) noexcept(true) = 0;
 
+    /**
+     * @brief Set how many columns can be processed at the same time (device parallelism)
+     *
+     * @param[in] parallelism - 1 means columns one after another (default), 0 means all columns at once
+     */
+    void setColumnsParallelism(size_t parallelism) noexcept(true)
+    {
+        columnsParallelism = parallelism;
+    }
+
+    size_t getColumnsParallelism() const noexcept(true)
+    {
+        return columnsParallelism;
+    }
+
     virtual ~DBIndexColumn() = default;
     DBIndexColumn() = default;
 
@@ -6,11 +6,56 @@
 class DSM : public DBIndexColumn
 {
 private:
+    size_t zoneMapEntries; // entries described by 1 min/max pair of in-memory zone map of key column, 0 - no zone maps
+
+    /**
+     * @brief Get how many units (zones or pages) of column contain qualifying entries
+     *
+     * @param[in] entriesPerUnit - entries in 1 unit
+     * @param[in] selectivity - fraction of qualifying entries
+     * @param[in] clustering - 1 - qualifying entries are contiguous, 0 - they are spread uniformly
+     * @return number of units to read
+     */
+    size_t getTouchedUnits(size_t entriesPerUnit, double selectivity, double clustering) const noexcept(true);
+
+    /**
+     * @brief Read touched units of column. Clustered units are read by 1 request, spread units by 1 request per unit
+     *
+     * @param[in] targetDisk - disk to read from
+     * @param[in] column - column index
+     * @param[in] touchedUnits - units to read
+     * @param[in] unitBytes - size of unit in bytes
+     * @param[in] clustering - 1 - qualifying entries are contiguous, 0 - they are spread uniformly
+     * @return time
+     */
+    double readUnits(Disk* targetDisk, size_t column, size_t touchedUnits, size_t unitBytes, double clustering) const noexcept(true);
+
+    /**
+     * @brief Read whole column sequentially
+     *
+     * @param[in] targetDisk - disk to read from
+     * @param[in] column - column index
+     * @return time
+     */
+    double readColumn(Disk* targetDisk, size_t column) const noexcept(true);
+
+    /**
+     * @brief Read touched units of column, but never pay more than sequential read of whole column
+     *
+     * @param[in] column - column index
+     * @param[in] touchedUnits - units to read
+     * @param[in] unitBytes - size of unit in bytes
+     * @param[in] clustering - 1 - qualifying entries are contiguous, 0 - they are spread uniformly
+     * @return min(time of unit reads, time of whole column read)
+     */
+    double readTouchedUnits(size_t column, size_t touchedUnits, size_t unitBytes, double clustering) noexcept(true);
+
     double findKey() noexcept(true);
     double insertEntriesHelper(size_t numOperations) noexcept(true);
     double bulkloadEntriesHelper(size_t numEntries) noexcept(true);
     double deleteEntriesHelper(size_t numOperations) noexcept(true);
     double findEntriesHelper(const std::vector<size_t>& columnsToFetch, size_t numEntries, size_t numOperations) noexcept(true);
+    double findPredicateEntriesHelper(const std::vector<size_t>& columnsToFetch, double selectivity, double clustering, size_t numOperations) noexcept(true);
 public:
     /**
      * @brief Create DSM
@@ -152,6 +197,35 @@ public:
      */
     virtual double findRangeEntries(const std::vector<size_t>& columnsToFetch, double selectivity, size_t numOperations = 1) noexcept(true) override;
 
+    /**
+     * @brief Find entries using scan with predicate on key column and late materialization.
+     *        Predicate is evaluated on key column (zone maps skip zones without qualifying entries),
+     *        then other columns are read only in pages with qualifying positions
+     *
+     * @param[in] columnsToFetch - sorted vector with number of columns
+     * @param[in] selectivity - number from range [0;1]. Qualifying entries = selectivity * index.numEntries
+     * @param[in] clustering - number from range [0;1]. 1 - qualifying entries are contiguous, 0 - they are spread uniformly
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findPredicateEntries(const std::vector<size_t>& columnsToFetch, double selectivity, double clustering, size_t numOperations = 1) noexcept(true) override;
+
+    /**
+     * @brief Keep in-memory min/max zone map of key column
+     *
+     * @param[in] zoneEntries - entries in 1 zone, 0 turns zone maps off
+     */
+    void setZoneMapEntries(size_t zoneEntries) noexcept(true)
+    {
+        zoneMapEntries = zoneEntries;
+    }
+
+    size_t getZoneMapEntries() const noexcept(true)
+    {
+        return zoneMapEntries;
+    }
+
     /**
      * @brief Fake the insert of numEntries entries to create a topology in fastest way.
      *        This should be used only to test non-empty index in workloads, so this is a total fakeout.
@@ -2,6 +2,7 @@
 #define FDTREE_HPP
 
 #include <index/dbIndex.hpp>
+#include <index/lsmBackgroundCompaction.hpp>
 #include <vector>
 
 class FDTree : public DBIndex
@@ -79,9 +80,12 @@ protected:
     FDLvl headTree;
     std::vector<FDLvl> levels;
 
+    LSMBackgroundCompaction compaction;
+
 private:
     double insertIntoHeadTree(size_t entries) noexcept(true);
     double deleteFromHeadTree(size_t entries) noexcept(true);
+    double chargeCompaction(double compactionTime) noexcept(true);
     void addLevel() noexcept(true);
 
     double mergeHeadTree() noexcept(true);
@@ -191,6 +195,26 @@ public:
      */
     const FDTree::FDLvl& getFDLvl(size_t lvl) const noexcept(true);
 
+    /**
+     * @brief Move merges of HeadTree and levels into background. Merge time is not charged to insert / delete,
+     *        writes stall only when writeStallThreshold merges are still running.
+     *        Background and stall times / operations are pegged to INDEX_COUNTER_RW_BACKGROUND_* and INDEX_COUNTER_RW_STALL_* counters
+     *
+     * @param[in] compactionThreads - number of merge threads, 0 turns background mode off
+     * @param[in] writeStallThreshold - how many running merges stall next HeadTree merge
+     */
+    void setBackgroundCompaction(size_t compactionThreads, size_t writeStallThreshold = 1) noexcept(true);
+
+    /**
+     * @brief Get background merge model as a const reference
+     *
+     * @return const reference to LSMBackgroundCompaction
+     */
+    const LSMBackgroundCompaction& getBackgroundCompaction() const noexcept(true)
+    {
+        return compaction;
+    }
+
     /**
      * @brief Check if bulkload operation is supported
      *
@@ -0,0 +1,170 @@
+#ifndef LSM_BACKGROUND_COMPACTION_HPP
+#define LSM_BACKGROUND_COMPACTION_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Model of background compaction for LSM-like indexes.
+ *        Merge work is scheduled on compaction threads with own timeline.
+ *        Foreground pays only for write stalls, when too many compactions are pending.
+ *        Index topology is updated immediately, only time is shifted to background.
+ *
+ */
+class LSMBackgroundCompaction
+{
+private:
+    size_t compactionThreads; // 0 means merges are charged to foreground (default LSM behaviour)
+    size_t writeStallThreshold; // writes stall when this many compactions are still running
+
+    double clock; // foreground simulated time
+    std::vector<double> threadsFreeAt;
+    std::vector<double> pendingCompactions; // finish time of not finished compactions
+
+    double backgroundTime;
+    long backgroundOperations;
+    double stallTime;
+    long stallOperations;
+
+    /**
+     * @brief Remove compactions finished before current clock
+     *
+     */
+    void retireFinishedCompactions() noexcept(true);
+
+public:
+    /**
+     * @brief Construct a new LSMBackgroundCompaction object
+     *
+     * @param[in] compactionThreads - number of background threads, 0 turns background mode off
+     * @param[in] writeStallThreshold - how many pending compactions stall next flush
+     */
+    LSMBackgroundCompaction(size_t compactionThreads = 0, size_t writeStallThreshold = 1);
+
+    /**
+     * @brief Is background mode turned on?
+     *
+     * @return true if merges are executed in background
+     */
+    bool isEnabled() const noexcept(true)
+    {
+        return compactionThreads > 0;
+    }
+
+    /**
+     * @brief Move foreground clock by time of foreground operation
+     *
+     * @param[in] time - foreground time
+     */
+    void advanceClock(double time) noexcept(true);
+
+    /**
+     * @brief Charge compaction. In foreground mode whole time is returned.
+     *        In background mode compaction is put on the earliest free thread
+     *        and only stall time is returned
+     *
+     * @param[in] compactionTime - time of merge executed by 1 thread
+     *
+     * @return time which has to be added to foreground operation
+     */
+    double chargeCompaction(double compactionTime) noexcept(true);
+
+    /**
+     * @brief Get number of compactions still running at current clock
+     *
+     * @return pending compactions
+     */
+    size_t getNumPendingCompactions() const noexcept(true);
+
+    size_t getCompactionThreads() const noexcept(true)
+    {
+        return compactionThreads;
+    }
+
+    size_t getWriteStallThreshold() const noexcept(true)
+    {
+        return writeStallThreshold;
+    }
+
+    double getClock() const noexcept(true)
+    {
+        return clock;
+    }
+
+    double getBackgroundTime() const noexcept(true)
+    {
+        return backgroundTime;
+    }
+
+    long getBackgroundOperations() const noexcept(true)
+    {
+        return backgroundOperations;
+    }
+
+    double getStallTime() const noexcept(true)
+    {
+        return stallTime;
+    }
+
+    long getStallOperations() const noexcept(true)
+    {
+        return stallOperations;
+    }
+
+    void resetBackgroundTime() noexcept(true)
+    {
+        backgroundTime = 0.0;
+    }
+
+    void resetBackgroundOperations() noexcept(true)
+    {
+        backgroundOperations = 0;
+    }
+
+    void resetStallTime() noexcept(true)
+    {
+        stallTime = 0.0;
+    }
+
+    void resetStallOperations() noexcept(true)
+    {
+        stallOperations = 0;
+    }
+
+    /**
+     * @brief Reset background and stall statistics
+     *
+     */
+    void resetCounters() noexcept(true);
+
+    /**
+     * @brief Reset whole timeline and statistics
+     *
+     */
+    void resetState() noexcept(true);
+
+    /**
+     * @brief Created brief snapshot of LSMBackgroundCompaction as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of LSMBackgroundCompaction
+     */
+    std::string toString(bool oneLine = true) const noexcept(true);
+
+    /**
+     * @brief Created full snapshot of LSMBackgroundCompaction as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of LSMBackgroundCompaction
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true);
+
+    virtual ~LSMBackgroundCompaction() = default;
+    LSMBackgroundCompaction(const LSMBackgroundCompaction&) = default;
+    LSMBackgroundCompaction& operator=(const LSMBackgroundCompaction&) = default;
+    LSMBackgroundCompaction(LSMBackgroundCompaction &&) = default;
+    LSMBackgroundCompaction& operator=(LSMBackgroundCompaction &&) = default;
+};
+
+#endif
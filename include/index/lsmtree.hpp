@@ -2,6 +2,7 @@
 #define LSMTREE_HPP
 
 #include <index/dbIndex.hpp>
+#include <index/lsmBackgroundCompaction.hpp>
 #include <vector>
 
 class LSMTree : public DBIndex
@@ -94,9 +95,14 @@ protected:
 
     enum BulkloadFeatureMode bulkloadMode;
 
+    LSMBackgroundCompaction compaction;
+
+    bool zonePerLevel;
+
 private:
     double insertIntoBufferTree(size_t entries) noexcept(true);
     double deleteFromBufferTree(size_t entries) noexcept(true);
+    double chargeCompaction(double compactionTime) noexcept(true);
     void addLevel() noexcept(true);
 
     double mergeBufferTree() noexcept(true);
@@ -212,6 +218,39 @@ public:
      */
     const LSMTree::LSMLvl& getLSMLvl(size_t lvl) const noexcept(true);
 
+    /**
+     * @brief Move merges into background. Merge time is not charged to insert / delete,
+     *        writes stall only when writeStallThreshold compactions are still running.
+     *        Background and stall times / operations are pegged to INDEX_COUNTER_RW_BACKGROUND_* and INDEX_COUNTER_RW_STALL_* counters
+     *
+     * @param[in] compactionThreads - number of compaction threads, 0 turns background mode off
+     * @param[in] writeStallThreshold - how many running compactions stall next flush
+     */
+    void setBackgroundCompaction(size_t compactionThreads, size_t writeStallThreshold = 1) noexcept(true);
+
+    /**
+     * @brief Keep each level in own space of device (own zones on ZNS), so level rewrite frees whole zones.
+     *        Devices without zones ignore it
+     *
+     * @param[in] zonePerLevel - true if levels should not share zones
+     */
+    void setZonePerLevel(bool zonePerLevel) noexcept(true);
+
+    bool isZonePerLevel() const noexcept(true)
+    {
+        return zonePerLevel;
+    }
+
+    /**
+     * @brief Get background compaction model as a const reference
+     *
+     * @return const reference to LSMBackgroundCompaction
+     */
+    const LSMBackgroundCompaction& getBackgroundCompaction() const noexcept(true)
+    {
+        return compaction;
+    }
+
     /**
      * @brief Check if bulkload operation is supported
      *
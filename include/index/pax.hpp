@@ -0,0 +1,287 @@
+#ifndef PAX_HPP
+#define PAX_HPP
+
+#include <index/dbIndexColumn.hpp>
+
+/**
+ * @brief PAX (Partition Attributes Across). Records are kept in pages like in NSM,
+ *        but each page is divided into minipages, 1 minipage per column.
+ *        Minipage size is proportional to column size and aligned to word, so each column can have different capacity (in entries).
+ *        Page is full when the first minipage is full (minipage overflow).
+ *        Any column access reads whole page, but reading several columns from the same pages costs nothing more.
+ *
+ */
+class PAX : public DBIndexColumn
+{
+private:
+    static constexpr size_t minipageAlignment = 8; // minipages start at word boundary
+
+    size_t pageSize;
+    size_t pageHeaderSize; // offsets of minipages and number of entries in page
+    std::vector<size_t> minipagesSize; // in bytes
+    std::vector<size_t> minipagesOffset; // in bytes from the beginning of page
+    size_t entriesPerPage; // min of entries that fit into each minipage
+    std::vector<size_t> minipagesOverflows; // how many times minipage of column was full during insert
+
+    /**
+     * @brief Split page into minipages for columns and compute page capacity
+     *
+     */
+    void createMinipages() noexcept(true);
+
+    /**
+     * @brief Get number of pages needed for entries
+     *
+     * @param[in] numEntries - number of entries
+     * @return number of pages
+     */
+    size_t calculateNumOfPages(size_t numEntries) const noexcept(true);
+
+    /**
+     * @brief Count overflow of the smallest minipages (they limit page capacity)
+     *
+     * @param[in] pages - how many pages were filled
+     */
+    void overflowMinipages(size_t pages) noexcept(true);
+
+    double findKey() noexcept(true);
+    double insertEntriesHelper(size_t numOperations) noexcept(true);
+    double bulkloadEntriesHelper(size_t numEntries) noexcept(true);
+    double deleteEntriesHelper(size_t numOperations) noexcept(true);
+    double findEntriesHelper(const std::vector<size_t>& columnsToFetch, size_t numEntries, size_t numOperations) noexcept(true);
+public:
+    /**
+     * @brief Create PAX
+     *
+     * @param[in] name -     dbIndex name
+     * @param[in] disk - pointer to disk
+     * @param[in] columnsSize - vector with size of each columns [0] - key
+     * @param[in] pageSize - PAX page size in bytes, rounded up to disk pages when minipages cannot keep 1 entry
+     *
+     * @return PAX object
+     */
+    PAX(const char* name, Disk* disk, const std::vector<size_t>& columnsSize, size_t pageSize);
+
+    /**
+     * @brief Create PAX
+     *
+     * @param[in] disk - pointer to disk
+     * @param[in] columnsSize - vector with size of each columns [0] - key
+     * @param[in] pageSize - PAX page size in bytes, rounded up to disk pages when minipages cannot keep 1 entry
+     *
+     * @return PAX object
+     */
+    PAX(Disk* disk, const std::vector<size_t>& columnsSize, size_t pageSize);
+
+    /**
+     * @brief Create PAX with PAX page equal to disk page
+     *
+     * @param[in] disk - pointer to disk
+     * @param[in] columnsSize - vector with size of each columns [0] - key
+     *
+     * @return PAX object
+     */
+    PAX(Disk* disk, const std::vector<size_t>& columnsSize);
+
+    /**
+     * @brief Create PAX with PAX page equal to disk page
+     *
+     * @param[in] name -     dbIndex name
+     * @param[in] disk - pointer to disk
+     * @param[in] columnsSize - vector with size of each columns [0] - key
+     *
+     * @return PAX object
+     */
+    PAX(const char* name, Disk* disk, const std::vector<size_t>& columnsSize);
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new DBIndexColumn
+    *
+    * @return new DBIndexColumn
+    */
+    DBIndexColumn* clone() const noexcept(true) override
+    {
+        return new PAX(*this);
+    }
+
+    /**
+     * @brief Reset non-const values to default value
+     *
+     */
+    virtual void resetState() noexcept(true) override;
+
+    /**
+     * @brief Created brief snapshot of DBIndex as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of DBIndex
+     */
+    virtual std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of DBIndex as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of DBIndex
+     */
+    virtual std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+     /**
+     * @brief Check if bulkload operation is supported
+     *
+     * @return true if bulkload is supported
+     *         false otherwise
+     */
+    virtual bool isBulkloadSupported() const noexcept(true) override;
+
+    /**
+     * @brief Insert new entries to the DBIndexColumn
+     *        Method get number of operations but evaluates operation one by one
+     *        So there is no buffering here.
+     *        Cost of operation(3) is always equal to 3x operation(1)
+     *
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double insertEntries(size_t numOperations = 1) noexcept(true) override;
+
+    /**
+     * @brief Insert new entries to the DBIndexColumn by using bulkload
+     *        If bulkload is not supported this function does nothing and returns 0.0
+     *
+     * @param[in] numEntries - entries to insert via bulkload
+     *
+     * @return time needed to evaluates the operation
+     */
+    virtual double bulkloadEntries(size_t numEntries = 1) noexcept(true) override;
+
+    /**
+     * @brief Delete entries from the DBIndexColumn
+     *        Method get number of operations but evaluates operation one by one
+     *        So there is no buffering here.
+     *        Cost of operation(3) is always equal to 3x operation(1)
+     *
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double deleteEntries(size_t numOperations = 1) noexcept(true) override;
+
+    /**
+     * @brief Find entries from the DBIndexColumn using point search (point seek)
+     *        Method get number of operations but evaluates operation one by one
+     *        So there is no buffering here.
+     *        Cost of operation(3) is always equal to 3x operation(1)
+     *
+     * @param[in] columnsToFetch - sorted vector with number of columns
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findPointEntries(const std::vector<size_t>& columnsToFetch, size_t numOperations = 1)  noexcept(true) override;
+
+    /**
+     * @brief Find entries from the DBIndex using point search (point seek)
+     *        Method get number of operations but evaluates operation one by one
+     *        So there is no buffering here.
+     *        Cost of operation(3) is always equal to 3x operation(1)
+     *
+     * @param[in] columnsToFetch - sorted vector with number of columns
+     * @param[in] selectivity - number from range [0;1]. Find entries = selectivity * index.numEntries
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findPointEntries(const std::vector<size_t>& columnsToFetch, double selectivity, size_t numOperations = 1) noexcept(true) override;
+
+    /**
+     * @brief Find entries from the DBIndex using range search (range seek)
+     *        This method finds all contiguous entries using 1 operation (range seek)
+     *
+     * @param[in] columnsToFetch - sorted vector with number of columns
+     * @param[in] numEntries - number of entries to seek
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findRangeEntries(const std::vector<size_t>& columnsToFetch, size_t numEntries, size_t numOperations = 1)  noexcept(true) override;
+
+    /**
+     * @brief Find entries from the DBIndex using range search (range seek)
+     *        This method finds all contiguous entries using 1 operation (range seek)
+     *
+     * @param[in] columnsToFetch - sorted vector with number of columns
+     * @param[in] selectivity - number from range [0;1]. Find entries = selectivity * index.numEntries
+     * @param[in] numOperations - number of operations to evaluate one by one
+     *
+     * @return time needed to evaluates the operations
+     */
+    virtual double findRangeEntries(const std::vector<size_t>& columnsToFetch, double selectivity, size_t numOperations = 1) noexcept(true) override;
+
+    /**
+     * @brief Fake the insert of numEntries entries to create a topology in fastest way.
+     *        This should be used only to test non-empty index in workloads, so this is a total fakeout.
+     *        No low-level simulation is done here. We are simulating only insert index code without involving disk simulator.
+     *        Counters wouldnt be pegged
+     *
+     * @param[in] numEntries - how entries to insert to create a topology
+     */
+    virtual void createTopologyAfterInsert(size_t numEntries = 1) noexcept(true) override;
+
+    size_t getPageSize() const noexcept(true)
+    {
+        return pageSize;
+    }
+
+    size_t getEntriesPerPage() const noexcept(true)
+    {
+        return entriesPerPage;
+    }
+
+    /**
+     * @brief Get number of pages used by entries
+     *
+     * @return number of pages
+     */
+    size_t getNumOfPages() const noexcept(true)
+    {
+        return calculateNumOfPages(numEntries);
+    }
+
+    size_t getMinipageSize(size_t columnIndex) const noexcept(true)
+    {
+        return minipagesSize[columnIndex];
+    }
+
+    /**
+     * @brief Get how many entries of column fit into its minipage
+     *
+     * @param[in] columnIndex - column index
+     * @return minipage capacity in entries
+     */
+    size_t getMinipageCapacity(size_t columnIndex) const noexcept(true)
+    {
+        return minipagesSize[columnIndex] / columnsSize[columnIndex];
+    }
+
+    /**
+     * @brief Get how many times minipage of column was full and insert had to open new page
+     *
+     * @param[in] columnIndex - column index
+     * @return number of overflows
+     */
+    size_t getMinipageOverflows(size_t columnIndex) const noexcept(true)
+    {
+        return minipagesOverflows[columnIndex];
+    }
+
+    virtual ~PAX() = default;
+    PAX() = default;
+    PAX(const PAX&) = default;
+    PAX& operator=(const PAX&) = default;
+    PAX(PAX &&) = default;
+    PAX& operator=(PAX &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -12,6 +12,8 @@ protected:
     bool isSpecialBulkloadFeatureOn;
 
 private:
+    static constexpr double appendBitChangeRatio = MemoryController::defaultBitChangeRatio; // appended record lands in free space, unrelated to old bytes
+
     size_t calculateNumOfNodes() const noexcept(true);
     size_t calculateNumOfInners() const noexcept(true);
     size_t calculateNumOfLeaves() const noexcept(true);
@@ -19,6 +19,14 @@ private:
 
     size_t calculateHeight() const noexcept(true);
 
+    /**
+     * @brief Record is written into gap left by deleted record of the same leaf.
+     *        Keys in leaf share upper half of bytes, so only lower half of key and data bits change
+     *
+     * @return expected bit change ratio of record overwrite
+     */
+    double calculateGapBitChangeRatio() const noexcept(true);
+
     double findLeaf() noexcept(true);
 
     double insertEntriesHelper(size_t numOperations) noexcept(true);
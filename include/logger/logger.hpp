@@ -34,6 +34,20 @@ enum logger_levels
  */
 void loggerStart();
 
+/**
+ * @brief Start logging into given sinks. Messages are queued and written by background thread
+ *
+ * @param[in] sinks - sinks used by background thread only, so they do not need to be thread safe
+ */
+void loggerStart(std::vector<spdlog::sink_ptr> sinks);
+
+/**
+ * @brief Flush all queued messages and stop background logging thread.
+ *        Call it at the end of program, messages logged after this call are lost
+ *
+ */
+void loggerStop();
+
 /**
  * @brief Set logger Level to new level
  *
@@ -41,12 +55,26 @@ void loggerStart();
  */
 void loggerSetLevel(enum logger_levels level);
 
+// Arguments are evaluated only when message will be printed:
+// below LOGGER_ACTIVE_LEVEL call is discarded in compile time (arguments are only type checked),
+// above it logger level is checked in runtime before arguments (like toStringFull()) are built
+#define LOGGER_LOG_CALL(level, ...) \
+    do \
+    { \
+        if constexpr (static_cast<int>(level) >= LOGGER_ACTIVE_LEVEL) \
+        { \
+            spdlog::logger* const loggerCallPtr = spdlog::default_logger_raw(); \
+            if (loggerCallPtr != nullptr && loggerCallPtr->should_log(level)) \
+                SPDLOG_LOGGER_CALL(loggerCallPtr, level, __VA_ARGS__); \
+        } \
+    } while (0)
+
 // Use this macros to log. This macro insert function:line automaticly
-#define LOGGER_LOG_TRACE(...)    SPDLOG_LOGGER_CALL(spdlog::default_logger_raw(), spdlog::level::trace, __VA_ARGS__)
-#define LOGGER_LOG_DEBUG(...)    SPDLOG_LOGGER_CALL(spdlog::default_logger_raw(), spdlog::level::debug, __VA_ARGS__)
-#define LOGGER_LOG_INFO(...)     SPDLOG_LOGGER_CALL(spdlog::default_logger_raw(), spdlog::level::info, __VA_ARGS__)
-#define LOGGER_LOG_WARN(...)     SPDLOG_LOGGER_CALL(spdlog::default_logger_raw(), spdlog::level::warn, __VA_ARGS__)
-#define LOGGER_LOG_ERROR(...)    SPDLOG_LOGGER_CALL(spdlog::default_logger_raw(), spdlog::level::err, __VA_ARGS__)
-#define LOGGER_LOG_CRITICAL(...) SPDLOG_LOGGER_CALL(spdlog::default_logger_raw(), spdlog::level::critical, __VA_ARGS__)
+#define LOGGER_LOG_TRACE(...)    LOGGER_LOG_CALL(spdlog::level::trace, __VA_ARGS__)
+#define LOGGER_LOG_DEBUG(...)    LOGGER_LOG_CALL(spdlog::level::debug, __VA_ARGS__)
+#define LOGGER_LOG_INFO(...)     LOGGER_LOG_CALL(spdlog::level::info, __VA_ARGS__)
+#define LOGGER_LOG_WARN(...)     LOGGER_LOG_CALL(spdlog::level::warn, __VA_ARGS__)
+#define LOGGER_LOG_ERROR(...)    LOGGER_LOG_CALL(spdlog::level::err, __VA_ARGS__)
+#define LOGGER_LOG_CRITICAL(...) LOGGER_LOG_CALL(spdlog::level::critical, __VA_ARGS__)
 
 #endif
\ No newline at end of file
@@ -0,0 +1,145 @@
+#ifndef DOWNSAMPLED_SERIES_HPP
+#define DOWNSAMPLED_SERIES_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Series of values with bounded memory. Values are averaged in buckets of bucketSize values,
+ *        when there are maxPoints full buckets adjacent buckets are merged and bucketSize is doubled.
+ *        Running aggregates (sum, min, max) are exact for all values.
+ *
+ */
+class DownsampledSeries
+{
+private:
+    size_t maxPoints; // max number of full buckets, always even
+    size_t bucketSize; // how many values are in 1 full bucket
+
+    std::vector<double> points; // means of full buckets
+    double bucketSum; // sum of values in the last (not full) bucket
+    size_t bucketValues; // number of values in the last (not full) bucket
+
+    size_t numValues;
+    double sum;
+    double min;
+    double max;
+
+    /**
+     * @brief Merge adjacent buckets, so half of points is free
+     *
+     */
+    void compactPoints() noexcept(true);
+
+public:
+    /**
+     * @brief Construct a new DownsampledSeries object
+     *
+     * @param[in] maxPoints - max number of kept points, rounded up to even value (at least 2)
+     *
+     * @return DownsampledSeries object
+     */
+    DownsampledSeries(size_t maxPoints);
+
+    /**
+     * @brief Add next value to series
+     *
+     * @param[in] value - new value
+     */
+    void addValue(double value) noexcept(true);
+
+    size_t getMaxPoints() const noexcept(true)
+    {
+        return maxPoints;
+    }
+
+    size_t getBucketSize() const noexcept(true)
+    {
+        return bucketSize;
+    }
+
+    size_t getNumValues() const noexcept(true)
+    {
+        return numValues;
+    }
+
+    double getSum() const noexcept(true)
+    {
+        return sum;
+    }
+
+    double getMin() const noexcept(true)
+    {
+        return numValues == 0 ? 0.0 : min;
+    }
+
+    double getMax() const noexcept(true)
+    {
+        return numValues == 0 ? 0.0 : max;
+    }
+
+    double getMean() const noexcept(true)
+    {
+        return numValues == 0 ? 0.0 : sum / static_cast<double>(numValues);
+    }
+
+    /**
+     * @brief Get number of points, the last bucket is counted even if it is not full
+     *
+     * @return number of points
+     */
+    size_t getNumPoints() const noexcept(true)
+    {
+        return points.size() + (bucketValues > 0 ? 1 : 0);
+    }
+
+    /**
+     * @brief Get number of first value of point (from 0). Point contains values [point * bucketSize, (point + 1) * bucketSize)
+     *
+     * @param[in] point - point index
+     * @return number of first value in point
+     */
+    size_t getPointFirstValue(size_t point) const noexcept(true)
+    {
+        return point * bucketSize;
+    }
+
+    /**
+     * @brief Get mean values of buckets, the last bucket is included even if it is not full
+     *
+     * @return vector with points
+     */
+    std::vector<double> getPoints() const noexcept(true);
+
+    /**
+     * @brief Remove all values, bucketSize is 1 again
+     *
+     */
+    void reset() noexcept(true);
+
+    /**
+     * @brief Created brief snapshot of DownsampledSeries as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of DownsampledSeries
+     */
+    std::string toString(bool oneLine = true) const noexcept(true);
+
+    /**
+     * @brief Created full snapshot of DownsampledSeries as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of DownsampledSeries
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true);
+
+    ~DownsampledSeries() = default;
+    DownsampledSeries() : DownsampledSeries(2) {}
+    DownsampledSeries(const DownsampledSeries&) = default;
+    DownsampledSeries& operator=(const DownsampledSeries&) = default;
+    DownsampledSeries(DownsampledSeries &&) = default;
+    DownsampledSeries& operator=(DownsampledSeries &&) = default;
+};
+
+#endif
\ No newline at end of file
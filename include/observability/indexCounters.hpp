@@ -25,6 +25,8 @@ public:
         INDEX_COUNTER_RW_DELETE_TOTAL_TIME,
         INDEX_COUNTER_RW_PSEARCH_TOTAL_TIME,
         INDEX_COUNTER_RW_RSEARCH_TOTAL_TIME,
+        INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME, // work moved out of foreground operations (e.g. LSM compaction)
+        INDEX_COUNTER_RW_STALL_TOTAL_TIME, // foreground time spent waiting for background work
 
         //////// READ ONLY COUNTERS, BASED ON RW COUNTERS ////////
         INDEX_COUNTER_RO_INSERT_AVG_TIME,
@@ -64,6 +66,8 @@ public:
         INDEX_COUNTER_RW_DELETE_TOTAL_OPERATIONS,
         INDEX_COUNTER_RW_PSEARCH_TOTAL_OPERATIONS,
         INDEX_COUNTER_RW_RSEARCH_TOTAL_OPERATIONS,
+        INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS,
+        INDEX_COUNTER_RW_STALL_TOTAL_OPERATIONS,
 
         //////// READ ONLY COUNTERS, BASED ON RW COUNTERS ////////
         INDEX_COUNTER_RO_TOTAL_OPERATIONS,
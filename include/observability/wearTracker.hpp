@@ -0,0 +1,179 @@
+#ifndef WEAR_TRACKER_HPP
+#define WEAR_TRACKER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Wear of each unit of device (erase block of flash, memory line of PCM) kept in compact array.
+ *        Simulator does not give addresses, so writes go to the next units (circular log)
+ *        and overwrites wear contiguous units from random place of written space.
+ *        With sampling only every sampleRate-th unit is tracked, so big devices stay cheap.
+ *        Tracker without units is disabled and all operations do nothing.
+ *
+ */
+class WearTracker
+{
+private:
+    static constexpr uint32_t defaultSeed = 2137;
+
+    size_t numUnits; // units of device
+    size_t sampleRate; // every sampleRate-th unit is tracked
+    std::vector<uint32_t> unitsWear; // wear of tracked units
+
+    size_t nextUnit; // next unit for writes
+    size_t writtenUnits; // units with data
+
+    std::mt19937 rng;
+
+    /**
+     * @brief Move circular log by units
+     *
+     * @param[in] units - number of units
+     * @return first unit of moved part
+     */
+    size_t allocateNextUnits(size_t units) noexcept(true);
+
+public:
+    /**
+     * @brief Construct a new WearTracker object
+     *
+     * @param[in] numUnits - number of units of device, 0 disables tracker
+     * @param[in] sampleRate - track only every sampleRate-th unit, 1 tracks all units
+     *
+     * @return WearTracker object
+     */
+    WearTracker(size_t numUnits, size_t sampleRate = 1);
+
+    bool isEnabled() const noexcept(true)
+    {
+        return numUnits > 0;
+    }
+
+    size_t getNumUnits() const noexcept(true)
+    {
+        return numUnits;
+    }
+
+    size_t getSampleRate() const noexcept(true)
+    {
+        return sampleRate;
+    }
+
+    size_t getTrackedUnits() const noexcept(true)
+    {
+        return unitsWear.size();
+    }
+
+    size_t getWrittenUnits() const noexcept(true)
+    {
+        return writtenUnits;
+    }
+
+    /**
+     * @brief Get wear of unit
+     *
+     * @param[in] unit - unit of device
+     * @return wear of unit, 0 when unit is not tracked (sampled out)
+     */
+    size_t getUnitWear(size_t unit) const noexcept(true);
+
+    const std::vector<uint32_t>& getUnitsWear() const noexcept(true)
+    {
+        return unitsWear;
+    }
+
+    /**
+     * @brief Wear contiguous units (modulo number of units)
+     *
+     * @param[in] firstUnit - first unit
+     * @param[in] units - number of units
+     */
+    void wearUnits(size_t firstUnit, size_t units) noexcept(true);
+
+    /**
+     * @brief Put data to next units of circular log without wear (for example pages programmed into erased flash block)
+     *
+     * @param[in] units - number of units
+     * @return first unit of written part
+     */
+    size_t writeUnits(size_t units) noexcept(true);
+
+    /**
+     * @brief Choose contiguous units with data from random place of written space, they are not worn here.
+     *        Used when units are worn via remapping layer
+     *
+     * @param[in] units - number of units
+     * @return first unit, when nothing is written units are written to next units of circular log
+     */
+    size_t pickWrittenUnits(size_t units) noexcept(true);
+
+    /**
+     * @brief Put data to next units of circular log and wear them
+     *
+     * @param[in] units - number of units
+     */
+    void wearNextUnits(size_t units) noexcept(true);
+
+    /**
+     * @brief Wear contiguous units from random place of written space, used for overwrites and erases
+     *
+     * @param[in] units - number of units
+     */
+    void wearWrittenUnits(size_t units) noexcept(true);
+
+    size_t getMinWear() const noexcept(true);
+    size_t getMaxWear() const noexcept(true);
+    double getMeanWear() const noexcept(true);
+    double getStdDevWear() const noexcept(true);
+
+    /**
+     * @brief Get Gini coefficient of wear. 0 means even wear, values close to 1 mean a few units take all wear
+     *
+     * @return Gini coefficient
+     */
+    double getGiniWear() const noexcept(true);
+
+    /**
+     * @brief Estimate lifetime of device, so how long the same workload can run before the most worn unit dies
+     *
+     * @param[in] endurance - how many times unit can be worn (erase cycles, line writes)
+     * @param[in] time - time of workload which caused current wear
+     * @return lifetime in the same unit as time, infinity when nothing is worn
+     */
+    double estimateLifetime(size_t endurance, double time) const noexcept(true);
+
+    /**
+     * @brief Reset wear and circular log, device is fresh again
+     *
+     */
+    void reset() noexcept(true);
+
+    /**
+     * @brief Created brief snapshot of WearTracker as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of WearTracker
+     */
+    std::string toString(bool oneLine = true) const noexcept(true);
+
+    /**
+     * @brief Created full snapshot of WearTracker as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of WearTracker
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true);
+
+    ~WearTracker() = default;
+    WearTracker() : WearTracker(0) {}
+    WearTracker(const WearTracker&) = default;
+    WearTracker& operator=(const WearTracker&) = default;
+    WearTracker(WearTracker &&) = default;
+    WearTracker& operator=(WearTracker &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -3,6 +3,9 @@
 
 #include <observability/counterManager.hpp>
 
+#include <istream>
+#include <ostream>
+
 class WorkloadCounters
 {
 public:
@@ -38,6 +41,9 @@ public:
         WORKLOAD_AM_COUNTER_RW_LOADING_AVG_TIME,
         WORKLOAD_AM_COUNTER_RW_TOTAL_TIME,
 
+        WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_TIME,
+        WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME,
+
         WORKLOAD_COUNTER_D_MAX_ITERATOR // to iterate over enum
     };
 
@@ -68,6 +74,9 @@ public:
         WORKLOAD_AM_COUNTER_RW_LOADING_TOTAL_OPERATIONS,
         WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS,
 
+        WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS,
+        WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS,
+
         WORKLOAD_COUNTER_L_MAX_ITERATOR // to iterate over enum
     };
 
@@ -169,6 +178,22 @@ public:
      */
     void resetAllCounters() noexcept(true);
 
+    /**
+     * @brief Write values of all counters to binary stream (native byte order).
+     *        Format: numDouble (u32), double values, numLong (u32), long values
+     *
+     * @param[in, out] stream - output stream
+     */
+    void serialize(std::ostream& stream) const noexcept(true);
+
+    /**
+     * @brief Read values of all counters written by serialize, old values are replaced
+     *
+     * @param[in, out] stream - input stream
+     * @return true if values were read, false if stream is broken or has different number of counters
+     */
+    bool deserialize(std::istream& stream) noexcept(true);
+
     /**
      * @brief Created brief snapshot of WorkloadCounters as a string
      *
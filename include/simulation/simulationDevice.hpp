@@ -0,0 +1,175 @@
+#ifndef SIMULATION_DEVICE_HPP
+#define SIMULATION_DEVICE_HPP
+
+#include <simulation/simulationEngine.hpp>
+
+#include <deque>
+#include <functional>
+#include <string>
+
+class SimulationDevice
+{
+public:
+    using CompletionAction = std::function<void(double)>;
+
+    enum SimulationRequestPriority
+    {
+        SIMULATION_REQUEST_FOREGROUND,
+        SIMULATION_REQUEST_BACKGROUND,
+    };
+
+private:
+    class SimulationRequest
+    {
+    public:
+        double serviceTime;
+        double submitTime;
+        CompletionAction onComplete;
+
+        SimulationRequest(double serviceTime, double submitTime, CompletionAction onComplete)
+        : serviceTime{serviceTime}, submitTime{submitTime}, onComplete{std::move(onComplete)}
+        {
+
+        }
+    };
+
+    const char* name;
+    SimulationEngine* engine; // wont be deallocated
+
+    size_t numServers; // how many requests device can serve in parallel (channels, queues)
+    size_t busyServers;
+
+    // foreground requests are always dispatched before background ones
+    std::deque<SimulationRequest> foregroundQueue;
+    std::deque<SimulationRequest> backgroundQueue;
+
+    double busyTime;
+    double foregroundWaitTime;
+    double backgroundWaitTime;
+    size_t numForegroundRequests;
+    size_t numBackgroundRequests;
+    size_t maxQueueLength;
+
+    /**
+     * @brief Start requests from queues on free servers
+     *
+     */
+    void dispatch() noexcept(true);
+
+public:
+    /**
+     * @brief Construct a new Simulation Device object
+     *
+     * @param[in] name - device name
+     * @param[in] engine - simulation engine (wont be deallocated)
+     * @param[in] numServers - how many requests can be served in parallel
+     */
+    SimulationDevice(const char* name, SimulationEngine* engine, size_t numServers = 1);
+
+    /**
+     * @brief Construct a new Simulation Device object
+     *
+     * @param[in] engine - simulation engine (wont be deallocated)
+     * @param[in] numServers - how many requests can be served in parallel
+     */
+    SimulationDevice(SimulationEngine* engine, size_t numServers = 1);
+
+    /**
+     * @brief Submit asynchronous request. Completion action is called at finish time
+     *
+     * @param[in] serviceTime - how long request occupies 1 server
+     * @param[in] onComplete - called with finish time when request is done
+     * @param[in] priority - foreground or background request
+     */
+    void submit(double serviceTime, CompletionAction onComplete, enum SimulationRequestPriority priority = SIMULATION_REQUEST_FOREGROUND) noexcept(true);
+
+    /**
+     * @brief Reset statistics and drop queued requests
+     *
+     */
+    void resetState() noexcept(true);
+
+    const char* getName() const noexcept(true)
+    {
+        return name;
+    }
+
+    size_t getNumServers() const noexcept(true)
+    {
+        return numServers;
+    }
+
+    size_t getNumBusyServers() const noexcept(true)
+    {
+        return busyServers;
+    }
+
+    size_t getQueueLength() const noexcept(true)
+    {
+        return foregroundQueue.size() + backgroundQueue.size();
+    }
+
+    size_t getMaxQueueLength() const noexcept(true)
+    {
+        return maxQueueLength;
+    }
+
+    double getBusyTime() const noexcept(true)
+    {
+        return busyTime;
+    }
+
+    double getForegroundWaitTime() const noexcept(true)
+    {
+        return foregroundWaitTime;
+    }
+
+    double getBackgroundWaitTime() const noexcept(true)
+    {
+        return backgroundWaitTime;
+    }
+
+    size_t getNumForegroundRequests() const noexcept(true)
+    {
+        return numForegroundRequests;
+    }
+
+    size_t getNumBackgroundRequests() const noexcept(true)
+    {
+        return numBackgroundRequests;
+    }
+
+    /**
+     * @brief Get utilization of device in time window
+     *
+     * @param[in] elapsed - length of time window
+     *
+     * @return busy time / (elapsed * servers)
+     */
+    double getUtilization(double elapsed) const noexcept(true);
+
+    /**
+     * @brief Created brief snapshot of SimulationDevice as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of SimulationDevice
+     */
+    std::string toString(bool oneLine = true) const noexcept(true);
+
+    /**
+     * @brief Created full snapshot of SimulationDevice as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of SimulationDevice
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true);
+
+    // scheduled completions keep pointer to this object, so copy and move are forbidden
+    virtual ~SimulationDevice() = default;
+    SimulationDevice(const SimulationDevice&) = delete;
+    SimulationDevice& operator=(const SimulationDevice&) = delete;
+    SimulationDevice(SimulationDevice &&) = delete;
+    SimulationDevice& operator=(SimulationDevice &&) = delete;
+};
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef SIMULATION_ENGINE_HPP
+#define SIMULATION_ENGINE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <string>
+#include <vector>
+
+class SimulationEngine
+{
+public:
+    using EventAction = std::function<void()>;
+
+private:
+    class SimulationEvent
+    {
+    public:
+        double time;
+        size_t seq; // events with the same time are processed in FIFO order
+        EventAction action;
+
+        SimulationEvent(double time, size_t seq, EventAction action)
+        : time{time}, seq{seq}, action{std::move(action)}
+        {
+
+        }
+    };
+
+    class SimulationEventCompare
+    {
+    public:
+        bool operator()(const SimulationEvent& a, const SimulationEvent& b) const noexcept(true)
+        {
+            return a.time > b.time || (a.time == b.time && a.seq > b.seq);
+        }
+    };
+
+    std::priority_queue<SimulationEvent, std::vector<SimulationEvent>, SimulationEventCompare> events;
+
+    double clock;
+    size_t nextSeq;
+    size_t numProcessedEvents;
+
+public:
+    /**
+     * @brief Construct a new Simulation Engine object, clock starts at 0
+     *
+     */
+    SimulationEngine();
+
+    /**
+     * @brief Get current simulated time
+     *
+     * @return simulated time in seconds
+     */
+    double getClock() const noexcept(true)
+    {
+        return clock;
+    }
+
+    /**
+     * @brief Get number of events waiting in queue
+     *
+     * @return number of pending events
+     */
+    size_t getNumPendingEvents() const noexcept(true)
+    {
+        return events.size();
+    }
+
+    /**
+     * @brief Get number of already processed events
+     *
+     * @return number of processed events
+     */
+    size_t getNumProcessedEvents() const noexcept(true)
+    {
+        return numProcessedEvents;
+    }
+
+    /**
+     * @brief Schedule event at absolute simulated time. Time from the past is moved to now
+     *
+     * @param[in] time - absolute time of event
+     * @param[in] action - action to perform when event fires
+     */
+    void scheduleAt(double time, EventAction action) noexcept(true);
+
+    /**
+     * @brief Schedule event after delay from now
+     *
+     * @param[in] delay - delay in seconds (negative is treated as 0)
+     * @param[in] action - action to perform when event fires
+     */
+    void scheduleAfter(double delay, EventAction action) noexcept(true);
+
+    /**
+     * @brief Process the earliest event
+     *
+     * @return true if event has been processed, false if queue was empty
+     */
+    bool step() noexcept(true);
+
+    /**
+     * @brief Process events until queue is empty
+     *
+     * @return simulated time after last event
+     */
+    double run() noexcept(true);
+
+    /**
+     * @brief Process all events with time <= endTime, clock is moved to endTime
+     *
+     * @param[in] endTime - simulated time when processing stops
+     *
+     * @return simulated time after processing
+     */
+    double runUntil(double endTime) noexcept(true);
+
+    /**
+     * @brief Drop all pending events and move clock to 0
+     *
+     */
+    void resetState() noexcept(true);
+
+    /**
+     * @brief Created brief snapshot of SimulationEngine as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of SimulationEngine
+     */
+    std::string toString(bool oneLine = true) const noexcept(true);
+
+    /**
+     * @brief Created full snapshot of SimulationEngine as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of SimulationEngine
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true);
+
+    // pending events keep pointers to objects living in simulation, so copy and move are forbidden
+    virtual ~SimulationEngine() = default;
+    SimulationEngine(const SimulationEngine&) = delete;
+    SimulationEngine& operator=(const SimulationEngine&) = delete;
+    SimulationEngine(SimulationEngine &&) = delete;
+    SimulationEngine& operator=(SimulationEngine &&) = delete;
+};
+
+#endif
@@ -0,0 +1,174 @@
+#ifndef SIMULATION_WORKLOAD_HPP
+#define SIMULATION_WORKLOAD_HPP
+
+#include <simulation/simulationEngine.hpp>
+#include <simulation/simulationDevice.hpp>
+#include <workload/workloadStep.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+class SimulationWorkload
+{
+public:
+    // returns amount of background work (in seconds of device time) produced since last call
+    using BackgroundJobSource = std::function<double()>;
+
+    class SimulationResult
+    {
+    public:
+        size_t numClients;
+        size_t numOperations;
+        size_t numBackgroundJobs;
+
+        double makespan; // simulated time from start to last completion
+        double throughput; // operations per second
+
+        double avgLatency;
+        double p50Latency;
+        double p95Latency;
+        double p99Latency;
+        double maxLatency;
+
+        double backgroundTime; // device time spend on background jobs
+        double deviceUtilization;
+
+        SimulationResult();
+
+        /**
+         * @brief Created brief snapshot of SimulationResult as a string
+         *
+         * @param[in] oneLine - create string as 1 line or not? By default Yes
+         * @return brief edscription of SimulationResult
+         */
+        std::string toString(bool oneLine = true) const noexcept(true);
+
+        virtual ~SimulationResult() = default;
+        SimulationResult(const SimulationResult&) = default;
+        SimulationResult& operator=(const SimulationResult&) = default;
+        SimulationResult(SimulationResult &&) = default;
+        SimulationResult& operator=(SimulationResult &&) = default;
+    };
+
+private:
+    const char* name;
+
+    DBIndex* rIndex; // wont be deallocated
+    DBIndexColumn* cIndex; // wont be deallocated
+    bool isColumnIndexMode;
+
+    // each client executes all steps in order, one step is one request
+    std::vector<WorkloadStep*> steps;
+
+    size_t numClients;
+    size_t deviceParallelism;
+    double thinkTime;
+
+    BackgroundJobSource backgroundJobSource;
+
+    SimulationResult lastResult;
+
+    /**
+     * @brief Execute step on index and get its service demand
+     *
+     * @param[in] stepId - step to execute
+     *
+     * @return service time of request
+     */
+    double executeRequest(size_t stepId) noexcept(true);
+
+    /**
+     * @brief Get total time of background work (compactions, merges, reorganizations) done by index so far
+     *
+     * @return INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME of simulated index
+     */
+    double getIndexBackgroundTime() const noexcept(true);
+
+public:
+    /**
+     * @brief Construct a new Simulation Workload object
+     *
+     * @param[in] index - index shared by all clients (wont be deallocated)
+     * @param[in] steps - requests executed by every client in order (will be deallocated)
+     * @param[in] numClients - how many concurrent clients
+     * @param[in] deviceParallelism - how many requests device serves in parallel
+     * @param[in] thinkTime - time between completion and next request of client
+     */
+    SimulationWorkload(DBIndex* index, const std::vector<WorkloadStep*>& steps, size_t numClients, size_t deviceParallelism = 1, double thinkTime = 0.0);
+
+    /**
+     * @brief Construct a new Simulation Workload object
+     *
+     * @param[in] index - column index shared by all clients (wont be deallocated)
+     * @param[in] steps - requests executed by every client in order (will be deallocated)
+     * @param[in] numClients - how many concurrent clients
+     * @param[in] deviceParallelism - how many requests device serves in parallel
+     * @param[in] thinkTime - time between completion and next request of client
+     */
+    SimulationWorkload(DBIndexColumn* index, const std::vector<WorkloadStep*>& steps, size_t numClients, size_t deviceParallelism = 1, double thinkTime = 0.0);
+
+    /**
+     * @brief Set additional source of background jobs. Background work of index itself (LSM compaction,
+     *        FD-tree merges, adaptive merging reorganization) is submitted automatically when enabled in index.
+     *        Source is polled after every request and returned work is submitted as background request on the same device
+     *
+     * @param[in] source - function returning new background work in seconds
+     */
+    void setBackgroundJobSource(BackgroundJobSource source) noexcept(true)
+    {
+        backgroundJobSource = std::move(source);
+    }
+
+    /**
+     * @brief Run simulation of all clients
+     *
+     * @return throughput and latency statistics
+     */
+    SimulationResult run() noexcept(true);
+
+    /**
+     * @brief Get result of last run
+     *
+     * @return const SimulationResult&
+     */
+    const SimulationResult& getLastResult() const noexcept(true)
+    {
+        return lastResult;
+    }
+
+    size_t getNumClients() const noexcept(true)
+    {
+        return numClients;
+    }
+
+    size_t getNumSteps() const noexcept(true)
+    {
+        return steps.size();
+    }
+
+    /**
+     * @brief Created brief snapshot of SimulationWorkload as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of SimulationWorkload
+     */
+    std::string toString(bool oneLine = true) const noexcept(true);
+
+    /**
+     * @brief Created full snapshot of SimulationWorkload as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of SimulationWorkload
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true);
+
+    virtual ~SimulationWorkload();
+    SimulationWorkload(const SimulationWorkload&);
+    SimulationWorkload& operator=(const SimulationWorkload&);
+    SimulationWorkload() = default;
+    SimulationWorkload(SimulationWorkload &&) = default;
+    SimulationWorkload& operator=(SimulationWorkload &&) = default;
+};
+
+#endif
@@ -21,10 +21,15 @@ protected:
     std::vector<size_t> readCache;
     std::vector<size_t> writeCache;
     std::vector<std::pair<size_t, std::vector<bool>>> overwriteCache;
+    double bitChangeRatio; // expected fraction of bits changed in bytes of next overwrite requests
+    double overwriteChangedBytes; // expected bytes with changed bits in overwrite cache (as a sum of bytes * bitChangeRatio of requests)
 
     virtual size_t addrToCacheLineIndex(uintptr_t addr, size_t cacheLineSize) const noexcept(true);
 
 public:
+    static constexpr double defaultBitChangeRatio = 0.5; // new random data differs from old data on half of bits
+    static constexpr double bitmapBitChangeRatio = 1.0 / 8.0; // bitmap update flips 1 bit of overwritten byte
+
     /**
     * @brief Virtual constructor idiom implemented as clone function. This function creates new MemoryController
     *
@@ -93,6 +98,31 @@ public:
      */
     virtual double flushCache() noexcept(true);
 
+    /**
+     * @brief Pass placement hint for next requests to memory model. Cache should be flushed before
+     *
+     * @param[in] hint - placement hint
+     * @param[in] hintBytes - how many bytes are kept under this hint now
+     *
+     * @return time needed to prepare data under this hint
+     */
+    virtual double setPlacementHint(size_t hint, size_t hintBytes) noexcept(true);
+
+    /**
+     * @brief Ask device to keep data of each placement hint in separate space
+     *
+     * @param[in] isolation - true if hints should not share space
+     */
+    virtual void setPlacementIsolation(bool isolation) noexcept(true);
+
+    /**
+     * @brief Track wear of each block (memory line) of device
+     *
+     * @param[in] capacity - device capacity in bytes
+     * @param[in] sampleRate - track every sampleRate-th unit
+     */
+    virtual void enableWearTracking(size_t capacity, size_t sampleRate = 1) noexcept(true);
+
     /**
      * @brief Read contiguous bytes from memory from address @addr
      *
@@ -113,6 +143,20 @@ public:
      */
     virtual double writeBytes(uintptr_t addr, size_t bytes) noexcept(true);
 
+    /**
+     * @brief Set expected fraction of bits changed in bytes of next overwrite requests (for example 1/8 for flag in 1 byte).
+     *        Bytes of cache lines which are not requested are not changed, so during flush memory model gets
+     *        bit change ratio of whole lines (changed bytes of all requests / bytes of cached lines)
+     *
+     * @param[in] ratio - changed bits / overwritten bits, from [0, 1]
+     */
+    void setBitChangeRatio(double ratio) noexcept(true);
+
+    double getBitChangeRatio() const noexcept(true)
+    {
+        return bitChangeRatio;
+    }
+
     /**
      * @brief Overwrite contiguous bytes to memory from address @addr
      *
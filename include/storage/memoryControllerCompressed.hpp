@@ -0,0 +1,59 @@
+#ifndef MEMORY_CONTROLLER_COMPRESSED_HPP
+#define MEMORY_CONTROLLER_COMPRESSED_HPP
+
+#include <storage/memoryController.hpp>
+#include <storage/memoryModelCompressed.hpp>
+
+class MemoryControllerCompressed : public MemoryController
+{
+public:
+    MemoryControllerCompressed(MemoryModelCompressed* compressed);
+
+    MemoryController* clone() const noexcept(true) override
+    {
+        return new MemoryControllerCompressed(*this);
+    }
+
+    /**
+     * @brief Get compressed model, use it to read compression stats
+     *
+     * @return const reference to compressed model
+     */
+    const MemoryModelCompressed& getCompressedModel() const noexcept(true)
+    {
+        return dynamic_cast<const MemoryModelCompressed&>(*memoryModel);
+    }
+
+    /**
+     * @brief Set compression ratio used for data under placement hint
+     *
+     * @param[in] hint - placement hint
+     * @param[in] ratio - compressed size / raw size from range (0, 1]
+     */
+    void setHintCompressionRatio(size_t hint, double ratio) noexcept(true);
+
+    /**
+     * @brief Created brief snapshot of Memory Controller as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of Memory Controller
+     */
+    std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of Memory Controller as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of Memory Controller
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    ~MemoryControllerCompressed() = default;
+    MemoryControllerCompressed() = default;
+    MemoryControllerCompressed(const MemoryControllerCompressed&) = default;
+    MemoryControllerCompressed& operator=(const MemoryControllerCompressed&) = default;
+    MemoryControllerCompressed(MemoryControllerCompressed &&) = default;
+    MemoryControllerCompressed& operator=(MemoryControllerCompressed &&) = default;
+};
+
+#endif
\ No newline at end of file
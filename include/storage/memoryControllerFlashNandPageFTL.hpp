@@ -0,0 +1,51 @@
+#ifndef MEMORY_CONTROLLER_FLASH_NAND_PAGE_FTL_HPP
+#define MEMORY_CONTROLLER_FLASH_NAND_PAGE_FTL_HPP
+
+#include <storage/memoryController.hpp>
+#include <storage/memoryModelFlashNandPageFTL.hpp>
+
+class MemoryControllerFlashNandPageFTL : public MemoryController
+{
+public:
+    MemoryControllerFlashNandPageFTL(MemoryModelFlashNandPageFTL* flash);
+
+    MemoryController* clone() const noexcept(true) override
+    {
+        return new MemoryControllerFlashNandPageFTL(*this);
+    }
+
+    /**
+     * @brief Get page-mapping FTL model, use it to read GC stats and write amplification
+     *
+     * @return const reference to flash model
+     */
+    const MemoryModelFlashNandPageFTL& getPageFTLModel() const noexcept(true)
+    {
+        return dynamic_cast<const MemoryModelFlashNandPageFTL&>(*memoryModel);
+    }
+
+    /**
+     * @brief Created brief snapshot of Memory Controller as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of Memory Controller
+     */
+    std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of Memory Controller as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of Memory Controller
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    ~MemoryControllerFlashNandPageFTL() = default;
+    MemoryControllerFlashNandPageFTL() = default;
+    MemoryControllerFlashNandPageFTL(const MemoryControllerFlashNandPageFTL&) = default;
+    MemoryControllerFlashNandPageFTL& operator=(const MemoryControllerFlashNandPageFTL&) = default;
+    MemoryControllerFlashNandPageFTL(MemoryControllerFlashNandPageFTL &&) = default;
+    MemoryControllerFlashNandPageFTL& operator=(MemoryControllerFlashNandPageFTL &&) = default;
+};
+
+#endif
\ No newline at end of file
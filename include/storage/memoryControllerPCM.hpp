@@ -14,6 +14,36 @@ public:
         return new MemoryControllerPCM(*this);
     }
 
+    /**
+     * @brief Flush cache and turn on wear leveling layer (start-gap or security refresh) of PCM.
+     *        Logical lines are redirected to physical lines and extra line moves are charged to writes
+     *
+     * @param[in] wearLeveling - wear leveling algorithm
+     * @param[in] capacity - capacity in bytes covered by wear leveling
+     * @param[in] interval - line writes between leveling moves
+     * @return time of flush
+     */
+    double setWearLeveling(enum MemoryModelPCM::WearLeveling wearLeveling, size_t capacity, size_t interval = 100) noexcept(true);
+
+    /**
+     * @brief Flush cache and choose how PCM overwrites lines.
+     *        In differential modes bit change ratio of flushed lines is computed from ratios given to overwriteBytes
+     *
+     * @param[in] differentialWrite - differential write mode
+     * @return time of flush
+     */
+    double setDifferentialWrite(enum MemoryModelPCM::DifferentialWrite differentialWrite) noexcept(true);
+
+    /**
+     * @brief Get PCM model, use it to read wear leveling stats
+     *
+     * @return const reference to PCM model
+     */
+    const MemoryModelPCM& getPCMModel() const noexcept(true)
+    {
+        return dynamic_cast<const MemoryModelPCM&>(*memoryModel);
+    }
+
     /**
      * @brief Created brief snapshot of Memory Controller as a string
      *
@@ -0,0 +1,51 @@
+#ifndef MEMORY_CONTROLLER_STRIPED_HPP
+#define MEMORY_CONTROLLER_STRIPED_HPP
+
+#include <storage/memoryController.hpp>
+#include <storage/memoryModelStriped.hpp>
+
+class MemoryControllerStriped : public MemoryController
+{
+public:
+    MemoryControllerStriped(MemoryModelStriped* striped);
+
+    MemoryController* clone() const noexcept(true) override
+    {
+        return new MemoryControllerStriped(*this);
+    }
+
+    /**
+     * @brief Get model of striped devices, use it to read stats of each member
+     *
+     * @return const reference to striped model
+     */
+    const MemoryModelStriped& getStripedModel() const noexcept(true)
+    {
+        return dynamic_cast<const MemoryModelStriped&>(*memoryModel);
+    }
+
+    /**
+     * @brief Created brief snapshot of Memory Controller as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of Memory Controller
+     */
+    std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of Memory Controller as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of Memory Controller
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    ~MemoryControllerStriped() = default;
+    MemoryControllerStriped() = default;
+    MemoryControllerStriped(const MemoryControllerStriped&) = default;
+    MemoryControllerStriped& operator=(const MemoryControllerStriped&) = default;
+    MemoryControllerStriped(MemoryControllerStriped &&) = default;
+    MemoryControllerStriped& operator=(MemoryControllerStriped &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,51 @@
+#ifndef MEMORY_CONTROLLER_TIERED_HPP
+#define MEMORY_CONTROLLER_TIERED_HPP
+
+#include <storage/memoryController.hpp>
+#include <storage/memoryModelTiered.hpp>
+
+class MemoryControllerTiered : public MemoryController
+{
+public:
+    MemoryControllerTiered(MemoryModelTiered* tiered);
+
+    MemoryController* clone() const noexcept(true) override
+    {
+        return new MemoryControllerTiered(*this);
+    }
+
+    /**
+     * @brief Get model of tiered devices, use it to read stats of each tier
+     *
+     * @return const reference to tiered model
+     */
+    const MemoryModelTiered& getTieredModel() const noexcept(true)
+    {
+        return dynamic_cast<const MemoryModelTiered&>(*memoryModel);
+    }
+
+    /**
+     * @brief Created brief snapshot of Memory Controller as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of Memory Controller
+     */
+    std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of Memory Controller as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of Memory Controller
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    ~MemoryControllerTiered() = default;
+    MemoryControllerTiered() = default;
+    MemoryControllerTiered(const MemoryControllerTiered&) = default;
+    MemoryControllerTiered& operator=(const MemoryControllerTiered&) = default;
+    MemoryControllerTiered(MemoryControllerTiered &&) = default;
+    MemoryControllerTiered& operator=(MemoryControllerTiered &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,51 @@
+#ifndef MEMORY_CONTROLLER_ZNS_HPP
+#define MEMORY_CONTROLLER_ZNS_HPP
+
+#include <storage/memoryController.hpp>
+#include <storage/memoryModelZNS.hpp>
+
+class MemoryControllerZNS : public MemoryController
+{
+public:
+    MemoryControllerZNS(MemoryModelZNS* zns);
+
+    MemoryController* clone() const noexcept(true) override
+    {
+        return new MemoryControllerZNS(*this);
+    }
+
+    /**
+     * @brief Get ZNS model, use it to read zone state, GC stats and write amplification
+     *
+     * @return const reference to ZNS model
+     */
+    const MemoryModelZNS& getZNSModel() const noexcept(true)
+    {
+        return dynamic_cast<const MemoryModelZNS&>(*memoryModel);
+    }
+
+    /**
+     * @brief Created brief snapshot of Memory Controller as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of Memory Controller
+     */
+    std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of Memory Controller as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of Memory Controller
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    ~MemoryControllerZNS() = default;
+    MemoryControllerZNS() = default;
+    MemoryControllerZNS(const MemoryControllerZNS&) = default;
+    MemoryControllerZNS& operator=(const MemoryControllerZNS&) = default;
+    MemoryControllerZNS(MemoryControllerZNS &&) = default;
+    MemoryControllerZNS& operator=(MemoryControllerZNS &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -1,6 +1,8 @@
 #ifndef MEMORY_MODEL_HPP
 #define MEMORY_MODEL_HPP
 
+#include <observability/wearTracker.hpp>
+
 #include <cstddef>
 #include <string>
 
@@ -11,6 +13,7 @@ protected:
     size_t pageSize; // page is a minimum number of bytes for writing and reading
     size_t blockSize; // block is a set of pages in case of block devices or just 0 in case of byte addresed devices
     size_t touchedBytes; // how many bytes we programmed? This is called memory wear-out
+    WearTracker wearTracker; // wear of each block (or memory line), disabled by default
 
     size_t bytesToPages(size_t bytes) const noexcept(true);
     size_t bytesToBlocks(size_t bytes) const noexcept(true);
@@ -50,6 +53,33 @@ public:
      */
     virtual double readBytes(size_t bytes) noexcept(true) = 0;
 
+    /**
+     * @brief Set placement hint (data group, for example LSM level or column) for next requests.
+     *        Plain devices ignore hints
+     *
+     * @param[in] hint - placement hint
+     * @param[in] hintBytes - how many bytes are kept under this hint now
+     *
+     * @return time needed to prepare data under this hint
+     */
+    virtual double setPlacementHint(size_t hint, size_t hintBytes) noexcept(true);
+
+    /**
+     * @brief Ask device to keep data of each placement hint in separate space (for example own zones).
+     *        Plain devices ignore it
+     *
+     * @param[in] isolation - true if hints should not share space
+     */
+    virtual void setPlacementIsolation(bool isolation) noexcept(true);
+
+    /**
+     * @brief Set expected fraction of bits changed in lines of next overwrites.
+     *        Devices which program only changed bits (PCM with differential writes) use it, others ignore it
+     *
+     * @param[in] ratio - changed bits / overwritten bits, from [0, 1]
+     */
+    virtual void setOverwriteBitChangeRatio(double ratio) noexcept(true);
+
     /**
      * @brief Get model name
      *
@@ -94,6 +124,25 @@ public:
         return touchedBytes;
     }
 
+    /**
+     * @brief Track wear of each block (memory line for byte addressed devices). Tracking is disabled by default.
+     *        Use sampleRate > 1 for big devices, only every sampleRate-th unit is kept then
+     *
+     * @param[in] capacity - device capacity in bytes
+     * @param[in] sampleRate - track every sampleRate-th unit
+     */
+    virtual void enableWearTracking(size_t capacity, size_t sampleRate = 1) noexcept(true);
+
+    /**
+     * @brief Get wear of each block (memory line)
+     *
+     * @return wear tracker
+     */
+    virtual const WearTracker& getWearTracker() const noexcept(true)
+    {
+        return wearTracker;
+    }
+
     /**
      * @brief Created brief snapshot of MemoryModel as a string
      *
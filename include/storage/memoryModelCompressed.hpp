@@ -0,0 +1,252 @@
+#ifndef MEMORY_MODEL_COMPRESSED_HPP
+#define MEMORY_MODEL_COMPRESSED_HPP
+
+#include <storage/memoryModel.hpp>
+
+#include <map>
+#include <memory>
+
+/**
+ * @brief Device with transparent block compression.
+ *        Pages are compressed before write and decompressed after read, so device sees fewer bytes (less time and wear-out)
+ *        but each request costs CPU time for compression / decompression.
+ *        Compression ratio can be set per placement hint (for example per column), other hints use default ratio.
+ *
+ */
+class MemoryModelCompressed : public MemoryModel
+{
+private:
+    std::unique_ptr<MemoryModel> model;
+
+    double compressionRatio; // compressed size / raw size, used for hints without own ratio
+    std::map<size_t, double> hintsCompressionRatio;
+    double currentCompressionRatio;
+
+    double compressThroughput; // raw bytes per second, 0 means free compression
+    double decompressThroughput; // raw bytes per second, 0 means free decompression
+
+    size_t rawBytes; // bytes before compression (written and overwritten)
+    size_t compressedBytes; // bytes after compression (written and overwritten)
+    double compressTime;
+    double decompressTime;
+
+    /**
+     * @brief Clamp ratio to (0, 1]
+     *
+     * @param[in] ratio - compression ratio
+     * @return valid compression ratio
+     */
+    static double validRatio(double ratio) noexcept(true);
+
+    /**
+     * @brief Get size of bytes after compression with current ratio
+     *
+     * @param[in] bytes - raw bytes
+     * @return compressed bytes
+     */
+    size_t compressBytes(size_t bytes) const noexcept(true);
+
+    /**
+     * @brief Get CPU time for processing bytes
+     *
+     * @param[in] bytes - raw bytes
+     * @param[in] throughput - raw bytes per second, 0 means no CPU cost
+     * @return time
+     */
+    static double cpuTime(size_t bytes, double throughput) noexcept(true);
+
+public:
+    /**
+     * @brief Construct a new MemoryModelCompressed object
+     *
+     * @param[in] model - model of device, MemoryModelCompressed keeps a clone of it
+     * @param[in] compressionRatio - compressed size / raw size from range (0, 1]
+     * @param[in] compressThroughput - compression speed in raw bytes per second, 0 means free compression
+     * @param[in] decompressThroughput - decompression speed in raw bytes per second, 0 means free decompression
+     *
+     * @return MemoryModelCompressed object
+     */
+    MemoryModelCompressed(const MemoryModel& model, double compressionRatio, double compressThroughput, double decompressThroughput);
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new MemoryModel
+    *
+    * @return new MemoryModel
+    */
+    virtual MemoryModel* clone() const noexcept(true) override
+    {
+        return new MemoryModelCompressed(*this);
+    }
+
+    /**
+     * @brief Set compression ratio used for data under placement hint
+     *
+     * @param[in] hint - placement hint
+     * @param[in] ratio - compressed size / raw size from range (0, 1]
+     */
+    void setHintCompressionRatio(size_t hint, double ratio) noexcept(true);
+
+    /**
+     * @brief Switch compression ratio to the one of hint
+     *
+     * @param[in] hint - placement hint
+     * @param[in] hintBytes - how many bytes are kept under this hint now
+     * @return time, always 0
+     */
+    double setPlacementHint(size_t hint, size_t hintBytes) noexcept(true) override;
+
+    /**
+     * @brief Pass placement isolation to compressed device
+     *
+     * @param[in] isolation - true if hints should not share space
+     */
+    void setPlacementIsolation(bool isolation) noexcept(true) override;
+
+    /**
+     * @brief Pass bit change ratio of next overwrites to compressed device
+     *
+     * @param[in] ratio - changed bits / overwritten bits, from [0, 1]
+     */
+    void setOverwriteBitChangeRatio(double ratio) noexcept(true) override;
+
+    /**
+     * @brief Track wear of compressed device
+     *
+     * @param[in] capacity - capacity of compressed device in bytes
+     * @param[in] sampleRate - track every sampleRate-th unit
+     */
+    void enableWearTracking(size_t capacity, size_t sampleRate = 1) noexcept(true) override;
+
+    /**
+     * @brief Get wear of compressed device
+     *
+     * @return wear tracker of compressed device
+     */
+    const WearTracker& getWearTracker() const noexcept(true) override
+    {
+        return model->getWearTracker();
+    }
+
+    /**
+     * @brief Write contiguous bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to write
+     *
+     * @return time required for operation
+     */
+    double writeBytes(size_t bytes) noexcept(true) override;
+
+    /**
+     * @brief Write contiguous bytes on top of existing bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to overwrite
+     *
+     * @return time required for operation
+     */
+    double overwriteBytes(size_t bytes) noexcept(true) override;
+
+    /**
+     * @brief Write contiguous bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to write
+     *
+     * @return time required for operation
+     */
+    double readBytes(size_t bytes) noexcept(true) override;
+
+    /**
+     * @brief Get Memory Wear-out of device, bytes are counted after compression
+     *
+     * @return wear-out in bytes
+     */
+    size_t getMemoryWearOut() const noexcept(true) override
+    {
+        return model->getMemoryWearOut();
+    }
+
+    const MemoryModel& getModel() const noexcept(true)
+    {
+        return *model;
+    }
+
+    double getCompressionRatio() const noexcept(true)
+    {
+        return compressionRatio;
+    }
+
+    /**
+     * @brief Get compression ratio used for hint
+     *
+     * @param[in] hint - placement hint
+     * @return compression ratio of hint or default one
+     */
+    double getHintCompressionRatio(size_t hint) const noexcept(true);
+
+    double getCurrentCompressionRatio() const noexcept(true)
+    {
+        return currentCompressionRatio;
+    }
+
+    double getCompressThroughput() const noexcept(true)
+    {
+        return compressThroughput;
+    }
+
+    double getDecompressThroughput() const noexcept(true)
+    {
+        return decompressThroughput;
+    }
+
+    size_t getRawBytes() const noexcept(true)
+    {
+        return rawBytes;
+    }
+
+    size_t getCompressedBytes() const noexcept(true)
+    {
+        return compressedBytes;
+    }
+
+    double getCompressTime() const noexcept(true)
+    {
+        return compressTime;
+    }
+
+    double getDecompressTime() const noexcept(true)
+    {
+        return decompressTime;
+    }
+
+    /**
+     * @brief Reset non-const values to default value
+     *
+     */
+    void resetState() noexcept(true) override;
+
+    /**
+     * @brief Created brief snapshot of MemoryModel as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of MemoryModel
+     */
+    std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of MemoryModel as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of MemoryModel
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    virtual ~MemoryModelCompressed() = default;
+    MemoryModelCompressed() = default;
+
+    MemoryModelCompressed(const MemoryModelCompressed&);
+    MemoryModelCompressed& operator=(const MemoryModelCompressed&);
+
+    MemoryModelCompressed(MemoryModelCompressed &&) = default;
+    MemoryModelCompressed& operator=(MemoryModelCompressed &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,392 @@
+#ifndef MEMORY_MODEL_FLASH_NAND_PAGE_FTL_HPP
+#define MEMORY_MODEL_FLASH_NAND_PAGE_FTL_HPP
+
+#include <storage/memoryModel.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Flash Nand with page-mapping FTL.
+ *        Each logical page is mapped to physical page, new data always goes to free pages of active block.
+ *        When free blocks run out, garbage collector chooses victim block, copies its valid pages and erases it.
+ *        Copied pages are extra writes, so write amplification and wear-out are visible.
+ *        Simulator does not give addresses, so writes allocate next logical pages (circular log)
+ *        and overwrites modify contiguous logical pages from random place of written space.
+ *
+ */
+class MemoryModelFlashNandPageFTL : public MemoryModel
+{
+public:
+    enum VictimPolicy
+    {
+        VICTIM_POLICY_GREEDY, // block with the fewest valid pages
+        VICTIM_POLICY_COST_BENEFIT, // block with the best (1 - u) * age / 2u ratio
+    };
+
+private:
+    static constexpr uint32_t invalidPage = UINT32_MAX;
+    static constexpr uint32_t invalidBlock = UINT32_MAX;
+    static constexpr size_t gcFreeBlocksTreshold = 2; // host writes wait for GC when free blocks drop below this
+    static constexpr uint32_t defaultSeed = 2137;
+
+    enum BlockState : uint8_t
+    {
+        BLOCK_STATE_FREE,
+        BLOCK_STATE_ACTIVE,
+        BLOCK_STATE_SEALED,
+        BLOCK_STATE_CLEANING, // valid pages are being copied out, block is not a victim and not free yet
+    };
+
+    size_t pagesInBlock; // how many pages are in 1 block
+
+    double readTime; // in s per page
+    double writeTime; // in s per page
+    double eraseTime; // in s per block
+
+    size_t logicalPages; // pages visible for host
+    size_t physicalBlocks; // blocks with over-provisioning and GC reserve
+    double overProvisioning; // extra physical space as a fraction of logical space
+    enum VictimPolicy victimPolicy;
+    size_t wearLevelingTreshold; // max difference of erase counters before cold block is moved, 0 turns wear leveling off
+
+    // mapping is kept in flat arrays, 8 bytes per page
+    std::vector<uint32_t> logicalToPhysical;
+    std::vector<uint32_t> physicalToLogical;
+
+    std::vector<uint32_t> blockValidPages;
+    std::vector<uint32_t> blockEraseCount;
+    std::vector<uint32_t> blockSealTime; // value of sealClock when block was filled
+    std::vector<BlockState> blockState;
+
+    // sealed blocks grouped by number of valid pages, as intrusive doubly linked lists
+    std::vector<uint32_t> bucketHead;
+    std::vector<uint32_t> blockNext;
+    std::vector<uint32_t> blockPrev;
+
+    std::deque<uint32_t> freeBlocks; // FIFO, so erased blocks wait before reuse
+    uint32_t activeBlock;
+    size_t activeBlockPages; // pages already programmed in active block
+
+    size_t nextLogicalPage; // next logical page for writes
+    size_t writtenLogicalPages; // logical pages with data
+    uint32_t sealClock;
+    uint32_t minEraseCount;
+    bool duringGarbageCollection;
+
+    size_t hostWrittenPages;
+    size_t gcWrittenPages;
+    size_t wearLevelingWrittenPages;
+    size_t erasedBlocks;
+    size_t gcOperations;
+    size_t wearLevelingOperations;
+
+    std::mt19937 rng;
+
+    void bucketInsert(uint32_t block) noexcept(true);
+    void bucketRemove(uint32_t block) noexcept(true);
+
+    double readPages(size_t pages) const noexcept(true);
+
+    /**
+     * @brief Mark physical page as not valid (logical page has newer copy or block is cleaned)
+     *
+     * @param[in] physicalPage - physical page
+     */
+    void invalidatePage(uint32_t physicalPage) noexcept(true);
+
+    /**
+     * @brief Seal active block, so it can be chosen as a GC victim
+     *
+     */
+    void sealActiveBlock() noexcept(true);
+
+    /**
+     * @brief Take free block as a new active block. Host writes can trigger garbage collection here
+     *
+     * @return time of garbage collection
+     */
+    double openBlock() noexcept(true);
+
+    /**
+     * @brief Write logical page to next free page of active block
+     *
+     * @param[in] logicalPage - logical page
+     * @return time
+     */
+    double programPage(uint32_t logicalPage) noexcept(true);
+
+    /**
+     * @brief Choose victim for garbage collection
+     *
+     * @return victim block or invalidBlock when no block can give free pages
+     */
+    uint32_t selectVictim() const noexcept(true);
+
+    /**
+     * @brief Check if valid pages of block have a destination: room in active block or a free block
+     *
+     * @param[in] block - sealed block
+     * @return true if block can be cleaned without losing pages
+     */
+    bool isDestinationReserved(uint32_t block) const noexcept(true);
+
+    /**
+     * @brief Copy valid pages of sealed block to active block and erase block.
+     *        Block is released only when destination for its valid pages is reserved
+     *
+     * @param[in] block - sealed block
+     * @param[out] copiedPages - how many valid pages were copied
+     * @return time
+     */
+    double cleanBlock(uint32_t block, size_t& copiedPages) noexcept(true);
+
+    /**
+     * @brief Erase block and put it into free blocks
+     *
+     * @param[in] block - block to erase
+     * @return time
+     */
+    double eraseBlock(uint32_t block) noexcept(true);
+
+    /**
+     * @brief Clean one victim block
+     *
+     * @return time, 0 if there is no victim
+     */
+    double collectGarbage() noexcept(true);
+
+    /**
+     * @brief Static wear leveling, move data from the least erased block when erase counters differ too much
+     *
+     * @param[in] erasedBlock - block erased by garbage collector
+     * @return time
+     */
+    double levelWear(uint32_t erasedBlock) noexcept(true);
+
+    /**
+     * @brief Write pages of logical pages from range [firstLogicalPage, firstLogicalPage + pages) modulo range
+     *
+     * @param[in] firstLogicalPage - first logical page
+     * @param[in] pages - number of pages
+     * @param[in] range - logical pages wrap around this value
+     * @return time
+     */
+    double writeLogicalPages(size_t firstLogicalPage, size_t pages, size_t range) noexcept(true);
+
+    /**
+     * @brief Prepare empty device
+     *
+     */
+    void formatDevice() noexcept(true);
+
+public:
+    virtual MemoryModel* clone() const noexcept(true) override
+    {
+        return new MemoryModelFlashNandPageFTL(*this);
+    }
+
+    virtual ~MemoryModelFlashNandPageFTL() = default;
+    MemoryModelFlashNandPageFTL() = default;
+    MemoryModelFlashNandPageFTL(const MemoryModelFlashNandPageFTL&) = default;
+    MemoryModelFlashNandPageFTL& operator=(const MemoryModelFlashNandPageFTL&) = default;
+    MemoryModelFlashNandPageFTL(MemoryModelFlashNandPageFTL &&) = default;
+    MemoryModelFlashNandPageFTL& operator=(MemoryModelFlashNandPageFTL &&) = default;
+
+    /**
+     * @brief Construct a new MemoryModelFlashNandPageFTL object
+     *
+     * @param[in] modelName - model name
+     * @param[in] pageSize - page size in bytes
+     * @param[in] blockSize - block size in bytes
+     * @param[in] readTime - page read time in s
+     * @param[in] writeTime - page program time in s
+     * @param[in] eraseTime - block erase time in s
+     * @param[in] capacity - logical capacity in bytes (visible for host)
+     * @param[in] overProvisioning - extra physical space as a fraction of capacity (for example 0.07)
+     * @param[in] victimPolicy - how garbage collector chooses victim block
+     * @param[in] wearLevelingTreshold - max difference of erase counters, 0 turns static wear leveling off
+     *
+     * @return MemoryModelFlashNandPageFTL object
+     */
+    MemoryModelFlashNandPageFTL(const char* modelName,
+                                size_t pageSize,
+                                size_t blockSize,
+                                double readTime,
+                                double writeTime,
+                                double eraseTime,
+                                size_t capacity,
+                                double overProvisioning,
+                                enum VictimPolicy victimPolicy = VICTIM_POLICY_GREEDY,
+                                size_t wearLevelingTreshold = 0);
+
+    /**
+     * @brief Write contiguous bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to write
+     *
+     * @return time required for operation
+     */
+    double writeBytes(size_t bytes) noexcept(true) override;
+
+    /**
+     * @brief Write contiguous bytes on top of existing bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to overwrite
+     *
+     * @return time required for operation
+     */
+    double overwriteBytes(size_t bytes) noexcept(true) override;
+
+    /**
+     * @brief Write contiguous bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to write
+     *
+     * @return time required for operation
+     */
+    double readBytes(size_t bytes) noexcept(true) override;
+
+    size_t getLogicalPages() const noexcept(true)
+    {
+        return logicalPages;
+    }
+
+    size_t getPhysicalBlocks() const noexcept(true)
+    {
+        return physicalBlocks;
+    }
+
+    double getOverProvisioning() const noexcept(true)
+    {
+        return overProvisioning;
+    }
+
+    enum VictimPolicy getVictimPolicy() const noexcept(true)
+    {
+        return victimPolicy;
+    }
+
+    size_t getWearLevelingTreshold() const noexcept(true)
+    {
+        return wearLevelingTreshold;
+    }
+
+    size_t getFreeBlocks() const noexcept(true)
+    {
+        return freeBlocks.size();
+    }
+
+    size_t getWrittenLogicalPages() const noexcept(true)
+    {
+        return writtenLogicalPages;
+    }
+
+    size_t getHostWrittenPages() const noexcept(true)
+    {
+        return hostWrittenPages;
+    }
+
+    size_t getGCWrittenPages() const noexcept(true)
+    {
+        return gcWrittenPages;
+    }
+
+    size_t getWearLevelingWrittenPages() const noexcept(true)
+    {
+        return wearLevelingWrittenPages;
+    }
+
+    size_t getErasedBlocks() const noexcept(true)
+    {
+        return erasedBlocks;
+    }
+
+    size_t getGCOperations() const noexcept(true)
+    {
+        return gcOperations;
+    }
+
+    size_t getWearLevelingOperations() const noexcept(true)
+    {
+        return wearLevelingOperations;
+    }
+
+    /**
+     * @brief Get write amplification (all programmed pages / pages written by host)
+     *
+     * @return write amplification, 1.0 when nothing was written
+     */
+    double getWriteAmplification() const noexcept(true);
+
+    size_t getBlockEraseCount(size_t block) const noexcept(true)
+    {
+        return blockEraseCount[block];
+    }
+
+    size_t getBlockValidPages(size_t block) const noexcept(true)
+    {
+        return blockValidPages[block];
+    }
+
+    /**
+     * @brief Get the highest erase counter of all blocks
+     *
+     * @return max erase count
+     */
+    size_t getMaxEraseCount() const noexcept(true);
+
+    /**
+     * @brief Get the lowest erase counter of all blocks
+     *
+     * @return min erase count
+     */
+    size_t getMinEraseCount() const noexcept(true);
+
+    /**
+     * @brief Reset non-const values to default value (device is empty again)
+     *
+     */
+    void resetState() noexcept(true) override;
+
+    /**
+     * @brief Created brief snapshot of MemoryModel as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of MemoryModel
+     */
+    std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of MemoryModel as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of MemoryModel
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+};
+
+class MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D : public MemoryModelFlashNandPageFTL
+{
+public:
+    MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D()
+    : MemoryModelFlashNandPageFTL("FlashNandPageFTL:samsungK9F1G08U0D", 2048, 2048 * 32, 35.0 / 1000000.0, 250.0 / 1000000.0, (2000.0 * 32) / 1000000.0, 128 * 1024 * 1024, 0.07)
+    {
+
+    }
+
+    MemoryModel* clone() const noexcept(true) override
+    {
+        return new MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D(*this);
+    }
+
+    ~MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D() = default;
+    MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D(const MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D&) = default;
+    MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D& operator=(const MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D&) = default;
+    MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D(MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D &&) = default;
+    MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D& operator=(MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -3,15 +3,118 @@
 
 #include <storage/memoryModel.hpp>
 
+#include <cstdint>
+#include <random>
+
 class MemoryModelPCM : public MemoryModel
 {
+public:
+    enum WearLeveling
+    {
+        WEAR_LEVELING_NONE,
+        WEAR_LEVELING_START_GAP, // lines rotate by 1 gap line, gap moves every interval writes
+        WEAR_LEVELING_SECURITY_REFRESH, // lines are XOR-ed with random key, key is refreshed line by line every interval writes
+    };
+
+    enum DifferentialWrite
+    {
+        DIFFERENTIAL_WRITE_NONE, // all bits of overwritten line are programmed
+        DIFFERENTIAL_WRITE_DCW, // data-comparison write, old line is read and only changed bits are programmed
+        DIFFERENTIAL_WRITE_FLIP_N_WRITE, // as DCW, but line is stored inverted when more than half of bits would change
+    };
+
 private:
+    static constexpr uint32_t defaultSeed = 2137;
+
     double readTime;
     double writeTime;
 
+    enum DifferentialWrite differentialWrite;
+    double overwriteBitChangeRatio; // changed bits / bits of lines in next overwrites
+    double programmedLinesCarry; // fraction of line left from previous differential overwrites, lines are worn as whole
+
+    enum WearLeveling wearLeveling;
+    size_t levelingLines; // logical lines covered by wear leveling
+    size_t levelingInterval; // line writes between 2 leveling moves
+    size_t writesSinceLevelingMove;
+
+    // start-gap, physical lines are [0, levelingLines], 1 of them is a gap
+    size_t startLine;
+    size_t gapLine;
+
+    // security refresh
+    size_t previousKey;
+    size_t currentKey;
+    size_t refreshPointer; // logical lines below it are remapped with current key
+
+    size_t levelingMoves;
+    size_t levelingWrittenLines;
+    double levelingTime;
+
+    std::mt19937 rng;
+
     double readMemLines(size_t memLines) const noexcept(true);
     double writeMemLines(size_t memLines) noexcept(true);
 
+    /**
+     * @brief Map logical line to physical line with current wear leveling state
+     *
+     * @param[in] logicalLine - logical line
+     * @return physical line
+     */
+    size_t remapLine(size_t logicalLine) const noexcept(true);
+
+    /**
+     * @brief Wear physical lines of contiguous logical lines
+     *
+     * @param[in] firstLogicalLine - first logical line
+     * @param[in] memLines - number of lines
+     */
+    void wearLines(size_t firstLogicalLine, size_t memLines) noexcept(true);
+
+    /**
+     * @brief Copy line to another physical line, it is an extra write caused by wear leveling
+     *
+     * @param[in] physicalLine - destination physical line
+     * @return time
+     */
+    double moveLine(size_t physicalLine) noexcept(true);
+
+    /**
+     * @brief Start-gap move, line before gap is copied into the gap
+     *
+     * @return time
+     */
+    double moveGap() noexcept(true);
+
+    /**
+     * @brief Security refresh move, line under refresh pointer is swapped with its partner for new key
+     *
+     * @return time
+     */
+    double refreshLine() noexcept(true);
+
+    /**
+     * @brief Count line writes and do wear leveling moves for them
+     *
+     * @param[in] memLines - written lines
+     * @return time of moves
+     */
+    double levelWear(size_t memLines) noexcept(true);
+
+    /**
+     * @brief Get fraction of bits programmed during overwrite with current differential write mode
+     *
+     * @return programmed bits / overwritten bits
+     */
+    double getProgrammedBitsRatio() const noexcept(true);
+
+    /**
+     * @brief Start wear leveling from identity mapping
+     *
+     */
+    void resetWearLeveling() noexcept(true);
+
 public:
     virtual MemoryModel* clone() const noexcept(true) override
     {
@@ -48,6 +151,13 @@ public:
      */
     double overwriteBytes(size_t bytes) noexcept(true) override;
 
+    /**
+     * @brief Set expected fraction of bits changed in lines of next overwrites, used only by differential writes
+     *
+     * @param[in] ratio - changed bits / overwritten bits, from [0, 1]
+     */
+    void setOverwriteBitChangeRatio(double ratio) noexcept(true) override;
+
     /**
      * @brief Write contiguous bytes to MemoryModel
      *
@@ -57,6 +167,82 @@ public:
      */
     double readBytes(size_t bytes) noexcept(true) override;
 
+    /**
+     * @brief Turn on wear leveling (remapping of logical lines to physical lines).
+     *        Every interval line writes one leveling move is done, it costs 1 line read and 1 line write (2 of each for security refresh swap).
+     *        Security refresh needs power of 2 lines, so lines are rounded down
+     *
+     * @param[in] wearLeveling - wear leveling algorithm
+     * @param[in] capacity - capacity in bytes covered by wear leveling
+     * @param[in] interval - line writes between leveling moves (100 is used by start-gap)
+     */
+    void setWearLeveling(enum WearLeveling wearLeveling, size_t capacity, size_t interval = 100) noexcept(true);
+
+    enum WearLeveling getWearLeveling() const noexcept(true)
+    {
+        return wearLeveling;
+    }
+
+    /**
+     * @brief Choose how lines are overwritten. In differential modes line is read before write
+     *        and write time and wear are scaled by fraction of programmed bits
+     *
+     * @param[in] differentialWrite - differential write mode
+     */
+    void setDifferentialWrite(enum DifferentialWrite differentialWrite) noexcept(true);
+
+    enum DifferentialWrite getDifferentialWrite() const noexcept(true)
+    {
+        return differentialWrite;
+    }
+
+    double getOverwriteBitChangeRatio() const noexcept(true)
+    {
+        return overwriteBitChangeRatio;
+    }
+
+    size_t getLevelingLines() const noexcept(true)
+    {
+        return levelingLines;
+    }
+
+    size_t getLevelingInterval() const noexcept(true)
+    {
+        return levelingInterval;
+    }
+
+    size_t getLevelingMoves() const noexcept(true)
+    {
+        return levelingMoves;
+    }
+
+    size_t getLevelingWrittenLines() const noexcept(true)
+    {
+        return levelingWrittenLines;
+    }
+
+    double getLevelingTime() const noexcept(true)
+    {
+        return levelingTime;
+    }
+
+    /**
+     * @brief Get physical line of logical line (for no wear leveling it is the same line)
+     *
+     * @param[in] logicalLine - logical line
+     * @return physical line
+     */
+    size_t getPhysicalLine(size_t logicalLine) const noexcept(true)
+    {
+        return remapLine(logicalLine);
+    }
+
+    /**
+     * @brief Reset non-const values to default value, wear leveling starts from identity mapping
+     *
+     */
+    void resetState() noexcept(true) override;
+
     /**
      * @brief Created brief snapshot of MemoryModel as a string
      *
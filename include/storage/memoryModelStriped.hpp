@@ -0,0 +1,250 @@
+#ifndef MEMORY_MODEL_STRIPED_HPP
+#define MEMORY_MODEL_STRIPED_HPP
+
+#include <storage/memoryModel.hpp>
+#include <observability/memoryCounters.hpp>
+
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Several identical devices seen as one (RAID-0 or RAID-10).
+ *        Each request is split by stripe unit and pieces are sent to member devices in parallel,
+ *        so time of request is the time of the slowest member.
+ *        In mirrored mode every member has a copy, writes go to both copies and reads are spread over all copies.
+ *
+ */
+class MemoryModelStriped : public MemoryModel
+{
+private:
+    std::vector<std::unique_ptr<MemoryModel>> members; // [0, numDisks) primary devices, [numDisks, 2 * numDisks) mirrors
+    std::vector<MemoryCounters> membersCounters;
+
+    size_t numDisks; // stripe width (number of devices without mirrors)
+    size_t stripeUnit; // bytes written to 1 device before going to the next one
+    bool mirrored;
+
+    size_t nextStripe; // stripe unit where next request starts
+
+    /**
+     * @brief Split request into bytes for each member. Stripe units are given round robin starting from nextStripe
+     *
+     * @param[in] bytes - bytes in request
+     * @param[in] width - number of members which take part in request
+     * @return bytes for each member
+     */
+    std::vector<size_t> splitBytes(size_t bytes, size_t width) noexcept(true);
+
+    /**
+     * @brief Execute part of the request on member and peg member counters
+     *
+     * @param[in] member - member index
+     * @param[in] bytes - bytes for this member
+     * @param[in] op - read / write / overwrite function of MemoryModel
+     * @param[in] timeId - time counter for this operation
+     * @param[in] bytesId - bytes counter for this operation
+     * @param[in] opsId - operations counter for this operation
+     * @return time
+     */
+    double accessMember(size_t member,
+                        size_t bytes,
+                        double (MemoryModel::*op)(size_t),
+                        enum MemoryCounters::MemoryCountersD timeId,
+                        enum MemoryCounters::MemoryCountersL bytesId,
+                        enum MemoryCounters::MemoryCountersL opsId) noexcept(true);
+
+    /**
+     * @brief Write or overwrite bytes on all devices. Mirrored pieces are written to both copies
+     *
+     * @param[in] bytes - bytes to write
+     * @param[in] op - write or overwrite function of MemoryModel
+     * @param[in] timeId - time counter for this operation
+     * @param[in] bytesId - bytes counter for this operation
+     * @param[in] opsId - operations counter for this operation
+     * @return time of the slowest member
+     */
+    double writeStriped(size_t bytes,
+                        double (MemoryModel::*op)(size_t),
+                        enum MemoryCounters::MemoryCountersD timeId,
+                        enum MemoryCounters::MemoryCountersL bytesId,
+                        enum MemoryCounters::MemoryCountersL opsId) noexcept(true);
+
+public:
+    /**
+     * @brief Construct a new MemoryModelStriped object
+     *
+     * @param[in] model - model of single device, each member is a clone of this model
+     * @param[in] numDisks - number of devices in stripe
+     * @param[in] stripeUnit - stripe unit in bytes, rounded up to page size
+     * @param[in] isMirrored - keep mirror of each device (RAID-10)
+     *
+     * @return MemoryModelStriped object
+     */
+    MemoryModelStriped(const MemoryModel& model, size_t numDisks, size_t stripeUnit, bool isMirrored = false);
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new MemoryModel
+    *
+    * @return new MemoryModel
+    */
+    virtual MemoryModel* clone() const noexcept(true) override
+    {
+        return new MemoryModelStriped(*this);
+    }
+
+    /**
+     * @brief Write contiguous bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to write
+     *
+     * @return time required for operation
+     */
+    double writeBytes(size_t bytes) noexcept(true) override;
+
+    /**
+     * @brief Write contiguous bytes on top of existing bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to overwrite
+     *
+     * @return time required for operation
+     */
+    double overwriteBytes(size_t bytes) noexcept(true) override;
+
+    /**
+     * @brief Write contiguous bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to write
+     *
+     * @return time required for operation
+     */
+    double readBytes(size_t bytes) noexcept(true) override;
+
+    /**
+     * @brief Get Memory Wear-out as a sum of wear-out of all members
+     *
+     * @return wear-out in bytes
+     */
+    size_t getMemoryWearOut() const noexcept(true) override;
+
+    /**
+     * @brief Pass bit change ratio of next overwrites to each member
+     *
+     * @param[in] ratio - changed bits / overwritten bits, from [0, 1]
+     */
+    void setOverwriteBitChangeRatio(double ratio) noexcept(true) override;
+
+    /**
+     * @brief Track wear of each member, every member keeps capacity / numDisks bytes.
+     *        Wear of member is available via getMember(member).getWearTracker()
+     *
+     * @param[in] capacity - capacity of whole stripe in bytes
+     * @param[in] sampleRate - track every sampleRate-th unit
+     */
+    void enableWearTracking(size_t capacity, size_t sampleRate = 1) noexcept(true) override;
+
+    size_t getNumDisks() const noexcept(true)
+    {
+        return numDisks;
+    }
+
+    size_t getStripeUnit() const noexcept(true)
+    {
+        return stripeUnit;
+    }
+
+    bool isMirrored() const noexcept(true)
+    {
+        return mirrored;
+    }
+
+    /**
+     * @brief Get number of member devices (with mirrors)
+     *
+     * @return number of members
+     */
+    size_t getNumMembers() const noexcept(true)
+    {
+        return members.size();
+    }
+
+    /**
+     * @brief Get member device model, mirror of member i has index i + numDisks
+     *
+     * @param[in] member - member index
+     * @return const reference to member model
+     */
+    const MemoryModel& getMember(size_t member) const noexcept(true)
+    {
+        return *members[member];
+    }
+
+    /**
+     * @brief Get Memory Wear-out of single member
+     *
+     * @param[in] member - member index
+     * @return wear-out in bytes
+     */
+    size_t getMemberWearOut(size_t member) const noexcept(true)
+    {
+        return members[member]->getMemoryWearOut();
+    }
+
+    /**
+     * @brief Get Counter of single member as a pair
+     *
+     * @param[in] member - member index
+     * @param[in] counterId - Counter ID
+     *
+     * @return Counter pair with name and value
+     */
+    std::pair<std::string, double> getMemberCounter(size_t member, enum MemoryCounters::MemoryCountersD counterId) const noexcept(true)
+    {
+        return membersCounters[member].getCounter(counterId);
+    }
+
+    /**
+     * @brief Get Counter of single member as a pair
+     *
+     * @param[in] member - member index
+     * @param[in] counterId - Counter ID
+     *
+     * @return Counter pair with name and value
+     */
+    std::pair<std::string, long> getMemberCounter(size_t member, enum MemoryCounters::MemoryCountersL counterId) const noexcept(true)
+    {
+        return membersCounters[member].getCounter(counterId);
+    }
+
+    /**
+     * @brief Reset non-const values to default value
+     *
+     */
+    void resetState() noexcept(true) override;
+
+    /**
+     * @brief Created brief snapshot of MemoryModel as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of MemoryModel
+     */
+    std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of MemoryModel as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of MemoryModel
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    virtual ~MemoryModelStriped() = default;
+    MemoryModelStriped() = default;
+
+    MemoryModelStriped(const MemoryModelStriped&);
+    MemoryModelStriped& operator=(const MemoryModelStriped&);
+
+    MemoryModelStriped(MemoryModelStriped &&) = default;
+    MemoryModelStriped& operator=(MemoryModelStriped &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,386 @@
+#ifndef MEMORY_MODEL_TIERED_HPP
+#define MEMORY_MODEL_TIERED_HPP
+
+#include <storage/memoryModel.hpp>
+#include <observability/memoryCounters.hpp>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Several devices of different types seen as one (tier 0 is the fastest one).
+ *        Data is grouped by placement hints (for example LSM levels), each hint lives on exactly one tier.
+ *        Migration policy decides where hint should live, tier capacity is enforced by demoting the least accessed hints.
+ *        Moving hint to another tier costs reading it from old tier and writing it to the new one.
+ *
+ */
+class MemoryModelTiered : public MemoryModel
+{
+public:
+    class MigrationPolicy
+    {
+    public:
+        /**
+        * @brief Virtual constructor idiom implemented as clone function. This function creates new MigrationPolicy
+        *
+        * @return new MigrationPolicy
+        */
+        virtual MigrationPolicy* clone() const noexcept(true) = 0;
+
+        /**
+         * @brief Choose tier for hint
+         *
+         * @param[in] hint - placement hint
+         * @param[in] accesses - accesses to hint since its last migration
+         * @param[in] currentTier - tier where hint lives now, numTiers for new hints
+         * @param[in] numTiers - number of tiers
+         * @return tier where hint should live
+         */
+        virtual size_t getTier(size_t hint, size_t accesses, size_t currentTier, size_t numTiers) const noexcept(true) = 0;
+
+        /**
+         * @brief Created brief snapshot of MigrationPolicy as a string
+         *
+         * @param[in] oneLine - create string as 1 line or not? By default Yes
+         * @return brief edscription of MigrationPolicy
+         */
+        virtual std::string toString(bool oneLine = true) const noexcept(true) = 0;
+
+        virtual ~MigrationPolicy() = default;
+        MigrationPolicy() = default;
+        MigrationPolicy(const MigrationPolicy&) = default;
+        MigrationPolicy& operator=(const MigrationPolicy&) = default;
+        MigrationPolicy(MigrationPolicy &&) = default;
+        MigrationPolicy& operator=(MigrationPolicy &&) = default;
+    };
+
+    /**
+     * @brief Static placement by hint value. Hints [0, hintsPerTier) go to tier 0, next hintsPerTier hints to tier 1 and so on.
+     *        For LSM-like indexes it keeps upper levels on fast tiers
+     *
+     */
+    class LevelPolicy : public MigrationPolicy
+    {
+    private:
+        size_t hintsPerTier;
+
+    public:
+        LevelPolicy(size_t hintsPerTier);
+
+        virtual MigrationPolicy* clone() const noexcept(true) override
+        {
+            return new LevelPolicy(*this);
+        }
+
+        virtual size_t getTier(size_t hint, size_t accesses, size_t currentTier, size_t numTiers) const noexcept(true) override;
+
+        virtual std::string toString(bool oneLine = true) const noexcept(true) override;
+
+        virtual ~LevelPolicy() = default;
+        LevelPolicy(const LevelPolicy&) = default;
+        LevelPolicy& operator=(const LevelPolicy&) = default;
+        LevelPolicy(LevelPolicy &&) = default;
+        LevelPolicy& operator=(LevelPolicy &&) = default;
+    };
+
+    /**
+     * @brief New hints start on the slowest tier. Hint accessed accessThreshold times is promoted 1 tier up
+     *
+     */
+    class PromotionPolicy : public MigrationPolicy
+    {
+    private:
+        size_t accessThreshold;
+
+    public:
+        PromotionPolicy(size_t accessThreshold);
+
+        virtual MigrationPolicy* clone() const noexcept(true) override
+        {
+            return new PromotionPolicy(*this);
+        }
+
+        virtual size_t getTier(size_t hint, size_t accesses, size_t currentTier, size_t numTiers) const noexcept(true) override;
+
+        virtual std::string toString(bool oneLine = true) const noexcept(true) override;
+
+        virtual ~PromotionPolicy() = default;
+        PromotionPolicy(const PromotionPolicy&) = default;
+        PromotionPolicy& operator=(const PromotionPolicy&) = default;
+        PromotionPolicy(PromotionPolicy &&) = default;
+        PromotionPolicy& operator=(PromotionPolicy &&) = default;
+    };
+
+private:
+    struct HintState
+    {
+        size_t tier;
+        size_t accesses; // since last migration
+        size_t bytes; // bytes kept under this hint, as reported by setPlacementHint
+        size_t writtenBytes; // bytes written under this hint since last setPlacementHint
+
+        // index which never reports hint size still fills tier by its writes
+        size_t getBytes() const noexcept(true)
+        {
+            return std::max(bytes, writtenBytes);
+        }
+    };
+
+    std::vector<std::unique_ptr<MemoryModel>> tiers;
+    std::vector<size_t> tiersCapacity; // in bytes, 0 means unlimited
+    std::vector<MemoryCounters> tiersCounters;
+    std::unique_ptr<MigrationPolicy> policy;
+
+    std::map<size_t, HintState> hints;
+    size_t currentHint;
+
+    double migrationTime;
+    size_t migrationBytes;
+    size_t migrationOperations;
+
+    /**
+     * @brief Get state of hint, new hint is placed by policy
+     *
+     * @param[in] hint - placement hint
+     * @return hint state
+     */
+    HintState& getHintState(size_t hint) noexcept(true);
+
+    /**
+     * @brief Move hint to another tier. Hint bytes are read from old tier and written to the new one
+     *
+     * @param[in] hint - placement hint
+     * @param[in] tier - destination tier
+     * @return time
+     */
+    double migrateHint(size_t hint, size_t tier) noexcept(true);
+
+    /**
+     * @brief Demote the least accessed hints from tier (and tiers below) until tiers fit in capacity
+     *
+     * @param[in] tier - first tier to check
+     * @param[in] hint - hint which is accessed now, it is demoted as the last one
+     * @return time
+     */
+    double enforceCapacity(size_t tier, size_t hint) noexcept(true);
+
+    /**
+     * @brief Execute request on tier of current hint and peg tier counters
+     *
+     * @param[in] bytes - bytes in request
+     * @param[in] op - read / write / overwrite function of MemoryModel
+     * @param[in] timeId - time counter for this operation
+     * @param[in] bytesId - bytes counter for this operation
+     * @param[in] opsId - operations counter for this operation
+     * @return time
+     */
+    double accessTier(size_t bytes,
+                      double (MemoryModel::*op)(size_t),
+                      enum MemoryCounters::MemoryCountersD timeId,
+                      enum MemoryCounters::MemoryCountersL bytesId,
+                      enum MemoryCounters::MemoryCountersL opsId) noexcept(true);
+
+public:
+    /**
+     * @brief Construct a new MemoryModelTiered object
+     *
+     * @param[in] tiers - models of tiers from the fastest one, each tier is a clone of given model
+     * @param[in] tiersCapacity - capacity of each tier in bytes, 0 means unlimited. Missing values are treated as 0
+     * @param[in] policy - migration policy, MemoryModelTiered takes ownership
+     *
+     * @return MemoryModelTiered object
+     */
+    MemoryModelTiered(const std::vector<const MemoryModel*>& tiers, const std::vector<size_t>& tiersCapacity, MigrationPolicy* policy);
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new MemoryModel
+    *
+    * @return new MemoryModel
+    */
+    virtual MemoryModel* clone() const noexcept(true) override
+    {
+        return new MemoryModelTiered(*this);
+    }
+
+    /**
+     * @brief Set placement hint for next requests. Policy can move hint to another tier here
+     *
+     * @param[in] hint - placement hint
+     * @param[in] hintBytes - how many bytes are kept under this hint now, resets bytes accounted by writes
+     * @return time of migrations
+     */
+    double setPlacementHint(size_t hint, size_t hintBytes) noexcept(true) override;
+
+    /**
+     * @brief Write contiguous bytes to MemoryModel. Written bytes are accounted to current hint,
+     *        so tier capacity is enforced also for indexes which do not report hint size
+     *
+     * @param[in] bytes - bytes to write
+     *
+     * @return time required for operation (with migrations caused by full tier)
+     */
+    double writeBytes(size_t bytes) noexcept(true) override;
+
+    /**
+     * @brief Write contiguous bytes on top of existing bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to overwrite
+     *
+     * @return time required for operation
+     */
+    double overwriteBytes(size_t bytes) noexcept(true) override;
+
+    /**
+     * @brief Write contiguous bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to write
+     *
+     * @return time required for operation
+     */
+    double readBytes(size_t bytes) noexcept(true) override;
+
+    /**
+     * @brief Get Memory Wear-out as a sum of wear-out of all tiers
+     *
+     * @return wear-out in bytes
+     */
+    size_t getMemoryWearOut() const noexcept(true) override;
+
+    /**
+     * @brief Pass bit change ratio of next overwrites to each tier
+     *
+     * @param[in] ratio - changed bits / overwritten bits, from [0, 1]
+     */
+    void setOverwriteBitChangeRatio(double ratio) noexcept(true) override;
+
+    /**
+     * @brief Track wear of each tier. Tier with limited capacity uses its own capacity.
+     *        Wear of tier is available via getTier(tier).getWearTracker()
+     *
+     * @param[in] capacity - capacity of tiers without limit in bytes
+     * @param[in] sampleRate - track every sampleRate-th unit
+     */
+    void enableWearTracking(size_t capacity, size_t sampleRate = 1) noexcept(true) override;
+
+    size_t getNumTiers() const noexcept(true)
+    {
+        return tiers.size();
+    }
+
+    const MemoryModel& getTier(size_t tier) const noexcept(true)
+    {
+        return *tiers[tier];
+    }
+
+    size_t getTierCapacity(size_t tier) const noexcept(true)
+    {
+        return tiersCapacity[tier];
+    }
+
+    size_t getTierWearOut(size_t tier) const noexcept(true)
+    {
+        return tiers[tier]->getMemoryWearOut();
+    }
+
+    /**
+     * @brief Get bytes of all hints placed on tier
+     *
+     * @param[in] tier - tier index
+     * @return used bytes
+     */
+    size_t getTierUsedBytes(size_t tier) const noexcept(true);
+
+    /**
+     * @brief Get tier where hint lives
+     *
+     * @param[in] hint - placement hint
+     * @return tier index or number of tiers when hint was not used yet
+     */
+    size_t getHintTier(size_t hint) const noexcept(true);
+
+    size_t getCurrentHint() const noexcept(true)
+    {
+        return currentHint;
+    }
+
+    const MigrationPolicy& getPolicy() const noexcept(true)
+    {
+        return *policy;
+    }
+
+    double getMigrationTime() const noexcept(true)
+    {
+        return migrationTime;
+    }
+
+    size_t getMigrationBytes() const noexcept(true)
+    {
+        return migrationBytes;
+    }
+
+    size_t getMigrationOperations() const noexcept(true)
+    {
+        return migrationOperations;
+    }
+
+    /**
+     * @brief Get Counter of single tier as a pair
+     *
+     * @param[in] tier - tier index
+     * @param[in] counterId - Counter ID
+     *
+     * @return Counter pair with name and value
+     */
+    std::pair<std::string, double> getTierCounter(size_t tier, enum MemoryCounters::MemoryCountersD counterId) const noexcept(true)
+    {
+        return tiersCounters[tier].getCounter(counterId);
+    }
+
+    /**
+     * @brief Get Counter of single tier as a pair
+     *
+     * @param[in] tier - tier index
+     * @param[in] counterId - Counter ID
+     *
+     * @return Counter pair with name and value
+     */
+    std::pair<std::string, long> getTierCounter(size_t tier, enum MemoryCounters::MemoryCountersL counterId) const noexcept(true)
+    {
+        return tiersCounters[tier].getCounter(counterId);
+    }
+
+    /**
+     * @brief Reset non-const values to default value
+     *
+     */
+    void resetState() noexcept(true) override;
+
+    /**
+     * @brief Created brief snapshot of MemoryModel as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of MemoryModel
+     */
+    std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of MemoryModel as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of MemoryModel
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    virtual ~MemoryModelTiered() = default;
+    MemoryModelTiered() = default;
+
+    MemoryModelTiered(const MemoryModelTiered&);
+    MemoryModelTiered& operator=(const MemoryModelTiered&);
+
+    MemoryModelTiered(MemoryModelTiered &&) = default;
+    MemoryModelTiered& operator=(MemoryModelTiered &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,391 @@
+#ifndef MEMORY_MODEL_ZNS_HPP
+#define MEMORY_MODEL_ZNS_HPP
+
+#include <storage/memoryModel.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <vector>
+
+/**
+ * @brief Zoned Namespace (ZNS) SSD. Device is split into zones, each zone can only be appended at its write pointer
+ *        and space is reclaimed by resetting the whole zone. Host decides which data goes to which zone.
+ *        Data is grouped by placement hints (for example LSM levels), hintBytes of setPlacementHint tells how much data of hint is still alive,
+ *        so the oldest data of hint becomes invalid. Zone without valid data is reset immediately.
+ *        With placement isolation each hint gets own zones, otherwise all hints share zones
+ *        and host-managed GC has to copy valid data out of victim zone before the reset.
+ *        Overwrite in place is not allowed, so overwritten data is appended and the old copy becomes invalid.
+ *
+ */
+class MemoryModelZNS : public MemoryModel
+{
+public:
+    enum ZoneState : uint8_t
+    {
+        ZONE_STATE_EMPTY,
+        ZONE_STATE_OPEN,
+        ZONE_STATE_FULL,
+    };
+
+private:
+    static constexpr size_t invalidZone = SIZE_MAX;
+    static constexpr size_t sharedStream = 0; // all hints without isolation
+    static constexpr size_t gcStream = SIZE_MAX; // GC writes never mix with host writes
+    static constexpr size_t gcEmptyZonesTreshold = 1; // empty zone kept for GC
+
+    struct Extent
+    {
+        size_t zone;
+        size_t pages;
+    };
+
+    size_t zonePages; // how many pages are in 1 zone
+
+    double readTime; // in s per page
+    double writeTime; // in s per page
+    double zoneResetTime; // in s per zone
+
+    size_t zoneSize; // in bytes
+    size_t numZones;
+    size_t maxOpenZones;
+    bool placementIsolation;
+
+    std::vector<size_t> zoneWritePointer; // in pages
+    std::vector<size_t> zoneValidPages;
+    std::vector<size_t> zoneResetCount;
+    std::vector<size_t> zoneLastWrite; // value of writeClock, the least recently written open zone is finished first
+    std::vector<ZoneState> zoneState;
+
+    std::deque<size_t> emptyZones; // FIFO, so reset zones wait before reuse
+    std::map<size_t, size_t> openZones; // stream -> zone
+
+    std::map<size_t, std::deque<Extent>> hintExtents; // data of hint from the oldest one
+    std::map<size_t, size_t> hintValidPages;
+    size_t currentHint;
+
+    size_t writeClock;
+    bool duringGarbageCollection;
+
+    size_t hostWrittenPages;
+    size_t gcWrittenPages;
+    size_t gcOperations;
+    size_t zoneResets;
+    size_t finishedZones; // zones closed before they were full due to open zones limit
+    size_t wastedPages; // pages lost in finished zones
+
+    double readPages(size_t pages) const noexcept(true);
+
+    /**
+     * @brief Get stream (set of open zones) for hint
+     *
+     * @param[in] hint - placement hint
+     * @return stream
+     */
+    size_t getStream(size_t hint) const noexcept(true)
+    {
+        return placementIsolation ? hint : sharedStream;
+    }
+
+    /**
+     * @brief Reset zone, zone is empty again
+     *
+     * @param[in] zone - zone index
+     * @return time
+     */
+    double resetZone(size_t zone) noexcept(true);
+
+    /**
+     * @brief Mark zone as full and close it. Zone without valid data is reset
+     *
+     * @param[in] zone - zone index
+     * @return time
+     */
+    double finishZone(size_t zone) noexcept(true);
+
+    /**
+     * @brief Get open zone with free pages for stream. Open zones limit and GC are handled here
+     *
+     * @param[in] stream - stream
+     * @param[out] zone - zone index, invalidZone when device is full
+     * @return time
+     */
+    double getOpenZone(size_t stream, size_t& zone) noexcept(true);
+
+    /**
+     * @brief Append pages to zones of stream
+     *
+     * @param[in] stream - stream
+     * @param[in] pages - pages to append
+     * @param[out] extents - where pages were written
+     * @return time
+     */
+    double appendPages(size_t stream, size_t pages, std::vector<Extent>& extents) noexcept(true);
+
+    /**
+     * @brief Append host pages under hint
+     *
+     * @param[in] hint - placement hint
+     * @param[in] pages - pages to append
+     * @return time
+     */
+    double appendHintPages(size_t hint, size_t pages) noexcept(true);
+
+    /**
+     * @brief Invalidate the oldest pages of hint, so hint keeps at most validPages pages
+     *
+     * @param[in] hint - placement hint
+     * @param[in] validPages - valid pages which stay under hint
+     * @return time of zone resets
+     */
+    double invalidateHintPages(size_t hint, size_t validPages) noexcept(true);
+
+    /**
+     * @brief Host-managed GC. Valid data from full zone with the fewest valid pages is copied and zone is reset
+     *
+     * @return time
+     */
+    double collectGarbage() noexcept(true);
+
+    /**
+     * @brief Prepare empty device
+     *
+     */
+    void formatDevice() noexcept(true);
+
+public:
+    virtual MemoryModel* clone() const noexcept(true) override
+    {
+        return new MemoryModelZNS(*this);
+    }
+
+    virtual ~MemoryModelZNS() = default;
+    MemoryModelZNS() = default;
+    MemoryModelZNS(const MemoryModelZNS&) = default;
+    MemoryModelZNS& operator=(const MemoryModelZNS&) = default;
+    MemoryModelZNS(MemoryModelZNS &&) = default;
+    MemoryModelZNS& operator=(MemoryModelZNS &&) = default;
+
+    /**
+     * @brief Construct a new MemoryModelZNS object
+     *
+     * @param[in] modelName - model name
+     * @param[in] pageSize - page size in bytes
+     * @param[in] blockSize - block size in bytes
+     * @param[in] readTime - page read time in s
+     * @param[in] writeTime - page program time in s
+     * @param[in] zoneResetTime - zone reset time in s
+     * @param[in] zoneSize - zone size in bytes, rounded up to page size
+     * @param[in] numZones - number of zones
+     * @param[in] maxOpenZones - how many zones can be open at the same time
+     *
+     * @return MemoryModelZNS object
+     */
+    MemoryModelZNS(const char* modelName,
+                   size_t pageSize,
+                   size_t blockSize,
+                   double readTime,
+                   double writeTime,
+                   double zoneResetTime,
+                   size_t zoneSize,
+                   size_t numZones,
+                   size_t maxOpenZones);
+
+    /**
+     * @brief Set placement hint for next requests. Oldest data of hint above hintBytes becomes invalid
+     *
+     * @param[in] hint - placement hint
+     * @param[in] hintBytes - how many bytes are kept under this hint now
+     * @return time of zone resets
+     */
+    double setPlacementHint(size_t hint, size_t hintBytes) noexcept(true) override;
+
+    /**
+     * @brief Turn on / off own zones for each placement hint
+     *
+     * @param[in] isolation - true if each hint should get own zones
+     */
+    void setPlacementIsolation(bool isolation) noexcept(true) override;
+
+    /**
+     * @brief Write contiguous bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to write
+     *
+     * @return time required for operation
+     */
+    double writeBytes(size_t bytes) noexcept(true) override;
+
+    /**
+     * @brief Write contiguous bytes on top of existing bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to overwrite
+     *
+     * @return time required for operation
+     */
+    double overwriteBytes(size_t bytes) noexcept(true) override;
+
+    /**
+     * @brief Write contiguous bytes to MemoryModel
+     *
+     * @param[in] bytes - bytes to write
+     *
+     * @return time required for operation
+     */
+    double readBytes(size_t bytes) noexcept(true) override;
+
+    size_t getZoneSize() const noexcept(true)
+    {
+        return zoneSize;
+    }
+
+    size_t getNumZones() const noexcept(true)
+    {
+        return numZones;
+    }
+
+    size_t getMaxOpenZones() const noexcept(true)
+    {
+        return maxOpenZones;
+    }
+
+    bool isPlacementIsolation() const noexcept(true)
+    {
+        return placementIsolation;
+    }
+
+    size_t getOpenZones() const noexcept(true)
+    {
+        return openZones.size();
+    }
+
+    size_t getEmptyZones() const noexcept(true)
+    {
+        return emptyZones.size();
+    }
+
+    enum ZoneState getZoneState(size_t zone) const noexcept(true)
+    {
+        return zoneState[zone];
+    }
+
+    /**
+     * @brief Get write pointer of zone
+     *
+     * @param[in] zone - zone index
+     * @return offset of write pointer from zone start in bytes
+     */
+    size_t getZoneWritePointer(size_t zone) const noexcept(true)
+    {
+        return zoneWritePointer[zone] * pageSize;
+    }
+
+    size_t getZoneValidPages(size_t zone) const noexcept(true)
+    {
+        return zoneValidPages[zone];
+    }
+
+    size_t getZoneResetCount(size_t zone) const noexcept(true)
+    {
+        return zoneResetCount[zone];
+    }
+
+    /**
+     * @brief Get valid pages of hint
+     *
+     * @param[in] hint - placement hint
+     * @return valid pages
+     */
+    size_t getHintValidPages(size_t hint) const noexcept(true);
+
+    size_t getCurrentHint() const noexcept(true)
+    {
+        return currentHint;
+    }
+
+    size_t getHostWrittenPages() const noexcept(true)
+    {
+        return hostWrittenPages;
+    }
+
+    size_t getGCWrittenPages() const noexcept(true)
+    {
+        return gcWrittenPages;
+    }
+
+    size_t getGCOperations() const noexcept(true)
+    {
+        return gcOperations;
+    }
+
+    size_t getZoneResets() const noexcept(true)
+    {
+        return zoneResets;
+    }
+
+    size_t getFinishedZones() const noexcept(true)
+    {
+        return finishedZones;
+    }
+
+    size_t getWastedPages() const noexcept(true)
+    {
+        return wastedPages;
+    }
+
+    /**
+     * @brief Get write amplification, (host + GC) writes / host writes
+     *
+     * @return write amplification, 1.0 when nothing was written
+     */
+    double getWriteAmplification() const noexcept(true);
+
+    /**
+     * @brief Reset non-const values to default value (device is empty again)
+     *
+     */
+    void resetState() noexcept(true) override;
+
+    /**
+     * @brief Created brief snapshot of MemoryModel as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of MemoryModel
+     */
+    std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of MemoryModel as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of MemoryModel
+     */
+    std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+};
+
+/**
+ * @brief ZNS device built from the same chips as FlashNand presets, zone has 16 blocks and reset erases all of them
+ *
+ */
+class MemoryModelZNS_SamsungK9F1G08U0D : public MemoryModelZNS
+{
+public:
+    MemoryModelZNS_SamsungK9F1G08U0D()
+    : MemoryModelZNS("ZNS:samsungK9F1G08U0D", 2048, 2048 * 32, 35.0 / 1000000.0, 250.0 / 1000000.0, (2000.0 * 32 * 16) / 1000000.0, 2048 * 32 * 16, 128, 14)
+    {
+
+    }
+
+    MemoryModel* clone() const noexcept(true) override
+    {
+        return new MemoryModelZNS_SamsungK9F1G08U0D(*this);
+    }
+
+    ~MemoryModelZNS_SamsungK9F1G08U0D() = default;
+    MemoryModelZNS_SamsungK9F1G08U0D(const MemoryModelZNS_SamsungK9F1G08U0D&) = default;
+    MemoryModelZNS_SamsungK9F1G08U0D& operator=(const MemoryModelZNS_SamsungK9F1G08U0D&) = default;
+    MemoryModelZNS_SamsungK9F1G08U0D(MemoryModelZNS_SamsungK9F1G08U0D &&) = default;
+    MemoryModelZNS_SamsungK9F1G08U0D& operator=(MemoryModelZNS_SamsungK9F1G08U0D &&) = default;
+};
+
+#endif
\ No newline at end of file
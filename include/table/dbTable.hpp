@@ -12,6 +12,7 @@ protected:
     size_t sizeData;
     size_t sizeRecord;
     std::vector<size_t> columnSize;
+    std::vector<double> columnCompressionRatio; // compressed size / raw size of each column
 public:
 
     /**
@@ -29,6 +30,15 @@ public:
      */
     DBTable(const char* name, std::vector<size_t> columnSize);
 
+    /**
+     * @brief Construct a new DBTable with compressibility hint of each column
+     *
+     * @param[in] name - table name
+     * @param[in] columnSize - vector with colum sizes, columnSize[0] - keySize
+     * @param[in] columnCompressionRatio - vector with compressed size / raw size of each column, missing columns are not compressible (1.0)
+     */
+    DBTable(const char* name, std::vector<size_t> columnSize, std::vector<double> columnCompressionRatio);
+
     /**
      * @brief Virtual constructor idiom
      *
@@ -93,6 +103,27 @@ public:
         return columnSize[column];
     }
 
+    /**
+     * @brief Get the Column Compression Ratio object
+     *
+     * @param[in] column - column index [0] - key
+     * @return compressed size / raw size of column, 1.0 for unknown column
+     */
+    double getColumnCompressionRatio(size_t column) const noexcept(true)
+    {
+        if (column >= columnCompressionRatio.size())
+            return 1.0;
+
+        return columnCompressionRatio[column];
+    }
+
+    /**
+     * @brief Get compression ratio of whole record (columns weighted by size)
+     *
+     * @return compressed size / raw size of record
+     */
+    double getRecordCompressionRatio() const noexcept(true);
+
     /**
      * @brief Get the Num Column object
      *
@@ -113,6 +144,16 @@ public:
         return columnSize;
     }
 
+    /**
+     * @brief Get the All Column Compression Ratio object
+     *
+     * @return vector with compression ratio of each column
+     */
+    const std::vector<double>& getAllColumnCompressionRatio() const noexcept(true)
+    {
+        return columnCompressionRatio;
+    }
+
     /**
      * @brief Created brief snapshot of DBIndex as a string
      *
@@ -10,6 +10,14 @@ class DBThreadPool
 public:
     static thread_pool threadPool;
     static std::mutex mutex;
+
+    /**
+     * @brief Get pool for work inside single index, tasks from threadPool can wait for it without deadlock.
+     *        Pool is created on the first call, so programs which never split work of index do not start its threads
+     *
+     * @return pool with 1 thread per hardware thread
+     */
+    static thread_pool& getIndexThreadPool();
 };
 
 #endif
\ No newline at end of file
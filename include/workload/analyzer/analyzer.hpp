@@ -34,6 +34,14 @@ public:
      */
     void addStep(WorkloadAnalyzerStep* step);
 
+    /**
+     * @brief Subscribe all steps to workload, so steps can aggregate counters during run.
+     *        Analyzer has to live as long as workload runs
+     *
+     * @param[in] w - workload to subscribe
+     */
+    void subscribe(Workload& w);
+
     /**
      * @brief Run all analyzers
      *
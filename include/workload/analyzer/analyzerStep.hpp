@@ -2,8 +2,14 @@
 #define WORKLOAD_ANALYZER_STEP_HPP
 
 #include <workload/workload.hpp>
+#include <workload/sink/sink.hpp>
 
-class WorkloadAnalyzerStep
+/**
+ * @brief Analyzer step is also a sink, so it can be subscribed to workload and aggregate counters during run.
+ *        By default step ignores callbacks and analyzes counters kept by workload
+ *
+ */
+class WorkloadAnalyzerStep : public WorkloadSink
 {
 protected:
     const char* name;
@@ -44,6 +50,23 @@ public:
      */
     virtual std::string analyzeWorkloadCounters(const Workload& w) = 0;
 
+    virtual void beginWorkload(const std::vector<std::string>& indexesName) noexcept(true) override
+    {
+        (void)indexesName;
+    }
+
+    virtual void consumeStep(size_t index, size_t step, const WorkloadCounters& counters) noexcept(true) override
+    {
+        (void)index;
+        (void)step;
+        (void)counters;
+    }
+
+    virtual void endWorkload() noexcept(true) override
+    {
+
+    }
+
     virtual ~WorkloadAnalyzerStep() = default;
     WorkloadAnalyzerStep() = default;
     WorkloadAnalyzerStep(const WorkloadAnalyzerStep&) = default;
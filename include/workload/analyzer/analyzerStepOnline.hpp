@@ -0,0 +1,98 @@
+#ifndef WORKLOAD_ANALYZER_STEP_ONLINE_HPP
+#define WORKLOAD_ANALYZER_STEP_ONLINE_HPP
+
+#include <workload/analyzer/analyzerStep.hpp>
+#include <observability/downsampledSeries.hpp>
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Analyzer step which reduces counters of each step to 1 value.
+ *        When step is subscribed to workload, values are aggregated during run in downsampled series (constant memory),
+ *        otherwise values are taken from stepCounters kept by workload.
+ *
+ */
+class WorkloadAnalyzerStepOnline : public WorkloadAnalyzerStep
+{
+protected:
+    static constexpr size_t defaultMaxPoints = 1024;
+
+    size_t maxPoints;
+    std::vector<DownsampledSeries> series; // per index
+
+    /**
+     * @brief Get value of step which is analyzed
+     *
+     * @param[in] counters - counters of step
+     * @return value of step
+     */
+    virtual double getStepValue(const WorkloadCounters& counters) const noexcept(true) = 0;
+
+    /**
+     * @brief Get values of all indexes. Online series are used if there are any, otherwise stepCounters from workload
+     *
+     * @param[in] w - workload to analyze
+     * @param[out] values - values[index][point]
+     * @param[out] steps - number of first step of each point (from 1)
+     * @return false if there is nothing to analyze
+     */
+    bool getStepValues(const Workload& w, std::vector<std::vector<double>>& values, std::vector<size_t>& steps) const noexcept(true);
+
+    /**
+     * @brief Create header of result "Type\tIndex1\tIndex2...\n"
+     *
+     * @param[in] w - workload to analyze
+     * @return header line
+     */
+    std::string getHeader(const Workload& w) const noexcept(true);
+
+public:
+    /**
+     * @brief Construct a new Workload Analyzer Step Online object
+     *
+     * @param[in] name - analyzer name
+     * @param[in] maxPoints - max number of points kept per index during online aggregation
+     */
+    WorkloadAnalyzerStepOnline(const char* name, size_t maxPoints = defaultMaxPoints);
+
+    size_t getMaxPoints() const noexcept(true)
+    {
+        return maxPoints;
+    }
+
+    /**
+     * @brief Get series aggregated during run
+     *
+     * @return series per index, empty if step was not subscribed to workload
+     */
+    const std::vector<DownsampledSeries>& getSeries() const noexcept(true)
+    {
+        return series;
+    }
+
+    /**
+     * @brief Called before the first step of workload, old series are dropped
+     *
+     * @param[in] indexesName - names of indexes in workload order
+     */
+    virtual void beginWorkload(const std::vector<std::string>& indexesName) noexcept(true) override;
+
+    /**
+     * @brief Called after each step of each index, value of step goes to series of index
+     *
+     * @param[in] index - index of DBIndex in workload
+     * @param[in] step - index of step in workload
+     * @param[in] counters - counters of this step
+     */
+    virtual void consumeStep(size_t index, size_t step, const WorkloadCounters& counters) noexcept(true) override;
+
+    virtual ~WorkloadAnalyzerStepOnline() = default;
+    WorkloadAnalyzerStepOnline() = default;
+    WorkloadAnalyzerStepOnline(const WorkloadAnalyzerStepOnline&) = default;
+    WorkloadAnalyzerStepOnline& operator=(const WorkloadAnalyzerStepOnline&) = default;
+    WorkloadAnalyzerStepOnline(WorkloadAnalyzerStepOnline &&) = default;
+    WorkloadAnalyzerStepOnline& operator=(WorkloadAnalyzerStepOnline &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -1,13 +1,26 @@
 #ifndef WORKLOAD_ANALYZER_STEP_QUERY_TIME_HPP
 #define WORKLOAD_ANALYZER_STEP_QUERY_TIME_HPP
 
-#include <workload/analyzer/analyzerStep.hpp>
+#include <workload/analyzer/analyzerStepOnline.hpp>
 
-class WorkloadAnalyzerStepQueryTime : public WorkloadAnalyzerStep
+class WorkloadAnalyzerStepQueryTime : public WorkloadAnalyzerStepOnline
 {
-public:
+protected:
+    /**
+     * @brief Get value of step which is analyzed
+     *
+     * @param[in] counters - counters of step
+     * @return time of step
+     */
+    virtual double getStepValue(const WorkloadCounters& counters) const noexcept(true) override;
 
-    WorkloadAnalyzerStepQueryTime();
+public:
+    /**
+     * @brief Construct a new WorkloadAnalyzerStepQueryTime object
+     *
+     * @param[in] maxPoints - max number of points kept per index during online aggregation
+     */
+    WorkloadAnalyzerStepQueryTime(size_t maxPoints = defaultMaxPoints);
 
     /**
     * @brief Virtual constructor idiom implemented as clone function. This function creates new WorkloadAnalyzerStep
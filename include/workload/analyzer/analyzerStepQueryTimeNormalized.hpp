@@ -1,12 +1,26 @@
 #ifndef WORKLOAD_ANALYZER_STEP_QUERY_TIME_NORMALIZED_HPP
 #define WORKLOAD_ANALYZER_STEP_QUERY_TIME_NORMALIZED_HPP
 
-#include <workload/analyzer/analyzerStep.hpp>
+#include <workload/analyzer/analyzerStepOnline.hpp>
 
-class WorkloadAnalyzerStepQueryTimeNormalized : public WorkloadAnalyzerStep
+class WorkloadAnalyzerStepQueryTimeNormalized : public WorkloadAnalyzerStepOnline
 {
+protected:
+    /**
+     * @brief Get value of step which is analyzed
+     *
+     * @param[in] counters - counters of step
+     * @return time of step
+     */
+    virtual double getStepValue(const WorkloadCounters& counters) const noexcept(true) override;
+
 public:
-    WorkloadAnalyzerStepQueryTimeNormalized();
+    /**
+     * @brief Construct a new WorkloadAnalyzerStepQueryTimeNormalized object
+     *
+     * @param[in] maxPoints - max number of points kept per index during online aggregation
+     */
+    WorkloadAnalyzerStepQueryTimeNormalized(size_t maxPoints = defaultMaxPoints);
 
     /**
     * @brief Virtual constructor idiom implemented as clone function. This function creates new WorkloadAnalyzerStep
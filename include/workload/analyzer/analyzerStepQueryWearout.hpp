@@ -1,13 +1,26 @@
 #ifndef WORKLOAD_ANALYZER_STEP_QUERY_WEAROUT_HPP
 #define WORKLOAD_ANALYZER_STEP_QUERY_WEAROUT_HPP
 
-#include <workload/analyzer/analyzerStep.hpp>
+#include <workload/analyzer/analyzerStepOnline.hpp>
 
-class WorkloadAnalyzerStepQueryWearout : public WorkloadAnalyzerStep
+class WorkloadAnalyzerStepQueryWearout : public WorkloadAnalyzerStepOnline
 {
-public:
-    WorkloadAnalyzerStepQueryWearout();
+protected:
+    /**
+     * @brief Get value of step which is analyzed
+     *
+     * @param[in] counters - counters of step
+     * @return physical wear-out of step
+     */
+    virtual double getStepValue(const WorkloadCounters& counters) const noexcept(true) override;
 
+public:
+    /**
+     * @brief Construct a new WorkloadAnalyzerStepQueryWearout object
+     *
+     * @param[in] maxPoints - max number of points kept per index during online aggregation
+     */
+    WorkloadAnalyzerStepQueryWearout(size_t maxPoints = defaultMaxPoints);
 
     /**
     * @brief Virtual constructor idiom implemented as clone function. This function creates new WorkloadAnalyzerStep
@@ -1,12 +1,26 @@
 #ifndef WORKLOAD_ANALYZER_STEP_QUERY_WEAROUT_NORMALIZED_HPP
 #define WORKLOAD_ANALYZER_STEP_QUERY_WEAROUT_NORMALIZED_HPP
 
-#include <workload/analyzer/analyzerStep.hpp>
+#include <workload/analyzer/analyzerStepOnline.hpp>
 
-class WorkloadAnalyzerStepQueryWearoutNormalized : public WorkloadAnalyzerStep
+class WorkloadAnalyzerStepQueryWearoutNormalized : public WorkloadAnalyzerStepOnline
 {
+protected:
+    /**
+     * @brief Get value of step which is analyzed
+     *
+     * @param[in] counters - counters of step
+     * @return physical wear-out of step
+     */
+    virtual double getStepValue(const WorkloadCounters& counters) const noexcept(true) override;
+
 public:
-    WorkloadAnalyzerStepQueryWearoutNormalized();
+    /**
+     * @brief Construct a new WorkloadAnalyzerStepQueryWearoutNormalized object
+     *
+     * @param[in] maxPoints - max number of points kept per index during online aggregation
+     */
+    WorkloadAnalyzerStepQueryWearoutNormalized(size_t maxPoints = defaultMaxPoints);
 
     /**
     * @brief Virtual constructor idiom implemented as clone function. This function creates new WorkloadAnalyzerStep
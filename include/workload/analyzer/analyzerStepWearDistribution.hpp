@@ -0,0 +1,64 @@
+#ifndef WORKLOAD_ANALYZER_STEP_WEAR_DISTRIBUTION_HPP
+#define WORKLOAD_ANALYZER_STEP_WEAR_DISTRIBUTION_HPP
+
+#include <workload/analyzer/analyzerStep.hpp>
+
+/**
+ * @brief Wear distribution of index devices (min / max / mean / stddev / Gini of block or memory line wear) and lifetime estimation.
+ *        Device needs wear tracking enabled (Disk::enableWearTracking), otherwise its row contains only zeros.
+ *
+ */
+class WorkloadAnalyzerStepWearDistribution : public WorkloadAnalyzerStep
+{
+private:
+    size_t endurance; // how many times block (line) can be worn
+
+    /**
+     * @brief Create row for single index
+     *
+     * @param[in] name - index name
+     * @param[in] disk - index disk
+     * @param[in] time - total time of workload for this index
+     * @return row of analysis
+     */
+    std::string analyzeDisk(const char* name, const Disk& disk, double time) const noexcept(true);
+
+public:
+    /**
+     * @brief Construct a new WorkloadAnalyzerStepWearDistribution object
+     *
+     * @param[in] endurance - how many times block (line) can be worn, used for lifetime estimation (default 100000 flash erase cycles)
+     */
+    WorkloadAnalyzerStepWearDistribution(size_t endurance = 100000);
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new WorkloadAnalyzerStep
+    *
+    * @return new WorkloadAnalyzerStep
+    */
+    virtual WorkloadAnalyzerStep* clone() const noexcept(true) override
+    {
+        return new WorkloadAnalyzerStepWearDistribution(*this);
+    }
+
+    size_t getEndurance() const noexcept(true)
+    {
+        return endurance;
+    }
+
+    /**
+     * @brief Create string from analysis like total Time string for all indexes
+     *
+     * @param[in] w - workload to analyze
+     * @return std::string
+     */
+    virtual std::string analyzeWorkloadCounters(const Workload& w) override;
+
+    virtual ~WorkloadAnalyzerStepWearDistribution() = default;
+    WorkloadAnalyzerStepWearDistribution(const WorkloadAnalyzerStepWearDistribution&) = default;
+    WorkloadAnalyzerStepWearDistribution& operator=(const WorkloadAnalyzerStepWearDistribution&) = default;
+    WorkloadAnalyzerStepWearDistribution(WorkloadAnalyzerStepWearDistribution &&) = default;
+    WorkloadAnalyzerStepWearDistribution& operator=(WorkloadAnalyzerStepWearDistribution &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,47 @@
+#ifndef WORKLOAD_SINK_HPP
+#define WORKLOAD_SINK_HPP
+
+#include <observability/workloadCounters.hpp>
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Receiver of step counters. Workload pushes counters of each step during run,
+ *        so results can be written incrementally instead of being built after the whole workload
+ *
+ */
+class WorkloadSink
+{
+public:
+    /**
+     * @brief Called before the first step of workload
+     *
+     * @param[in] indexesName - names of indexes in workload order
+     */
+    virtual void beginWorkload(const std::vector<std::string>& indexesName) noexcept(true) = 0;
+
+    /**
+     * @brief Called after each step of each index
+     *
+     * @param[in] index - index of DBIndex in workload
+     * @param[in] step - index of step in workload
+     * @param[in] counters - counters of this step
+     */
+    virtual void consumeStep(size_t index, size_t step, const WorkloadCounters& counters) noexcept(true) = 0;
+
+    /**
+     * @brief Called after the last step of workload
+     *
+     */
+    virtual void endWorkload() noexcept(true) = 0;
+
+    virtual ~WorkloadSink() = default;
+    WorkloadSink() = default;
+    WorkloadSink(const WorkloadSink&) = default;
+    WorkloadSink& operator=(const WorkloadSink&) = default;
+    WorkloadSink(WorkloadSink &&) = default;
+    WorkloadSink& operator=(WorkloadSink &&) = default;
+};
+
+#endif
\ No newline at end of file
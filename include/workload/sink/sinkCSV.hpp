@@ -0,0 +1,76 @@
+#ifndef WORKLOAD_SINK_CSV_HPP
+#define WORKLOAD_SINK_CSV_HPP
+
+#include <workload/sink/sink.hpp>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Sink which streams step counters into CSV file, 1 line per step of each index.
+ *        Columns: Index (name), Step, all double counters, all long counters
+ *
+ */
+class WorkloadSinkCSV : public WorkloadSink
+{
+private:
+    std::string filePath;
+    char separator;
+    std::ofstream file;
+    std::vector<std::string> indexesName;
+
+    size_t numRows;
+
+public:
+    /**
+     * @brief Construct a new WorkloadSinkCSV object
+     *
+     * @param[in] filePath - path of output file, file is created when workload starts
+     * @param[in] separator - columns separator
+     *
+     * @return WorkloadSinkCSV object
+     */
+    WorkloadSinkCSV(const char* filePath, char separator = ',');
+
+    /**
+     * @brief Create file and write header line
+     *
+     * @param[in] indexesName - names of indexes in workload order
+     */
+    virtual void beginWorkload(const std::vector<std::string>& indexesName) noexcept(true) override;
+
+    /**
+     * @brief Write step counters as a new line
+     *
+     * @param[in] index - index of DBIndex in workload
+     * @param[in] step - index of step in workload
+     * @param[in] counters - counters of this step
+     */
+    virtual void consumeStep(size_t index, size_t step, const WorkloadCounters& counters) noexcept(true) override;
+
+    /**
+     * @brief Close file
+     *
+     */
+    virtual void endWorkload() noexcept(true) override;
+
+    const std::string& getFilePath() const noexcept(true)
+    {
+        return filePath;
+    }
+
+    size_t getNumRows() const noexcept(true)
+    {
+        return numRows;
+    }
+
+    // sink owns opened file, so copy is forbidden
+    virtual ~WorkloadSinkCSV() = default;
+    WorkloadSinkCSV(const WorkloadSinkCSV&) = delete;
+    WorkloadSinkCSV& operator=(const WorkloadSinkCSV&) = delete;
+    WorkloadSinkCSV(WorkloadSinkCSV &&) = default;
+    WorkloadSinkCSV& operator=(WorkloadSinkCSV &&) = default;
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,134 @@
+#ifndef WORKLOAD_SINK_COLUMNAR_HPP
+#define WORKLOAD_SINK_COLUMNAR_HPP
+
+#include <workload/sink/sink.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Sink which streams step counters into columnar binary file.
+ *        Rows (index, step, counters) are buffered per column and written as row groups,
+ *        inside row group each column is contiguous, so reader can seek over columns which it does not need.
+ *
+ *        File layout (native byte order):
+ *        header: magic (u64), numIndexes (u32), {nameLength (u32), name}, numColumns (u32), {type (u8), nameLength (u32), name}
+ *        row group: numRows (u32), then numRows values (8 bytes each) of each column in header order
+ *        footer: numRows = 0 (u32), totalRows (u64)
+ *
+ */
+class WorkloadSinkColumnar : public WorkloadSink
+{
+public:
+    enum ColumnType : uint8_t
+    {
+        COLUMN_TYPE_LONG,
+        COLUMN_TYPE_DOUBLE,
+    };
+
+    static inline constexpr uint64_t columnarMagic = 0x014C4F43534D4244ULL;
+    static inline constexpr size_t defaultRowGroupSize = 4096;
+
+private:
+    std::string filePath;
+    size_t rowGroupSize;
+    std::ofstream file;
+
+    // buffered rows of current row group
+    std::vector<long> indexColumn;
+    std::vector<long> stepColumn;
+    std::vector<std::vector<double>> doubleColumns;
+    std::vector<std::vector<long>> longColumns;
+
+    size_t numRows; // all rows written to file
+
+    /**
+     * @brief Write buffered rows as 1 row group and clear buffers
+     *
+     */
+    void flushRowGroup() noexcept(true);
+
+public:
+    /**
+     * @brief Construct a new WorkloadSinkColumnar object
+     *
+     * @param[in] filePath - path of output file, file is created when workload starts
+     * @param[in] rowGroupSize - how many rows are buffered before write
+     *
+     * @return WorkloadSinkColumnar object
+     */
+    WorkloadSinkColumnar(const char* filePath, size_t rowGroupSize = defaultRowGroupSize);
+
+    /**
+     * @brief Create file and write header
+     *
+     * @param[in] indexesName - names of indexes in workload order
+     */
+    virtual void beginWorkload(const std::vector<std::string>& indexesName) noexcept(true) override;
+
+    /**
+     * @brief Buffer step counters as a new row, full row group is written to file
+     *
+     * @param[in] index - index of DBIndex in workload
+     * @param[in] step - index of step in workload
+     * @param[in] counters - counters of this step
+     */
+    virtual void consumeStep(size_t index, size_t step, const WorkloadCounters& counters) noexcept(true) override;
+
+    /**
+     * @brief Write last row group and footer, then close file
+     *
+     */
+    virtual void endWorkload() noexcept(true) override;
+
+    const std::string& getFilePath() const noexcept(true)
+    {
+        return filePath;
+    }
+
+    size_t getRowGroupSize() const noexcept(true)
+    {
+        return rowGroupSize;
+    }
+
+    size_t getNumRows() const noexcept(true)
+    {
+        return numRows;
+    }
+
+    /**
+     * @brief Get names of all columns stored in file
+     *
+     * @param[in] filePath - path of columnar file
+     * @return columns name, empty if file is not a columnar file
+     */
+    static std::vector<std::string> readColumnsName(const char* filePath) noexcept(true);
+
+    /**
+     * @brief Get names of indexes stored in file, value of column Index points to this vector
+     *
+     * @param[in] filePath - path of columnar file
+     * @return indexes name, empty if file is not a columnar file
+     */
+    static std::vector<std::string> readIndexesName(const char* filePath) noexcept(true);
+
+    /**
+     * @brief Read only 1 column from file, other columns are skipped
+     *
+     * @param[in] filePath - path of columnar file
+     * @param[in] columnName - name of column (Index, Step or counter name)
+     * @return values of column in rows order, long columns are converted to double. Empty if file is not a columnar file or is truncated
+     */
+    static std::vector<double> readColumn(const char* filePath, const std::string& columnName) noexcept(true);
+
+    // sink owns opened file, so copy is forbidden
+    virtual ~WorkloadSinkColumnar() = default;
+    WorkloadSinkColumnar(const WorkloadSinkColumnar&) = delete;
+    WorkloadSinkColumnar& operator=(const WorkloadSinkColumnar&) = delete;
+    WorkloadSinkColumnar(WorkloadSinkColumnar &&) = default;
+    WorkloadSinkColumnar& operator=(WorkloadSinkColumnar &&) = default;
+};
+
+#endif
\ No newline at end of file
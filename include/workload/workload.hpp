@@ -5,8 +5,11 @@
 #include <index/dbIndex.hpp>
 #include <index/dbIndexColumn.hpp>
 #include <workload/workloadStep.hpp>
+#include <workload/sink/sink.hpp>
 #include <logger/logger.hpp>
 
+#include <cstdint>
+#include <string>
 #include <vector>
 
 class Workload
@@ -20,8 +23,54 @@ protected:
     std::vector<WorkloadCounters> totalCounters;
     std::vector<std::vector<WorkloadCounters>> stepCounters;
 
+    std::vector<WorkloadSink*> sinks; // wont be deallocated
+    bool keepStepCounters; // when false only totalCounters are kept and steps are visible only via sinks
+
     void aggregateCounters(WorkloadCounters& total, const WorkloadCounters& step) noexcept(true);
     bool isColumnIndexMode;
+
+    static inline constexpr uint64_t checkpointMagic = 0x32504b43444c4b57ULL; // "WKLDCKP2"
+    std::string checkpointPath; // empty means no checkpoints
+    size_t numRestoredIndexes; // indexes restored from checkpoint in last run
+    std::vector<uint64_t> indexesFingerprint; // taken before run, indexes change during run
+
+    /**
+     * @brief Get names of all indexes in workload order
+     *
+     * @return names of indexes
+     */
+    std::vector<std::string> getIndexesName() const noexcept(true);
+
+    /**
+     * @brief Get fingerprint of steps configuration, checkpoint is valid only for the same steps
+     *
+     * @return hash of steps description
+     */
+    uint64_t getStepsFingerprint() const noexcept(true);
+
+    /**
+     * @brief Get fingerprint of each index (full description with disk), checkpoint is valid only for the same indexes
+     *
+     * @return hash of toStringFull of each index in workload order
+     */
+    std::vector<uint64_t> getIndexesFingerprint() const noexcept(true);
+
+    /**
+     * @brief Save counters of completed indexes to checkpointPath.
+     *        File is written to temporary file and renamed, so crash during save keeps the previous checkpoint
+     *
+     * @param[in] completedIndexes - number of indexes with final counters
+     * @return true on success, false otherwise
+     */
+    bool saveCheckpoint(size_t completedIndexes) const noexcept(true);
+
+    /**
+     * @brief Load counters of completed indexes from checkpointPath to totalCounters and stepCounters.
+     *        Checkpoint of other workload (indexes, steps or keepStepCounters differ) is ignored
+     *
+     * @return number of restored indexes
+     */
+    size_t loadCheckpoint() noexcept(true);
 public:
 
     /**
@@ -82,6 +131,60 @@ public:
      */
     void addIndex(DBIndexColumn* index) noexcept(true);
 
+    /**
+     * @brief Add sink which receives counters of each step during run
+     *
+     * @param[in] sink - pointer to sink (wont be deallocated)
+     */
+    void addSink(WorkloadSink* sink) noexcept(true);
+
+    /**
+     * @brief Keep counters of each step in stepCounters or not.
+     *        Without step counters memory does not grow with number of steps,
+     *        step analysis has to be done online by sinks (see WorkloadAnalyzer::subscribe)
+     *
+     * @param[in] keep - keep step counters? By default Yes
+     */
+    void setKeepStepCounters(bool keep) noexcept(true)
+    {
+        keepStepCounters = keep;
+    }
+
+    bool isKeepingStepCounters() const noexcept(true)
+    {
+        return keepStepCounters;
+    }
+
+    /**
+     * @brief Save counters to checkpoint file after each completed index.
+     *        When file with checkpoint of the same workload exists, run restores counters of completed indexes
+     *        and continues from the first not completed index. Checkpoint is removed when run finishes.
+     *        Restored indexes are not executed again, so their in-memory state is not rebuilt:
+     *        getDisk() and getCounter() of restored index are stale (state before run), use Workload counters instead.
+     *        Sinks receive restored steps only when step counters were kept
+     *
+     * @param[in] path - path to checkpoint file, empty path turns checkpoints off
+     */
+    void setCheckpointPath(const std::string& path) noexcept(true)
+    {
+        checkpointPath = path;
+    }
+
+    const std::string& getCheckpointPath() const noexcept(true)
+    {
+        return checkpointPath;
+    }
+
+    /**
+     * @brief Get number of indexes restored from checkpoint during the last run
+     *
+     * @return number of restored indexes
+     */
+    size_t getNumRestoredIndexes() const noexcept(true)
+    {
+        return numRestoredIndexes;
+    }
+
     /**
      * @brief Run all steps for all indexes
      *
@@ -158,15 +261,29 @@ public:
      *
      * @param[in] index - index of DBIndex in vector
      * @param[in] step - index of step in vector
-     * @return stepCounters[index][step]
+     * @return stepCounters[index][step], empty counters when step counters are not kept or index / step is out of range
      */
     const WorkloadCounters& getStepCounters(size_t index, size_t step) const noexcept(true)
     {
+        static const WorkloadCounters emptyCounters;
+
+        if (!keepStepCounters)
+        {
+            LOGGER_LOG_ERROR("Step counters are not kept, use sinks to get step {} of index {}", step, index);
+            return emptyCounters;
+        }
+
         if (index >= stepCounters.size())
+        {
             LOGGER_LOG_ERROR("Index {} >= vector size {}", index, stepCounters.size());
+            return emptyCounters;
+        }
 
         if (step >= stepCounters[index].size())
+        {
             LOGGER_LOG_ERROR("Step {} >= vector size {}", step, stepCounters[index].size());
+            return emptyCounters;
+        }
 
         return stepCounters[index][step];
     }
@@ -198,6 +315,12 @@ public:
     virtual std::string toStringFull(bool oneLine = true) const noexcept(true);
 
     virtual ~Workload();
+
+    /**
+     * @brief Copy Workload. Indexes are shared, steps are cloned.
+     *        Sinks are not copied, they write to 1 file or keep state of 1 run, so copy starts without sinks
+     *        and assignment keeps sinks of this Workload. Add sinks to copy via addSink
+     */
     Workload(const Workload&);
     Workload& operator=(const Workload&);
 
@@ -8,6 +8,7 @@
 #include <workload/workloadStepDelete.hpp>
 #include <workload/workloadStepPSearch.hpp>
 #include <workload/workloadStepRSearch.hpp>
+#include <workload/workloadStepTrace.hpp>
 
 #include <workload/workload.hpp>
 #include <workload/workloadAdaptiveMerging.hpp>
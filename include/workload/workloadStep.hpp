@@ -44,11 +44,6 @@ protected:
      */
     virtual void finishStep() noexcept(true);
 
-    void setColumnsToSearch(const std::vector<size_t> columns)
-    {
-        columnsToSearch = columns;
-    }
-
 public:
 
     /**
@@ -120,6 +115,21 @@ public:
      */
     WorkloadStep(const char* name, size_t numOperations, size_t numEntriesPerOperations, double selectivity, const std::vector<size_t>& col);
 
+    /**
+     * @brief Set columns used by step in column mode
+     *
+     * @param[in] columns - columns to search
+     */
+    void setColumnsToSearch(const std::vector<size_t>& columns)
+    {
+        columnsToSearch = columns;
+    }
+
+    const std::vector<size_t>& getColumnsToSearch() const noexcept(true)
+    {
+        return columnsToSearch;
+    }
+
     /**
      * @brief Set the Db Index object
      *
@@ -0,0 +1,181 @@
+#ifndef WORKLOAD_TRACE_STEP_HPP
+#define WORKLOAD_TRACE_STEP_HPP
+
+#include <workload/workloadStep.hpp>
+
+#include <cstdint>
+#include <string>
+
+class WorkloadStepTrace : public WorkloadStep
+{
+public:
+    // operation types stored in trace file (1 byte per record)
+    enum TraceOperationType : uint8_t
+    {
+        TRACE_OPERATION_INSERT = 0,
+        TRACE_OPERATION_BULKLOAD,
+        TRACE_OPERATION_DELETE,
+        TRACE_OPERATION_PSEARCH,
+        TRACE_OPERATION_RSEARCH,
+        TRACE_OPERATION_MAX_ITERATOR,
+    };
+
+    // 8 bytes at the begining of file, "DBMSTRC" + version
+    static inline constexpr uint64_t traceMagic = 0x01435254534D4244ULL;
+
+    // Binary trace is a header followed by numRecords records, both in native byte order
+    struct TraceHeader
+    {
+        uint64_t magic;
+        uint64_t numRecords;
+    };
+
+    // Fixed size record, aligned to 8 bytes so records can be read directly from mapped file
+    struct TraceRecord
+    {
+        uint64_t timestamp;
+        uint64_t key;
+        uint32_t rangeLength; // range search: entries to find, bulkload: entries to load, others: ignored
+        uint8_t opType;
+        uint8_t padding[3];
+    };
+
+private:
+    std::string tracePath;
+    size_t maxBatchSize;
+
+    size_t numBatches;
+    size_t numRecordsReplayed;
+
+    /**
+     * @brief Execute batch of the same operations on index
+     *
+     * @param[in] opType - type of operation in batch
+     * @param[in] rangeLength - range length (the same for whole batch)
+     * @param[in] batchSize - how many operations are in batch
+     *
+     * @return execution time
+     */
+    double executeBatch(uint8_t opType, uint32_t rangeLength, size_t batchSize) noexcept(true);
+
+public:
+
+    /**
+     * @brief Construct a new Workload Step object
+     *
+     * @param[in] index - pointer to index (wont be deallocated)
+     * @param[in] tracePath - path to binary trace file
+     * @param[in] maxBatchSize - max number of consecutive same operations merged into 1 index call (0 - unlimited)
+     */
+    WorkloadStepTrace(DBIndex* index, const std::string& tracePath, size_t maxBatchSize = 0);
+
+    /**
+     * @brief Construct a new Workload Step object
+     *
+     * @param[in] index - pointer to index (wont be deallocated)
+     * @param[in] tracePath - path to binary trace file
+     * @param[in] maxBatchSize - max number of consecutive same operations merged into 1 index call (0 - unlimited)
+     */
+    WorkloadStepTrace(DBIndexColumn* index, const std::string& tracePath, size_t maxBatchSize = 0);
+
+    /**
+     * @brief Construct a new Workload Step object
+     *
+     * @param[in] index - pointer to index (wont be deallocated)
+     * @param[in] tracePath - path to binary trace file
+     * @param[in] col - columns to search
+     * @param[in] maxBatchSize - max number of consecutive same operations merged into 1 index call (0 - unlimited)
+     */
+    WorkloadStepTrace(DBIndexColumn* index, const std::string& tracePath, const std::vector<size_t>& col, size_t maxBatchSize = 0);
+
+    /**
+     * @brief Construct a new Workload Step object
+     *
+     * @param[in] tracePath - path to binary trace file
+     * @param[in] maxBatchSize - max number of consecutive same operations merged into 1 index call (0 - unlimited)
+     */
+    WorkloadStepTrace(const std::string& tracePath, size_t maxBatchSize = 0);
+
+    /**
+     * @brief Construct a new Workload Step object
+     *
+     * @param[in] tracePath - path to binary trace file
+     * @param[in] col - columns to search
+     * @param[in] maxBatchSize - max number of consecutive same operations merged into 1 index call (0 - unlimited)
+     */
+    WorkloadStepTrace(const std::string& tracePath, const std::vector<size_t>& col, size_t maxBatchSize = 0);
+
+    /**
+     * @brief Convert CSV trace into binary trace
+     *        Each line: op,key,rangeLength,timestamp where op is one of INSERT, BULKLOAD, DELETE, PSEARCH, RSEARCH
+     *        Lines starting with '#' and empty lines are skipped. CSV is processed line by line
+     *
+     * @param[in] csvPath - path to CSV trace
+     * @param[in] tracePath - path to output binary trace
+     *
+     * @return number of converted records, 0 on error
+     */
+    static size_t convertCsvToTrace(const std::string& csvPath, const std::string& tracePath) noexcept(true);
+
+    /**
+     * @brief Get the Num Batches object
+     *
+     * @return how many index calls were made in last execution
+     */
+    size_t getNumBatches() const noexcept(true)
+    {
+        return numBatches;
+    }
+
+    /**
+     * @brief Get the Num Records Replayed object
+     *
+     * @return how many trace records were replayed in last execution
+     */
+    size_t getNumRecordsReplayed() const noexcept(true)
+    {
+        return numRecordsReplayed;
+    }
+
+    /**
+    * @brief Virtual constructor idiom implemented as clone function. This function creates new WorkloadStep
+    *
+    * @return new WorkloadStep
+    */
+    virtual WorkloadStep* clone() const noexcept(true) override
+    {
+        return new WorkloadStepTrace(*this);
+    }
+
+    /**
+     * @brief Created brief snapshot of WorkloadStep as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return brief edscription of WorkloadStep
+     */
+    virtual std::string toString(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Created full snapshot of WorkloadStep as a string
+     *
+     * @param[in] oneLine - create string as 1 line or not? By default Yes
+     * @return Full edscription of WorkloadStep
+     */
+    virtual std::string toStringFull(bool oneLine = true) const noexcept(true) override;
+
+    /**
+     * @brief Replay trace on index. File is memory mapped and streamed, consecutive operations with the same type are batched
+     *
+     * @return execution time
+     */
+    virtual double executeStep() noexcept(true) override;
+
+    virtual ~WorkloadStepTrace() = default;
+    WorkloadStepTrace() = default;
+    WorkloadStepTrace(const WorkloadStepTrace&) = default;
+    WorkloadStepTrace& operator=(const WorkloadStepTrace&) = default;
+    WorkloadStepTrace(WorkloadStepTrace &&) = default;
+    WorkloadStepTrace& operator=(WorkloadStepTrace &&) = default;
+};
+
+#endif
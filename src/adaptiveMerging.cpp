@@ -36,7 +36,7 @@ std::string AdaptiveMerging::AMPartitionManager::AMPartition::toStringFull(bool
 }
 
 AdaptiveMerging::AMPartitionManager::AMPartitionManager(size_t numEntries, size_t recordSize, size_t partitionSize, enum AMUnsortedMemoryInvalidation invalidationType)
-: AdaptiveMergingFramework::AMUnsortedMemoryManager(numEntries, recordSize, invalidationType), partitionSize{partitionSize}
+: AdaptiveMergingFramework::AMUnsortedMemoryManager(numEntries, recordSize, invalidationType), partitionSize{partitionSize}, loadingStreams{1}, rng{std::mt19937(AdaptiveMergingFramework::seed)}
 {
     const size_t maxEntriesInParition = partitionSize / recordSize;
     size_t entriesToInsert = numEntries;
@@ -61,6 +61,7 @@ std::string AdaptiveMerging::AMPartitionManager::toString(bool oneLine) const no
                            std::string(" .invalidationType = ") + std::to_string(invalidationType) +
                            std::string(" .partitionSize = ") + std::to_string(partitionSize) +
                            std::string(" .numPartitions = ") + std::to_string(partitions.size()) +
+                           std::string(" .loadingStreams = ") + std::to_string(loadingStreams) +
                            std::string(" }"));
     else
         return std::string(std::string("AMUnsortedMemoryManager {\n") +
@@ -69,6 +70,7 @@ std::string AdaptiveMerging::AMPartitionManager::toString(bool oneLine) const no
                            std::string("\t.invalidationType = ") + std::to_string(invalidationType) + std::string("\n") +
                            std::string("\t.partitionSize = ") + std::to_string(partitionSize) + std::string("\n") +
                            std::string("\t.numPartitions = ") + std::to_string(partitions.size()) + std::string("\n") +
+                           std::string("\t.loadingStreams = ") + std::to_string(loadingStreams) + std::string("\n") +
                            std::string("}"));
 }
 
@@ -90,6 +92,7 @@ std::string AdaptiveMerging::AMPartitionManager::toStringFull(bool oneLine) cons
                            std::string(" .invalidationType = ") + std::to_string(invalidationType) +
                            std::string(" .partitionSize = ") + std::to_string(partitionSize) +
                            std::string(" .numPartitions = ") + std::to_string(partitions.size()) +
+                           std::string(" .loadingStreams = ") + std::to_string(loadingStreams) +
                            std::string(" .partitions = ") + partitionString +
                            std::string(" .counters = ") + counters.toStringFull() +
                            std::string(" }"));
@@ -100,6 +103,7 @@ std::string AdaptiveMerging::AMPartitionManager::toStringFull(bool oneLine) cons
                            std::string("\t.invalidationType = ") + std::to_string(invalidationType) + std::string("\n") +
                            std::string("\t.partitionSize = ") + std::to_string(partitionSize) + std::string("\n") +
                            std::string("\t.numPartitions = ") + std::to_string(partitions.size()) + std::string("\n") +
+                           std::string("\t.loadingStreams = ") + std::to_string(loadingStreams) + std::string("\n") +
                            std::string("\t.partitions = ") + partitionString  + std::string("\n") +
                            std::string("\t.counters = ") + counters.toStringFull() + std::string("\n") +
                            std::string("}"));
@@ -113,10 +117,52 @@ void AdaptiveMerging::AMPartitionManager::cleanPartitions() noexcept(true)
     numEntries = 0;
 }
 
+std::vector<size_t> AdaptiveMerging::AMPartitionManager::takeEntriesFromPartitions(size_t numEntries) noexcept(true)
+{
+    // to randomize partitions sequences
+    std::vector<size_t> pos;
+    for (size_t i = 0; i < partitions.size(); ++i)
+        pos.push_back(i);
+
+    std::shuffle(pos.begin(), pos.end(), rng);
+
+    // distribute entries through partitions
+    std::vector<size_t> toLoad(partitions.size(), 0);
+
+    const size_t entriesInPartitions = std::accumulate(partitions.begin(), partitions.end(), static_cast<size_t>(0), [](size_t sum, const AMPartition& p) { return sum + p.numEntries; });
+    size_t entriesToLoad = std::min(numEntries, entriesInPartitions);
+    while (entriesToLoad > 0)
+    {
+        for (size_t i = 0; i < pos.size(); ++i)
+        {
+            size_t ppos = pos[i];
+
+            if (partitions[ppos].numEntries == toLoad[ppos])
+                continue;
+
+            size_t entiesFromThisPartition = std::min(partitions[ppos].numEntries - toLoad[ppos], numEntries / partitions.size());
+            entiesFromThisPartition = std::max(entiesFromThisPartition, static_cast<size_t>(1));
+            entiesFromThisPartition = std::min(entiesFromThisPartition, entriesToLoad);
+
+            toLoad[ppos] += entiesFromThisPartition;
+            entriesToLoad -= entiesFromThisPartition;
+
+            if (entriesToLoad == 0)
+                break;
+        }
+    }
+
+    for (size_t i = 0; i < partitions.size(); ++i)
+        partitions[i].numEntries -= toLoad[i];
+
+    return toLoad;
+}
+
 double AdaptiveMerging::AMPartitionManager::loadEntries(Disk *disk, size_t numEntries) noexcept(true)
 {
-    double lTime = 0.0;
-    double iTime = 0.0;
+    // partitions are spread through loading streams, each stream works in parallel, so only the slowest stream matters
+    std::vector<double> lTimes(loadingStreams, 0.0);
+    std::vector<double> iTimes(loadingStreams, 0.0);
 
     if (invalidationType == AdaptiveMergingFramework::AMUnsortedMemoryManager::AM_UNSORTED_MEMORY_INVALIDATION_OVERWRITE)
     {
@@ -124,13 +170,18 @@ double AdaptiveMerging::AMPartitionManager::loadEntries(Disk *disk, size_t numEn
         const size_t minPagesForEntries = (numEntries * recordSize + disk->getLowLevelController().getPageSize() - 1) / disk->getLowLevelController().getPageSize();
         const size_t minPagesForParitions = (this->numEntries * recordSize + partitionSize - 1) / partitionSize;
 
-        // scan required entries
-        uintptr_t addr = disk->getCurrentMemoryAddr();
-        lTime += disk->readBytes(addr, numEntries * recordSize);
-        lTime += disk->flushCache();
+        for (size_t s = 0; s < loadingStreams; ++s)
+        {
+            const size_t entriesInStream = numEntries / loadingStreams + (s < numEntries % loadingStreams ? 1 : 0);
+
+            // scan required entries
+            uintptr_t addr = disk->getCurrentMemoryAddr();
+            lTimes[s] += disk->readBytes(addr, entriesInStream * recordSize);
+            lTimes[s] += disk->flushCache();
 
-        // invalid data
-        iTime += invalidEntries(disk, numEntries, partitionSize);
+            // invalid data
+            iTimes[s] += invalidEntries(disk, entriesInStream, partitionSize);
+        }
 
         // seek untouched parts
         if (minPagesForEntries < minPagesForParitions)
@@ -138,60 +189,31 @@ double AdaptiveMerging::AMPartitionManager::loadEntries(Disk *disk, size_t numEn
             for (size_t i = 0; i < minPagesForParitions - minPagesForEntries; ++i)
             {
                 uintptr_t addr = disk->getCurrentMemoryAddr();
-                lTime += disk->readBytes(addr, 1);
-                lTime += disk->flushCache();
+                lTimes[i % loadingStreams] += disk->readBytes(addr, 1);
+                lTimes[i % loadingStreams] += disk->flushCache();
             }
         }
     }
     else
     {
-        // to randomize partitions sequences
-        std::vector<size_t> pos;
-        for (size_t i = 0; i < partitions.size(); ++i)
-            pos.push_back(i);
-
-        std::random_shuffle(pos.begin(), pos.end());
-
-        // distribute entries through partitions
-        std::unique_ptr<size_t[]> toLoad(new size_t[partitions.size()]);
-        std::fill(toLoad.get(), toLoad.get() + partitions.size(), 0);
-
-        size_t entriesToLoad = numEntries;
-        while (entriesToLoad > 0)
-        {
-            for (size_t i = 0; i < pos.size(); ++i)
-            {
-                size_t ppos = pos[i];
-
-                if (partitions[ppos].numEntries == 0)
-                    continue;
-
-                size_t entiesFromThisPartition = std::min(partitions[ppos].numEntries, numEntries / partitions.size());
-                entiesFromThisPartition = std::max(entiesFromThisPartition, static_cast<size_t>(1));
-                entiesFromThisPartition = std::min(entiesFromThisPartition, entriesToLoad);
+        const std::vector<size_t> toLoad = takeEntriesFromPartitions(numEntries);
 
-                toLoad.get()[ppos] += entiesFromThisPartition;
-                entriesToLoad -= entiesFromThisPartition;
-
-                if (entriesToLoad == 0)
-                    break;
-            }
-        }
-
-        // load entries from partitions
+        // load entries from partitions, partition i is placed on stream i % loadingStreams
         for (size_t i = 0; i < partitions.size(); ++i)
         {
-            partitions[i].numEntries -= toLoad.get()[i];
+            const size_t stream = i % loadingStreams;
+
             uintptr_t addr = disk->getCurrentMemoryAddr();
-            lTime += disk->readBytes(addr, toLoad.get()[i] * recordSize);
-            lTime += disk->flushCache();
+            lTimes[stream] += disk->readBytes(addr, toLoad[i] * recordSize);
+            lTimes[stream] += disk->flushCache();
 
             if (invalidationType != AdaptiveMergingFramework::AMUnsortedMemoryManager::AM_UNSORTED_MEMORY_INVALIDATION_JOURNAL)
-                iTime += invalidEntries(disk, toLoad.get()[i], partitionSize);
+                iTimes[stream] += invalidEntries(disk, toLoad[i], partitionSize);
         }
 
+        // journal is a single log, so it cannot be written in parallel
         if (invalidationType == AdaptiveMergingFramework::AMUnsortedMemoryManager::AM_UNSORTED_MEMORY_INVALIDATION_JOURNAL)
-            iTime += invalidEntries(disk, numEntries, partitionSize);
+            iTimes[0] += invalidEntries(disk, numEntries, partitionSize);
 
         const size_t minPagesForEntries = (numEntries * recordSize + disk->getLowLevelController().getPageSize() - 1) / disk->getLowLevelController().getPageSize();
         const size_t minPagesForParitions = (this->numEntries * recordSize + partitionSize - 1) / partitionSize;
@@ -202,18 +224,27 @@ double AdaptiveMerging::AMPartitionManager::loadEntries(Disk *disk, size_t numEn
             for (size_t i = 0; i < minPagesForParitions - minPagesForEntries; ++i)
             {
                 uintptr_t addr = disk->getCurrentMemoryAddr();
-                lTime += disk->readBytes(addr, 1);
-                lTime += disk->flushCache();
+                lTimes[i % loadingStreams] += disk->readBytes(addr, 1);
+                lTimes[i % loadingStreams] += disk->flushCache();
             }
         }
     }
 
+    // critical path: the slowest stream
+    size_t criticalStream = 0;
+    for (size_t s = 1; s < loadingStreams; ++s)
+        if (lTimes[s] + iTimes[s] > lTimes[criticalStream] + iTimes[criticalStream])
+            criticalStream = s;
+
+    const double lTime = lTimes[criticalStream];
+    const double iTime = iTimes[criticalStream];
+
     this->numEntries -= numEntries;
 
     counters.pegCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_LOADING_TOTAL_TIME, lTime);
     counters.pegCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_LOADING_TOTAL_OPERATIONS, 1);
 
-    LOGGER_LOG_TRACE("Loading entries {}, took {}s, invalidation took {}s, now entries {}", numEntries, lTime, iTime, this->numEntries);
+    LOGGER_LOG_TRACE("Loading entries {} by {} streams, took {}s, invalidation took {}s, now entries {}", numEntries, loadingStreams, lTime, iTime, this->numEntries);
 
     return lTime + iTime;
 }
@@ -228,10 +259,18 @@ double AdaptiveMerging::findEntriesHelper(size_t numEntries, size_t numOperation
         size_t loadFromIndex = splitEntries.first;
         size_t loadFromPartitions = splitEntries.second;
 
+        double indexTime = 0.0;
         if (loadFromIndex > 0)
-            time += index->findRangeEntries(loadFromIndex);
+            indexTime = index->findRangeEntries(loadFromIndex);
+
+        const double loadTime = memoryManager->loadEntries(const_cast<Disk*>(&index->getDisk()), loadFromPartitions);
+
+        // with parallel loading, index is searched by own stream together with partitions
+        if (getLoadingStreams() > 1)
+            time += std::max(indexTime, loadTime);
+        else
+            time += indexTime + loadTime;
 
-        time += memoryManager->loadEntries(const_cast<Disk*>(&index->getDisk()), loadFromPartitions);
         if (index->isBulkloadSupported())
             time += index->bulkloadEntries(loadFromPartitions);
         else
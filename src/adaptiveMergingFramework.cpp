@@ -114,7 +114,11 @@ double AdaptiveMergingFramework::AMUnsortedMemoryManager::invalidEntries(Disk* d
     counters.pegCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_INVALIDATION_TOTAL_TIME, time);
     counters.pegCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS, 1);
 
-    LOGGER_LOG_TRACE("Invalidation type {}, entries {}, nodeSize {}, took {}s", invalidationType, numEntries, nodeSize, time);
+    LOGGER_LOG_TRACE("Invalidation type {}, entries {}, nodeSize {}, took {}s, in background {}", invalidationType, numEntries, nodeSize, time, backgroundInvalidation);
+
+    if (backgroundInvalidation)
+        return 0.0;
+
     return time;
 }
 
@@ -244,7 +248,16 @@ std::pair<std::string, double> AdaptiveMergingFramework::getCounter(enum IndexCo
         }
         case IndexCounters::INDEX_COUNTER_RO_TOTAL_TIME:
         {
-            return std::pair<std::string, double>(index->getCounter(IndexCounters::INDEX_COUNTER_RO_TOTAL_TIME).first, index->getCounter(IndexCounters::INDEX_COUNTER_RO_TOTAL_TIME).second + memoryManager->counters.getCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RO_TOTAL_TIME).second);
+            // background invalidation is not a part of foreground time
+            const double backgroundTime = memoryManager->backgroundInvalidation ? memoryManager->counters.getCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_INVALIDATION_TOTAL_TIME).second : 0.0;
+            return std::pair<std::string, double>(index->getCounter(IndexCounters::INDEX_COUNTER_RO_TOTAL_TIME).first, index->getCounter(IndexCounters::INDEX_COUNTER_RO_TOTAL_TIME).second + memoryManager->counters.getCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RO_TOTAL_TIME).second - backgroundTime);
+        }
+        case IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME:
+        {
+            if (memoryManager->backgroundInvalidation)
+                return std::pair<std::string, double>(index->getCounter(counterId).first, index->getCounter(counterId).second + memoryManager->counters.getCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_INVALIDATION_TOTAL_TIME).second);
+
+            break;
         }
 
         default:
@@ -274,6 +287,13 @@ std::pair<std::string, long> AdaptiveMergingFramework::getCounter(enum IndexCoun
         {
             return std::pair<std::string, double>(index->getCounter(IndexCounters::INDEX_COUNTER_RO_TOTAL_OPERATIONS).first, index->getCounter(IndexCounters::INDEX_COUNTER_RO_TOTAL_OPERATIONS).second + memoryManager->counters.getCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RO_TOTAL_OPERATIONS).second);
         }
+        case IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS:
+        {
+            if (memoryManager->backgroundInvalidation)
+                return std::pair<std::string, long>(index->getCounter(counterId).first, index->getCounter(counterId).second + memoryManager->counters.getCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS).second);
+
+            break;
+        }
         default:
             break;
     }
@@ -316,6 +336,12 @@ void AdaptiveMergingFramework::resetCounter(enum IndexCounters::IndexCountersD c
             memoryManager->counters.resetCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RO_TOTAL_TIME);
             break;
         }
+        case IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME:
+        {
+            if (memoryManager->backgroundInvalidation)
+                memoryManager->counters.resetCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_INVALIDATION_TOTAL_TIME);
+            break;
+        }
 
         default:
             break;
@@ -349,6 +375,12 @@ void AdaptiveMergingFramework::resetCounter(enum IndexCounters::IndexCountersL c
             memoryManager->counters.resetCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RO_TOTAL_OPERATIONS);
             break;
         }
+        case IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS:
+        {
+            if (memoryManager->backgroundInvalidation)
+                memoryManager->counters.resetCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS);
+            break;
+        }
         default:
             break;
     }
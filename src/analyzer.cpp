@@ -43,3 +43,8 @@ void WorkloadAnalyzer::addStep(WorkloadAnalyzerStep* step)
     steps.push_back(step);
 }
 
+void WorkloadAnalyzer::subscribe(Workload& w)
+{
+    for (size_t i = 0; i < steps.size(); ++i)
+        w.addSink(steps[i]);
+}
\ No newline at end of file
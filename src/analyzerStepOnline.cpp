@@ -0,0 +1,84 @@
+#include <workload/analyzer/analyzerStepOnline.hpp>
+#include <logger/logger.hpp>
+
+WorkloadAnalyzerStepOnline::WorkloadAnalyzerStepOnline(const char* name, size_t maxPoints)
+: WorkloadAnalyzerStep(name), maxPoints{maxPoints}
+{
+
+}
+
+void WorkloadAnalyzerStepOnline::beginWorkload(const std::vector<std::string>& indexesName) noexcept(true)
+{
+    series = std::vector<DownsampledSeries>(indexesName.size(), DownsampledSeries(maxPoints));
+}
+
+void WorkloadAnalyzerStepOnline::consumeStep(size_t index, size_t step, const WorkloadCounters& counters) noexcept(true)
+{
+    (void)step;
+
+    if (index >= series.size())
+    {
+        LOGGER_LOG_ERROR("Index {} >= number of series {}", index, series.size());
+        return;
+    }
+
+    series[index].addValue(getStepValue(counters));
+}
+
+bool WorkloadAnalyzerStepOnline::getStepValues(const Workload& w, std::vector<std::vector<double>>& values, std::vector<size_t>& steps) const noexcept(true)
+{
+    values.clear();
+    steps.clear();
+
+    if (series.size() > 0 && series[0].getNumValues() > 0)
+    {
+        for (size_t i = 0; i < series.size(); ++i)
+            values.push_back(series[i].getPoints());
+
+        for (size_t i = 0; i < values[0].size(); ++i)
+            steps.push_back(series[0].getPointFirstValue(i) + 1);
+
+        return true;
+    }
+
+    const std::vector<std::vector<WorkloadCounters>>& stepCounters = w.getAllStepCounters();
+    if (stepCounters.size() == 0)
+    {
+        LOGGER_LOG_WARN("You are trying to analyze workload before execution stepCounters.size() = {}", stepCounters.size());
+        return false;
+    }
+
+    for (size_t i = 0; i < stepCounters.size(); ++i) // per index
+    {
+        values.push_back(std::vector<double>());
+        for (size_t j = 0; j < stepCounters[i].size(); ++j) // per step
+            values[i].push_back(getStepValue(stepCounters[i][j]));
+    }
+
+    for (size_t i = 0; i < stepCounters[0].size(); ++i)
+        steps.push_back(i + 1);
+
+    return true;
+}
+
+std::string WorkloadAnalyzerStepOnline::getHeader(const Workload& w) const noexcept(true)
+{
+    std::string result = std::string("Type");
+
+    if (w.isInColumnMode() == false)
+    {
+        const std::vector<DBIndex*>& indexes = w.getAllRawIndexes();
+        for (size_t i = 0; i < indexes.size(); ++i)
+            result += std::string("\t") + std::string(indexes[i]->getName());
+    }
+    else
+    {
+        const std::vector<DBIndexColumn*>& indexes = w.getAllColumnIndexes();
+        for (size_t i = 0; i < indexes.size(); ++i)
+            result += std::string("\t") + std::string(indexes[i]->getName());
+    }
+
+    result += std::string("\n");
+
+    return result;
+}
\ No newline at end of file
@@ -1,45 +1,33 @@
 #include <workload/analyzer/analyzerStepQueryTime.hpp>
 #include <logger/logger.hpp>
 
-WorkloadAnalyzerStepQueryTime::WorkloadAnalyzerStepQueryTime()
-: WorkloadAnalyzerStep("QueryTime")
+WorkloadAnalyzerStepQueryTime::WorkloadAnalyzerStepQueryTime(size_t maxPoints)
+: WorkloadAnalyzerStepOnline("QueryTime", maxPoints)
 {
 
 }
 
+double WorkloadAnalyzerStepQueryTime::getStepValue(const WorkloadCounters& counters) const noexcept(true)
+{
+    return counters.getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME);
+}
+
 std::string WorkloadAnalyzerStepQueryTime::analyzeWorkloadCounters(const Workload& w)
 {
     std::string result;
-    const std::vector<std::vector<WorkloadCounters>>& stepCounters = w.getAllStepCounters();
+    std::vector<std::vector<double>> values;
+    std::vector<size_t> steps;
 
-    if (stepCounters.size() == 0)
-    {
-        LOGGER_LOG_WARN("You are trying to analyze workload before execution stepCounters.size() = {}", stepCounters.size());
+    if (!getStepValues(w, values, steps))
         return result;
-    }
-
-    result += std::string("Type");
-
-    if (w.isInColumnMode() == false)
-    {
-        const std::vector<DBIndex*>& indexes = w.getAllRawIndexes();
-        for (size_t i = 0; i < indexes.size(); ++i)
-            result += std::string("\t") + std::string(indexes[i]->getName());
-    }
-    else
-    {
-        const std::vector<DBIndexColumn*>& indexes = w.getAllColumnIndexes();
-        for (size_t i = 0; i < indexes.size(); ++i)
-            result += std::string("\t") + std::string(indexes[i]->getName());
-    }
 
-    result += std::string("\n");
+    result += getHeader(w);
 
-    for (size_t i = 0; i < stepCounters[0].size(); ++i) // per step
+    for (size_t i = 0; i < steps.size(); ++i) // per step
     {
-        result += std::to_string(i + 1);
-        for (size_t j = 0; j < stepCounters.size(); ++j) // per index
-            result += std::string("\t") + std::to_string(stepCounters[j][i].getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME));
+        result += std::to_string(steps[i]);
+        for (size_t j = 0; j < values.size(); ++j) // per index
+            result += std::string("\t") + std::to_string(values[j][i]);
 
 
         result += std::string("\n");
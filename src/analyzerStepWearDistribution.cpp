@@ -0,0 +1,52 @@
+#include <workload/analyzer/analyzerStepWearDistribution.hpp>
+#include <logger/logger.hpp>
+
+WorkloadAnalyzerStepWearDistribution::WorkloadAnalyzerStepWearDistribution(size_t endurance)
+: WorkloadAnalyzerStep("WearDistribution"), endurance{endurance}
+{
+
+}
+
+std::string WorkloadAnalyzerStepWearDistribution::analyzeDisk(const char* name, const Disk& disk, double time) const noexcept(true)
+{
+    const WearTracker& tracker = disk.getLowLevelController().getMemoryModel().getWearTracker();
+
+    if (!tracker.isEnabled())
+        LOGGER_LOG_WARN("Wear tracking is disabled for {}", name);
+
+    return std::string(name) + std::string("\t") +
+           std::to_string(tracker.getMinWear()) + std::string("\t") +
+           std::to_string(tracker.getMaxWear()) + std::string("\t") +
+           std::to_string(tracker.getMeanWear()) + std::string("\t") +
+           std::to_string(tracker.getStdDevWear()) + std::string("\t") +
+           std::to_string(tracker.getGiniWear()) + std::string("\t") +
+           std::to_string(tracker.estimateLifetime(endurance, time)) + std::string("\n");
+}
+
+std::string WorkloadAnalyzerStepWearDistribution::analyzeWorkloadCounters(const Workload& w)
+{
+    std::string result;
+    const std::vector<WorkloadCounters>& totalCounters = w.getAllTotalCounters();
+
+    if (totalCounters.size() == 0)
+    {
+        LOGGER_LOG_WARN("You are trying to analyze workload before execution totalCounters.size() = {}", totalCounters.size());
+        return result;
+    }
+
+    result += std::string("Type\tMinWear\tMaxWear\tMeanWear\tStdDevWear\tGini\tLifetime\n");
+    if (w.isInColumnMode() == false)
+    {
+        const std::vector<DBIndex*>& indexes = w.getAllRawIndexes();
+        for (size_t i = 0; i < indexes.size(); ++i)
+            result += analyzeDisk(indexes[i]->getName(), indexes[i]->getDisk(), totalCounters[i].getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME));
+    }
+    else
+    {
+        const std::vector<DBIndexColumn*>& indexes = w.getAllColumnIndexes();
+        for (size_t i = 0; i < indexes.size(); ++i)
+            result += analyzeDisk(indexes[i]->getName(), indexes[i]->getDisk(), totalCounters[i].getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME));
+    }
+
+    return result;
+}
\ No newline at end of file
@@ -134,7 +134,7 @@ double BBPTree::insertEntriesHelper(size_t numOperations) noexcept(true)
 
         // we need insert into a gap (or at the end + update bitmap)
         time += disk->overwriteBytes(addr + nodeSize - (entriesPerLeaf / 4) * sizeRecord - 1, (entriesPerLeaf / 4) * sizeRecord);
-        time += disk->overwriteBytes(addr + nodeSize - 1, 1);
+        time += disk->overwriteBytes(addr + nodeSize - 1, 1, MemoryController::bitmapBitChangeRatio);
         time += disk->flushCache();
     }
 
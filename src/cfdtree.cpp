@@ -1,6 +1,8 @@
 #include <index/cfdtree.hpp>
+#include <threadPool/dbThreadPool.hpp>
 #include <logger/logger.hpp>
 
+#include <future>
 #include <numeric>
 
 CFDTree::CFDTree(const char* name, Disk* disk, const std::vector<size_t>& columnsSize, size_t nodeSize, size_t headTreeSize, size_t lvlRatio)
@@ -14,7 +16,12 @@ CFDTree::CFDTree(const char* name, Disk* disk, const std::vector<size_t>& column
     {
         const size_t cNodeSize = i == 0 ? (maxEntries * (columnsSize[i])) : (maxEntries * (columnsSize[i] + columnsSize[0]));
         // fdColumns.push_back(FDTree(new Disk(*disk), columnsSize[i], 0, nodeSize, cNodeSize * headTreeMultipler, lvlRatio)); // (for PhD tests only)
-        fdColumns.push_back(FDTree(new Disk(*disk), columnsSize[0], i == 0 ? 0 : columnsSize[i], nodeSize, cNodeSize * headTreeMultipler, lvlRatio));
+
+        // each column has own disk, so column index is a placement hint for the whole column life (for example column compression)
+        Disk* columnDisk = new Disk(*disk);
+        (void)columnDisk->setPlacementHint(i);
+
+        fdColumns.push_back(FDTree(columnDisk, columnsSize[0], i == 0 ? 0 : columnsSize[i], nodeSize, cNodeSize * headTreeMultipler, lvlRatio));
     }
 
     LOGGER_LOG_DEBUG("CFDTree created {}", toStringFull());
@@ -42,7 +49,37 @@ CFDTree::CFDTree(const char* name, Disk* disk, const std::vector<size_t>& column
 CFDTree::CFDTree(const CFDTree& other)
 : CFDTree(other.name, (*other.disk).clone(), other.columnsSize, other.nodeSize, other.headTreeSize, other.lvlRatio)
 {
+    columnsParallelism = other.columnsParallelism;
+}
+
+double CFDTree::executeOnColumns(const std::vector<size_t>& columns,
+                                 const std::function<double(FDTree&)>& op,
+                                 enum IndexCounters::IndexCountersD timeId) noexcept(true)
+{
+    std::vector<double> columnsTime(columns.size(), 0.0);
+
+    if (columnsParallelism == 1 || columns.size() == 1)
+    {
+        for (size_t i = 0; i < columns.size(); ++i)
+            columnsTime[i] = op(fdColumns[columns[i]]);
+    }
+    else
+    {
+        std::vector<std::future<double>> futures;
+        futures.reserve(columns.size());
+        for (const size_t column : columns)
+            futures.push_back(DBThreadPool::getIndexThreadPool().submit([this, &op, column]() { return op(fdColumns[column]); }));
+
+        for (size_t i = 0; i < futures.size(); ++i)
+            columnsTime[i] = futures[i].get();
+    }
+
+    const double time = getColumnsTime(columnsTime);
 
+    // FD-trees count time of each column, so CFDTree remembers only the hidden part. Operations are taken from key column
+    overlappedCounters.pegCounter(timeId, std::accumulate(columnsTime.begin(), columnsTime.end(), 0.0) - time);
+
+    return time;
 }
 
 CFDTree& CFDTree::operator=(const CFDTree& other)
@@ -53,6 +90,7 @@ CFDTree& CFDTree::operator=(const CFDTree& other)
     DBIndexColumn::operator =(other);
     disk.reset(new DiskColumnOverlay(other.disk.get()));
     fdColumns = other.fdColumns;
+    overlappedCounters = other.overlappedCounters;
     nodeSize = other.nodeSize;
     headTreeSize = other.headTreeSize;
     lvlRatio = other.lvlRatio;
@@ -106,8 +144,8 @@ std::string CFDTree::toStringFull(bool oneLine) const noexcept(true)
     };
 
     const std::string fdColumnsString =  std::string("{") +
-                                         std::accumulate(std::begin(fdColumns), std::end(fdColumns), std::string(), buildStringFDColumns) +
-                                         std::string("}");
+                            std::accumulate(std::begin(fdColumns), std::end(fdColumns), std::string(), buildStringFDColumns) +
+                            std::string("}");
 
     (void)getDisk(); // this triggers disk stat merge
 
@@ -159,6 +197,9 @@ std::pair<std::string, double> CFDTree::getCounter(enum IndexCounters::IndexCoun
     for (size_t i = 0; i < fdColumns.size(); ++i)
         val += fdColumns[i].getCounter(counterId).second;
 
+    // columns processed concurrently overlap in time
+    val -= overlappedCounters.getCounterValue(counterId);
+
     return std::pair<std::string, double>(fdColumns[0].getCounter(counterId).first, val);
 }
 
@@ -169,6 +210,7 @@ std::pair<std::string, long> CFDTree::getCounter(enum IndexCounters::IndexCounte
 
 void CFDTree::resetCounter(enum IndexCounters::IndexCountersD counterId) noexcept(true)
 {
+    overlappedCounters.resetCounter(counterId);
     for (size_t i = 0; i < fdColumns.size(); ++i)
         fdColumns[i].resetCounter(counterId);
 }
@@ -181,6 +223,7 @@ void CFDTree::resetCounter(enum IndexCounters::IndexCountersL counterId) noexcep
 
 void CFDTree::resetAllCounters() noexcept(true)
 {
+    overlappedCounters.resetAllCounters();
     for (size_t i = 0; i < fdColumns.size(); ++i)
         fdColumns[i].resetAllCounters();
 }
@@ -210,12 +253,12 @@ bool CFDTree::isBulkloadSupported() const noexcept(true)
 
 double CFDTree::insertEntries(size_t numOperations) noexcept(true)
 {
-    double time = 0.0;
+    std::vector<size_t> columns(fdColumns.size());
+    std::iota(columns.begin(), columns.end(), 0);
 
-    for (size_t i = 0; i < fdColumns.size(); ++i)
-        time += fdColumns[i].insertEntries(numOperations);
-
-    return time;
+    return executeOnColumns(columns,
+                            [numOperations](FDTree& fd) { return fd.insertEntries(numOperations); },
+                            IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME);
 }
 
 double CFDTree::bulkloadEntries(size_t numEntries) noexcept(true)
@@ -230,18 +273,16 @@ double CFDTree::bulkloadEntries(size_t numEntries) noexcept(true)
 
 double CFDTree::deleteEntries(size_t numOperations) noexcept(true)
 {
-    double time = 0.0;
+    std::vector<size_t> columns(fdColumns.size());
+    std::iota(columns.begin(), columns.end(), 0);
 
-    for (size_t i = 0; i < fdColumns.size(); ++i)
-        time += fdColumns[i].deleteEntries(numOperations);
-
-    return time;
+    return executeOnColumns(columns,
+                            [numOperations](FDTree& fd) { return fd.deleteEntries(numOperations); },
+                            IndexCounters::INDEX_COUNTER_RW_DELETE_TOTAL_TIME);
 }
 
 double CFDTree::findPointEntries(const std::vector<size_t>& columnsToFetch, size_t numOperations) noexcept(true)
 {
-    double time = 0.0;
-
     std::vector colCopy = columnsToFetch;
     std::sort(colCopy.begin(), colCopy.end());
 
@@ -251,35 +292,20 @@ double CFDTree::findPointEntries(const std::vector<size_t>& columnsToFetch, size
         return 0.0;
     }
 
-    for (size_t i = 0; i < colCopy.size(); ++i)
-        time += fdColumns[colCopy[i]].findPointEntries(numOperations);
-
-    return time;
+    return executeOnColumns(colCopy,
+                            [numOperations](FDTree& fd) { return fd.findPointEntries(numOperations); },
+                            IndexCounters::INDEX_COUNTER_RW_PSEARCH_TOTAL_TIME);
 }
 
 double CFDTree::findPointEntries(const std::vector<size_t>& columnsToFetch, double selectivity, size_t numOperations) noexcept(true)
 {
-    double time = 0.0;
+    LOGGER_LOG_TRACE("selectivity={}, numOperations={}, call findPointEntries({})", selectivity, numOperations, static_cast<size_t>(static_cast<double>(getNumEntries()) * selectivity) * numOperations);
 
-    std::vector colCopy = columnsToFetch;
-    std::sort(colCopy.begin(), colCopy.end());
-
-    if (colCopy[0] != 0)
-    {
-        LOGGER_LOG_ERROR("You need key column!");
-        return 0.0;
-    }
-
-    for (size_t i = 0; i < colCopy.size(); ++i)
-        time += fdColumns[colCopy[i]].findPointEntries(selectivity, numOperations);
-
-    return time;
+    return findPointEntries(columnsToFetch, static_cast<size_t>(static_cast<double>(getNumEntries()) * selectivity) * numOperations);
 }
 
 double CFDTree::findRangeEntries(const std::vector<size_t>& columnsToFetch, size_t numEntries, size_t numOperations)  noexcept(true)
 {
-    double time = 0.0;
-
     std::vector colCopy = columnsToFetch;
     std::sort(colCopy.begin(), colCopy.end());
 
@@ -289,29 +315,16 @@ double CFDTree::findRangeEntries(const std::vector<size_t>& columnsToFetch, size
         return 0.0;
     }
 
-    for (size_t i = 0; i < colCopy.size(); ++i)
-        time += fdColumns[colCopy[i]].findRangeEntries(numEntries, numOperations);
-
-    return time;
+    return executeOnColumns(colCopy,
+                            [numEntries, numOperations](FDTree& fd) { return fd.findRangeEntries(numEntries, numOperations); },
+                            IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_TIME);
 }
 
 double CFDTree::findRangeEntries(const std::vector<size_t>& columnsToFetch, double selectivity, size_t numOperations) noexcept(true)
 {
-    double time = 0.0;
-
-    std::vector colCopy = columnsToFetch;
-    std::sort(colCopy.begin(), colCopy.end());
-
-    if (colCopy[0] != 0)
-    {
-        LOGGER_LOG_ERROR("You need key column!");
-        return 0.0;
-    }
-
-    for (size_t i = 0; i < colCopy.size(); ++i)
-        time += fdColumns[colCopy[i]].findRangeEntries(selectivity, numOperations);
+    LOGGER_LOG_TRACE("selectivity={}, numOperations={}, call findRangeEntries({}, {})", selectivity, numOperations, static_cast<size_t>(static_cast<double>(getNumEntries()) * selectivity), numOperations);
 
-    return time;
+    return findRangeEntries(columnsToFetch, static_cast<size_t>(static_cast<double>(getNumEntries()) * selectivity), numOperations);
 }
 
 void CFDTree::createTopologyAfterInsert(size_t numEntries) noexcept(true)
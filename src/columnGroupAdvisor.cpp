@@ -0,0 +1,357 @@
+#include <advisor/columnGroupAdvisor.hpp>
+#include <index/bptree.hpp>
+#include <index/dbIndexRawToColumnWrapper.hpp>
+#include <index/dsm.hpp>
+#include <index/pax.hpp>
+#include <threadPool/dbThreadPool.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+#include <future>
+#include <limits>
+#include <numeric>
+#include <set>
+
+void ColumnGroupAdvisor::normalizeLayout(ColumnGroups& groups) noexcept(true)
+{
+    groups.erase(std::remove_if(groups.begin(), groups.end(), [](const std::vector<size_t>& group) { return group.empty(); }), groups.end());
+
+    for (auto& group : groups)
+        std::sort(group.begin(), group.end());
+
+    std::sort(groups.begin(), groups.end());
+}
+
+std::string ColumnGroupAdvisor::layoutToString(const ColumnGroups& groups) noexcept(true)
+{
+    auto buildStringFromVector = [](const std::string &accumulator, const size_t &column)
+    {
+        return accumulator.empty() ? std::to_string(column) : accumulator + "," + std::to_string(column);
+    };
+
+    auto buildStringFromGroups = [&buildStringFromVector](const std::string &accumulator, const std::vector<size_t> &group)
+    {
+        const std::string groupString = std::string("{") + std::accumulate(std::begin(group), std::end(group), std::string(), buildStringFromVector) + std::string("}");
+        return accumulator.empty() ? groupString : accumulator + "," + groupString;
+    };
+
+    return std::string("{ ") + std::accumulate(std::begin(groups), std::end(groups), std::string(), buildStringFromGroups) + std::string(" }");
+}
+
+bool ColumnGroupAdvisor::isValidLayout(const ColumnGroups& groups) const noexcept(true)
+{
+    std::vector<bool> isInGroup(columnsSize.size(), false);
+    for (const auto& group : groups)
+        for (const size_t column : group)
+        {
+            if (column >= columnsSize.size() || isInGroup[column])
+                return false;
+
+            isInGroup[column] = true;
+        }
+
+    return std::find(isInGroup.begin(), isInGroup.end(), false) == isInGroup.end();
+}
+
+std::vector<ColumnGroupAdvisor::ColumnGroups> ColumnGroupAdvisor::getNeighbourLayouts(const ColumnGroups& groups) const noexcept(true)
+{
+    std::set<ColumnGroups> neighbours;
+
+    // move 1 column to other group or to new group, key column defines key group so it stays
+    for (size_t from = 0; from < groups.size(); ++from)
+        for (const size_t column : groups[from])
+        {
+            if (column == 0)
+                continue;
+
+            ColumnGroups withoutColumn = groups;
+            withoutColumn[from].erase(std::find(withoutColumn[from].begin(), withoutColumn[from].end(), column));
+
+            for (size_t to = 0; to < groups.size(); ++to)
+            {
+                if (to == from)
+                    continue;
+
+                ColumnGroups neighbour = withoutColumn;
+                neighbour[to].push_back(column);
+                normalizeLayout(neighbour);
+                neighbours.insert(neighbour);
+            }
+
+            if (groups[from].size() > 1)
+            {
+                ColumnGroups neighbour = withoutColumn;
+                neighbour.push_back(std::vector<size_t>{column});
+                normalizeLayout(neighbour);
+                neighbours.insert(neighbour);
+            }
+        }
+
+    // merge 2 groups
+    for (size_t i = 0; i < groups.size(); ++i)
+        for (size_t j = i + 1; j < groups.size(); ++j)
+        {
+            ColumnGroups neighbour = groups;
+            neighbour[i].insert(neighbour[i].end(), neighbour[j].begin(), neighbour[j].end());
+            neighbour[j].clear();
+            normalizeLayout(neighbour);
+            neighbours.insert(neighbour);
+        }
+
+    return std::vector<ColumnGroups>(neighbours.begin(), neighbours.end());
+}
+
+DBIndexColumn* ColumnGroupAdvisor::createIndex(Disk* disk, const std::vector<size_t>& groupsSize) const noexcept(true)
+{
+    // all columns in 1 group is NSM, column index needs at least 2 columns so use row index
+    if (groupsSize.size() == 1)
+        return new DBIndexRawToColumnWrapper(new BPTree(disk, columnsSize[0], groupsSize[0] - columnsSize[0]), columnsSize);
+
+    switch (layoutModel)
+    {
+        case LAYOUT_MODEL_PAX:
+            return new PAX(disk, groupsSize);
+        case LAYOUT_MODEL_DSM:
+        default:
+            return new DSM(disk, groupsSize);
+    }
+}
+
+double ColumnGroupAdvisor::simulateLayout(const ColumnGroups& groups) const noexcept(true)
+{
+    // group is seen by index as 1 wide column
+    std::vector<size_t> groupsSize(groups.size(), 0);
+    std::vector<size_t> columnToGroup(columnsSize.size(), 0);
+    for (size_t i = 0; i < groups.size(); ++i)
+        for (const size_t column : groups[i])
+        {
+            groupsSize[i] += columnsSize[column];
+            columnToGroup[column] = i;
+        }
+
+    std::unique_ptr<DBIndexColumn> index(createIndex(disk->clone(), groupsSize));
+    index->createTopologyAfterInsert(numEntries);
+
+    double time = 0.0;
+    for (const auto& step : steps)
+    {
+        std::unique_ptr<WorkloadStep> stepCopy(step->clone());
+
+        std::vector<size_t> groupsToSearch;
+        for (const size_t column : stepCopy->getColumnsToSearch())
+            if (column < columnToGroup.size())
+                groupsToSearch.push_back(columnToGroup[column]);
+
+        // step without columns uses all of them
+        if (groupsToSearch.empty())
+        {
+            groupsToSearch = std::vector<size_t>(groups.size());
+            std::iota(groupsToSearch.begin(), groupsToSearch.end(), 0);
+        }
+
+        // entries are found by key, so key group is searched even when step does not fetch key column
+        groupsToSearch.push_back(columnToGroup[0]);
+
+        std::sort(groupsToSearch.begin(), groupsToSearch.end());
+        groupsToSearch.erase(std::unique(groupsToSearch.begin(), groupsToSearch.end()), groupsToSearch.end());
+
+        stepCopy->setDbIndex(index.get());
+        stepCopy->setColumnsToSearch(groupsToSearch);
+        time += stepCopy->executeStep();
+    }
+
+    return time;
+}
+
+std::vector<double> ColumnGroupAdvisor::evaluateLayouts(const std::vector<ColumnGroups>& layouts) noexcept(true)
+{
+    std::vector<double> layoutsTime(layouts.size(), 0.0);
+
+    // candidates use indexes with sequential columns, so they never wait for indexThreadPool themselves
+    std::vector<std::future<double>> futures;
+    std::vector<size_t> simulatedLayouts;
+    for (size_t i = 0; i < layouts.size(); ++i)
+    {
+        auto it = evaluatedLayouts.find(layouts[i]);
+        if (it != evaluatedLayouts.end())
+            layoutsTime[i] = it->second;
+        else
+        {
+            simulatedLayouts.push_back(i);
+            futures.push_back(DBThreadPool::getIndexThreadPool().submit([this, &layouts, i]() { return simulateLayout(layouts[i]); }));
+        }
+    }
+
+    for (size_t i = 0; i < futures.size(); ++i)
+    {
+        layoutsTime[simulatedLayouts[i]] = futures[i].get();
+        evaluatedLayouts[layouts[simulatedLayouts[i]]] = layoutsTime[simulatedLayouts[i]];
+    }
+
+    return layoutsTime;
+}
+
+ColumnGroupAdvisor::ColumnGroupAdvisor(const DBTable& table, const Disk* disk, size_t numEntries, const std::vector<WorkloadStep*>& steps, enum LayoutModel layoutModel, size_t maxIterations)
+: columnsSize{table.getAllColumnSize()}, disk{std::unique_ptr<Disk>(disk->clone())}, numEntries{numEntries}, layoutModel{layoutModel}, maxIterations{maxIterations}, bestTime{0.0}, numIterations{0}
+{
+    for (const auto& step : steps)
+        this->steps.push_back(std::unique_ptr<WorkloadStep>(step->clone()));
+
+    LOGGER_LOG_DEBUG("ColumnGroupAdvisor created {}", toStringFull());
+}
+
+ColumnGroupAdvisor::ColumnGroupAdvisor(const ColumnGroupAdvisor& other)
+: columnsSize{other.columnsSize}, disk{std::unique_ptr<Disk>(other.disk->clone())}, numEntries{other.numEntries}, layoutModel{other.layoutModel}, maxIterations{other.maxIterations}, evaluatedLayouts{other.evaluatedLayouts}, bestLayout{other.bestLayout}, bestTime{other.bestTime}, numIterations{other.numIterations}
+{
+    for (const auto& step : other.steps)
+        steps.push_back(std::unique_ptr<WorkloadStep>(step->clone()));
+}
+
+ColumnGroupAdvisor& ColumnGroupAdvisor::operator=(const ColumnGroupAdvisor& other)
+{
+    if (this == &other)
+        return *this;
+
+    columnsSize = other.columnsSize;
+    disk.reset(other.disk->clone());
+
+    steps.clear();
+    for (const auto& step : other.steps)
+        steps.push_back(std::unique_ptr<WorkloadStep>(step->clone()));
+
+    numEntries = other.numEntries;
+    layoutModel = other.layoutModel;
+    maxIterations = other.maxIterations;
+    evaluatedLayouts = other.evaluatedLayouts;
+    bestLayout = other.bestLayout;
+    bestTime = other.bestTime;
+    numIterations = other.numIterations;
+
+    return *this;
+}
+
+ColumnGroupAdvisor::ColumnGroups ColumnGroupAdvisor::getNSMLayout(size_t numColumns) noexcept(true)
+{
+    std::vector<size_t> group(numColumns);
+    std::iota(group.begin(), group.end(), 0);
+
+    return ColumnGroups{group};
+}
+
+ColumnGroupAdvisor::ColumnGroups ColumnGroupAdvisor::getDSMLayout(size_t numColumns) noexcept(true)
+{
+    ColumnGroups groups;
+    for (size_t i = 0; i < numColumns; ++i)
+        groups.push_back(std::vector<size_t>{i});
+
+    return groups;
+}
+
+double ColumnGroupAdvisor::evaluateLayout(const ColumnGroups& groups) noexcept(true)
+{
+    if (!isValidLayout(groups))
+    {
+        LOGGER_LOG_ERROR("Layout {} is not a partition of {} columns", layoutToString(groups), columnsSize.size());
+        return 0.0;
+    }
+
+    ColumnGroups layout = groups;
+    normalizeLayout(layout);
+
+    return evaluateLayouts(std::vector<ColumnGroups>{layout})[0];
+}
+
+double ColumnGroupAdvisor::findBestLayout() noexcept(true)
+{
+    bestTime = std::numeric_limits<double>::max();
+    numIterations = 0;
+
+    const std::vector<ColumnGroups> startLayouts = {getDSMLayout(columnsSize.size()), getNSMLayout(columnsSize.size())};
+    for (const auto& start : startLayouts)
+    {
+        ColumnGroups current = start;
+        double currentTime = evaluateLayouts(std::vector<ColumnGroups>{current})[0];
+
+        for (size_t i = 0; i < maxIterations; ++i)
+        {
+            const std::vector<ColumnGroups> neighbours = getNeighbourLayouts(current);
+            if (neighbours.empty())
+                break;
+
+            const std::vector<double> neighboursTime = evaluateLayouts(neighbours);
+            const size_t best = static_cast<size_t>(std::min_element(neighboursTime.begin(), neighboursTime.end()) - neighboursTime.begin());
+
+            ++numIterations;
+
+            if (neighboursTime[best] >= currentTime)
+                break;
+
+            current = neighbours[best];
+            currentTime = neighboursTime[best];
+
+            LOGGER_LOG_TRACE("Hill-climbing moved to {}, time {}s", layoutToString(current), currentTime);
+        }
+
+        if (currentTime < bestTime)
+        {
+            bestLayout = current;
+            bestTime = currentTime;
+        }
+    }
+
+    LOGGER_LOG_INFO("Best layout {}, workload took {}s, evaluated {} layouts", layoutToString(bestLayout), bestTime, evaluatedLayouts.size());
+
+    return bestTime;
+}
+
+std::string ColumnGroupAdvisor::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("ColumnGroupAdvisor {") +
+                           std::string(" .numColumns = ") + std::to_string(columnsSize.size()) +
+                           std::string(" .numEntries = ") + std::to_string(numEntries) +
+                           std::string(" .numSteps = ") + std::to_string(steps.size()) +
+                           std::string(" .layoutModel = ") + std::string(layoutModel == LAYOUT_MODEL_PAX ? "PAX" : "DSM") +
+                           std::string(" .bestLayout = ") + layoutToString(bestLayout) +
+                           std::string(" .bestTime = ") + std::to_string(bestTime) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("ColumnGroupAdvisor {\n") +
+                           std::string("\t.numColumns = ") + std::to_string(columnsSize.size()) + std::string("\n") +
+                           std::string("\t.numEntries = ") + std::to_string(numEntries) + std::string("\n") +
+                           std::string("\t.numSteps = ") + std::to_string(steps.size()) + std::string("\n") +
+                           std::string("\t.layoutModel = ") + std::string(layoutModel == LAYOUT_MODEL_PAX ? "PAX" : "DSM") + std::string("\n") +
+                           std::string("\t.bestLayout = ") + layoutToString(bestLayout) + std::string("\n") +
+                           std::string("\t.bestTime = ") + std::to_string(bestTime) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string ColumnGroupAdvisor::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("ColumnGroupAdvisor {") +
+                           std::string(" .numColumns = ") + std::to_string(columnsSize.size()) +
+                           std::string(" .numEntries = ") + std::to_string(numEntries) +
+                           std::string(" .numSteps = ") + std::to_string(steps.size()) +
+                           std::string(" .layoutModel = ") + std::string(layoutModel == LAYOUT_MODEL_PAX ? "PAX" : "DSM") +
+                           std::string(" .maxIterations = ") + std::to_string(maxIterations) +
+                           std::string(" .numIterations = ") + std::to_string(numIterations) +
+                           std::string(" .numEvaluatedLayouts = ") + std::to_string(evaluatedLayouts.size()) +
+                           std::string(" .bestLayout = ") + layoutToString(bestLayout) +
+                           std::string(" .bestTime = ") + std::to_string(bestTime) +
+                           std::string(" .disk = ") + disk->toString() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("ColumnGroupAdvisor {\n") +
+                           std::string("\t.numColumns = ") + std::to_string(columnsSize.size()) + std::string("\n") +
+                           std::string("\t.numEntries = ") + std::to_string(numEntries) + std::string("\n") +
+                           std::string("\t.numSteps = ") + std::to_string(steps.size()) + std::string("\n") +
+                           std::string("\t.layoutModel = ") + std::string(layoutModel == LAYOUT_MODEL_PAX ? "PAX" : "DSM") + std::string("\n") +
+                           std::string("\t.maxIterations = ") + std::to_string(maxIterations) + std::string("\n") +
+                           std::string("\t.numIterations = ") + std::to_string(numIterations) + std::string("\n") +
+                           std::string("\t.numEvaluatedLayouts = ") + std::to_string(evaluatedLayouts.size()) + std::string("\n") +
+                           std::string("\t.bestLayout = ") + layoutToString(bestLayout) + std::string("\n") +
+                           std::string("\t.bestTime = ") + std::to_string(bestTime) + std::string("\n") +
+                           std::string("\t.disk = ") + disk->toString() + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
@@ -0,0 +1,356 @@
+#include <index/columnLSMTree.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+bool ColumnLSMTree::normalizeColumnGroups(std::vector<std::vector<size_t>>& groups) const noexcept(true)
+{
+    if (groups.empty())
+        return false;
+
+    std::vector<bool> isInGroup(columnsSize.size(), false);
+    for (auto& group : groups)
+    {
+        if (group.empty())
+            return false;
+
+        for (const size_t column : group)
+        {
+            if (column >= columnsSize.size() || isInGroup[column])
+                return false;
+
+            isInGroup[column] = true;
+        }
+
+        std::sort(group.begin(), group.end());
+    }
+
+    if (std::find(isInGroup.begin(), isInGroup.end(), false) != isInGroup.end())
+        return false;
+
+    // after sort key column can be only at the beginning of group
+    auto keyGroup = std::find_if(groups.begin(), groups.end(), [](const std::vector<size_t>& group) { return group[0] == 0; });
+    std::iter_swap(groups.begin(), keyGroup);
+
+    return true;
+}
+
+std::vector<size_t> ColumnLSMTree::getGroupsToFetch(const std::vector<size_t>& columnsToFetch) const noexcept(true)
+{
+    std::vector<size_t> groups;
+    for (size_t i = 0; i < columnGroups.size(); ++i)
+    {
+        auto isRequested = [&columnsToFetch](size_t column) { return std::find(columnsToFetch.begin(), columnsToFetch.end(), column) != columnsToFetch.end(); };
+        if (std::any_of(columnGroups[i].begin(), columnGroups[i].end(), isRequested))
+            groups.push_back(i);
+    }
+
+    return groups;
+}
+
+double ColumnLSMTree::insertEntriesHelper(size_t numOperations) noexcept(true)
+{
+    // memtable is split by groups, so each group flushes and compacts own sorted runs
+    std::vector<double> groupsTime(lsmGroups.size(), 0.0);
+    for (size_t i = 0; i < lsmGroups.size(); ++i)
+        groupsTime[i] = lsmGroups[i].insertEntries(numOperations);
+
+    return getColumnsTime(groupsTime);
+}
+
+double ColumnLSMTree::deleteEntriesHelper(size_t numOperations) noexcept(true)
+{
+    std::vector<double> groupsTime(lsmGroups.size(), 0.0);
+    for (size_t i = 0; i < lsmGroups.size(); ++i)
+        groupsTime[i] = lsmGroups[i].deleteEntries(numOperations);
+
+    return getColumnsTime(groupsTime);
+}
+
+double ColumnLSMTree::findEntriesHelper(const std::vector<size_t>& columnsToFetch, size_t numEntries, size_t numOperations, bool isPointSearch) noexcept(true)
+{
+    std::vector colCopy = columnsToFetch;
+    std::sort(colCopy.begin(), colCopy.end());
+
+    if (colCopy[0] != 0)
+    {
+        LOGGER_LOG_ERROR("You need key column!");
+        return 0.0;
+    }
+
+    // only groups with requested columns are searched
+    const std::vector<size_t> groups = getGroupsToFetch(colCopy);
+
+    std::vector<double> groupsTime(groups.size(), 0.0);
+    for (size_t i = 0; i < groups.size(); ++i)
+        groupsTime[i] = isPointSearch ? lsmGroups[groups[i]].findPointEntries(numOperations) : lsmGroups[groups[i]].findRangeEntries(numEntries, numOperations);
+
+    return getColumnsTime(groupsTime);
+}
+
+ColumnLSMTree::ColumnLSMTree(const char* name, Disk* disk, const std::vector<size_t>& columnsSize, const std::vector<std::vector<size_t>>& columnGroups, size_t nodeSize, size_t memtableSize, size_t lvlRatio)
+: DBIndexColumn(name, disk, columnsSize), columnGroups{columnGroups}, disk{std::unique_ptr<DiskColumnOverlay>(new DiskColumnOverlay(disk))}, nodeSize{nodeSize}, memtableSize{memtableSize}, lvlRatio{lvlRatio}
+{
+    if (!normalizeColumnGroups(this->columnGroups))
+    {
+        if (!columnGroups.empty())
+            LOGGER_LOG_WARN("Column groups are invalid, using 1 group per column");
+
+        this->columnGroups.clear();
+        for (size_t i = 0; i < columnsSize.size(); ++i)
+            this->columnGroups.push_back(std::vector<size_t>{i});
+    }
+
+    // memtable keeps whole rows, so after flush each group gets the same entries
+    const size_t memtableEntries = memtableSize / sizeRecord;
+    if (memtableEntries == 0)
+        LOGGER_LOG_WARN("Memtable {} is smaller than record {}", memtableSize, sizeRecord);
+
+    lsmGroups.reserve(this->columnGroups.size());
+    for (const auto& group : this->columnGroups)
+    {
+        // each sorted run keeps key next to columns of group
+        size_t groupDataSize = 0;
+        for (const size_t column : group)
+            if (column != 0)
+                groupDataSize += columnsSize[column];
+
+        lsmGroups.push_back(LSMTree(new Disk(*disk), sizeKey, groupDataSize, nodeSize, memtableEntries * (sizeKey + groupDataSize), lvlRatio));
+    }
+
+    LOGGER_LOG_DEBUG("ColumnLSMTree created {}", toStringFull());
+}
+
+ColumnLSMTree::ColumnLSMTree(Disk* disk, const std::vector<size_t>& columnsSize, const std::vector<std::vector<size_t>>& columnGroups, size_t nodeSize, size_t memtableSize, size_t lvlRatio)
+: ColumnLSMTree("ColumnLSMTree", disk, columnsSize, columnGroups, nodeSize, memtableSize, lvlRatio)
+{
+
+}
+
+ColumnLSMTree::ColumnLSMTree(Disk* disk, const std::vector<size_t>& columnsSize, const std::vector<std::vector<size_t>>& columnGroups)
+: ColumnLSMTree(disk, columnsSize, columnGroups, 1UL << 21 /* 2MB is a default for LSMTree */, 1UL << 21, 5)
+{
+
+}
+
+ColumnLSMTree::ColumnLSMTree(Disk* disk, const std::vector<size_t>& columnsSize)
+: ColumnLSMTree(disk, columnsSize, std::vector<std::vector<size_t>>())
+{
+
+}
+
+ColumnLSMTree::ColumnLSMTree(const char* name, Disk* disk, const std::vector<size_t>& columnsSize)
+: ColumnLSMTree(name, disk, columnsSize, std::vector<std::vector<size_t>>(), 1UL << 21 /* 2MB is a default for LSMTree */, 1UL << 21, 5)
+{
+
+}
+
+ColumnLSMTree::ColumnLSMTree(const ColumnLSMTree& other)
+: DBIndexColumn(other), columnGroups{other.columnGroups}, lsmGroups{other.lsmGroups}, disk{std::unique_ptr<DiskColumnOverlay>(new DiskColumnOverlay(other.disk.get()))}, nodeSize{other.nodeSize}, memtableSize{other.memtableSize}, lvlRatio{other.lvlRatio}
+{
+
+}
+
+ColumnLSMTree& ColumnLSMTree::operator=(const ColumnLSMTree& other)
+{
+    if (this == &other)
+        return *this;
+
+    DBIndexColumn::operator =(other);
+    disk.reset(new DiskColumnOverlay(other.disk.get()));
+    columnGroups = other.columnGroups;
+    lsmGroups = other.lsmGroups;
+    nodeSize = other.nodeSize;
+    memtableSize = other.memtableSize;
+    lvlRatio = other.lvlRatio;
+
+    return *this;
+}
+
+std::string ColumnLSMTree::toString(bool oneLine) const noexcept(true)
+{
+    auto buildStringFromVector = [](const std::string &accumulator, const size_t &columnSize)
+    {
+        return accumulator.empty() ? std::to_string(columnSize) : accumulator + "," + std::to_string(columnSize);
+    };
+
+    const std::string columnsString = std::string("{ ") + std::accumulate(std::begin(columnsSize), std::end(columnsSize), std::string(), buildStringFromVector) + std::string(" }");
+
+    auto buildStringFromGroups = [&buildStringFromVector](const std::string &accumulator, const std::vector<size_t> &group)
+    {
+        const std::string groupString = std::string("{") + std::accumulate(std::begin(group), std::end(group), std::string(), buildStringFromVector) + std::string("}");
+        return accumulator.empty() ? groupString : accumulator + "," + groupString;
+    };
+
+    const std::string groupsString = std::string("{ ") + std::accumulate(std::begin(columnGroups), std::end(columnGroups), std::string(), buildStringFromGroups) + std::string(" }");
+
+    (void)getDisk(); // this triggers disk stat merge
+
+    if (oneLine)
+        return std::string(std::string("ColumnLSMTree {") +
+                           std::string(" .sizeKey = ") + std::to_string(sizeKey) +
+                           std::string(" .sizeData = ") + std::to_string(sizeData) +
+                           std::string(" .sizeRecord = ") + std::to_string(sizeRecord) +
+                           std::string(" .columnsSize = ") + columnsString +
+                           std::string(" .columnGroups = ") + groupsString +
+                           std::string(" .numEntries = ") + std::to_string(getNumEntries()) +
+                           std::string(" .disk = ") + disk->toStringFull() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("ColumnLSMTree {\n") +
+                           std::string("\t.sizeKey = ") + std::to_string(sizeKey) + std::string("\n") +
+                           std::string("\t.sizeData = ") + std::to_string(sizeData) + std::string("\n") +
+                           std::string("\t.sizeRecord = ") + std::to_string(sizeRecord) + std::string("\n") +
+                           std::string("\t.columnsSize = ") + columnsString + std::string("\n") +
+                           std::string("\t.columnGroups = ") + groupsString + std::string("\n") +
+                           std::string("\t.numEntries = ") + std::to_string(getNumEntries()) + std::string("\n") +
+                           std::string("\t.disk = ") + disk->toStringFull() + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string ColumnLSMTree::toStringFull(bool oneLine) const noexcept(true)
+{
+    auto buildStringLSMGroups = [](const std::string &accumulator, const LSMTree &lsm)
+    {
+        return accumulator.empty() ? lsm.toStringFull() : accumulator + "," + lsm.toStringFull();
+    };
+
+    const std::string lsmGroupsString = std::string("{") +
+                                        std::accumulate(std::begin(lsmGroups), std::end(lsmGroups), std::string(), buildStringLSMGroups) +
+                                        std::string("}");
+
+    if (oneLine)
+        return std::string(std::string("ColumnLSMTree {") +
+                           std::string(" .index = ") + toString() +
+                           std::string(" .nodeSize = ") + std::to_string(nodeSize) +
+                           std::string(" .memtableSize = ") + std::to_string(memtableSize) +
+                           std::string(" .lvlRatio = ") + std::to_string(lvlRatio) +
+                           std::string(" .columnsParallelism = ") + std::to_string(columnsParallelism) +
+                           std::string(" .counters = ") + counters.toStringFull() +
+                           std::string(" .lsmGroups = ") + lsmGroupsString +
+                           std::string(" }"));
+    else
+        return std::string(std::string("ColumnLSMTree {\n") +
+                           std::string("\t.index = ") + toString() + std::string("\n") +
+                           std::string("\t.nodeSize = ") + std::to_string(nodeSize) + std::string("\n") +
+                           std::string("\t.memtableSize = ") + std::to_string(memtableSize) + std::string("\n") +
+                           std::string("\t.lvlRatio = ") + std::to_string(lvlRatio) + std::string("\n") +
+                           std::string("\t.columnsParallelism = ") + std::to_string(columnsParallelism) + std::string("\n") +
+                           std::string("\t.counters = ") + counters.toStringFull() + std::string("\n") +
+                           std::string("\t.lsmGroups = ") + lsmGroupsString + std::string("\n") +
+                           std::string("}"));
+}
+
+const Disk& ColumnLSMTree::getDisk() const noexcept(true)
+{
+    // We need to merge all pieces of disks to 1 disk
+    disk->resetState();
+
+    for (size_t i = 0; i < lsmGroups.size(); ++i)
+        disk->addStats(lsmGroups[i].getDisk());
+
+    return *disk.get();
+}
+
+size_t ColumnLSMTree::getNumEntries() const noexcept(true)
+{
+    return lsmGroups[0].getNumEntries();
+}
+
+size_t ColumnLSMTree::getHeight() const noexcept(true)
+{
+    return lsmGroups[0].getHeight();
+}
+
+const LSMTree::LSMLvl& ColumnLSMTree::getColumnLSMLvl(size_t lvl, size_t groupIndex) const noexcept(true)
+{
+    if (groupIndex >= lsmGroups.size())
+        LOGGER_LOG_ERROR("GroupIndex = {} is greater than number of groups {}", groupIndex, lsmGroups.size());
+
+    return lsmGroups[groupIndex].getLSMLvl(lvl);
+}
+
+bool ColumnLSMTree::isBulkloadSupported() const noexcept(true)
+{
+    return false;
+}
+
+double ColumnLSMTree::insertEntries(size_t numOperations) noexcept(true)
+{
+    const double time = insertEntriesHelper(numOperations);
+
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME, time);
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS, numOperations);
+
+    LOGGER_LOG_TRACE("Inserted {} entries, took {}s", numOperations, time);
+
+    return time;
+}
+
+double ColumnLSMTree::bulkloadEntries(size_t numEntries) noexcept(true)
+{
+    (void)numEntries;
+
+    LOGGER_LOG_WARN("Bulkload is unsupported");
+
+    // unsupported
+    return 0.0;
+}
+
+double ColumnLSMTree::deleteEntries(size_t numOperations) noexcept(true)
+{
+    const size_t realDeletion = std::min(getNumEntries(), numOperations);
+    const double time = deleteEntriesHelper(numOperations);
+
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_DELETE_TOTAL_TIME, time);
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_DELETE_TOTAL_OPERATIONS, realDeletion);
+
+    LOGGER_LOG_TRACE("Deleted {} entries, took {}s", numOperations, time);
+
+    return time;
+}
+
+double ColumnLSMTree::findPointEntries(const std::vector<size_t>& columnsToFetch, size_t numOperations) noexcept(true)
+{
+    const double time = findEntriesHelper(columnsToFetch, 1, numOperations, true);
+
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_PSEARCH_TOTAL_TIME, time);
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_PSEARCH_TOTAL_OPERATIONS, numOperations);
+
+    LOGGER_LOG_TRACE("Found {} entries, took {}s", numOperations, time);
+
+    return time;
+}
+
+double ColumnLSMTree::findPointEntries(const std::vector<size_t>& columnsToFetch, double selectivity, size_t numOperations) noexcept(true)
+{
+    LOGGER_LOG_TRACE("selectivity={}, numOperations={}, call findPointEntries({})", selectivity, numOperations, static_cast<size_t>(static_cast<double>(getNumEntries()) * selectivity) * numOperations);
+
+    return findPointEntries(columnsToFetch, static_cast<size_t>(static_cast<double>(getNumEntries()) * selectivity) * numOperations);
+}
+
+double ColumnLSMTree::findRangeEntries(const std::vector<size_t>& columnsToFetch, size_t numEntries, size_t numOperations) noexcept(true)
+{
+    const double time = findEntriesHelper(columnsToFetch, numEntries, numOperations, false);
+
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_TIME, time);
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_OPERATIONS, numOperations);
+
+    LOGGER_LOG_TRACE("Found {} entries, took {}s", numOperations, time);
+
+    return time;
+}
+
+double ColumnLSMTree::findRangeEntries(const std::vector<size_t>& columnsToFetch, double selectivity, size_t numOperations) noexcept(true)
+{
+    LOGGER_LOG_TRACE("selectivity={}, numOperations={}, call findRangeEntries({}, {})", selectivity, numOperations, static_cast<size_t>(static_cast<double>(getNumEntries()) * selectivity), numOperations);
+
+    return findRangeEntries(columnsToFetch, static_cast<size_t>(static_cast<double>(getNumEntries()) * selectivity), numOperations);
+}
+
+void ColumnLSMTree::createTopologyAfterInsert(size_t numEntries) noexcept(true)
+{
+    for (size_t i = 0; i < lsmGroups.size(); ++i)
+        lsmGroups[i].createTopologyAfterInsert(numEntries);
+}
\ No newline at end of file
@@ -0,0 +1,464 @@
+#include <adaptiveMerging/databaseCracking.hpp>
+#include <logger/logger.hpp>
+
+#include <numeric>
+#include <algorithm>
+
+DatabaseCracking::CrackerColumnManager::CrackerColumnManager(size_t numEntries, size_t recordSize, size_t minPieceSize, bool isStochastic)
+: AdaptiveMergingFramework::AMUnsortedMemoryManager(numEntries, recordSize, AdaptiveMergingFramework::AMUnsortedMemoryManager::AM_UNSORTED_MEMORY_INVALIDATION_OVERWRITE), minPieceSize{minPieceSize}, isStochastic{isStochastic}, numCracks{0}, rng{std::mt19937(235111741)}
+{
+    // whole column is 1 big piece before first query
+    if (numEntries > 0)
+        pieces.push_back(numEntries);
+
+    LOGGER_LOG_DEBUG("CrackerColumnManager created {}", toStringFull());
+}
+
+double DatabaseCracking::CrackerColumnManager::scanBytes(Disk* disk, size_t bytes, size_t bytesToSwap) noexcept(true)
+{
+    double time = 0.0;
+
+    // long scans are done in chunks, so controller cache is flushed before it grows too much
+    const size_t chunkSize = disk->getLowLevelController().getPageSize() * pagesInScanChunk;
+    while (bytes > 0)
+    {
+        const size_t bytesToRead = std::min(bytes, chunkSize);
+        const size_t bytesToOverwrite = std::min(bytesToSwap, chunkSize);
+
+        const uintptr_t addr = disk->getCurrentMemoryAddr();
+        time += disk->readBytes(addr, bytesToRead);
+        if (bytesToOverwrite > 0)
+            time += disk->overwriteBytes(addr, bytesToOverwrite);
+        time += disk->flushCache();
+
+        bytes -= bytesToRead;
+        bytesToSwap -= bytesToOverwrite;
+    }
+
+    return time;
+}
+
+double DatabaseCracking::CrackerColumnManager::crackPiece(Disk* disk, size_t pieceIndex, size_t offset) noexcept(true)
+{
+    double time = 0.0;
+
+    const size_t pieceEntries = pieces[pieceIndex];
+    const size_t pieceBytes = pieceEntries * recordSize;
+
+    // in-place partitioning reads whole piece and swaps on average half of entries
+    time += scanBytes(disk, pieceBytes, pieceBytes / 2);
+
+    pieces[pieceIndex] = offset;
+    pieces.insert(pieces.begin() + static_cast<long>(pieceIndex) + 1, pieceEntries - offset);
+    ++numCracks;
+
+    LOGGER_LOG_TRACE("Piece {} with {} entries cracked at {}, took {}s", pieceIndex, pieceEntries, offset, time);
+
+    return time;
+}
+
+double DatabaseCracking::CrackerColumnManager::crackAt(Disk* disk, size_t pos) noexcept(true)
+{
+    double time = 0.0;
+
+    // find piece with pos inside
+    size_t pieceIndex = 0;
+    size_t pieceStart = 0;
+    while (pieceIndex < pieces.size() && pieceStart + pieces[pieceIndex] <= pos)
+    {
+        pieceStart += pieces[pieceIndex];
+        ++pieceIndex;
+    }
+
+    // pos is on piece border, cracker index knows it already
+    if (pieceIndex >= pieces.size() || pos == pieceStart)
+        return 0.0;
+
+    size_t offset = pos - pieceStart;
+
+    // stochastic cracking: crack at random pivot first, so next queries get smaller pieces no matter of query pattern
+    if (isStochastic && pieces[pieceIndex] > 2)
+    {
+        std::uniform_int_distribution<size_t> randomizer(1, pieces[pieceIndex] - 1);
+        const size_t randomOffset = randomizer(rng);
+
+        time += crackPiece(disk, pieceIndex, randomOffset);
+
+        if (offset == randomOffset)
+            return time;
+
+        if (offset > randomOffset)
+        {
+            offset -= randomOffset;
+            ++pieceIndex;
+        }
+    }
+
+    time += crackPiece(disk, pieceIndex, offset);
+
+    return time;
+}
+
+size_t DatabaseCracking::CrackerColumnManager::removeConvergedPieces() noexcept(true)
+{
+    size_t convergedEntries = 0;
+
+    auto isConverged = [this](size_t pieceEntries) { return pieceEntries * recordSize < minPieceSize; };
+    for (size_t i = 0; i < pieces.size(); ++i)
+        if (isConverged(pieces[i]))
+            convergedEntries += pieces[i];
+
+    pieces.erase(std::remove_if(pieces.begin(), pieces.end(), isConverged), pieces.end());
+    numEntries -= convergedEntries;
+
+    LOGGER_LOG_TRACE("Converged entries {}, now entries {} in {} pieces", convergedEntries, numEntries, pieces.size());
+
+    return convergedEntries;
+}
+
+double DatabaseCracking::CrackerColumnManager::crackEntries(Disk* disk, size_t numEntries, size_t& convergedEntries) noexcept(true)
+{
+    double time = 0.0;
+    convergedEntries = 0;
+
+    if (numEntries == 0 || this->numEntries == 0)
+        return 0.0;
+
+    numEntries = std::min(numEntries, this->numEntries);
+
+    // query range is placed randomly in column
+    std::uniform_int_distribution<size_t> randomizer(0, this->numEntries - numEntries);
+    const size_t low = randomizer(rng);
+    const size_t high = low + numEntries;
+
+    time += crackAt(disk, low);
+    time += crackAt(disk, high);
+
+    // now query result is a set of pieces, scan them
+    size_t pieceStart = 0;
+    for (size_t i = 0; i < pieces.size() && pieceStart < high; ++i)
+    {
+        if (pieceStart >= low)
+            time += scanBytes(disk, pieces[i] * recordSize, 0);
+
+        pieceStart += pieces[i];
+    }
+
+    convergedEntries = removeConvergedPieces();
+
+    counters.pegCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_LOADING_TOTAL_TIME, time);
+    counters.pegCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_LOADING_TOTAL_OPERATIONS, 1);
+
+    LOGGER_LOG_TRACE("Cracking query [{}, {}), took {}s, converged entries {}, now pieces {}, cracks {}", low, high, time, convergedEntries, pieces.size(), numCracks);
+
+    return time;
+}
+
+double DatabaseCracking::CrackerColumnManager::sortRemainingEntries(Disk* disk) noexcept(true)
+{
+    double time = 0.0;
+
+    if (numEntries == 0)
+        return 0.0;
+
+    time += scanBytes(disk, numEntries * recordSize, numEntries * recordSize);
+
+    // sorted column has crack between every piece
+    numCracks += pieces.size();
+    pieces.clear();
+
+    counters.pegCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_LOADING_TOTAL_TIME, time);
+    counters.pegCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_LOADING_TOTAL_OPERATIONS, 1);
+
+    LOGGER_LOG_TRACE("Sorting remaining {} entries, took {}s", numEntries, time);
+
+    numEntries = 0;
+
+    return time;
+}
+
+double DatabaseCracking::CrackerColumnManager::loadEntries(Disk *disk, size_t numEntries) noexcept(true)
+{
+    numEntries = std::min(numEntries, this->numEntries);
+    if (numEntries == 0)
+        return 0.0;
+
+    // entries to delete are spread over pieces proportionally to piece size
+    size_t entriesLeft = numEntries;
+    for (size_t i = 0; i < pieces.size() && entriesLeft > 0; ++i)
+    {
+        const size_t fromThisPiece = std::min(std::max(pieces[i] * numEntries / this->numEntries, static_cast<size_t>(1)), std::min(pieces[i], entriesLeft));
+        pieces[i] -= fromThisPiece;
+        entriesLeft -= fromThisPiece;
+    }
+
+    // proportional shares are rounded down, spread remainder so pieces always sum up to numEntries
+    for (size_t i = 0; i < pieces.size() && entriesLeft > 0; ++i)
+    {
+        const size_t fromThisPiece = std::min(pieces[i], entriesLeft);
+        pieces[i] -= fromThisPiece;
+        entriesLeft -= fromThisPiece;
+    }
+
+    pieces.erase(std::remove(pieces.begin(), pieces.end(), 0), pieces.end());
+
+    const double time = invalidEntries(disk, numEntries, minPieceSize);
+    this->numEntries -= numEntries;
+
+    LOGGER_LOG_TRACE("Deleting entries {}, took {}s, now entries {}", numEntries, time, this->numEntries);
+
+    return time;
+}
+
+std::string DatabaseCracking::CrackerColumnManager::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("CrackerColumnManager {") +
+                           std::string(" .numEntries = ") + std::to_string(numEntries) +
+                           std::string(" .recordSize = ") + std::to_string(recordSize) +
+                           std::string(" .minPieceSize = ") + std::to_string(minPieceSize) +
+                           std::string(" .isStochastic = ") + std::to_string(isStochastic) +
+                           std::string(" .numPieces = ") + std::to_string(pieces.size()) +
+                           std::string(" .numCracks = ") + std::to_string(numCracks) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("CrackerColumnManager {\n") +
+                           std::string("\t.numEntries = ") + std::to_string(numEntries) + std::string("\n") +
+                           std::string("\t.recordSize = ") + std::to_string(recordSize) + std::string("\n") +
+                           std::string("\t.minPieceSize = ") + std::to_string(minPieceSize) + std::string("\n") +
+                           std::string("\t.isStochastic = ") + std::to_string(isStochastic) + std::string("\n") +
+                           std::string("\t.numPieces = ") + std::to_string(pieces.size()) + std::string("\n") +
+                           std::string("\t.numCracks = ") + std::to_string(numCracks) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string DatabaseCracking::CrackerColumnManager::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("CrackerColumnManager {") +
+                           std::string(" .numEntries = ") + std::to_string(numEntries) +
+                           std::string(" .recordSize = ") + std::to_string(recordSize) +
+                           std::string(" .invalidationType = ") + std::to_string(invalidationType) +
+                           std::string(" .minPieceSize = ") + std::to_string(minPieceSize) +
+                           std::string(" .isStochastic = ") + std::to_string(isStochastic) +
+                           std::string(" .numPieces = ") + std::to_string(pieces.size()) +
+                           std::string(" .numCracks = ") + std::to_string(numCracks) +
+                           std::string(" .counters = ") + counters.toStringFull() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("CrackerColumnManager {\n") +
+                           std::string("\t.numEntries = ") + std::to_string(numEntries) + std::string("\n") +
+                           std::string("\t.recordSize = ") + std::to_string(recordSize) + std::string("\n") +
+                           std::string("\t.invalidationType = ") + std::to_string(invalidationType) + std::string("\n") +
+                           std::string("\t.minPieceSize = ") + std::to_string(minPieceSize) + std::string("\n") +
+                           std::string("\t.isStochastic = ") + std::to_string(isStochastic) + std::string("\n") +
+                           std::string("\t.numPieces = ") + std::to_string(pieces.size()) + std::string("\n") +
+                           std::string("\t.numCracks = ") + std::to_string(numCracks) + std::string("\n") +
+                           std::string("\t.counters = ") + counters.toStringFull() + std::string("\n") +
+                           std::string("}"));
+}
+
+void DatabaseCracking::moveConvergedEntries(size_t convergedEntries) noexcept(true)
+{
+    if (convergedEntries == 0)
+        return;
+
+    // pieces stay where they are, index only starts to know them as sorted
+    index->createTopologyAfterInsert(convergedEntries);
+
+    LOGGER_LOG_TRACE("Moved {} converged entries, now index has {} entries", convergedEntries, index->getNumEntries());
+}
+
+double DatabaseCracking::findEntriesHelper(size_t numEntries, size_t numOperations) noexcept(true)
+{
+    double time = 0.0;
+    CrackerColumnManager* manager = dynamic_cast<CrackerColumnManager*>(memoryManager.get());
+    Disk* disk = const_cast<Disk*>(&index->getDisk());
+
+    for (size_t i = 0; i < numOperations; ++i)
+    {
+        auto splitEntries = splitLoadForIndexAndUnsortedPart(numEntries);
+        size_t loadFromIndex = splitEntries.first;
+        size_t loadFromColumn = splitEntries.second;
+
+        if (loadFromIndex > 0)
+            time += index->findRangeEntries(loadFromIndex);
+
+        if (loadFromColumn > 0)
+        {
+            size_t convergedEntries = 0;
+
+            // query covers whole column, so there is nothing to crack
+            if (loadFromColumn >= manager->getNumEntries())
+            {
+                convergedEntries = manager->getNumEntries();
+                time += manager->sortRemainingEntries(disk);
+            }
+            else
+                time += manager->crackEntries(disk, loadFromColumn, convergedEntries);
+
+            moveConvergedEntries(convergedEntries);
+        }
+
+        // cracking small column is a waste of time, sort it
+        if (manager->getNumEntries() > 0 && manager->getNumEntries() <= sortTreshold)
+        {
+            const size_t convergedEntries = manager->getNumEntries();
+            time += manager->sortRemainingEntries(disk);
+
+            moveConvergedEntries(convergedEntries);
+        }
+    }
+
+    LOGGER_LOG_TRACE("FindEntriesHelper: entries {}, operations {}, took {}s", numEntries, numOperations, time);
+
+    return time;
+}
+
+double DatabaseCracking::deleteEntriesHelper(size_t numOperations) noexcept(true)
+{
+    double time = 0.0;
+    CrackerColumnManager* manager = dynamic_cast<CrackerColumnManager*>(memoryManager.get());
+    Disk* disk = const_cast<Disk*>(&index->getDisk());
+
+    const size_t entriesToDelete = std::min(numOperations, getNumEntries());
+
+    auto splitEntries = splitLoadForIndexAndUnsortedPart(entriesToDelete);
+    size_t loadFromIndex = splitEntries.first;
+    size_t loadFromColumn = splitEntries.second;
+
+    if (loadFromIndex > 0)
+        time += index->deleteEntries(loadFromIndex);
+
+    time += manager->loadEntries(disk, loadFromColumn);
+    moveConvergedEntries(manager->removeConvergedPieces());
+
+    if (manager->getNumEntries() > 0 && manager->getNumEntries() <= sortTreshold)
+    {
+        const size_t convergedEntries = manager->getNumEntries();
+        time += manager->sortRemainingEntries(disk);
+
+        moveConvergedEntries(convergedEntries);
+    }
+
+    LOGGER_LOG_TRACE("DeleteEntriesHelper: operations {}, took {}s", numOperations, time);
+
+    return time;
+}
+
+DatabaseCracking::DatabaseCracking(const char* name, DBIndex* index, size_t startingEntries, size_t minPieceSize, bool isStochastic)
+: AdaptiveMergingFramework(name, index, new CrackerColumnManager(startingEntries, index->getRecordSize(), minPieceSize, isStochastic), startingEntries)
+{
+    LOGGER_LOG_DEBUG("DatabaseCracking created {}", toStringFull());
+}
+
+void DatabaseCracking::resetState() noexcept(true)
+{
+    const CrackerColumnManager* manager = dynamic_cast<const CrackerColumnManager*>(memoryManager.get());
+
+    const bool background = manager->isBackgroundInvalidation();
+
+    index->resetState();
+    memoryManager.reset(new CrackerColumnManager(startingEntries, getRecordSize(), manager->minPieceSize, manager->isStochastic));
+    setBackgroundInvalidation(background);
+}
+
+std::string DatabaseCracking::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DatabaseCracking {") +
+                           std::string(" .name = ") + std::string(name) +
+                           std::string(" .numEntries = ") + std::to_string(getNumEntries()) +
+                           std::string(" .crackerIndexSize = ") + std::to_string(getCrackerIndexSize()) +
+                           std::string(" .memoryManager = ") + memoryManager->toString() +
+                           std::string(" .index = ") + index->toString() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DatabaseCracking {\n") +
+                           std::string("\t.name = ") + std::string(name) + std::string("\n") +
+                           std::string("\t.numEntries = ") +  std::to_string(getNumEntries()) + std::string("\n") +
+                           std::string("\t.crackerIndexSize = ") + std::to_string(getCrackerIndexSize()) + std::string("\n") +
+                           std::string("\t.memoryManager = ") + memoryManager->toString() + std::string("\n") +
+                           std::string("\t.index = ") + index->toString() + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string DatabaseCracking::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DatabaseCracking {") +
+                           std::string(" .name = ") + std::string(name) +
+                           std::string(" .startingEntries = ") + std::to_string(startingEntries) +
+                           std::string(" .numEntries = ") + std::to_string(getNumEntries()) +
+                           std::string(" .crackerIndexSize = ") + std::to_string(getCrackerIndexSize()) +
+                           std::string(" .memoryManager = ") + memoryManager->toStringFull() +
+                           std::string(" .index = ") + index->toStringFull() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DatabaseCracking {\n") +
+                           std::string("\t.name = ") + std::string(name) + std::string("\n") +
+                           std::string("\t.startingEntries = ") + std::to_string(startingEntries) + std::string("\n") +
+                           std::string("\t.numEntries = ") +  std::to_string(getNumEntries()) + std::string("\n") +
+                           std::string("\t.crackerIndexSize = ") + std::to_string(getCrackerIndexSize()) + std::string("\n") +
+                           std::string("\t.memoryManager = ") + memoryManager->toStringFull() + std::string("\n") +
+                           std::string("\t.index = ") + index->toStringFull() + std::string("\n") +
+                           std::string("}"));
+}
+
+double DatabaseCracking::insertEntries(size_t numOperations) noexcept(true)
+{
+    LOGGER_LOG_TRACE("Cracking: insertEntries {}", numOperations);
+
+    return index->insertEntries(numOperations);
+}
+
+double DatabaseCracking::bulkloadEntries(size_t numEntries) noexcept(true)
+{
+    LOGGER_LOG_TRACE("Cracking: bulkloadEntries {}", numEntries);
+
+    return index->bulkloadEntries(numEntries);
+}
+
+double DatabaseCracking::deleteEntries(size_t numOperations) noexcept(true)
+{
+    LOGGER_LOG_TRACE("Cracking: DeleteEntries {}", numOperations);
+
+    return deleteEntriesHelper(numOperations);
+}
+
+double DatabaseCracking::findPointEntries(size_t numOperations) noexcept(true)
+{
+    const double time = findEntriesHelper(1, numOperations);
+
+    LOGGER_LOG_TRACE("Found {} entries, took {}s", numOperations, time);
+
+    return time;
+}
+
+double DatabaseCracking::findPointEntries(double selectivity, size_t numOperations) noexcept(true)
+{
+    LOGGER_LOG_TRACE("selectivity={}, numOperations={}, call findPointEntries({})", selectivity, numOperations, static_cast<size_t>(static_cast<double>(getNumEntries()) * selectivity) * numOperations);
+
+    return findPointEntries(static_cast<size_t>(static_cast<double>(getNumEntries()) * selectivity) * numOperations);
+}
+
+double DatabaseCracking::findRangeEntries(size_t numEntries, size_t numOperations) noexcept(true)
+{
+    const double time = findEntriesHelper(numEntries, numOperations);
+
+    LOGGER_LOG_TRACE("Found {} entries, took {}s", numOperations, time);
+
+    return time;
+}
+
+double DatabaseCracking::findRangeEntries(double selectivity, size_t numOperations) noexcept(true)
+{
+    LOGGER_LOG_TRACE("selectivity={}, numOperations={}, call findRangeEntries({}, {})", selectivity, numOperations, static_cast<size_t>(static_cast<double>(getNumEntries()) * selectivity), numOperations);
+
+    return findRangeEntries(static_cast<size_t>(static_cast<double>(getNumEntries()) * selectivity), numOperations);
+}
+
+void DatabaseCracking::createTopologyAfterInsert(size_t numEntries) noexcept(true)
+{
+    index->createTopologyAfterInsert(numEntries);
+}
@@ -1,8 +1,10 @@
 #include <numeric>
+#include <algorithm>
+#include <functional>
 #include <index/dbIndexColumn.hpp>
 
 DBIndexColumn::DBIndexColumn(const char*name, Disk* disk, const std::vector<size_t>& columnsSize)
-: name{name}, disk{std::unique_ptr<Disk>(disk)}, columnsSize{std::vector<size_t>(columnsSize)}, numEntries{0}
+: name{name}, disk{std::unique_ptr<Disk>(disk)}, columnsSize{std::vector<size_t>(columnsSize)}, numEntries{0}, columnsParallelism{1}
 {
     const size_t numOfColumns = columnsSize.size();
     if (numOfColumns < 2)
@@ -23,6 +25,7 @@ DBIndexColumn::DBIndexColumn(const DBIndexColumn& other)
 : DBIndexColumn(other.name, (*other.disk).clone(), other.columnsSize)
 {
     numEntries = other.numEntries;
+    columnsParallelism = other.columnsParallelism;
     counters = other.counters;
 }
 
@@ -39,6 +42,7 @@ DBIndexColumn& DBIndexColumn::operator=(const DBIndexColumn& other)
 
     numEntries = other.numEntries;
     columnsSize = other.columnsSize;
+    columnsParallelism = other.columnsParallelism;
     counters = other.counters;
 
     return *this;
@@ -109,6 +113,32 @@ std::string DBIndexColumn::toStringFull(bool oneLine) const noexcept(true)
                            std::string("}"));
 }
 
+double DBIndexColumn::getColumnsTime(const std::vector<double>& columnsTime) const noexcept(true)
+{
+    if (columnsParallelism == 1 || columnsTime.size() <= 1)
+        return std::accumulate(columnsTime.begin(), columnsTime.end(), 0.0);
+
+    if (columnsParallelism == 0 || columnsParallelism >= columnsTime.size())
+        return *std::max_element(columnsTime.begin(), columnsTime.end());
+
+    // longest columns first, each column goes to the channel which is free as the first one
+    std::vector<double> sortedTime = columnsTime;
+    std::sort(sortedTime.begin(), sortedTime.end(), std::greater<double>());
+
+    std::vector<double> channelsTime(columnsParallelism, 0.0);
+    for (const double time : sortedTime)
+        *std::min_element(channelsTime.begin(), channelsTime.end()) += time;
+
+    return *std::max_element(channelsTime.begin(), channelsTime.end());
+}
+
+double DBIndexColumn::findPredicateEntries(const std::vector<size_t>& columnsToFetch, double selectivity, double clustering, size_t numOperations) noexcept(true)
+{
+    (void)clustering;
+
+    return findRangeEntries(columnsToFetch, selectivity, numOperations);
+}
+
 void DBIndexColumn::resetState() noexcept(true)
 {
     disk->resetState();
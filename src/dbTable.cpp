@@ -3,9 +3,11 @@
 
 #include <numeric>
 
-DBTable::DBTable(const char* name, std::vector<size_t> columnSize)
-: name{name}, columnSize{columnSize}
+DBTable::DBTable(const char* name, std::vector<size_t> columnSize, std::vector<double> columnCompressionRatio)
+: name{name}, columnSize{columnSize}, columnCompressionRatio{columnCompressionRatio}
 {
+    this->columnCompressionRatio.resize(columnSize.size(), 1.0);
+
     if (columnSize.size() == 0)
     {
         LOGGER_LOG_ERROR("Table needs at least 1 columns");
@@ -22,12 +24,30 @@ DBTable::DBTable(const char* name, std::vector<size_t> columnSize)
     LOGGER_LOG_DEBUG("DBTable created {}", toStringFull());
 }
 
+DBTable::DBTable(const char* name, std::vector<size_t> columnSize)
+: DBTable(name, columnSize, std::vector<double>())
+{
+
+}
+
 DBTable::DBTable(std::vector<size_t> columnSize)
 : DBTable("DBTable", columnSize)
 {
 
 }
 
+double DBTable::getRecordCompressionRatio() const noexcept(true)
+{
+    if (sizeRecord == 0)
+        return 1.0;
+
+    double compressedRecord = 0.0;
+    for (size_t i = 0; i < columnSize.size(); ++i)
+        compressedRecord += static_cast<double>(columnSize[i]) * columnCompressionRatio[i];
+
+    return compressedRecord / static_cast<double>(sizeRecord);
+}
+
 std::string DBTable::toString(bool oneLine) const noexcept(true)
 {
     return toStringFull(oneLine);
@@ -40,7 +60,13 @@ std::string DBTable::toStringFull(bool oneLine) const noexcept(true)
         return accumulator.empty() ? std::to_string(columnSize) : accumulator + "," + std::to_string(columnSize);
     };
 
+    auto buildStringFromRatioVector = [](const std::string &accumulator, const double &ratio)
+    {
+        return accumulator.empty() ? std::to_string(ratio) : accumulator + "," + std::to_string(ratio);
+    };
+
     const std::string columnsString = std::string("{ ") + std::accumulate(std::begin(columnSize), std::end(columnSize), std::string(), buildStringFromVector) + std::string(" }");
+    const std::string compressionString = std::string("{ ") + std::accumulate(std::begin(columnCompressionRatio), std::end(columnCompressionRatio), std::string(), buildStringFromRatioVector) + std::string(" }");
 
 
     if (oneLine)
@@ -50,6 +76,7 @@ std::string DBTable::toStringFull(bool oneLine) const noexcept(true)
                            std::string(" .sizeData = ") + std::to_string(sizeData) +
                            std::string(" .sizeRecord = ") + std::to_string(sizeRecord) +
                            std::string(" .columnsSize = ") + columnsString +
+                           std::string(" .columnsCompressionRatio = ") + compressionString +
                            std::string(" }"));
     else
         return std::string(std::string("DBTable {\n") +
@@ -58,5 +85,6 @@ std::string DBTable::toStringFull(bool oneLine) const noexcept(true)
                            std::string("\t.sizeData = ") + std::to_string(sizeData) + std::string("\n") +
                            std::string("\t.sizeRecord = ") + std::to_string(sizeRecord) + std::string("\n") +
                            std::string("\t.columnsSize = ") + columnsString + std::string("\n") +
+                           std::string("\t.columnsCompressionRatio = ") + compressionString + std::string("\n") +
                            std::string("}"));
 }
\ No newline at end of file
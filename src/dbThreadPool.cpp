@@ -1,4 +1,11 @@
 #include <threadPool/dbThreadPool.hpp>
 
 thread_pool DBThreadPool::threadPool;
-std::mutex DBThreadPool::mutex;
\ No newline at end of file
+std::mutex DBThreadPool::mutex;
+
+thread_pool& DBThreadPool::getIndexThreadPool()
+{
+    static thread_pool indexThreadPool(std::thread::hardware_concurrency());
+
+    return indexThreadPool;
+}
\ No newline at end of file
@@ -26,6 +26,21 @@ double Disk::flushCache() noexcept(true)
     return flushTime;
 }
 
+double Disk::setPlacementHint(size_t hint, size_t hintBytes) noexcept(true)
+{
+    return memoryController->setPlacementHint(hint, hintBytes);
+}
+
+void Disk::setPlacementIsolation(bool isolation) noexcept(true)
+{
+    memoryController->setPlacementIsolation(isolation);
+}
+
+void Disk::enableWearTracking(size_t capacity, size_t sampleRate) noexcept(true)
+{
+    memoryController->enableWearTracking(capacity, sampleRate);
+}
+
 double Disk::readBytes(uintptr_t addr, size_t bytes) noexcept(true)
 {
     const double time = memoryController->readBytes(addr, bytes);
@@ -49,8 +64,9 @@ double Disk::writeBytes(uintptr_t addr, size_t bytes) noexcept(true)
     return time;
 }
 
-double Disk::overwriteBytes(uintptr_t addr, size_t bytes) noexcept(true)
+double Disk::overwriteBytes(uintptr_t addr, size_t bytes, double bitChangeRatio) noexcept(true)
 {
+    memoryController->setBitChangeRatio(bitChangeRatio);
     const double time = memoryController->overwriteBytes(addr, bytes);
 
     // on most of the disks (right now on every disk) time is 0, because real overwriting is during flushing the cache
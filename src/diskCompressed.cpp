@@ -0,0 +1,63 @@
+#include <disk/diskCompressed.hpp>
+#include <logger/logger.hpp>
+
+DiskCompressed::DiskCompressed(MemoryControllerCompressed* controller)
+: Disk(controller)
+{
+    LOGGER_LOG_DEBUG("Disk Compressed created: {}", toStringFull());
+}
+
+DiskCompressed::DiskCompressed(const Disk& disk, double compressionRatio, double compressThroughput, double decompressThroughput)
+: DiskCompressed(new MemoryControllerCompressed(new MemoryModelCompressed(disk.getLowLevelController().getMemoryModel(), compressionRatio, compressThroughput, decompressThroughput)))
+{
+
+}
+
+DiskCompressed::DiskCompressed(const Disk& disk, const DBTable& table, double compressThroughput, double decompressThroughput)
+: DiskCompressed(disk, table.getRecordCompressionRatio(), compressThroughput, decompressThroughput)
+{
+    for (size_t i = 0; i < table.getNumColumns(); ++i)
+        setHintCompressionRatio(i, table.getColumnCompressionRatio(i));
+}
+
+double DiskCompressed::setPlacementHint(size_t hint, size_t hintBytes) noexcept(true)
+{
+    // pages in cache belong to previous hint
+    double time = flushCache();
+    time += Disk::setPlacementHint(hint, hintBytes);
+
+    return time;
+}
+
+void DiskCompressed::setHintCompressionRatio(size_t hint, double ratio) noexcept(true)
+{
+    dynamic_cast<MemoryControllerCompressed*>(memoryController.get())->setHintCompressionRatio(hint, ratio);
+}
+
+std::string DiskCompressed::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DiskCompressed {") +
+                           std::string(" .memoryController = ") + memoryController->toString() +
+                           std::string(" .diskCounters = ") + diskCounters.toString() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DiskCompressed {\n") +
+                           std::string("\t.memoryController = ") + memoryController->toString()  + std::string("\n") +
+                           std::string("\t.diskCounters = ") + diskCounters.toString() + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string DiskCompressed::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DiskCompressed {") +
+                           std::string(" .memoryController = ") + memoryController->toStringFull() +
+                           std::string(" .diskCounters = ") + diskCounters.toStringFull() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DiskCompressed {\n") +
+                           std::string("\t.memoryController = ") + memoryController->toStringFull()  + std::string("\n") +
+                           std::string("\t.diskCounters = ") + diskCounters.toStringFull() + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
@@ -0,0 +1,37 @@
+#include <disk/diskFlashNandPageFTL.hpp>
+#include <logger/logger.hpp>
+
+DiskFlashNandPageFTL::DiskFlashNandPageFTL(MemoryControllerFlashNandPageFTL* controller)
+: Disk(controller)
+{
+    LOGGER_LOG_DEBUG("Disk FlashNandPageFTL created: {}", toStringFull());
+}
+
+std::string DiskFlashNandPageFTL::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DiskFlashNandPageFTL {") +
+                           std::string(" .memoryController = ") + memoryController->toString() +
+                           std::string(" .diskCounters = ") + diskCounters.toString() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DiskFlashNandPageFTL {\n") +
+                           std::string("\t.memoryController = ") + memoryController->toString()  + std::string("\n") +
+                           std::string("\t.diskCounters = ") + diskCounters.toString() + std::string("\n") +
+                           std::string("}"));
+}
+
+
+std::string DiskFlashNandPageFTL::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DiskFlashNandPageFTL {") +
+                           std::string(" .memoryController = ") + memoryController->toStringFull() +
+                           std::string(" .diskCounters = ") + diskCounters.toStringFull() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DiskFlashNandPageFTL {\n") +
+                           std::string("\t.memoryController = ") + memoryController->toStringFull()  + std::string("\n") +
+                           std::string("\t.diskCounters = ") + diskCounters.toStringFull() + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
@@ -7,6 +7,24 @@ DiskPCM::DiskPCM(MemoryControllerPCM* controller)
     LOGGER_LOG_DEBUG("Disk PCM created: {}", toStringFull());
 }
 
+double DiskPCM::setWearLeveling(enum MemoryModelPCM::WearLeveling wearLeveling, size_t capacity, size_t interval) noexcept(true)
+{
+    const double time = flushCache();
+
+    dynamic_cast<MemoryControllerPCM&>(*memoryController).setWearLeveling(wearLeveling, capacity, interval);
+
+    return time;
+}
+
+double DiskPCM::setDifferentialWrite(enum MemoryModelPCM::DifferentialWrite differentialWrite) noexcept(true)
+{
+    const double time = flushCache();
+
+    dynamic_cast<MemoryControllerPCM&>(*memoryController).setDifferentialWrite(differentialWrite);
+
+    return time;
+}
+
 std::string DiskPCM::toString(bool oneLine) const noexcept(true)
 {
     if (oneLine)
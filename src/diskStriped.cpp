@@ -0,0 +1,42 @@
+#include <disk/diskStriped.hpp>
+#include <logger/logger.hpp>
+
+DiskStriped::DiskStriped(MemoryControllerStriped* controller)
+: Disk(controller)
+{
+    LOGGER_LOG_DEBUG("Disk Striped created: {}", toStringFull());
+}
+
+DiskStriped::DiskStriped(const Disk& disk, size_t numDisks, size_t stripeUnit, bool isMirrored)
+: DiskStriped(new MemoryControllerStriped(new MemoryModelStriped(disk.getLowLevelController().getMemoryModel(), numDisks, stripeUnit, isMirrored)))
+{
+
+}
+
+std::string DiskStriped::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DiskStriped {") +
+                           std::string(" .memoryController = ") + memoryController->toString() +
+                           std::string(" .diskCounters = ") + diskCounters.toString() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DiskStriped {\n") +
+                           std::string("\t.memoryController = ") + memoryController->toString()  + std::string("\n") +
+                           std::string("\t.diskCounters = ") + diskCounters.toString() + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string DiskStriped::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DiskStriped {") +
+                           std::string(" .memoryController = ") + memoryController->toStringFull() +
+                           std::string(" .diskCounters = ") + diskCounters.toStringFull() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DiskStriped {\n") +
+                           std::string("\t.memoryController = ") + memoryController->toStringFull()  + std::string("\n") +
+                           std::string("\t.diskCounters = ") + diskCounters.toStringFull() + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include <disk/diskTiered.hpp>
+#include <logger/logger.hpp>
+
+DiskTiered::DiskTiered(MemoryControllerTiered* controller)
+: Disk(controller)
+{
+    LOGGER_LOG_DEBUG("Disk Tiered created: {}", toStringFull());
+}
+
+MemoryModelTiered* DiskTiered::createModel(const std::vector<const Disk*>& tiers, const std::vector<size_t>& tiersCapacity, MemoryModelTiered::MigrationPolicy* policy) noexcept(true)
+{
+    std::vector<const MemoryModel*> models;
+    for (const Disk* disk : tiers)
+        models.push_back(&disk->getLowLevelController().getMemoryModel());
+
+    return new MemoryModelTiered(models, tiersCapacity, policy);
+}
+
+DiskTiered::DiskTiered(const std::vector<const Disk*>& tiers, const std::vector<size_t>& tiersCapacity, MemoryModelTiered::MigrationPolicy* policy)
+: DiskTiered(new MemoryControllerTiered(createModel(tiers, tiersCapacity, policy)))
+{
+
+}
+
+DiskTiered::DiskTiered(const Disk& fast, const Disk& slow, size_t fastCapacity, MemoryModelTiered::MigrationPolicy* policy)
+: DiskTiered(std::vector<const Disk*>{&fast, &slow}, std::vector<size_t>{fastCapacity, 0}, policy)
+{
+
+}
+
+double DiskTiered::setPlacementHint(size_t hint, size_t hintBytes) noexcept(true)
+{
+    // pages in cache belong to previous hint
+    double time = flushCache();
+    time += Disk::setPlacementHint(hint, hintBytes);
+
+    return time;
+}
+
+std::string DiskTiered::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DiskTiered {") +
+                           std::string(" .memoryController = ") + memoryController->toString() +
+                           std::string(" .diskCounters = ") + diskCounters.toString() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DiskTiered {\n") +
+                           std::string("\t.memoryController = ") + memoryController->toString()  + std::string("\n") +
+                           std::string("\t.diskCounters = ") + diskCounters.toString() + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string DiskTiered::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DiskTiered {") +
+                           std::string(" .memoryController = ") + memoryController->toStringFull() +
+                           std::string(" .diskCounters = ") + diskCounters.toStringFull() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DiskTiered {\n") +
+                           std::string("\t.memoryController = ") + memoryController->toStringFull()  + std::string("\n") +
+                           std::string("\t.diskCounters = ") + diskCounters.toStringFull() + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#include <disk/diskZNS.hpp>
+#include <logger/logger.hpp>
+
+DiskZNS::DiskZNS(MemoryControllerZNS* controller)
+: Disk(controller)
+{
+    LOGGER_LOG_DEBUG("Disk ZNS created: {}", toStringFull());
+}
+
+double DiskZNS::setPlacementHint(size_t hint, size_t hintBytes) noexcept(true)
+{
+    // pages in cache belong to previous hint
+    double time = flushCache();
+    time += Disk::setPlacementHint(hint, hintBytes);
+
+    return time;
+}
+
+std::string DiskZNS::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DiskZNS {") +
+                           std::string(" .memoryController = ") + memoryController->toString() +
+                           std::string(" .diskCounters = ") + diskCounters.toString() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DiskZNS {\n") +
+                           std::string("\t.memoryController = ") + memoryController->toString()  + std::string("\n") +
+                           std::string("\t.diskCounters = ") + diskCounters.toString() + std::string("\n") +
+                           std::string("}"));
+}
+
+
+std::string DiskZNS::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DiskZNS {") +
+                           std::string(" .memoryController = ") + memoryController->toStringFull() +
+                           std::string(" .diskCounters = ") + diskCounters.toStringFull() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DiskZNS {\n") +
+                           std::string("\t.memoryController = ") + memoryController->toStringFull()  + std::string("\n") +
+                           std::string("\t.diskCounters = ") + diskCounters.toStringFull() + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
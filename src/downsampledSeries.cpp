@@ -0,0 +1,114 @@
+#include <observability/downsampledSeries.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+#include <limits>
+
+DownsampledSeries::DownsampledSeries(size_t maxPoints)
+: maxPoints{maxPoints}
+{
+    if (this->maxPoints < 2 || this->maxPoints % 2 != 0)
+    {
+        const size_t evenMaxPoints = std::max(this->maxPoints + this->maxPoints % 2, static_cast<size_t>(2));
+        LOGGER_LOG_WARN("Max points {} has to be even and at least 2, using {}", this->maxPoints, evenMaxPoints);
+        this->maxPoints = evenMaxPoints;
+    }
+
+    points.reserve(this->maxPoints);
+    reset();
+}
+
+void DownsampledSeries::compactPoints() noexcept(true)
+{
+    // buckets have the same size, so mean of 2 means is the mean of merged bucket
+    for (size_t i = 0; i < points.size() / 2; ++i)
+        points[i] = (points[2 * i] + points[2 * i + 1]) / 2.0;
+
+    points.resize(points.size() / 2);
+    bucketSize *= 2;
+}
+
+void DownsampledSeries::addValue(double value) noexcept(true)
+{
+    ++numValues;
+    sum += value;
+    min = std::min(min, value);
+    max = std::max(max, value);
+
+    bucketSum += value;
+    ++bucketValues;
+
+    if (bucketValues < bucketSize)
+        return;
+
+    points.push_back(bucketSum / static_cast<double>(bucketValues));
+    bucketSum = 0.0;
+    bucketValues = 0;
+
+    if (points.size() == maxPoints)
+        compactPoints();
+}
+
+std::vector<double> DownsampledSeries::getPoints() const noexcept(true)
+{
+    std::vector<double> result(points);
+    if (bucketValues > 0)
+        result.push_back(bucketSum / static_cast<double>(bucketValues));
+
+    return result;
+}
+
+void DownsampledSeries::reset() noexcept(true)
+{
+    bucketSize = 1;
+    points.clear();
+    bucketSum = 0.0;
+    bucketValues = 0;
+
+    numValues = 0;
+    sum = 0.0;
+    min = std::numeric_limits<double>::max();
+    max = std::numeric_limits<double>::lowest();
+}
+
+std::string DownsampledSeries::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DownsampledSeries {") +
+                           std::string(" .maxPoints = ") + std::to_string(maxPoints) +
+                           std::string(" .bucketSize = ") + std::to_string(bucketSize) +
+                           std::string(" .numValues = ") + std::to_string(numValues) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DownsampledSeries {\n") +
+                           std::string("\t.maxPoints = ") + std::to_string(maxPoints) + std::string("\n") +
+                           std::string("\t.bucketSize = ") + std::to_string(bucketSize) + std::string("\n") +
+                           std::string("\t.numValues = ") + std::to_string(numValues) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string DownsampledSeries::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("DownsampledSeries {") +
+                           std::string(" .maxPoints = ") + std::to_string(maxPoints) +
+                           std::string(" .bucketSize = ") + std::to_string(bucketSize) +
+                           std::string(" .numPoints = ") + std::to_string(getNumPoints()) +
+                           std::string(" .numValues = ") + std::to_string(numValues) +
+                           std::string(" .sum = ") + std::to_string(sum) +
+                           std::string(" .min = ") + std::to_string(getMin()) +
+                           std::string(" .max = ") + std::to_string(getMax()) +
+                           std::string(" .mean = ") + std::to_string(getMean()) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("DownsampledSeries {\n") +
+                           std::string("\t.maxPoints = ") + std::to_string(maxPoints) + std::string("\n") +
+                           std::string("\t.bucketSize = ") + std::to_string(bucketSize) + std::string("\n") +
+                           std::string("\t.numPoints = ") + std::to_string(getNumPoints()) + std::string("\n") +
+                           std::string("\t.numValues = ") + std::to_string(numValues) + std::string("\n") +
+                           std::string("\t.sum = ") + std::to_string(sum) + std::string("\n") +
+                           std::string("\t.min = ") + std::to_string(getMin()) + std::string("\n") +
+                           std::string("\t.max = ") + std::to_string(getMax()) + std::string("\n") +
+                           std::string("\t.mean = ") + std::to_string(getMean()) + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
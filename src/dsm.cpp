@@ -1,16 +1,84 @@
 #include <index/dsm.hpp>
 #include <logger/logger.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
 #include <numeric>
 
+size_t DSM::getTouchedUnits(size_t entriesPerUnit, double selectivity, double clustering) const noexcept(true)
+{
+    const size_t units = (numEntries + entriesPerUnit - 1) / entriesPerUnit;
+    const size_t qualifyingEntries = static_cast<size_t>(static_cast<double>(numEntries) * selectivity);
+    if (qualifyingEntries == 0)
+        return 0;
+
+    // contiguous entries fill whole units, spread entries hit unit with probability 1 - (1 - s)^entriesPerUnit
+    const double clusteredUnits = std::ceil(static_cast<double>(qualifyingEntries) / static_cast<double>(entriesPerUnit));
+    const double spreadUnits = static_cast<double>(units) * (1.0 - std::pow(1.0 - selectivity, static_cast<double>(entriesPerUnit)));
+
+    const double touchedUnits = clustering * clusteredUnits + (1.0 - clustering) * spreadUnits;
+
+    return std::min(units, static_cast<size_t>(std::ceil(touchedUnits)));
+}
+
+double DSM::readUnits(Disk* targetDisk, size_t column, size_t touchedUnits, size_t unitBytes, double clustering) const noexcept(true)
+{
+    double time = 0.0;
+
+    if (touchedUnits == 0)
+        return time;
+
+    time += targetDisk->setPlacementHint(column, numEntries * columnsSize[column]);
+
+    const size_t requests = std::clamp(static_cast<size_t>(std::round((1.0 - clustering) * static_cast<double>(touchedUnits))), static_cast<size_t>(1), touchedUnits);
+    for (size_t i = 0; i < requests; ++i)
+    {
+        const size_t units = touchedUnits / requests + (i < touchedUnits % requests ? 1 : 0);
+        const uintptr_t addr = targetDisk->getCurrentMemoryAddr();
+        time += targetDisk->readBytes(addr, units * unitBytes);
+        time += targetDisk->flushCache();
+    }
+
+    return time;
+}
+
+double DSM::readColumn(Disk* targetDisk, size_t column) const noexcept(true)
+{
+    double time = 0.0;
+
+    time += targetDisk->setPlacementHint(column, numEntries * columnsSize[column]);
+    const uintptr_t addr = targetDisk->getCurrentMemoryAddr();
+    time += targetDisk->readBytes(addr, numEntries * columnsSize[column]);
+    time += targetDisk->flushCache();
+
+    return time;
+}
+
+double DSM::readTouchedUnits(size_t column, size_t touchedUnits, size_t unitBytes, double clustering) noexcept(true)
+{
+    if (touchedUnits == 0)
+        return 0.0;
+
+    // spread units cost 1 request each, so for low clustering sequential scan of whole column can be cheaper.
+    // Both plans are checked on copies of disk, only the cheaper one changes state of disk
+    std::unique_ptr<Disk> unitsDisk(disk->clone());
+    std::unique_ptr<Disk> columnDisk(disk->clone());
+    const double unitsTime = readUnits(unitsDisk.get(), column, touchedUnits, unitBytes, clustering);
+    const double columnTime = readColumn(columnDisk.get(), column);
+
+    if (columnTime < unitsTime)
+        return readColumn(disk.get(), column);
+
+    return readUnits(disk.get(), column, touchedUnits, unitBytes, clustering);
+}
+
 double DSM::findKey() noexcept(true)
 {
     double time = 0.0;
 
     // scan 1st column
-    const uintptr_t addr = disk->getCurrentMemoryAddr();
-    time += disk->readBytes(addr, numEntries * columnsSize[0]);
-    time += disk->flushCache();
+    time += readColumn(disk.get(), 0);
 
     LOGGER_LOG_TRACE("Key found, took {}s", time);
 
@@ -23,14 +91,19 @@ double DSM::insertEntriesHelper(size_t numOperations) noexcept(true)
 
     for (size_t i = 0; i < numOperations; ++i)
     {
+        // each column is a separate file, so columns can be written concurrently
+        std::vector<double> columnsTime(columnsSize.size(), 0.0);
         for (size_t j = 0; j < columnsSize.size(); ++j)
         {
+            columnsTime[j] += disk->setPlacementHint(j, numEntries * columnsSize[j]);
             const uintptr_t addr = disk->getCurrentMemoryAddr();
 
             // write at the end or in a predefined gap
-            time += disk->overwriteBytes(addr, columnsSize[j]);
-            time += disk->flushCache();
+            columnsTime[j] += disk->overwriteBytes(addr, columnsSize[j]);
+            columnsTime[j] += disk->flushCache();
         }
+
+        time += getColumnsTime(columnsTime);
         ++numEntries;
     }
     return time;
@@ -38,17 +111,19 @@ double DSM::insertEntriesHelper(size_t numOperations) noexcept(true)
 
 double DSM::bulkloadEntriesHelper(size_t numEntries) noexcept(true)
 {
-    double time = 0.0;
-
+    std::vector<double> columnsTime(columnsSize.size(), 0.0);
     for (size_t j = 0; j < columnsSize.size(); ++j)
     {
+        columnsTime[j] += disk->setPlacementHint(j, this->numEntries * columnsSize[j]);
         const uintptr_t addr = disk->getCurrentMemoryAddr();
 
         // write at the end or in a predefined gap
-        time += disk->writeBytes(addr, columnsSize[j] * numEntries);
-        time += disk->flushCache();
+        columnsTime[j] += disk->writeBytes(addr, columnsSize[j] * numEntries);
+        columnsTime[j] += disk->flushCache();
     }
 
+    const double time = getColumnsTime(columnsTime);
+
     this->numEntries += numEntries;
 
     return time;
@@ -66,15 +141,18 @@ double DSM::deleteEntriesHelper(size_t numOperations) noexcept(true)
     {
         time += findKey();
 
+        std::vector<double> columnsTime(columnsSize.size(), 0.0);
         for (size_t j = 0; j < columnsSize.size(); ++j)
         {
+            columnsTime[j] += disk->setPlacementHint(j, numEntries * columnsSize[j]);
             const uintptr_t addr = disk->getCurrentMemoryAddr();
 
             // delete 1 entry
-            time += disk->overwriteBytes(addr, columnsSize[j]);
-            time += disk->flushCache();
+            columnsTime[j] += disk->overwriteBytes(addr, columnsSize[j]);
+            columnsTime[j] += disk->flushCache();
         }
 
+        time += getColumnsTime(columnsTime);
         --numEntries;
     }
 
@@ -97,19 +175,64 @@ double DSM::findEntriesHelper(const std::vector<size_t>& columnsToFetch, size_t
     for (size_t i = 0; i < numOperations; ++i)
     {
         time += findKey();
+
+        // positions are known after key scan, then other columns can be read concurrently
+        std::vector<double> columnsTime(colCopy.size() - 1, 0.0);
         for (size_t j = 1; j < colCopy.size(); ++j)
         {
+            columnsTime[j - 1] += disk->setPlacementHint(colCopy[j], this->numEntries * columnsSize[colCopy[j]]);
             const uintptr_t addr = disk->getCurrentMemoryAddr();
-            time += disk->readBytes(addr, numEntries * columnsSize[colCopy[j]]);
-            time += disk->flushCache();
+            columnsTime[j - 1] += disk->readBytes(addr, numEntries * columnsSize[colCopy[j]]);
+            columnsTime[j - 1] += disk->flushCache();
         }
+
+        time += getColumnsTime(columnsTime);
+    }
+
+    return time;
+}
+
+double DSM::findPredicateEntriesHelper(const std::vector<size_t>& columnsToFetch, double selectivity, double clustering, size_t numOperations) noexcept(true)
+{
+    double time = 0.0;
+
+    std::vector colCopy = columnsToFetch;
+    std::sort(colCopy.begin(), colCopy.end());
+
+    if (colCopy[0] != 0)
+    {
+        LOGGER_LOG_ERROR("You need key column!");
+        return 0.0;
+    }
+
+    selectivity = std::clamp(selectivity, 0.0, 1.0);
+    clustering = std::clamp(clustering, 0.0, 1.0);
+
+    const size_t pageSize = disk->getLowLevelController().getPageSize();
+    for (size_t i = 0; i < numOperations; ++i)
+    {
+        // zone maps are in memory, so only zones which can have qualifying entries are read
+        if (zoneMapEntries == 0)
+            time += findKey();
+        else
+            time += readTouchedUnits(0, getTouchedUnits(zoneMapEntries, selectivity, clustering), zoneMapEntries * columnsSize[0], clustering);
+
+        // late materialization, other columns are read only in pages with qualifying positions
+        std::vector<double> columnsTime(colCopy.size() - 1, 0.0);
+        for (size_t j = 1; j < colCopy.size(); ++j)
+        {
+            const size_t entriesPerPage = std::max(pageSize / columnsSize[colCopy[j]], static_cast<size_t>(1));
+            columnsTime[j - 1] = readTouchedUnits(colCopy[j], getTouchedUnits(entriesPerPage, selectivity, clustering), pageSize, clustering);
+        }
+
+        time += getColumnsTime(columnsTime);
     }
 
     return time;
 }
 
 DSM::DSM(const char* name, Disk* disk, const std::vector<size_t>& columnsSize)
-: DBIndexColumn(name, disk, columnsSize)
+: DBIndexColumn(name, disk, columnsSize), zoneMapEntries{0}
 {
     LOGGER_LOG_DEBUG("DSM created {}", toStringFull());
 }
@@ -166,6 +289,7 @@ std::string DSM::toStringFull(bool oneLine) const noexcept(true)
                            std::string(" .sizeRecord = ") + std::to_string(sizeRecord) +
                            std::string(" .columnsSize = ") + columnsString +
                            std::string(" .numEntries = ") + std::to_string(numEntries) +
+                           std::string(" .zoneMapEntries = ") + std::to_string(zoneMapEntries) +
                            std::string(" .disk = ") + disk->toStringFull() +
                            std::string(" .counters = ") + counters.toStringFull() +
                            std::string(" }"));
@@ -176,6 +300,7 @@ std::string DSM::toStringFull(bool oneLine) const noexcept(true)
                            std::string("\t.sizeRecord = ") + std::to_string(sizeRecord) + std::string("\n") +
                            std::string("\t.columnsSize = ") + columnsString + std::string("\n") +
                            std::string("\t.numEntries = ") + std::to_string(numEntries) + std::string("\n") +
+                           std::string("\t.zoneMapEntries = ") + std::to_string(zoneMapEntries) + std::string("\n") +
                            std::string("\t.disk = ") + disk->toStringFull() + std::string("\n") +
                            std::string("\t.counters = ") + counters.toStringFull() + std::string("\n") +
                            std::string("}"));
@@ -261,6 +386,18 @@ double DSM::findRangeEntries(const std::vector<size_t>& columnsToFetch, double s
     return findRangeEntries(columnsToFetch, static_cast<size_t>(static_cast<double>(this->numEntries) * selectivity), numOperations);
 }
 
+double DSM::findPredicateEntries(const std::vector<size_t>& columnsToFetch, double selectivity, double clustering, size_t numOperations) noexcept(true)
+{
+    const double time = findPredicateEntriesHelper(columnsToFetch, selectivity, clustering, numOperations);
+
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_TIME, time);
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_OPERATIONS, numOperations);
+
+    LOGGER_LOG_TRACE("Found {} entries, took {}s", static_cast<size_t>(static_cast<double>(numEntries) * selectivity) * numOperations, time);
+
+    return time;
+}
+
 void DSM::createTopologyAfterInsert(size_t numEntries) noexcept(true)
 {
     LOGGER_LOG_DEBUG("Creating a topology now entries={}, inserting new {} entries, after we will have {} entries", this->numEntries, numEntries, this->numEntries + numEntries);
@@ -64,12 +64,15 @@ double FALSMTree::insertIntoBufferTree(size_t entries) noexcept(true)
 
     LOGGER_LOG_TRACE("{} entries inserted into bufferTree, now: ({} + {} = {})/{}, took {}s", entries, bufferTree.numEntries, bufferTree.numEntriesToDelete, bufferTree.numEntries + bufferTree.numEntriesToDelete, bufferTree.maxEntries, 0.0);
 
+    // foreground part of operation is on compaction timeline before merge is scheduled
+    compaction.advanceClock(time);
+
     if (bufferTree.isFull())
     {
         if (getHeight() == 0)
             addLevel();
 
-        time += mergeBufferTree();
+        time += chargeCompaction(mergeBufferTree());
     }
 
     return time;
@@ -83,17 +86,39 @@ double FALSMTree::deleteFromBufferTree(size_t entries) noexcept(true)
 
     LOGGER_LOG_TRACE("{} entriesToDelete inserted into bufferTree, now: ({} + {} = {})/{}, took {}s", entries, bufferTree.numEntries, bufferTree.numEntriesToDelete, bufferTree.numEntries + bufferTree.numEntriesToDelete, bufferTree.maxEntries, 0.0);
 
+    // foreground part of operation is on compaction timeline before merge is scheduled
+    compaction.advanceClock(time);
+
     if (bufferTree.isFull())
     {
         if (getHeight() == 0)
             addLevel();
 
-        time += mergeBufferTree();
+        time += chargeCompaction(mergeBufferTree());
     }
 
     return time;
 }
 
+double FALSMTree::chargeCompaction(double compactionTime) noexcept(true)
+{
+    const double stall = compaction.chargeCompaction(compactionTime);
+
+    if (compaction.isEnabled())
+    {
+        counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME, compactionTime);
+        counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS, 1);
+
+        if (stall > 0.0)
+        {
+            counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_TIME, stall);
+            counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_OPERATIONS, 1);
+        }
+    }
+
+    return stall;
+}
+
 void FALSMTree::addLevel() noexcept(true)
 {
     size_t lvlSize = bufferTree.sizeInBytes * lvlRatio;
@@ -162,6 +187,9 @@ double FALSMTree::mergeBufferTree() noexcept(true)
                      lvl.get().getLvl(),
                      (entriesAfterMerge + entriesToDeleteAfterMerge) * getRecordSize());
 
+    // place lvl0 on device
+    time += disk->setPlacementHint(lvl.get().getLvl(), (lvl.get().numEntries + lvl.get().numEntriesToDelete) * getRecordSize());
+
     // read entries from lvl0
     uintptr_t addr = disk->getCurrentMemoryAddr();
     time += disk->readBytes(addr, (lvl.get().numEntries + lvl.get().numEntriesToDelete) * getRecordSize());
@@ -315,11 +343,17 @@ double FALSMTree::mergeLevels(size_t upperLvl, size_t lowerLvl) noexcept(true)
                      lower.get().getLvl(),
                      (entriesAfterMerge + entriesToDeleteAfterMerge) * getRecordSize());
 
+    // place lvl upper on device
+    time += disk->setPlacementHint(upper.get().getLvl(), (upper.get().numEntries + upper.get().numEntriesToDelete) * getRecordSize());
+
     // read entries from lvl upper
     uintptr_t addr = disk->getCurrentMemoryAddr();
     time += disk->readBytes(addr, (upper.get().numEntries + upper.get().numEntriesToDelete) * getRecordSize());
     time += disk->flushCache();
 
+    // place lvl lower on device
+    time += disk->setPlacementHint(lower.get().getLvl(), (lower.get().numEntries + lower.get().numEntriesToDelete) * getRecordSize());
+
     // read entries from lvl lower
     addr = disk->getCurrentMemoryAddr();
     time += disk->readBytes(addr, (lower.get().numEntries + lower.get().numEntriesToDelete) * getRecordSize());
@@ -438,6 +472,9 @@ double FALSMTree::addEntriesToLevel(size_t lvl, size_t entries) noexcept(true)
                      falsmLvl.get().getLvl(),
                      entries * getRecordSize());
 
+    // place lvl on device
+    time += disk->setPlacementHint(falsmLvl.get().getLvl(), (falsmLvl.get().numEntries + falsmLvl.get().numEntriesToDelete) * getRecordSize());
+
     // write entries to lvl
     uintptr_t addr = disk->getCurrentMemoryAddr();
     time += disk->writeBytes(addr, entries * getRecordSize());
@@ -499,7 +536,7 @@ double FALSMTree::findEntriesHelper(size_t numEntries, size_t numOperations) noe
     for (size_t i = 0; i < numOperations; ++i)
         for (size_t j = 0; j < getHeight(); ++j)
         {
-            double lvlTime = 0.0;
+            double lvlTime = disk->setPlacementHint(levels[j].getLvl(), (levels[j].numEntries + levels[j].numEntriesToDelete) * getRecordSize());
             const size_t maxEntries = nodeSize / getRecordSize();
             uintptr_t addr = disk->getCurrentMemoryAddr();
 
@@ -527,6 +564,8 @@ double FALSMTree::findEntriesHelper(size_t numEntries, size_t numOperations) noe
             time += lvlTime;
         }
 
+    compaction.advanceClock(time);
+
     return time;
 }
 
@@ -598,7 +637,7 @@ double FALSMTree::bulkloadEntriesHelper(size_t numEntries) noexcept(true)
 
 
 FALSMTree::FALSMTree(const char* name, Disk* disk, size_t sizeKey, size_t sizeData, size_t nodeSize, size_t bufferTreeSize, size_t lvlRatio, size_t capRatio)
-: DBIndex(name, disk, sizeKey, sizeData), nodeSize{nodeSize}, lvlRatio{lvlRatio}, capRatio{capRatio}, bufferTree{FALSMLvl(bufferTreeSize, sizeKey + sizeData, -1, nodeSize)}
+: DBIndex(name, disk, sizeKey, sizeData), nodeSize{nodeSize}, lvlRatio{lvlRatio}, capRatio{capRatio}, bufferTree{FALSMLvl(bufferTreeSize, sizeKey + sizeData, -1, nodeSize)}, zonePerLevel{false}
 {
     LOGGER_LOG_DEBUG("FALSMTree created {}", toStringFull());
 }
@@ -671,6 +710,7 @@ std::string FALSMTree::toStringFull(bool oneLine) const noexcept(true)
                            std::string(" .capRatio = ") + std::to_string(capRatio) +
                            std::string(" .bufferTree = ") + bufferTree.toStringFull() +
                            std::string(" .levels = ") + fdLvlsString +
+                           std::string(" .zonePerLevel = ") + std::to_string(zonePerLevel) +
                            std::string(" .disk = ") + disk->toStringFull() +
                            std::string(" .counters = ") + counters.toStringFull() +
                            std::string(" }"));
@@ -685,6 +725,7 @@ std::string FALSMTree::toStringFull(bool oneLine) const noexcept(true)
                            std::string("\t.capRatio = ") + std::to_string(capRatio) + std::string("\n") +
                            std::string("\t.bufferTree = ") + bufferTree.toStringFull() + std::string("\n") +
                            std::string("\t.levels = ") + fdLvlsString + std::string("\n") +
+                           std::string("\t.zonePerLevel = ") + std::to_string(zonePerLevel) + std::string("\n") +
                            std::string("\t.disk = ") + disk->toStringFull() + std::string("\n") +
                            std::string("\t.counters = ") + counters.toStringFull() + std::string("\n") +
                            std::string("}"));
@@ -703,6 +744,21 @@ const FALSMTree::FALSMLvl& FALSMTree::getFALSMLvl(size_t lvl) const noexcept(tru
     return levels[lvl - 1];
 }
 
+void FALSMTree::setZonePerLevel(bool zonePerLevel) noexcept(true)
+{
+    this->zonePerLevel = zonePerLevel;
+    disk->setPlacementIsolation(zonePerLevel);
+
+    LOGGER_LOG_DEBUG("Zone per level set to {}", zonePerLevel);
+}
+
+void FALSMTree::setBackgroundCompaction(size_t compactionThreads, size_t writeStallThreshold) noexcept(true)
+{
+    compaction = LSMBackgroundCompaction(compactionThreads, writeStallThreshold);
+
+    LOGGER_LOG_DEBUG("Background compaction set to {}", compaction.toString());
+}
+
 bool FALSMTree::isBulkloadSupported() const noexcept(true)
 {
     return true;
@@ -724,6 +780,10 @@ double FALSMTree::bulkloadEntries(size_t numEntries) noexcept(true)
 {
     const double time = bulkloadEntriesHelper(numEntries);
 
+    // small bulkload goes through buffer tree and moves clock by stalls only
+    if (numEntries >= bufferTree.maxEntries)
+        compaction.advanceClock(time);
+
     counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_BULKLOAD_TOTAL_TIME, time);
     counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_BULKLOAD_TOTAL_OPERATIONS, 1);
 
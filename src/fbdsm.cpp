@@ -8,6 +8,7 @@ double FBDSM::findKey() noexcept(true)
     double time = 0.0;
 
     // scan 1st column
+    time += disk->setPlacementHint(0, numEntries * columnsSize[0]);
     const uintptr_t addr = disk->getCurrentMemoryAddr();
     time += disk->readBytes(addr, numEntries * columnsSize[0]);
     time += disk->flushCache();
@@ -35,6 +36,7 @@ double FBDSM::insertEntriesHelper(size_t numOperations) noexcept(true)
 
     for (size_t j = 0; j < columnsSize.size(); ++j)
     {
+        time += disk->setPlacementHint(j, numEntries * columnsSize[j]);
         const uintptr_t addr = disk->getCurrentMemoryAddr();
 
         // write at the end or in a predefined gap
@@ -54,6 +56,7 @@ double FBDSM::bulkloadEntriesHelper(size_t numEntries) noexcept(true)
 
     for (size_t j = 0; j < columnsSize.size(); ++j)
     {
+        time += disk->setPlacementHint(j, this->numEntries * columnsSize[j]);
         const uintptr_t addr = disk->getCurrentMemoryAddr();
 
         // write at the end or in a predefined gap
@@ -88,6 +91,7 @@ double FBDSM::deleteEntriesHelper(size_t numOperations) noexcept(true)
 
         for (size_t j = 0; j < columnsSize.size(); ++j)
         {
+            time += disk->setPlacementHint(j, numEntries * columnsSize[j]);
             const uintptr_t addr = disk->getCurrentMemoryAddr();
 
             // delete 1 entry
@@ -117,6 +121,7 @@ double FBDSM::findEntriesHelper(const std::vector<size_t>& columnsToFetch, size_
         time += findKey();
         for (size_t j = 1; j < colCopy.size(); ++j)
         {
+            time += disk->setPlacementHint(colCopy[j], this->numEntries * columnsSize[colCopy[j]]);
             const uintptr_t addr = disk->getCurrentMemoryAddr();
             time += disk->readBytes(addr, numEntries * columnsSize[colCopy[j]]);
             time += disk->flushCache();
@@ -60,12 +60,15 @@ double FDTree::insertIntoHeadTree(size_t entries) noexcept(true)
 
     LOGGER_LOG_TRACE("{} entries inserted into headTree, now: ({} + {} = {})/{}, took {}s", entries, headTree.numEntries, headTree.numEntriesToDelete, headTree.numEntries + headTree.numEntriesToDelete, headTree.maxEntries, 0.0);
 
+    // foreground part of operation is on merge timeline before merge is scheduled
+    compaction.advanceClock(time);
+
     if (headTree.isFull())
     {
         if (getHeight() == 0)
             addLevel();
 
-        time += mergeHeadTree();
+        time += chargeCompaction(mergeHeadTree());
     }
 
     return time;
@@ -79,17 +82,39 @@ double FDTree::deleteFromHeadTree(size_t entries) noexcept(true)
 
     LOGGER_LOG_TRACE("{} entriesToDelete inserted into headTree, now: ({} + {} = {})/{}, took {}s", entries, headTree.numEntries, headTree.numEntriesToDelete, headTree.numEntries + headTree.numEntriesToDelete, headTree.maxEntries, 0.0);
 
+    // foreground part of operation is on merge timeline before merge is scheduled
+    compaction.advanceClock(time);
+
     if (headTree.isFull())
     {
         if (getHeight() == 0)
             addLevel();
 
-        time += mergeHeadTree();
+        time += chargeCompaction(mergeHeadTree());
     }
 
     return time;
 }
 
+double FDTree::chargeCompaction(double compactionTime) noexcept(true)
+{
+    const double stall = compaction.chargeCompaction(compactionTime);
+
+    if (compaction.isEnabled())
+    {
+        counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME, compactionTime);
+        counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS, 1);
+
+        if (stall > 0.0)
+        {
+            counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_TIME, stall);
+            counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_OPERATIONS, 1);
+        }
+    }
+
+    return stall;
+}
+
 void FDTree::addLevel() noexcept(true)
 {
     size_t lvlSize = headTree.sizeInBytes * lvlRatio;
@@ -490,6 +515,8 @@ double FDTree::findEntriesHelper(size_t numEntries, size_t numOperations) noexce
             time += lvlTime;
         }
 
+    compaction.advanceClock(time);
+
     return time;
 }
 
@@ -594,6 +621,13 @@ const FDTree::FDLvl& FDTree::getFDLvl(size_t lvl) const noexcept(true)
     return levels[lvl - 1];
 }
 
+void FDTree::setBackgroundCompaction(size_t compactionThreads, size_t writeStallThreshold) noexcept(true)
+{
+    compaction = LSMBackgroundCompaction(compactionThreads, writeStallThreshold);
+
+    LOGGER_LOG_DEBUG("Background merges set to {}", compaction.toString());
+}
+
 bool FDTree::isBulkloadSupported() const noexcept(true)
 {
     // In oryginal FDTree bulkload is unsupported, use insert loop into buffered HeadTree
@@ -0,0 +1,83 @@
+#include <adaptiveMerging/hybridCrackSort.hpp>
+#include <logger/logger.hpp>
+
+#include <numeric>
+#include <algorithm>
+
+HybridCrackSort::HCSPartitionManager::HCSPartitionManager(size_t numEntries, size_t recordSize, size_t partitionSize)
+: AdaptiveMerging::AMPartitionManager(numEntries, recordSize, partitionSize, AdaptiveMergingFramework::AMUnsortedMemoryManager::AM_UNSORTED_MEMORY_INVALIDATION_OVERWRITE)
+{
+    cracks = std::vector<size_t>(partitions.size(), 0);
+
+    LOGGER_LOG_DEBUG("HCSPartitionManager created {}", toStringFull());
+}
+
+size_t HybridCrackSort::HCSPartitionManager::getCrackerIndexSize(size_t keySize) const noexcept(true)
+{
+    return std::accumulate(cracks.begin(), cracks.end(), static_cast<size_t>(0)) * (keySize + sizeof(uintptr_t));
+}
+
+double HybridCrackSort::HCSPartitionManager::crackPartitions(Disk* disk, const std::vector<size_t>& loadedEntries) noexcept(true)
+{
+    double time = 0.0;
+    size_t crackedPartitions = 0;
+
+    for (size_t i = 0; i < partitions.size(); ++i)
+    {
+        if (loadedEntries[i] == 0)
+            continue;
+
+        // piece with query result is cracked on both bounds, on average half of piece is swapped
+        const size_t entriesBeforeLoad = partitions[i].getNumEntries() + loadedEntries[i];
+        const size_t pieceEntries = std::max(entriesBeforeLoad / (cracks[i] + 1), static_cast<size_t>(1));
+
+        const uintptr_t addr = disk->getCurrentMemoryAddr();
+        time += disk->readBytes(addr, pieceEntries * recordSize);
+        time += disk->overwriteBytes(addr, (pieceEntries * recordSize) / 2);
+        time += disk->flushCache();
+
+        cracks[i] += 2;
+        ++crackedPartitions;
+    }
+
+    LOGGER_LOG_TRACE("Cracked {} partitions, took {}s", crackedPartitions, time);
+
+    return time;
+}
+
+double HybridCrackSort::HCSPartitionManager::loadEntries(Disk *disk, size_t numEntries) noexcept(true)
+{
+    if (numEntries == 0)
+        return 0.0;
+
+    // crack exactly these partitions from which entries are loaded
+    const std::vector<size_t> loadedEntries = takeEntriesFromPartitions(numEntries);
+
+    const double cTime = crackPartitions(disk, loadedEntries);
+    counters.pegCounter(AdaptiveMergingCounters::ADAPTIVE_MERGING_COUNTER_RW_LOADING_TOTAL_TIME, cTime);
+
+    return cTime + AdaptiveMerging::AMPartitionManager::loadEntries(disk, numEntries);
+}
+
+HybridCrackSort::HybridCrackSort(const char* name, DBIndex* index, size_t startingEntries, size_t partitionSize)
+: AdaptiveMerging(name, index, new HCSPartitionManager(startingEntries, index->getRecordSize(), partitionSize), startingEntries)
+{
+    LOGGER_LOG_DEBUG("HybridCrackSort created {}", toStringFull());
+}
+
+HybridCrackSort::HybridCrackSort(DBIndex* index, size_t startingEntries, size_t partitionSize)
+: HybridCrackSort("HybridCrackSort", index, startingEntries, partitionSize)
+{
+
+}
+
+void HybridCrackSort::resetState() noexcept(true)
+{
+    const HCSPartitionManager* manager = dynamic_cast<const HCSPartitionManager*>(memoryManager.get());
+
+    const bool background = manager->isBackgroundInvalidation();
+
+    index->resetState();
+    memoryManager.reset(new HCSPartitionManager(startingEntries, getRecordSize(), manager->partitionSize));
+    setBackgroundInvalidation(background);
+}
\ No newline at end of file
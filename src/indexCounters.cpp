@@ -33,6 +33,8 @@ IndexCounters::IndexCounters()
     countersDouble.addCounter(INDEX_COUNTER_RW_DELETE_TOTAL_TIME, std::string(TO_STRING(INDEX_COUNTER_RW_DELETE_TOTAL_TIME)));
     countersDouble.addCounter(INDEX_COUNTER_RW_PSEARCH_TOTAL_TIME, std::string(TO_STRING(INDEX_COUNTER_RW_PSEARCH_TOTAL_TIME)));
     countersDouble.addCounter(INDEX_COUNTER_RW_RSEARCH_TOTAL_TIME, std::string(TO_STRING(INDEX_COUNTER_RW_RSEARCH_TOTAL_TIME)));
+    countersDouble.addCounter(INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME, std::string(TO_STRING(INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME)));
+    countersDouble.addCounter(INDEX_COUNTER_RW_STALL_TOTAL_TIME, std::string(TO_STRING(INDEX_COUNTER_RW_STALL_TOTAL_TIME)));
 
 
     // add RO counters to get name in easy way
@@ -49,6 +51,8 @@ IndexCounters::IndexCounters()
     countersLong.addCounter(INDEX_COUNTER_RW_DELETE_TOTAL_OPERATIONS, std::string(TO_STRING(INDEX_COUNTER_RW_DELETE_TOTAL_OPERATIONS)));
     countersLong.addCounter(INDEX_COUNTER_RW_PSEARCH_TOTAL_OPERATIONS, std::string(TO_STRING(INDEX_COUNTER_RW_PSEARCH_TOTAL_OPERATIONS)));
     countersLong.addCounter(INDEX_COUNTER_RW_RSEARCH_TOTAL_OPERATIONS, std::string(TO_STRING(INDEX_COUNTER_RW_RSEARCH_TOTAL_OPERATIONS)));
+    countersLong.addCounter(INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS, std::string(TO_STRING(INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS)));
+    countersLong.addCounter(INDEX_COUNTER_RW_STALL_TOTAL_OPERATIONS, std::string(TO_STRING(INDEX_COUNTER_RW_STALL_TOTAL_OPERATIONS)));
 
     // add RO counters to get name is easy way
     countersLong.addCounter(INDEX_COUNTER_RO_TOTAL_OPERATIONS, std::string(TO_STRING(INDEX_COUNTER_RO_TOTAL_OPERATIONS)));
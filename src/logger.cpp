@@ -1,14 +1,159 @@
 #include <logger/logger.hpp>
+#include <spdlog/sinks/sink.h>
+#include <spdlog/details/circular_q.h>
+#include <spdlog/details/log_msg_buffer.h>
 
 #include <iomanip>
 #include <ctime>
 #include <sstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+// number of messages in async queue
+static constexpr size_t loggerAsyncQueueSize = 1 << 16;
+
+/**
+ * @brief Sink which only copies message into ring buffer.
+ *        Formatting and writing to real sinks is done by 1 background thread,
+ *        so experiment threads do not serialize on stdout and file
+ *
+ */
+class LoggerAsyncSink : public spdlog::sinks::sink
+{
+private:
+    static constexpr std::chrono::milliseconds waitTime{100};
+
+    std::vector<spdlog::sink_ptr> sinks; // used only by writer thread (and set_pattern under sinksMutex)
+    spdlog::details::circular_q<spdlog::details::log_msg_buffer> queue;
+
+    std::mutex queueMutex;
+    std::mutex sinksMutex;
+    std::condition_variable queueNotEmpty;
+    std::condition_variable queueNotFull;
+    bool isStopped;
+
+    std::thread writer;
+
+    void writeMessages()
+    {
+        std::vector<spdlog::details::log_msg_buffer> messages;
+
+        while (true)
+        {
+            std::unique_lock<std::mutex> queueLock(queueMutex);
+            while (queue.empty() && !isStopped)
+                queueNotEmpty.wait_for(queueLock, waitTime);
+
+            if (queue.empty() && isStopped)
+                break;
+
+            // sinks are locked before queue is released, so flush waits for messages which are being written
+            std::lock_guard<std::mutex> sinksLock(sinksMutex);
+            while (!queue.empty())
+            {
+                messages.push_back(std::move(queue.front()));
+                queue.pop_front();
+            }
+
+            queueLock.unlock();
+            queueNotFull.notify_all();
+
+            for (const auto& msg : messages)
+                for (auto& sink : sinks)
+                    if (sink->should_log(msg.level))
+                        sink->log(msg);
+
+            messages.clear();
+        }
+
+        std::lock_guard<std::mutex> sinksLock(sinksMutex);
+        for (auto& sink : sinks)
+            sink->flush();
+    }
+
+public:
+    LoggerAsyncSink(std::vector<spdlog::sink_ptr> sinks, size_t queueSize)
+    : sinks{std::move(sinks)}, queue(queueSize), isStopped{false}
+    {
+        writer = std::thread(&LoggerAsyncSink::writeMessages, this);
+    }
+
+    void log(const spdlog::details::log_msg& msg) override
+    {
+        // copy message before lock, so critical section only moves it into queue
+        spdlog::details::log_msg_buffer msgBuffer(msg);
+
+        std::unique_lock<std::mutex> queueLock(queueMutex);
+
+        // do not lose messages, wait for writer
+        while (queue.full())
+            queueNotFull.wait_for(queueLock, waitTime);
+
+        queue.push_back(std::move(msgBuffer));
+        queueLock.unlock();
+
+        queueNotEmpty.notify_one();
+    }
+
+    void flush() override
+    {
+        std::unique_lock<std::mutex> queueLock(queueMutex);
+        while (!queue.empty())
+            queueNotFull.wait_for(queueLock, waitTime);
+
+        queueLock.unlock();
+
+        std::lock_guard<std::mutex> sinksLock(sinksMutex);
+        for (auto& sink : sinks)
+            sink->flush();
+    }
+
+    void set_pattern(const std::string& pattern) override
+    {
+        std::lock_guard<std::mutex> sinksLock(sinksMutex);
+        for (auto& sink : sinks)
+            sink->set_pattern(pattern);
+    }
+
+    void set_formatter(std::unique_ptr<spdlog::formatter> sinkFormatter) override
+    {
+        std::lock_guard<std::mutex> sinksLock(sinksMutex);
+        for (auto& sink : sinks)
+            sink->set_formatter(sinkFormatter->clone());
+    }
+
+    ~LoggerAsyncSink()
+    {
+        {
+            std::lock_guard<std::mutex> queueLock(queueMutex);
+            isStopped = true;
+        }
+
+        queueNotEmpty.notify_one();
+        writer.join();
+    }
+
+    LoggerAsyncSink(const LoggerAsyncSink&) = delete;
+    LoggerAsyncSink& operator=(const LoggerAsyncSink&) = delete;
+};
 
 void loggerSetLevel(enum logger_levels level)
 {
     spdlog::set_level(static_cast<spdlog::level::level_enum>(level));
 }
 
+void loggerStart(std::vector<spdlog::sink_ptr> sinks)
+{
+    // messages are queued in ring buffer and written by 1 background thread, so experiment threads do not wait for sinks
+    std::shared_ptr<spdlog::logger> logger = std::make_shared<spdlog::logger>("", std::make_shared<LoggerAsyncSink>(std::move(sinks), loggerAsyncQueueSize));
+    logger->flush_on(spdlog::level::err);
+
+    // overwrite namespaced logger by my logger (without this we need to get this logger each time, now we can use spdlog::info)
+    spdlog::set_default_logger(logger);
+}
+
 void loggerStart()
 {
     // Create fileName with current date
@@ -27,14 +172,19 @@ void loggerStart()
     std::vector<spdlog::sink_ptr> sinks;
     sinks.push_back(std::make_shared<spdlog::sinks::stdout_color_sink_st>());
     sinks.push_back(std::make_shared<spdlog::sinks::basic_file_sink_st>(logFileName));
-    std::shared_ptr<spdlog::logger> logger = std::make_shared<spdlog::logger>("", begin(sinks), end(sinks));
 
-    // overwrite namespaced logger by my logger (without this we need to get this logger each time, now we can use spdlog::info)
-    spdlog::set_default_logger(logger);
+    loggerStart(std::move(sinks));
 
     LOGGER_LOG_INFO("Setting LEVEL to {}", LOGGER_LEVEL_NAMES[LOGGER_ACTIVE_LEVEL]);
     loggerSetLevel(static_cast<enum logger_levels>(LOGGER_ACTIVE_LEVEL));
 
     LOGGER_LOG_INFO("Logging to file {}", logFileName);
     LOGGER_LOG_INFO("Logger is ready!");
-}
\ No newline at end of file
+}
+
+void loggerStop()
+{
+    LOGGER_LOG_INFO("Logger is stopping");
+
+    spdlog::shutdown();
+}
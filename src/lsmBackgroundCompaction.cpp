@@ -0,0 +1,128 @@
+#include <index/lsmBackgroundCompaction.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+
+LSMBackgroundCompaction::LSMBackgroundCompaction(size_t compactionThreads, size_t writeStallThreshold)
+: compactionThreads{compactionThreads}, writeStallThreshold{writeStallThreshold}, clock{0.0}, threadsFreeAt(compactionThreads, 0.0), backgroundTime{0.0}, backgroundOperations{0}, stallTime{0.0}, stallOperations{0}
+{
+    if (writeStallThreshold == 0)
+    {
+        LOGGER_LOG_WARN("writeStallThreshold has to be at least 1, got 0");
+        this->writeStallThreshold = 1;
+    }
+}
+
+void LSMBackgroundCompaction::retireFinishedCompactions() noexcept(true)
+{
+    pendingCompactions.erase(std::remove_if(pendingCompactions.begin(), pendingCompactions.end(), [this](double finish) { return finish <= clock; }), pendingCompactions.end());
+}
+
+void LSMBackgroundCompaction::advanceClock(double time) noexcept(true)
+{
+    if (!isEnabled())
+        return;
+
+    clock += time;
+}
+
+double LSMBackgroundCompaction::chargeCompaction(double compactionTime) noexcept(true)
+{
+    if (!isEnabled())
+        return compactionTime;
+
+    retireFinishedCompactions();
+
+    // level0 is backed up, foreground waits until the oldest compaction finishes
+    double stall = 0.0;
+    while (pendingCompactions.size() >= writeStallThreshold)
+    {
+        const double earliestFinish = *std::min_element(pendingCompactions.begin(), pendingCompactions.end());
+        stall += earliestFinish - clock;
+        clock = earliestFinish;
+
+        retireFinishedCompactions();
+    }
+
+    if (stall > 0.0)
+    {
+        stallTime += stall;
+        ++stallOperations;
+    }
+
+    auto thread = std::min_element(threadsFreeAt.begin(), threadsFreeAt.end());
+    const double start = std::max(clock, *thread);
+    const double finish = start + compactionTime;
+
+    *thread = finish;
+    pendingCompactions.push_back(finish);
+
+    backgroundTime += compactionTime;
+    ++backgroundOperations;
+
+    LOGGER_LOG_TRACE("Compaction scheduled in background: start={}, finish={}, stall={}, pending={}", start, finish, stall, pendingCompactions.size());
+
+    return stall;
+}
+
+size_t LSMBackgroundCompaction::getNumPendingCompactions() const noexcept(true)
+{
+    return static_cast<size_t>(std::count_if(pendingCompactions.begin(), pendingCompactions.end(), [this](double finish) { return finish > clock; }));
+}
+
+void LSMBackgroundCompaction::resetCounters() noexcept(true)
+{
+    backgroundTime = 0.0;
+    backgroundOperations = 0;
+    stallTime = 0.0;
+    stallOperations = 0;
+}
+
+void LSMBackgroundCompaction::resetState() noexcept(true)
+{
+    resetCounters();
+
+    clock = 0.0;
+    std::fill(threadsFreeAt.begin(), threadsFreeAt.end(), 0.0);
+    pendingCompactions.clear();
+}
+
+std::string LSMBackgroundCompaction::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("LSMBackgroundCompaction {") +
+                           std::string(" .compactionThreads = ") + std::to_string(compactionThreads) +
+                           std::string(" .writeStallThreshold = ") + std::to_string(writeStallThreshold) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("LSMBackgroundCompaction {\n") +
+                           std::string("\t.compactionThreads = ") + std::to_string(compactionThreads) + std::string("\n") +
+                           std::string("\t.writeStallThreshold = ") + std::to_string(writeStallThreshold) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string LSMBackgroundCompaction::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("LSMBackgroundCompaction {") +
+                           std::string(" .compactionThreads = ") + std::to_string(compactionThreads) +
+                           std::string(" .writeStallThreshold = ") + std::to_string(writeStallThreshold) +
+                           std::string(" .clock = ") + std::to_string(clock) +
+                           std::string(" .pendingCompactions = ") + std::to_string(getNumPendingCompactions()) +
+                           std::string(" .backgroundTime = ") + std::to_string(backgroundTime) +
+                           std::string(" .backgroundOperations = ") + std::to_string(backgroundOperations) +
+                           std::string(" .stallTime = ") + std::to_string(stallTime) +
+                           std::string(" .stallOperations = ") + std::to_string(stallOperations) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("LSMBackgroundCompaction {\n") +
+                           std::string("\t.compactionThreads = ") + std::to_string(compactionThreads) + std::string("\n") +
+                           std::string("\t.writeStallThreshold = ") + std::to_string(writeStallThreshold) + std::string("\n") +
+                           std::string("\t.clock = ") + std::to_string(clock) + std::string("\n") +
+                           std::string("\t.pendingCompactions = ") + std::to_string(getNumPendingCompactions()) + std::string("\n") +
+                           std::string("\t.backgroundTime = ") + std::to_string(backgroundTime) + std::string("\n") +
+                           std::string("\t.backgroundOperations = ") + std::to_string(backgroundOperations) + std::string("\n") +
+                           std::string("\t.stallTime = ") + std::to_string(stallTime) + std::string("\n") +
+                           std::string("\t.stallOperations = ") + std::to_string(stallOperations) + std::string("\n") +
+                           std::string("}"));
+}
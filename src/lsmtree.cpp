@@ -62,12 +62,15 @@ double LSMTree::insertIntoBufferTree(size_t entries) noexcept(true)
 
     LOGGER_LOG_TRACE("{} entries inserted into bufferTree, now: ({} + {} = {})/{}, took {}s", entries, bufferTree.numEntries, bufferTree.numEntriesToDelete, bufferTree.numEntries + bufferTree.numEntriesToDelete, bufferTree.maxEntries, 0.0);
 
+    // foreground part of operation is on compaction timeline before merge is scheduled
+    compaction.advanceClock(time);
+
     if (bufferTree.isFull())
     {
         if (getHeight() == 0)
             addLevel();
 
-        time += mergeBufferTree();
+        time += chargeCompaction(mergeBufferTree());
     }
 
     return time;
@@ -81,17 +84,39 @@ double LSMTree::deleteFromBufferTree(size_t entries) noexcept(true)
 
     LOGGER_LOG_TRACE("{} entriesToDelete inserted into bufferTree, now: ({} + {} = {})/{}, took {}s", entries, bufferTree.numEntries, bufferTree.numEntriesToDelete, bufferTree.numEntries + bufferTree.numEntriesToDelete, bufferTree.maxEntries, 0.0);
 
+    // foreground part of operation is on compaction timeline before merge is scheduled
+    compaction.advanceClock(time);
+
     if (bufferTree.isFull())
     {
         if (getHeight() == 0)
             addLevel();
 
-        time += mergeBufferTree();
+        time += chargeCompaction(mergeBufferTree());
     }
 
     return time;
 }
 
+double LSMTree::chargeCompaction(double compactionTime) noexcept(true)
+{
+    const double stall = compaction.chargeCompaction(compactionTime);
+
+    if (compaction.isEnabled())
+    {
+        counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME, compactionTime);
+        counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS, 1);
+
+        if (stall > 0.0)
+        {
+            counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_TIME, stall);
+            counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_OPERATIONS, 1);
+        }
+    }
+
+    return stall;
+}
+
 void LSMTree::addLevel() noexcept(true)
 {
     size_t lvlSize = bufferTree.sizeInBytes * lvlRatio;
@@ -160,6 +185,9 @@ double LSMTree::mergeBufferTree() noexcept(true)
                      lvl.get().getLvl(),
                      (entriesAfterMerge + entriesToDeleteAfterMerge) * getRecordSize());
 
+    // place lvl0 on device
+    time += disk->setPlacementHint(lvl.get().getLvl(), (lvl.get().numEntries + lvl.get().numEntriesToDelete) * getRecordSize());
+
     // read entries from lvl0
     uintptr_t addr = disk->getCurrentMemoryAddr();
     time += disk->readBytes(addr, (lvl.get().numEntries + lvl.get().numEntriesToDelete) * getRecordSize());
@@ -310,11 +338,17 @@ double LSMTree::mergeLevels(size_t upperLvl, size_t lowerLvl) noexcept(true)
                      lower.get().getLvl(),
                      (entriesAfterMerge + entriesToDeleteAfterMerge) * getRecordSize());
 
+    // place lvl upper on device
+    time += disk->setPlacementHint(upper.get().getLvl(), (upper.get().numEntries + upper.get().numEntriesToDelete) * getRecordSize());
+
     // read entries from lvl upper
     uintptr_t addr = disk->getCurrentMemoryAddr();
     time += disk->readBytes(addr, (upper.get().numEntries + upper.get().numEntriesToDelete) * getRecordSize());
     time += disk->flushCache();
 
+    // place lvl lower on device
+    time += disk->setPlacementHint(lower.get().getLvl(), (lower.get().numEntries + lower.get().numEntriesToDelete) * getRecordSize());
+
     // read entries from lvl lower
     addr = disk->getCurrentMemoryAddr();
     time += disk->readBytes(addr, (lower.get().numEntries + lower.get().numEntriesToDelete) * getRecordSize());
@@ -429,6 +463,9 @@ double LSMTree::addEntriesToLevel(size_t lvl, size_t entries) noexcept(true)
                      lsmLvl.get().getLvl(),
                      (entriesAfterMerge + entriesToDeleteAfterMerge) * getRecordSize());
 
+    // place lvl on device
+    time += disk->setPlacementHint(lsmLvl.get().getLvl(), (lsmLvl.get().numEntries + lsmLvl.get().numEntriesToDelete) * getRecordSize());
+
     // read entries from lvl
     uintptr_t addr = disk->getCurrentMemoryAddr();
     time += disk->readBytes(addr, (lsmLvl.get().numEntries + lsmLvl.get().numEntriesToDelete) * getRecordSize());
@@ -492,7 +529,7 @@ double LSMTree::findEntriesHelper(size_t numEntries, size_t numOperations) noexc
     for (size_t i = 0; i < numOperations; ++i)
         for (size_t j = 0; j < getHeight(); ++j)
         {
-            double lvlTime = 0.0;
+            double lvlTime = disk->setPlacementHint(levels[j].getLvl(), (levels[j].numEntries + levels[j].numEntriesToDelete) * getRecordSize());
             const size_t maxEntries = nodeSize / getRecordSize();
             uintptr_t addr = disk->getCurrentMemoryAddr();
 
@@ -512,6 +549,8 @@ double LSMTree::findEntriesHelper(size_t numEntries, size_t numOperations) noexc
             time += lvlTime;
         }
 
+    compaction.advanceClock(time);
+
     return time;
 }
 
@@ -632,7 +671,7 @@ double LSMTree::bulkloadEntriesHelperMaxCapacity(size_t numEntries) noexcept(tru
 }
 
 LSMTree::LSMTree(const char* name, Disk* disk, size_t sizeKey, size_t sizeData, size_t nodeSize, size_t bufferTreeSize, size_t lvlRatio, enum BulkloadFeatureMode bulkloadMode)
-: DBIndex(name, disk, sizeKey, sizeData), nodeSize{nodeSize}, lvlRatio{lvlRatio}, bufferTree{LSMLvl(bufferTreeSize, sizeKey + sizeData, -1, nodeSize)}, bulkloadMode{bulkloadMode}
+: DBIndex(name, disk, sizeKey, sizeData), nodeSize{nodeSize}, lvlRatio{lvlRatio}, bufferTree{LSMLvl(bufferTreeSize, sizeKey + sizeData, -1, nodeSize)}, bulkloadMode{bulkloadMode}, zonePerLevel{false}
 {
     LOGGER_LOG_DEBUG("LSMTree created {}", toStringFull());
 }
@@ -705,6 +744,7 @@ std::string LSMTree::toStringFull(bool oneLine) const noexcept(true)
                            std::string(" .bulkloadMode = ") + std::to_string(bulkloadMode) +
                            std::string(" .bufferTree = ") + bufferTree.toStringFull() +
                            std::string(" .levels = ") + fdLvlsString +
+                           std::string(" .zonePerLevel = ") + std::to_string(zonePerLevel) +
                            std::string(" .disk = ") + disk->toStringFull() +
                            std::string(" .counters = ") + counters.toStringFull() +
                            std::string(" }"));
@@ -719,6 +759,7 @@ std::string LSMTree::toStringFull(bool oneLine) const noexcept(true)
                            std::string("\t.bulkloadMode = ") + std::to_string(bulkloadMode) + std::string("\n") +
                            std::string("\t.bufferTree = ") + bufferTree.toStringFull() + std::string("\n") +
                            std::string("\t.levels = ") + fdLvlsString + std::string("\n") +
+                           std::string("\t.zonePerLevel = ") + std::to_string(zonePerLevel) + std::string("\n") +
                            std::string("\t.disk = ") + disk->toStringFull() + std::string("\n") +
                            std::string("\t.counters = ") + counters.toStringFull() + std::string("\n") +
                            std::string("}"));
@@ -737,6 +778,21 @@ const LSMTree::LSMLvl& LSMTree::getLSMLvl(size_t lvl) const noexcept(true)
     return levels[lvl - 1];
 }
 
+void LSMTree::setZonePerLevel(bool zonePerLevel) noexcept(true)
+{
+    this->zonePerLevel = zonePerLevel;
+    disk->setPlacementIsolation(zonePerLevel);
+
+    LOGGER_LOG_DEBUG("Zone per level set to {}", zonePerLevel);
+}
+
+void LSMTree::setBackgroundCompaction(size_t compactionThreads, size_t writeStallThreshold) noexcept(true)
+{
+    compaction = LSMBackgroundCompaction(compactionThreads, writeStallThreshold);
+
+    LOGGER_LOG_DEBUG("Background compaction set to {}", compaction.toString());
+}
+
 bool LSMTree::isBulkloadSupported() const noexcept(true)
 {
     return bulkloadMode != BULKLOAD_FEATURE_OFF;
@@ -782,6 +838,10 @@ double LSMTree::bulkloadEntries(size_t numEntries) noexcept(true)
             LOGGER_LOG_ERROR("Something went wrong, bulkloadMode {} unsupported", bulkloadMode);
     }
 
+    // small bulkload goes through buffer tree and moves clock by stalls only
+    if (numEntries >= bufferTree.maxEntries)
+        compaction.advanceClock(time);
+
     counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_BULKLOAD_TOTAL_TIME, time);
     counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_BULKLOAD_TOTAL_OPERATIONS, 1);
 
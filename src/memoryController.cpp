@@ -21,7 +21,7 @@ MemoryController::MemoryController(MemoryModel* memoryModel)
 }
 
 MemoryController::MemoryController(MemoryModel* memoryModel, size_t readCacheLineSize, size_t writeCacheLineSize)
-: memoryModel{std::unique_ptr<MemoryModel>(memoryModel)}, readCacheLineSize{readCacheLineSize}, writeCacheLineSize{writeCacheLineSize}
+: memoryModel{std::unique_ptr<MemoryModel>(memoryModel)}, readCacheLineSize{readCacheLineSize}, writeCacheLineSize{writeCacheLineSize}, bitChangeRatio{defaultBitChangeRatio}, overwriteChangedBytes{0.0}
 {
     LOGGER_LOG_DEBUG("Memory controller created: {}", toStringFull());
 }
@@ -32,6 +32,8 @@ MemoryController::MemoryController(const MemoryController& other)
     readCache = other.readCache;
     writeCache = other.writeCache;
     overwriteCache = other.overwriteCache;
+    bitChangeRatio = other.bitChangeRatio;
+    overwriteChangedBytes = other.overwriteChangedBytes;
     counters = other.counters;
 }
 
@@ -45,6 +47,8 @@ MemoryController& MemoryController::operator=(const MemoryController& other)
     readCache = other.readCache;
     writeCache = other.writeCache;
     overwriteCache = other.overwriteCache;
+    bitChangeRatio = other.bitChangeRatio;
+    overwriteChangedBytes = other.overwriteChangedBytes;
     counters = other.counters;
     memoryModel.reset((*other.memoryModel).clone());
 
@@ -168,6 +172,10 @@ double MemoryController::flushCache() noexcept(true)
     {
         bytesToWrite = writeCacheLineSize;
         bytesToRead += addBytesToRead(0);
+
+        // not requested bytes of lines are rewritten with the same value
+        const double cachedBytes = static_cast<double>(overwriteCache.size() * writeCacheLineSize);
+        memoryModel->setOverwriteBitChangeRatio(std::min(overwriteChangedBytes / cachedBytes, 1.0));
     }
 
     std::sort(overwriteCache.begin(), overwriteCache.end());
@@ -241,10 +249,26 @@ double MemoryController::flushCache() noexcept(true)
     readCache.clear();
     writeCache.clear();
     overwriteCache.clear();
+    overwriteChangedBytes = 0.0;
 
     return flushWriteTime + flushOverWriteTime;
 }
 
+double MemoryController::setPlacementHint(size_t hint, size_t hintBytes) noexcept(true)
+{
+    return memoryModel->setPlacementHint(hint, hintBytes);
+}
+
+void MemoryController::setPlacementIsolation(bool isolation) noexcept(true)
+{
+    memoryModel->setPlacementIsolation(isolation);
+}
+
+void MemoryController::enableWearTracking(size_t capacity, size_t sampleRate) noexcept(true)
+{
+    memoryModel->enableWearTracking(capacity, sampleRate);
+}
+
 double MemoryController::readBytes(uintptr_t addr, size_t bytes) noexcept(true)
 {
     if (bytes == 0)
@@ -322,11 +346,18 @@ double MemoryController::writeBytes(uintptr_t addr, size_t bytes) noexcept(true)
     return 0.0;
 }
 
+void MemoryController::setBitChangeRatio(double ratio) noexcept(true)
+{
+    bitChangeRatio = std::clamp(ratio, 0.0, 1.0);
+}
+
 double MemoryController::overwriteBytes(uintptr_t addr, size_t bytes) noexcept(true)
 {
     if (bytes == 0)
         return 0.0;
 
+    overwriteChangedBytes += static_cast<double>(bytes) * bitChangeRatio;
+
     const size_t cacheLineStartIndex = addrToCacheLineIndex(addr, writeCacheLineSize);
     const size_t cacheLineEndIndex = addrToCacheLineIndex(addr + static_cast<uintptr_t>(bytes - 1), writeCacheLineSize);
 
@@ -9,6 +9,26 @@ MemoryControllerPCM::MemoryControllerPCM(MemoryModelPCM* pcm)
     LOGGER_LOG_DEBUG("Memory controller PCM created: {}", toStringFull());
 }
 
+double MemoryControllerPCM::setWearLeveling(enum MemoryModelPCM::WearLeveling wearLeveling, size_t capacity, size_t interval) noexcept(true)
+{
+    // cached lines are written with the old mapping
+    const double time = flushCache();
+
+    dynamic_cast<MemoryModelPCM&>(*memoryModel).setWearLeveling(wearLeveling, capacity, interval);
+
+    return time;
+}
+
+double MemoryControllerPCM::setDifferentialWrite(enum MemoryModelPCM::DifferentialWrite differentialWrite) noexcept(true)
+{
+    // cached lines are written with the old mode
+    const double time = flushCache();
+
+    dynamic_cast<MemoryModelPCM&>(*memoryModel).setDifferentialWrite(differentialWrite);
+
+    return time;
+}
+
 std::string MemoryControllerPCM::toString(bool oneLine) const noexcept(true)
 {
     if (oneLine)
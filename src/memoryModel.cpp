@@ -11,6 +11,33 @@ size_t MemoryModel::bytesToBlocks(size_t bytes) const noexcept(true)
     return (bytes + (blockSize - 1)) / blockSize;
 }
 
+double MemoryModel::setPlacementHint(size_t hint, size_t hintBytes) noexcept(true)
+{
+    (void)hint;
+    (void)hintBytes;
+
+    return 0.0;
+}
+
+void MemoryModel::setPlacementIsolation(bool isolation) noexcept(true)
+{
+    (void)isolation;
+}
+
+void MemoryModel::setOverwriteBitChangeRatio(double ratio) noexcept(true)
+{
+    (void)ratio;
+}
+
+void MemoryModel::enableWearTracking(size_t capacity, size_t sampleRate) noexcept(true)
+{
+    const size_t unitSize = blockSize > 0 ? blockSize : pageSize;
+
+    wearTracker = WearTracker((capacity + unitSize - 1) / unitSize, sampleRate);
+
+    LOGGER_LOG_DEBUG("Wear tracking enabled: {}", wearTracker.toString());
+}
+
 std::string MemoryModel::toString(bool oneLine) const noexcept(true)
 {
     if (oneLine)
@@ -49,6 +76,7 @@ void MemoryModel::resetState() noexcept(true)
 {
     // for now only reset wearout
     touchedBytes = 0;
+    wearTracker.reset();
 }
 
 MemoryModel::MemoryModel(const char* modelName, size_t pageSize, size_t blockSize)
@@ -0,0 +1,207 @@
+#include <storage/memoryModelCompressed.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+MemoryModelCompressed::MemoryModelCompressed(const MemoryModel& model, double compressionRatio, double compressThroughput, double decompressThroughput)
+: MemoryModel("Compressed", model.getPageSize(), model.getBlockSize()), model{std::unique_ptr<MemoryModel>(model.clone())}, compressionRatio{validRatio(compressionRatio)}, currentCompressionRatio{validRatio(compressionRatio)}, compressThroughput{compressThroughput}, decompressThroughput{decompressThroughput}, rawBytes{0}, compressedBytes{0}, compressTime{0.0}, decompressTime{0.0}
+{
+    this->model->resetState();
+
+    LOGGER_LOG_DEBUG("Compressed Memory model created: {}", toStringFull());
+}
+
+MemoryModelCompressed::MemoryModelCompressed(const MemoryModelCompressed& other)
+: MemoryModel(other), model{std::unique_ptr<MemoryModel>(other.model->clone())}, compressionRatio{other.compressionRatio}, hintsCompressionRatio{other.hintsCompressionRatio}, currentCompressionRatio{other.currentCompressionRatio}, compressThroughput{other.compressThroughput}, decompressThroughput{other.decompressThroughput}, rawBytes{other.rawBytes}, compressedBytes{other.compressedBytes}, compressTime{other.compressTime}, decompressTime{other.decompressTime}
+{
+
+}
+
+MemoryModelCompressed& MemoryModelCompressed::operator=(const MemoryModelCompressed& other)
+{
+    if (this == &other)
+        return *this;
+
+    MemoryModel::operator=(other);
+
+    model.reset(other.model->clone());
+    compressionRatio = other.compressionRatio;
+    hintsCompressionRatio = other.hintsCompressionRatio;
+    currentCompressionRatio = other.currentCompressionRatio;
+    compressThroughput = other.compressThroughput;
+    decompressThroughput = other.decompressThroughput;
+    rawBytes = other.rawBytes;
+    compressedBytes = other.compressedBytes;
+    compressTime = other.compressTime;
+    decompressTime = other.decompressTime;
+
+    return *this;
+}
+
+double MemoryModelCompressed::validRatio(double ratio) noexcept(true)
+{
+    if (ratio <= 0.0 || ratio > 1.0)
+    {
+        LOGGER_LOG_WARN("Compression ratio {} is not in range (0, 1], using 1.0", ratio);
+        return 1.0;
+    }
+
+    return ratio;
+}
+
+size_t MemoryModelCompressed::compressBytes(size_t bytes) const noexcept(true)
+{
+    if (bytes == 0)
+        return 0;
+
+    return std::max(static_cast<size_t>(std::ceil(static_cast<double>(bytes) * currentCompressionRatio)), static_cast<size_t>(1));
+}
+
+double MemoryModelCompressed::cpuTime(size_t bytes, double throughput) noexcept(true)
+{
+    if (throughput <= 0.0)
+        return 0.0;
+
+    return static_cast<double>(bytes) / throughput;
+}
+
+void MemoryModelCompressed::setHintCompressionRatio(size_t hint, double ratio) noexcept(true)
+{
+    hintsCompressionRatio[hint] = validRatio(ratio);
+}
+
+double MemoryModelCompressed::getHintCompressionRatio(size_t hint) const noexcept(true)
+{
+    const auto it = hintsCompressionRatio.find(hint);
+
+    return it == hintsCompressionRatio.end() ? compressionRatio : it->second;
+}
+
+double MemoryModelCompressed::setPlacementHint(size_t hint, size_t hintBytes) noexcept(true)
+{
+    currentCompressionRatio = getHintCompressionRatio(hint);
+
+    // device below can use hints too
+    return model->setPlacementHint(hint, compressBytes(hintBytes));
+}
+
+void MemoryModelCompressed::setPlacementIsolation(bool isolation) noexcept(true)
+{
+    model->setPlacementIsolation(isolation);
+}
+
+void MemoryModelCompressed::setOverwriteBitChangeRatio(double ratio) noexcept(true)
+{
+    model->setOverwriteBitChangeRatio(ratio);
+}
+
+void MemoryModelCompressed::enableWearTracking(size_t capacity, size_t sampleRate) noexcept(true)
+{
+    model->enableWearTracking(capacity, sampleRate);
+}
+
+double MemoryModelCompressed::writeBytes(size_t bytes) noexcept(true)
+{
+    const size_t bytesToWrite = compressBytes(bytes);
+    const double cpu = cpuTime(bytes, compressThroughput);
+
+    rawBytes += bytes;
+    compressedBytes += bytesToWrite;
+    compressTime += cpu;
+
+    return cpu + model->writeBytes(bytesToWrite);
+}
+
+double MemoryModelCompressed::overwriteBytes(size_t bytes) noexcept(true)
+{
+    const size_t bytesToWrite = compressBytes(bytes);
+    const double cpu = cpuTime(bytes, compressThroughput);
+
+    rawBytes += bytes;
+    compressedBytes += bytesToWrite;
+    compressTime += cpu;
+
+    return cpu + model->overwriteBytes(bytesToWrite);
+}
+
+double MemoryModelCompressed::readBytes(size_t bytes) noexcept(true)
+{
+    const double cpu = cpuTime(bytes, decompressThroughput);
+
+    decompressTime += cpu;
+
+    return cpu + model->readBytes(compressBytes(bytes));
+}
+
+void MemoryModelCompressed::resetState() noexcept(true)
+{
+    MemoryModel::resetState();
+
+    model->resetState();
+
+    rawBytes = 0;
+    compressedBytes = 0;
+    compressTime = 0.0;
+    decompressTime = 0.0;
+}
+
+std::string MemoryModelCompressed::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("MemoryModelCompressed {") +
+                           std::string(" .name = ") + std::string(modelName) +
+                           std::string(" .pageSize = ") + std::to_string(pageSize) +
+                           std::string(" .blockSize = ") + std::to_string(blockSize) +
+                           std::string(" .compressionRatio = ") + std::to_string(compressionRatio) +
+                           std::string(" .compressThroughput = ") + std::to_string(compressThroughput) +
+                           std::string(" .decompressThroughput = ") + std::to_string(decompressThroughput) +
+                           std::string(" .model = ") + (model ? model->toString() : std::string("{}")) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("MemoryModelCompressed {\n") +
+                           std::string("\t.name = ") + std::string(modelName) + std::string("\n") +
+                           std::string("\t.pageSize = ") + std::to_string(pageSize) + std::string("\n") +
+                           std::string("\t.blockSize = ") + std::to_string(blockSize) + std::string("\n") +
+                           std::string("\t.compressionRatio = ") + std::to_string(compressionRatio) + std::string("\n") +
+                           std::string("\t.compressThroughput = ") + std::to_string(compressThroughput) + std::string("\n") +
+                           std::string("\t.decompressThroughput = ") + std::to_string(decompressThroughput) + std::string("\n") +
+                           std::string("\t.model = ") + (model ? model->toString() : std::string("{}")) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string MemoryModelCompressed::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("MemoryModelCompressed {") +
+                           std::string(" .name = ") + std::string(modelName) +
+                           std::string(" .pageSize = ") + std::to_string(pageSize) +
+                           std::string(" .blockSize = ") + std::to_string(blockSize) +
+                           std::string(" .compressionRatio = ") + std::to_string(compressionRatio) +
+                           std::string(" .hintsWithOwnRatio = ") + std::to_string(hintsCompressionRatio.size()) +
+                           std::string(" .currentCompressionRatio = ") + std::to_string(currentCompressionRatio) +
+                           std::string(" .compressThroughput = ") + std::to_string(compressThroughput) +
+                           std::string(" .decompressThroughput = ") + std::to_string(decompressThroughput) +
+                           std::string(" .rawBytes = ") + std::to_string(rawBytes) +
+                           std::string(" .compressedBytes = ") + std::to_string(compressedBytes) +
+                           std::string(" .compressTime = ") + std::to_string(compressTime) +
+                           std::string(" .decompressTime = ") + std::to_string(decompressTime) +
+                           std::string(" .model = ") + (model ? model->toStringFull() : std::string("{}")) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("MemoryModelCompressed {\n") +
+                           std::string("\t.name = ") + std::string(modelName) + std::string("\n") +
+                           std::string("\t.pageSize = ") + std::to_string(pageSize) + std::string("\n") +
+                           std::string("\t.blockSize = ") + std::to_string(blockSize) + std::string("\n") +
+                           std::string("\t.compressionRatio = ") + std::to_string(compressionRatio) + std::string("\n") +
+                           std::string("\t.hintsWithOwnRatio = ") + std::to_string(hintsCompressionRatio.size()) + std::string("\n") +
+                           std::string("\t.currentCompressionRatio = ") + std::to_string(currentCompressionRatio) + std::string("\n") +
+                           std::string("\t.compressThroughput = ") + std::to_string(compressThroughput) + std::string("\n") +
+                           std::string("\t.decompressThroughput = ") + std::to_string(decompressThroughput) + std::string("\n") +
+                           std::string("\t.rawBytes = ") + std::to_string(rawBytes) + std::string("\n") +
+                           std::string("\t.compressedBytes = ") + std::to_string(compressedBytes) + std::string("\n") +
+                           std::string("\t.compressTime = ") + std::to_string(compressTime) + std::string("\n") +
+                           std::string("\t.decompressTime = ") + std::to_string(decompressTime) + std::string("\n") +
+                           std::string("\t.model = ") + (model ? model->toStringFull() : std::string("{}")) + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
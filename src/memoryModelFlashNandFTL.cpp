@@ -35,6 +35,8 @@ double MemoryModelFlashNandFTL::eraseBlocks(size_t blocks) noexcept(true)
     const double time = static_cast<double>(blocks) * eraseTime;
     dirtyPages -= pagesInBlock * blocks;
 
+    wearTracker.wearWrittenUnits(blocks);
+
     LOGGER_LOG_TRACE("erasing blocks {}, took time {}", blocks, time);
     return time;
 }
@@ -57,6 +59,8 @@ double MemoryModelFlashNandFTL::writeBytes(size_t bytes) noexcept(true)
 
     const size_t pages = bytesToPages(bytes);
 
+    wearTracker.writeUnits(bytesToBlocks(bytes));
+
     return writePages(pages);
 }
 
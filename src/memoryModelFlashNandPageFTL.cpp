@@ -0,0 +1,524 @@
+#include <storage/memoryModelFlashNandPageFTL.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+void MemoryModelFlashNandPageFTL::bucketInsert(uint32_t block) noexcept(true)
+{
+    const uint32_t validPages = blockValidPages[block];
+
+    blockPrev[block] = invalidBlock;
+    blockNext[block] = bucketHead[validPages];
+    if (bucketHead[validPages] != invalidBlock)
+        blockPrev[bucketHead[validPages]] = block;
+
+    bucketHead[validPages] = block;
+}
+
+void MemoryModelFlashNandPageFTL::bucketRemove(uint32_t block) noexcept(true)
+{
+    const uint32_t validPages = blockValidPages[block];
+
+    if (blockPrev[block] != invalidBlock)
+        blockNext[blockPrev[block]] = blockNext[block];
+    else
+        bucketHead[validPages] = blockNext[block];
+
+    if (blockNext[block] != invalidBlock)
+        blockPrev[blockNext[block]] = blockPrev[block];
+
+    blockPrev[block] = invalidBlock;
+    blockNext[block] = invalidBlock;
+}
+
+double MemoryModelFlashNandPageFTL::readPages(size_t pages) const noexcept(true)
+{
+    const double time = static_cast<double>(pages) * readTime;
+
+    LOGGER_LOG_TRACE("reading pages {}, took time {}", pages, time);
+    return time;
+}
+
+void MemoryModelFlashNandPageFTL::invalidatePage(uint32_t physicalPage) noexcept(true)
+{
+    const uint32_t block = physicalPage / pagesInBlock;
+
+    physicalToLogical[physicalPage] = invalidPage;
+
+    // sealed block goes to bucket with 1 valid page less
+    if (blockState[block] == BLOCK_STATE_SEALED)
+    {
+        bucketRemove(block);
+        --blockValidPages[block];
+        bucketInsert(block);
+    }
+    else
+        --blockValidPages[block];
+}
+
+void MemoryModelFlashNandPageFTL::sealActiveBlock() noexcept(true)
+{
+    if (activeBlock == invalidBlock)
+        return;
+
+    blockState[activeBlock] = BLOCK_STATE_SEALED;
+    blockSealTime[activeBlock] = ++sealClock;
+    bucketInsert(activeBlock);
+    activeBlock = invalidBlock;
+}
+
+double MemoryModelFlashNandPageFTL::openBlock() noexcept(true)
+{
+    double time = 0.0;
+
+    sealActiveBlock();
+
+    // GC copies pages to active block, so it cannot wait for itself
+    if (!duringGarbageCollection)
+        while (freeBlocks.size() < gcFreeBlocksTreshold)
+        {
+            const size_t erasedBefore = erasedBlocks;
+            time += collectGarbage();
+
+            if (erasedBlocks == erasedBefore)
+                break;
+        }
+
+    // GC could open new block for copied pages, host pages go there too
+    if (activeBlock != invalidBlock)
+    {
+        if (activeBlockPages < pagesInBlock)
+            return time;
+
+        sealActiveBlock();
+    }
+
+    if (freeBlocks.empty())
+    {
+        LOGGER_LOG_ERROR("Flash device is full, there is no free block");
+        return time;
+    }
+
+    activeBlock = freeBlocks.front();
+    freeBlocks.pop_front();
+    blockState[activeBlock] = BLOCK_STATE_ACTIVE;
+    activeBlockPages = 0;
+
+    return time;
+}
+
+double MemoryModelFlashNandPageFTL::programPage(uint32_t logicalPage) noexcept(true)
+{
+    double time = 0.0;
+
+    // old copy is not valid anymore, GC can see it before opening new block
+    if (logicalToPhysical[logicalPage] != invalidPage)
+    {
+        invalidatePage(logicalToPhysical[logicalPage]);
+        logicalToPhysical[logicalPage] = invalidPage;
+    }
+
+    if (activeBlock == invalidBlock || activeBlockPages == pagesInBlock)
+        time += openBlock();
+
+    if (activeBlock == invalidBlock)
+        return time;
+
+    const uint32_t physicalPage = activeBlock * static_cast<uint32_t>(pagesInBlock) + static_cast<uint32_t>(activeBlockPages);
+    ++activeBlockPages;
+
+    logicalToPhysical[logicalPage] = physicalPage;
+    physicalToLogical[physicalPage] = logicalPage;
+    ++blockValidPages[activeBlock];
+
+    touchedBytes += pageSize;
+    time += writeTime;
+
+    return time;
+}
+
+uint32_t MemoryModelFlashNandPageFTL::selectVictim() const noexcept(true)
+{
+    if (victimPolicy == VICTIM_POLICY_GREEDY)
+    {
+        // full block gives nothing
+        for (size_t validPages = 0; validPages < pagesInBlock; ++validPages)
+            if (bucketHead[validPages] != invalidBlock)
+                return bucketHead[validPages];
+
+        return invalidBlock;
+    }
+
+    uint32_t victim = invalidBlock;
+    double bestScore = 0.0;
+    for (uint32_t block = 0; block < static_cast<uint32_t>(physicalBlocks); ++block)
+    {
+        if (blockState[block] != BLOCK_STATE_SEALED || blockValidPages[block] == pagesInBlock)
+            continue;
+
+        if (blockValidPages[block] == 0)
+            return block;
+
+        const double utilization = static_cast<double>(blockValidPages[block]) / static_cast<double>(pagesInBlock);
+        const double age = static_cast<double>(sealClock - blockSealTime[block] + 1);
+        const double score = (1.0 - utilization) * age / (2.0 * utilization);
+
+        if (score > bestScore)
+        {
+            bestScore = score;
+            victim = block;
+        }
+    }
+
+    return victim;
+}
+
+bool MemoryModelFlashNandPageFTL::isDestinationReserved(uint32_t block) const noexcept(true)
+{
+    const size_t activeFreePages = activeBlock == invalidBlock ? 0 : pagesInBlock - activeBlockPages;
+
+    // during cleaning nobody else takes free blocks, so 1 free block is enough for whole victim
+    return blockValidPages[block] <= activeFreePages || !freeBlocks.empty();
+}
+
+double MemoryModelFlashNandPageFTL::cleanBlock(uint32_t block, size_t& copiedPages) noexcept(true)
+{
+    double time = 0.0;
+
+    copiedPages = 0;
+    if (!isDestinationReserved(block))
+    {
+        LOGGER_LOG_WARN("There is no destination for {} valid pages of block {}, block is not cleaned", blockValidPages[block], block);
+        return 0.0;
+    }
+
+    const bool wasDuringGarbageCollection = duringGarbageCollection;
+    duringGarbageCollection = true;
+
+    // block is released (becomes free) by erase, after all valid pages are copied
+    bucketRemove(block);
+    blockState[block] = BLOCK_STATE_CLEANING;
+
+    for (size_t i = 0; i < pagesInBlock; ++i)
+    {
+        const uint32_t logicalPage = physicalToLogical[block * pagesInBlock + i];
+        if (logicalPage == invalidPage)
+            continue;
+
+        time += readTime;
+        time += programPage(logicalPage);
+        ++copiedPages;
+    }
+
+    time += eraseBlock(block);
+
+    duringGarbageCollection = wasDuringGarbageCollection;
+
+    return time;
+}
+
+double MemoryModelFlashNandPageFTL::eraseBlock(uint32_t block) noexcept(true)
+{
+    ++blockEraseCount[block];
+    ++erasedBlocks;
+
+    wearTracker.wearUnits(block, 1);
+
+    blockValidPages[block] = 0;
+    blockState[block] = BLOCK_STATE_FREE;
+    freeBlocks.push_back(block);
+
+    LOGGER_LOG_TRACE("erasing block {}, took time {}", block, eraseTime);
+    return eraseTime;
+}
+
+double MemoryModelFlashNandPageFTL::collectGarbage() noexcept(true)
+{
+    const uint32_t victim = selectVictim();
+    if (victim == invalidBlock)
+    {
+        LOGGER_LOG_WARN("There is no victim for garbage collection");
+        return 0.0;
+    }
+
+    if (!isDestinationReserved(victim))
+    {
+        LOGGER_LOG_WARN("There is no free block for valid pages of victim {}", victim);
+        return 0.0;
+    }
+
+    size_t copiedPages = 0;
+    double time = cleanBlock(victim, copiedPages);
+
+    gcWrittenPages += copiedPages;
+    ++gcOperations;
+
+    LOGGER_LOG_TRACE("GC cleaned block {}, copied {} pages, took time {}", victim, copiedPages, time);
+
+    time += levelWear(victim);
+
+    return time;
+}
+
+double MemoryModelFlashNandPageFTL::levelWear(uint32_t erasedBlock) noexcept(true)
+{
+    if (wearLevelingTreshold == 0 || blockEraseCount[erasedBlock] <= minEraseCount + wearLevelingTreshold)
+        return 0.0;
+
+    // cold data sits in the least erased sealed block, move it so block can take hot data
+    uint32_t coldBlock = invalidBlock;
+    for (uint32_t block = 0; block < static_cast<uint32_t>(physicalBlocks); ++block)
+        if (blockState[block] == BLOCK_STATE_SEALED && (coldBlock == invalidBlock || blockEraseCount[block] < blockEraseCount[coldBlock]))
+            coldBlock = block;
+
+    double time = 0.0;
+    if (coldBlock != invalidBlock && blockEraseCount[coldBlock] + wearLevelingTreshold < blockEraseCount[erasedBlock] && isDestinationReserved(coldBlock))
+    {
+        size_t copiedPages = 0;
+        time += cleanBlock(coldBlock, copiedPages);
+
+        wearLevelingWrittenPages += copiedPages;
+        ++wearLevelingOperations;
+
+        LOGGER_LOG_TRACE("Wear leveling moved block {}, copied {} pages, took time {}", coldBlock, copiedPages, time);
+    }
+
+    minEraseCount = static_cast<uint32_t>(getMinEraseCount());
+
+    return time;
+}
+
+double MemoryModelFlashNandPageFTL::writeLogicalPages(size_t firstLogicalPage, size_t pages, size_t range) noexcept(true)
+{
+    double time = 0.0;
+
+    for (size_t i = 0; i < pages; ++i)
+        time += programPage(static_cast<uint32_t>((firstLogicalPage + i) % range));
+
+    hostWrittenPages += pages;
+
+    LOGGER_LOG_TRACE("writing pages {}, took time {}", pages, time);
+    return time;
+}
+
+void MemoryModelFlashNandPageFTL::formatDevice() noexcept(true)
+{
+    logicalToPhysical.assign(logicalPages, invalidPage);
+    physicalToLogical.assign(physicalBlocks * pagesInBlock, invalidPage);
+
+    blockValidPages.assign(physicalBlocks, 0);
+    blockEraseCount.assign(physicalBlocks, 0);
+    blockSealTime.assign(physicalBlocks, 0);
+    blockState.assign(physicalBlocks, BLOCK_STATE_FREE);
+
+    bucketHead.assign(pagesInBlock + 1, invalidBlock);
+    blockNext.assign(physicalBlocks, invalidBlock);
+    blockPrev.assign(physicalBlocks, invalidBlock);
+
+    freeBlocks.clear();
+    for (uint32_t block = 0; block < static_cast<uint32_t>(physicalBlocks); ++block)
+        freeBlocks.push_back(block);
+
+    activeBlock = invalidBlock;
+    activeBlockPages = 0;
+
+    nextLogicalPage = 0;
+    writtenLogicalPages = 0;
+    sealClock = 0;
+    minEraseCount = 0;
+    duringGarbageCollection = false;
+
+    hostWrittenPages = 0;
+    gcWrittenPages = 0;
+    wearLevelingWrittenPages = 0;
+    erasedBlocks = 0;
+    gcOperations = 0;
+    wearLevelingOperations = 0;
+
+    rng.seed(defaultSeed);
+}
+
+MemoryModelFlashNandPageFTL::MemoryModelFlashNandPageFTL(const char* modelName,
+                                                         size_t pageSize,
+                                                         size_t blockSize,
+                                                         double readTime,
+                                                         double writeTime,
+                                                         double eraseTime,
+                                                         size_t capacity,
+                                                         double overProvisioning,
+                                                         enum VictimPolicy victimPolicy,
+                                                         size_t wearLevelingTreshold)
+: MemoryModel(modelName, pageSize, blockSize), pagesInBlock{blockSize / pageSize}, readTime{readTime}, writeTime{writeTime}, eraseTime{eraseTime}, overProvisioning{overProvisioning}, victimPolicy{victimPolicy}, wearLevelingTreshold{wearLevelingTreshold}
+{
+    if (this->overProvisioning < 0.0)
+    {
+        LOGGER_LOG_WARN("Over-provisioning {} is negative, using 0.0", overProvisioning);
+        this->overProvisioning = 0.0;
+    }
+
+    logicalPages = std::max(bytesToPages(capacity), static_cast<size_t>(1));
+    physicalBlocks = static_cast<size_t>(std::ceil(static_cast<double>(logicalPages) * (1.0 + this->overProvisioning) / static_cast<double>(pagesInBlock))) + gcFreeBlocksTreshold;
+
+    if (physicalBlocks * pagesInBlock >= static_cast<size_t>(invalidPage))
+        LOGGER_LOG_ERROR("Flash device with {} pages is too big for page mapping", physicalBlocks * pagesInBlock);
+
+    formatDevice();
+
+    LOGGER_LOG_DEBUG("Flash Page FTL Memory model created: {}", toStringFull());
+}
+
+double MemoryModelFlashNandPageFTL::writeBytes(size_t bytes) noexcept(true)
+{
+    if (bytes == 0)
+        return 0.0;
+
+    const size_t pages = bytesToPages(bytes);
+    const size_t firstLogicalPage = nextLogicalPage;
+
+    const double time = writeLogicalPages(firstLogicalPage, pages, logicalPages);
+
+    // writes are a circular log over logical space
+    nextLogicalPage = (firstLogicalPage + pages) % logicalPages;
+    writtenLogicalPages = firstLogicalPage + pages >= logicalPages ? logicalPages : std::max(writtenLogicalPages, firstLogicalPage + pages);
+
+    return time;
+}
+
+double MemoryModelFlashNandPageFTL::overwriteBytes(size_t bytes) noexcept(true)
+{
+    double time = 0.0;
+
+    if (bytes == 0)
+        return 0.0;
+
+    /* read bytes to rewrite */
+    if (bytes % pageSize != 0)
+        time += readBytes(pageSize - bytes % pageSize);
+
+    if (writtenLogicalPages == 0)
+        return time + writeBytes(bytes);
+
+    /* new version of pages goes to free pages, old version waits for GC */
+    const size_t pages = bytesToPages(bytes);
+    const size_t firstLogicalPage = rng() % writtenLogicalPages;
+
+    time += writeLogicalPages(firstLogicalPage, pages, writtenLogicalPages);
+
+    return time;
+}
+
+double MemoryModelFlashNandPageFTL::readBytes(size_t bytes) noexcept(true)
+{
+    if (bytes == 0)
+        return 0.0;
+
+    const size_t pages = bytesToPages(bytes);
+
+    return readPages(pages);
+}
+
+double MemoryModelFlashNandPageFTL::getWriteAmplification() const noexcept(true)
+{
+    if (hostWrittenPages == 0)
+        return 1.0;
+
+    return static_cast<double>(hostWrittenPages + gcWrittenPages + wearLevelingWrittenPages) / static_cast<double>(hostWrittenPages);
+}
+
+size_t MemoryModelFlashNandPageFTL::getMaxEraseCount() const noexcept(true)
+{
+    return blockEraseCount.empty() ? 0 : *std::max_element(blockEraseCount.begin(), blockEraseCount.end());
+}
+
+size_t MemoryModelFlashNandPageFTL::getMinEraseCount() const noexcept(true)
+{
+    return blockEraseCount.empty() ? 0 : *std::min_element(blockEraseCount.begin(), blockEraseCount.end());
+}
+
+void MemoryModelFlashNandPageFTL::resetState() noexcept(true)
+{
+    MemoryModel::resetState();
+
+    formatDevice();
+}
+
+std::string MemoryModelFlashNandPageFTL::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("MemoryModelFlashPageFTL {") +
+                           std::string(" .name = ") + std::string(modelName) +
+                           std::string(" .pageSize = ") + std::to_string(pageSize) +
+                           std::string(" .blockSize = ") + std::to_string(blockSize) +
+                           std::string(" .readTime = ") + std::to_string(readTime) +
+                           std::string(" .writeTime = ") + std::to_string(writeTime) +
+                           std::string(" .eraseTime = ") + std::to_string(eraseTime) +
+                           std::string(" .logicalPages = ") + std::to_string(logicalPages) +
+                           std::string(" .physicalBlocks = ") + std::to_string(physicalBlocks) +
+                           std::string(" .overProvisioning = ") + std::to_string(overProvisioning) +
+                           std::string(" .victimPolicy = ") + std::to_string(victimPolicy) +
+                           std::string(" .wearLevelingTreshold = ") + std::to_string(wearLevelingTreshold) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("MemoryModelFlashPageFTL {\n") +
+                           std::string("\t.name = ") + std::string(modelName) + std::string("\n") +
+                           std::string("\t.pageSize = ") + std::to_string(pageSize) + std::string("\n") +
+                           std::string("\t.blockSize = ") + std::to_string(blockSize) + std::string("\n") +
+                           std::string("\t.readTime = ") + std::to_string(readTime) + std::string("\n") +
+                           std::string("\t.writeTime = ") + std::to_string(writeTime) + std::string("\n") +
+                           std::string("\t.eraseTime = ") + std::to_string(eraseTime) + std::string("\n") +
+                           std::string("\t.logicalPages = ") + std::to_string(logicalPages) + std::string("\n") +
+                           std::string("\t.physicalBlocks = ") + std::to_string(physicalBlocks) + std::string("\n") +
+                           std::string("\t.overProvisioning = ") + std::to_string(overProvisioning) + std::string("\n") +
+                           std::string("\t.victimPolicy = ") + std::to_string(victimPolicy) + std::string("\n") +
+                           std::string("\t.wearLevelingTreshold = ") + std::to_string(wearLevelingTreshold) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string MemoryModelFlashNandPageFTL::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("MemoryModelFlashPageFTL {") +
+                           std::string(" .name = ") + std::string(modelName) +
+                           std::string(" .pageSize = ") + std::to_string(pageSize) +
+                           std::string(" .blockSize = ") + std::to_string(blockSize) +
+                           std::string(" .readTime = ") + std::to_string(readTime) +
+                           std::string(" .writeTime = ") + std::to_string(writeTime) +
+                           std::string(" .eraseTime = ") + std::to_string(eraseTime) +
+                           std::string(" .logicalPages = ") + std::to_string(logicalPages) +
+                           std::string(" .physicalBlocks = ") + std::to_string(physicalBlocks) +
+                           std::string(" .overProvisioning = ") + std::to_string(overProvisioning) +
+                           std::string(" .victimPolicy = ") + std::to_string(victimPolicy) +
+                           std::string(" .wearLevelingTreshold = ") + std::to_string(wearLevelingTreshold) +
+                           std::string(" .freeBlocks = ") + std::to_string(freeBlocks.size()) +
+                           std::string(" .writtenLogicalPages = ") + std::to_string(writtenLogicalPages) +
+                           std::string(" .hostWrittenPages = ") + std::to_string(hostWrittenPages) +
+                           std::string(" .gcWrittenPages = ") + std::to_string(gcWrittenPages) +
+                           std::string(" .wearLevelingWrittenPages = ") + std::to_string(wearLevelingWrittenPages) +
+                           std::string(" .erasedBlocks = ") + std::to_string(erasedBlocks) +
+                           std::string(" .writeAmplification = ") + std::to_string(getWriteAmplification()) +
+                           std::string(" .touchedBytes = ") + std::to_string(touchedBytes) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("MemoryModelFlashPageFTL {\n") +
+                           std::string("\t.name = ") + std::string(modelName) + std::string("\n") +
+                           std::string("\t.pageSize = ") + std::to_string(pageSize) + std::string("\n") +
+                           std::string("\t.blockSize = ") + std::to_string(blockSize) + std::string("\n") +
+                           std::string("\t.readTime = ") + std::to_string(readTime) + std::string("\n") +
+                           std::string("\t.writeTime = ") + std::to_string(writeTime) + std::string("\n") +
+                           std::string("\t.eraseTime = ") + std::to_string(eraseTime) + std::string("\n") +
+                           std::string("\t.logicalPages = ") + std::to_string(logicalPages) + std::string("\n") +
+                           std::string("\t.physicalBlocks = ") + std::to_string(physicalBlocks) + std::string("\n") +
+                           std::string("\t.overProvisioning = ") + std::to_string(overProvisioning) + std::string("\n") +
+                           std::string("\t.victimPolicy = ") + std::to_string(victimPolicy) + std::string("\n") +
+                           std::string("\t.wearLevelingTreshold = ") + std::to_string(wearLevelingTreshold) + std::string("\n") +
+                           std::string("\t.freeBlocks = ") + std::to_string(freeBlocks.size()) + std::string("\n") +
+                           std::string("\t.writtenLogicalPages = ") + std::to_string(writtenLogicalPages) + std::string("\n") +
+                           std::string("\t.hostWrittenPages = ") + std::to_string(hostWrittenPages) + std::string("\n") +
+                           std::string("\t.gcWrittenPages = ") + std::to_string(gcWrittenPages) + std::string("\n") +
+                           std::string("\t.wearLevelingWrittenPages = ") + std::to_string(wearLevelingWrittenPages) + std::string("\n") +
+                           std::string("\t.erasedBlocks = ") + std::to_string(erasedBlocks) + std::string("\n") +
+                           std::string("\t.writeAmplification = ") + std::to_string(getWriteAmplification()) + std::string("\n") +
+                           std::string("\t.touchedBytes = ") + std::to_string(touchedBytes) + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
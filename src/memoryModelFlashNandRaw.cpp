@@ -23,6 +23,8 @@ double MemoryModelFlashNandRaw::eraseBlocks(size_t blocks) noexcept(true)
 {
     const double time = static_cast<double>(blocks) * eraseTime;
 
+    wearTracker.wearWrittenUnits(blocks);
+
     LOGGER_LOG_TRACE("erasing blocks {}, took time {}", blocks, time);
     return time;
 }
@@ -42,6 +44,8 @@ double MemoryModelFlashNandRaw::writeBytes(size_t bytes) noexcept(true)
 {
     const size_t pages = bytesToPages(bytes);
 
+    wearTracker.writeUnits(bytesToBlocks(bytes));
+
     return writePages(pages);
 }
 
@@ -57,8 +61,8 @@ double MemoryModelFlashNandRaw::overwriteBytes(size_t bytes) noexcept(true)
     const size_t blocks = bytesToBlocks(bytes);
     time += eraseBlocks(blocks);
 
-    /* write new bytes and bytes from block, so we need to write full blocks */
-    time += writeBytes(blocks * blockSize);
+    /* write new bytes and bytes from block, so we need to write full blocks (in place, so not via writeBytes) */
+    time += writePages(bytesToPages(blocks * blockSize));
 
     return time;
 }
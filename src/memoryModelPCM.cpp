@@ -1,6 +1,9 @@
 #include <storage/memoryModelPCM.hpp>
 #include <logger/logger.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 double MemoryModelPCM::readMemLines(size_t memLines) const noexcept(true)
 {
     const double time = static_cast<double>(memLines) * readTime;
@@ -17,11 +20,156 @@ double MemoryModelPCM::writeMemLines(size_t memLines) noexcept(true)
     return time;
 }
 
+size_t MemoryModelPCM::remapLine(size_t logicalLine) const noexcept(true)
+{
+    switch (wearLeveling)
+    {
+        case WEAR_LEVELING_START_GAP:
+        {
+            const size_t physicalLine = (logicalLine % levelingLines + startLine) % levelingLines;
+
+            // lines from gap are shifted by 1
+            return physicalLine >= gapLine ? physicalLine + 1 : physicalLine;
+        }
+        case WEAR_LEVELING_SECURITY_REFRESH:
+        {
+            const size_t line = logicalLine % levelingLines;
+            const size_t partnerLine = line ^ previousKey ^ currentKey;
+
+            // pair is swapped when refresh pointer passed any of its lines
+            return (line < refreshPointer || partnerLine < refreshPointer) ? line ^ currentKey : line ^ previousKey;
+        }
+        default:
+            return logicalLine;
+    }
+}
+
+void MemoryModelPCM::wearLines(size_t firstLogicalLine, size_t memLines) noexcept(true)
+{
+    if (!wearTracker.isEnabled())
+        return;
+
+    if (wearLeveling == WEAR_LEVELING_NONE)
+    {
+        wearTracker.wearUnits(firstLogicalLine, memLines);
+        return;
+    }
+
+    for (size_t i = 0; i < memLines; ++i)
+        wearTracker.wearUnits(remapLine(firstLogicalLine + i), 1);
+}
+
+double MemoryModelPCM::moveLine(size_t physicalLine) noexcept(true)
+{
+    const double time = readMemLines(1) + writeMemLines(1);
+
+    touchedBytes += pageSize;
+    wearTracker.wearUnits(physicalLine, 1);
+    ++levelingWrittenLines;
+
+    return time;
+}
+
+double MemoryModelPCM::moveGap() noexcept(true)
+{
+    double time = 0.0;
+
+    if (gapLine == 0)
+    {
+        // gap reached the beginning, the last line goes to line 0 and all lines are rotated by 1
+        time += moveLine(0);
+        gapLine = levelingLines;
+        startLine = (startLine + 1) % levelingLines;
+    }
+    else
+    {
+        time += moveLine(gapLine);
+        --gapLine;
+    }
+
+    return time;
+}
+
+double MemoryModelPCM::refreshLine() noexcept(true)
+{
+    double time = 0.0;
+
+    const size_t line = refreshPointer;
+    const size_t partnerLine = line ^ previousKey ^ currentKey;
+
+    // pair is swapped once, by its lower line
+    if (partnerLine > line)
+        time += moveLine(line ^ currentKey) + moveLine(partnerLine ^ currentKey);
+
+    ++refreshPointer;
+    if (refreshPointer == levelingLines)
+    {
+        previousKey = currentKey;
+        currentKey = rng() % levelingLines;
+        refreshPointer = 0;
+    }
+
+    return time;
+}
+
+double MemoryModelPCM::levelWear(size_t memLines) noexcept(true)
+{
+    if (wearLeveling == WEAR_LEVELING_NONE)
+        return 0.0;
+
+    double time = 0.0;
+
+    writesSinceLevelingMove += memLines;
+    while (writesSinceLevelingMove >= levelingInterval)
+    {
+        writesSinceLevelingMove -= levelingInterval;
+
+        time += wearLeveling == WEAR_LEVELING_START_GAP ? moveGap() : refreshLine();
+        ++levelingMoves;
+    }
+
+    levelingTime += time;
+
+    LOGGER_LOG_TRACE("wear leveling after {} memLines, took time {}", memLines, time);
+    return time;
+}
+
+double MemoryModelPCM::getProgrammedBitsRatio() const noexcept(true)
+{
+    switch (differentialWrite)
+    {
+        case DIFFERENTIAL_WRITE_DCW:
+            return overwriteBitChangeRatio;
+        case DIFFERENTIAL_WRITE_FLIP_N_WRITE:
+            // inverted line needs 1 - ratio changes, flip bits are not counted
+            return std::min(overwriteBitChangeRatio, 1.0 - overwriteBitChangeRatio);
+        default:
+            return 1.0;
+    }
+}
+
+void MemoryModelPCM::resetWearLeveling() noexcept(true)
+{
+    writesSinceLevelingMove = 0;
+
+    startLine = 0;
+    gapLine = levelingLines;
+
+    rng.seed(defaultSeed);
+    previousKey = 0;
+    currentKey = wearLeveling == WEAR_LEVELING_SECURITY_REFRESH ? rng() % levelingLines : 0;
+    refreshPointer = 0;
+
+    levelingMoves = 0;
+    levelingWrittenLines = 0;
+    levelingTime = 0.0;
+}
+
 MemoryModelPCM::MemoryModelPCM(const char* modelName,
                                size_t memLine,
                                double readTime,
                                double writeTime)
-: MemoryModel(modelName, memLine, 0), readTime{readTime}, writeTime{writeTime}
+: MemoryModel(modelName, memLine, 0), readTime{readTime}, writeTime{writeTime}, differentialWrite{DIFFERENTIAL_WRITE_NONE}, overwriteBitChangeRatio{1.0}, programmedLinesCarry{0.0}, wearLeveling{WEAR_LEVELING_NONE}, levelingLines{0}, levelingInterval{0}, writesSinceLevelingMove{0}, startLine{0}, gapLine{0}, previousKey{0}, currentKey{0}, refreshPointer{0}, levelingMoves{0}, levelingWrittenLines{0}, levelingTime{0.0}, rng{defaultSeed}
 {
     LOGGER_LOG_DEBUG("PCM Memory model created: {}", toStringFull());
 }
@@ -40,7 +188,9 @@ double MemoryModelPCM::writeBytes(size_t bytes) noexcept(true)
     // PCM is byte addressed, so we can touched only specific bytes
     touchedBytes += bytes;
 
-    return writeMemLines(memLines);
+    wearLines(wearTracker.writeUnits(memLines), memLines);
+
+    return writeMemLines(memLines) + levelWear(memLines);
 }
 
 double MemoryModelPCM::overwriteBytes(size_t bytes) noexcept(true)
@@ -54,8 +204,36 @@ double MemoryModelPCM::overwriteBytes(size_t bytes) noexcept(true)
     if (bytes % pageSize != 0)
         time += readBytes(pageSize - bytes % pageSize);
 
-    // write new bytes + rewrite existing bytes from page
-    time += writeBytes(bytes);
+    // write new bytes + rewrite existing bytes from page, lines with data are worn instead of next lines
+    const size_t memLines = bytesToPages(bytes);
+
+    const size_t firstLine = wearTracker.pickWrittenUnits(memLines);
+    const size_t writtenLines = std::min(memLines, wearTracker.getWrittenUnits());
+
+    if (differentialWrite == DIFFERENTIAL_WRITE_NONE)
+    {
+        touchedBytes += bytes;
+        wearLines(firstLine, writtenLines);
+
+        time += writeMemLines(memLines);
+    }
+    else
+    {
+        // lines are compared with new data, only changed bits are programmed
+        const double programmedBitsRatio = getProgrammedBitsRatio();
+
+        touchedBytes += static_cast<size_t>(std::round(static_cast<double>(bytes) * programmedBitsRatio));
+
+        programmedLinesCarry += static_cast<double>(writtenLines) * programmedBitsRatio;
+        const size_t wornLines = static_cast<size_t>(programmedLinesCarry);
+        programmedLinesCarry -= static_cast<double>(wornLines);
+        wearLines(firstLine, wornLines);
+
+        time += readMemLines(memLines);
+        time += writeMemLines(memLines) * programmedBitsRatio;
+    }
+
+    time += levelWear(memLines);
 
     return time;
 }
@@ -74,6 +252,64 @@ double MemoryModelPCM::readBytes(size_t bytes) noexcept(true)
     return readMemLines(memLines);
 }
 
+void MemoryModelPCM::setWearLeveling(enum WearLeveling wearLeveling, size_t capacity, size_t interval) noexcept(true)
+{
+    size_t lines = capacity / pageSize;
+
+    if (wearLeveling != WEAR_LEVELING_NONE && lines < 2)
+    {
+        LOGGER_LOG_WARN("Wear leveling needs at least 2 lines, got {}, wear leveling is off", lines);
+        wearLeveling = WEAR_LEVELING_NONE;
+    }
+
+    if (interval == 0)
+    {
+        LOGGER_LOG_WARN("Wear leveling interval cannot be 0, using 1");
+        interval = 1;
+    }
+
+    // XOR keys need power of 2 lines
+    if (wearLeveling == WEAR_LEVELING_SECURITY_REFRESH && (lines & (lines - 1)) != 0)
+    {
+        size_t powerOf2Lines = 1;
+        while (powerOf2Lines * 2 <= lines)
+            powerOf2Lines *= 2;
+
+        LOGGER_LOG_WARN("Security refresh needs power of 2 lines, using {} lines instead of {}", powerOf2Lines, lines);
+        lines = powerOf2Lines;
+    }
+
+    this->wearLeveling = wearLeveling;
+    levelingLines = wearLeveling == WEAR_LEVELING_NONE ? 0 : lines;
+    levelingInterval = interval;
+
+    resetWearLeveling();
+
+    LOGGER_LOG_DEBUG("PCM wear leveling {} set for {} lines with interval {}", static_cast<int>(wearLeveling), levelingLines, levelingInterval);
+}
+
+void MemoryModelPCM::setOverwriteBitChangeRatio(double ratio) noexcept(true)
+{
+    overwriteBitChangeRatio = std::clamp(ratio, 0.0, 1.0);
+}
+
+void MemoryModelPCM::setDifferentialWrite(enum DifferentialWrite differentialWrite) noexcept(true)
+{
+    this->differentialWrite = differentialWrite;
+    programmedLinesCarry = 0.0;
+
+    LOGGER_LOG_DEBUG("PCM differential write {} set", static_cast<int>(differentialWrite));
+}
+
+void MemoryModelPCM::resetState() noexcept(true)
+{
+    MemoryModel::resetState();
+
+    programmedLinesCarry = 0.0;
+
+    resetWearLeveling();
+}
+
 std::string MemoryModelPCM::toString(bool oneLine) const noexcept(true)
 {
     if (oneLine)
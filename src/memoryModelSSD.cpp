@@ -53,6 +53,8 @@ double MemoryModelSSD::eraseBlocks(size_t blocks) noexcept(true)
     const double time = static_cast<double>(blocks) * eraseTime;
     dirtyPages -= pagesInBlock * blocks;
 
+    wearTracker.wearWrittenUnits(blocks);
+
     // LOGGER_LOG_TRACE("erasing blocks {}, took time {}", blocks, time);
     return time;
 }
@@ -77,6 +79,8 @@ double MemoryModelSSD::writeBytes(size_t bytes) noexcept(true)
 
     const size_t pages = bytesToPages(bytes);
 
+    wearTracker.writeUnits(bytesToBlocks(bytes));
+
     return pages < seqOpTreshold ? writePagesRandom(pages) : writePagesSeq(pages);
 }
 
@@ -0,0 +1,249 @@
+#include <storage/memoryModelStriped.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+
+MemoryModelStriped::MemoryModelStriped(const MemoryModel& model, size_t numDisks, size_t stripeUnit, bool isMirrored)
+: MemoryModel(isMirrored ? "RAID-10" : "RAID-0", model.getPageSize(), model.getBlockSize()), numDisks{numDisks}, stripeUnit{stripeUnit}, mirrored{isMirrored}, nextStripe{0}
+{
+    if (this->numDisks == 0)
+    {
+        LOGGER_LOG_WARN("Stripe needs at least 1 disk, using 1 disk");
+        this->numDisks = 1;
+    }
+
+    // stripe unit has to contain whole pages
+    const size_t alignedStripeUnit = std::max(bytesToPages(stripeUnit), static_cast<size_t>(1)) * pageSize;
+    if (alignedStripeUnit != stripeUnit)
+    {
+        LOGGER_LOG_WARN("Stripe unit {} is not aligned to page size {}, using {}", stripeUnit, pageSize, alignedStripeUnit);
+        this->stripeUnit = alignedStripeUnit;
+    }
+
+    const size_t numMembers = mirrored ? 2 * this->numDisks : this->numDisks;
+    for (size_t i = 0; i < numMembers; ++i)
+    {
+        members.push_back(std::unique_ptr<MemoryModel>(model.clone()));
+        members.back()->resetState();
+    }
+
+    membersCounters = std::vector<MemoryCounters>(numMembers);
+
+    LOGGER_LOG_DEBUG("Striped Memory model created: {}", toStringFull());
+}
+
+MemoryModelStriped::MemoryModelStriped(const MemoryModelStriped& other)
+: MemoryModel(other), membersCounters{other.membersCounters}, numDisks{other.numDisks}, stripeUnit{other.stripeUnit}, mirrored{other.mirrored}, nextStripe{other.nextStripe}
+{
+    for (const auto& member : other.members)
+        members.push_back(std::unique_ptr<MemoryModel>(member->clone()));
+}
+
+MemoryModelStriped& MemoryModelStriped::operator=(const MemoryModelStriped& other)
+{
+    if (this == &other)
+        return *this;
+
+    MemoryModel::operator=(other);
+
+    members.clear();
+    for (const auto& member : other.members)
+        members.push_back(std::unique_ptr<MemoryModel>(member->clone()));
+
+    membersCounters = other.membersCounters;
+    numDisks = other.numDisks;
+    stripeUnit = other.stripeUnit;
+    mirrored = other.mirrored;
+    nextStripe = other.nextStripe;
+
+    return *this;
+}
+
+std::vector<size_t> MemoryModelStriped::splitBytes(size_t bytes, size_t width) noexcept(true)
+{
+    std::vector<size_t> memberBytes(width, 0);
+
+    const size_t fullUnits = bytes / stripeUnit;
+    const size_t lastUnitBytes = bytes % stripeUnit;
+
+    // each member gets the same number of full units, first members from nextStripe get 1 unit more
+    for (size_t i = 0; i < width; ++i)
+        memberBytes[(nextStripe + i) % width] = (fullUnits / width + (i < fullUnits % width ? 1 : 0)) * stripeUnit;
+
+    if (lastUnitBytes > 0)
+        memberBytes[(nextStripe + fullUnits) % width] += lastUnitBytes;
+
+    nextStripe = (nextStripe + fullUnits + (lastUnitBytes > 0 ? 1 : 0)) % (2 * numDisks);
+
+    return memberBytes;
+}
+
+double MemoryModelStriped::accessMember(size_t member,
+                                        size_t bytes,
+                                        double (MemoryModel::*op)(size_t),
+                                        enum MemoryCounters::MemoryCountersD timeId,
+                                        enum MemoryCounters::MemoryCountersL bytesId,
+                                        enum MemoryCounters::MemoryCountersL opsId) noexcept(true)
+{
+    const double time = ((*members[member]).*op)(bytes);
+
+    membersCounters[member].pegCounter(timeId, time);
+    membersCounters[member].pegCounter(bytesId, static_cast<long>(bytes));
+    membersCounters[member].pegCounter(opsId, 1L);
+
+    return time;
+}
+
+double MemoryModelStriped::writeStriped(size_t bytes,
+                                        double (MemoryModel::*op)(size_t),
+                                        enum MemoryCounters::MemoryCountersD timeId,
+                                        enum MemoryCounters::MemoryCountersL bytesId,
+                                        enum MemoryCounters::MemoryCountersL opsId) noexcept(true)
+{
+    if (bytes == 0)
+        return 0.0;
+
+    const std::vector<size_t> memberBytes = splitBytes(bytes, numDisks);
+
+    double time = 0.0;
+    for (size_t i = 0; i < numDisks; ++i)
+    {
+        if (memberBytes[i] == 0)
+            continue;
+
+        double memberTime = accessMember(i, memberBytes[i], op, timeId, bytesId, opsId);
+        if (mirrored)
+            memberTime = std::max(memberTime, accessMember(i + numDisks, memberBytes[i], op, timeId, bytesId, opsId));
+
+        time = std::max(time, memberTime);
+    }
+
+    return time;
+}
+
+double MemoryModelStriped::writeBytes(size_t bytes) noexcept(true)
+{
+    return writeStriped(bytes,
+                        &MemoryModel::writeBytes,
+                        MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_TIME,
+                        MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES,
+                        MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_OPERATIONS);
+}
+
+double MemoryModelStriped::overwriteBytes(size_t bytes) noexcept(true)
+{
+    return writeStriped(bytes,
+                        &MemoryModel::overwriteBytes,
+                        MemoryCounters::MEMORY_COUNTER_RW_OVERWRITE_TOTAL_TIME,
+                        MemoryCounters::MEMORY_COUNTER_RW_OVERWRITE_TOTAL_BYTES,
+                        MemoryCounters::MEMORY_COUNTER_RW_OVERWRITE_TOTAL_OPERATIONS);
+}
+
+double MemoryModelStriped::readBytes(size_t bytes) noexcept(true)
+{
+    if (bytes == 0)
+        return 0.0;
+
+    // mirrors have the same data, so reads can use all copies
+    const std::vector<size_t> memberBytes = splitBytes(bytes, members.size());
+
+    double time = 0.0;
+    for (size_t i = 0; i < members.size(); ++i)
+        if (memberBytes[i] > 0)
+            time = std::max(time, accessMember(i,
+                                               memberBytes[i],
+                                               &MemoryModel::readBytes,
+                                               MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME,
+                                               MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES,
+                                               MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS));
+
+    return time;
+}
+
+size_t MemoryModelStriped::getMemoryWearOut() const noexcept(true)
+{
+    size_t wearOut = 0;
+    for (const auto& member : members)
+        wearOut += member->getMemoryWearOut();
+
+    return wearOut;
+}
+
+void MemoryModelStriped::setOverwriteBitChangeRatio(double ratio) noexcept(true)
+{
+    for (auto& member : members)
+        member->setOverwriteBitChangeRatio(ratio);
+}
+
+void MemoryModelStriped::enableWearTracking(size_t capacity, size_t sampleRate) noexcept(true)
+{
+    for (auto& member : members)
+        member->enableWearTracking((capacity + numDisks - 1) / numDisks, sampleRate);
+}
+
+void MemoryModelStriped::resetState() noexcept(true)
+{
+    MemoryModel::resetState();
+
+    for (auto& member : members)
+        member->resetState();
+
+    for (auto& counters : membersCounters)
+        counters.resetAllCounters();
+
+    nextStripe = 0;
+}
+
+std::string MemoryModelStriped::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("MemoryModelStriped {") +
+                           std::string(" .name = ") + std::string(modelName) +
+                           std::string(" .pageSize = ") + std::to_string(pageSize) +
+                           std::string(" .blockSize = ") + std::to_string(blockSize) +
+                           std::string(" .numDisks = ") + std::to_string(numDisks) +
+                           std::string(" .stripeUnit = ") + std::to_string(stripeUnit) +
+                           std::string(" .isMirrored = ") + std::to_string(mirrored) +
+                           std::string(" .member = ") + (members.empty() ? std::string("{}") : members[0]->toString()) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("MemoryModelStriped {\n") +
+                           std::string("\t.name = ") + std::string(modelName) + std::string("\n") +
+                           std::string("\t.pageSize = ") + std::to_string(pageSize) + std::string("\n") +
+                           std::string("\t.blockSize = ") + std::to_string(blockSize) + std::string("\n") +
+                           std::string("\t.numDisks = ") + std::to_string(numDisks) + std::string("\n") +
+                           std::string("\t.stripeUnit = ") + std::to_string(stripeUnit) + std::string("\n") +
+                           std::string("\t.isMirrored = ") + std::to_string(mirrored) + std::string("\n") +
+                           std::string("\t.member = ") + (members.empty() ? std::string("{}") : members[0]->toString()) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string MemoryModelStriped::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("MemoryModelStriped {") +
+                           std::string(" .name = ") + std::string(modelName) +
+                           std::string(" .pageSize = ") + std::to_string(pageSize) +
+                           std::string(" .blockSize = ") + std::to_string(blockSize) +
+                           std::string(" .numDisks = ") + std::to_string(numDisks) +
+                           std::string(" .stripeUnit = ") + std::to_string(stripeUnit) +
+                           std::string(" .isMirrored = ") + std::to_string(mirrored) +
+                           std::string(" .numMembers = ") + std::to_string(members.size()) +
+                           std::string(" .nextStripe = ") + std::to_string(nextStripe) +
+                           std::string(" .touchedBytes = ") + std::to_string(getMemoryWearOut()) +
+                           std::string(" .member = ") + (members.empty() ? std::string("{}") : members[0]->toStringFull()) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("MemoryModelStriped {\n") +
+                           std::string("\t.name = ") + std::string(modelName) + std::string("\n") +
+                           std::string("\t.pageSize = ") + std::to_string(pageSize) + std::string("\n") +
+                           std::string("\t.blockSize = ") + std::to_string(blockSize) + std::string("\n") +
+                           std::string("\t.numDisks = ") + std::to_string(numDisks) + std::string("\n") +
+                           std::string("\t.stripeUnit = ") + std::to_string(stripeUnit) + std::string("\n") +
+                           std::string("\t.isMirrored = ") + std::to_string(mirrored) + std::string("\n") +
+                           std::string("\t.numMembers = ") + std::to_string(members.size()) + std::string("\n") +
+                           std::string("\t.nextStripe = ") + std::to_string(nextStripe) + std::string("\n") +
+                           std::string("\t.touchedBytes = ") + std::to_string(getMemoryWearOut()) + std::string("\n") +
+                           std::string("\t.member = ") + (members.empty() ? std::string("{}") : members[0]->toStringFull()) + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
@@ -0,0 +1,414 @@
+#include <storage/memoryModelTiered.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+MemoryModelTiered::LevelPolicy::LevelPolicy(size_t hintsPerTier)
+: hintsPerTier{hintsPerTier}
+{
+    if (this->hintsPerTier == 0)
+    {
+        LOGGER_LOG_WARN("LevelPolicy needs at least 1 hint per tier, using 1");
+        this->hintsPerTier = 1;
+    }
+}
+
+size_t MemoryModelTiered::LevelPolicy::getTier(size_t hint, size_t accesses, size_t currentTier, size_t numTiers) const noexcept(true)
+{
+    (void)accesses;
+    (void)currentTier;
+
+    return std::min(hint / hintsPerTier, numTiers - 1);
+}
+
+std::string MemoryModelTiered::LevelPolicy::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("LevelPolicy {") +
+                           std::string(" .hintsPerTier = ") + std::to_string(hintsPerTier) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("LevelPolicy {\n") +
+                           std::string("\t.hintsPerTier = ") + std::to_string(hintsPerTier) + std::string("\n") +
+                           std::string("}"));
+}
+
+MemoryModelTiered::PromotionPolicy::PromotionPolicy(size_t accessThreshold)
+: accessThreshold{accessThreshold}
+{
+    if (this->accessThreshold == 0)
+    {
+        LOGGER_LOG_WARN("PromotionPolicy needs at least 1 access to promote hint, using 1");
+        this->accessThreshold = 1;
+    }
+}
+
+size_t MemoryModelTiered::PromotionPolicy::getTier(size_t hint, size_t accesses, size_t currentTier, size_t numTiers) const noexcept(true)
+{
+    (void)hint;
+
+    // new hint, start from the slowest tier
+    if (currentTier >= numTiers)
+        return numTiers - 1;
+
+    if (accesses >= accessThreshold && currentTier > 0)
+        return currentTier - 1;
+
+    return currentTier;
+}
+
+std::string MemoryModelTiered::PromotionPolicy::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("PromotionPolicy {") +
+                           std::string(" .accessThreshold = ") + std::to_string(accessThreshold) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("PromotionPolicy {\n") +
+                           std::string("\t.accessThreshold = ") + std::to_string(accessThreshold) + std::string("\n") +
+                           std::string("}"));
+}
+
+MemoryModelTiered::MemoryModelTiered(const std::vector<const MemoryModel*>& tiers, const std::vector<size_t>& tiersCapacity, MigrationPolicy* policy)
+: MemoryModel("Tiered", 0, 0), policy{std::unique_ptr<MigrationPolicy>(policy)}, currentHint{0}, migrationTime{0.0}, migrationBytes{0}, migrationOperations{0}
+{
+    for (const MemoryModel* tier : tiers)
+    {
+        this->tiers.push_back(std::unique_ptr<MemoryModel>(tier->clone()));
+        this->tiers.back()->resetState();
+    }
+
+    if (this->tiers.empty())
+        LOGGER_LOG_ERROR("MemoryModelTiered needs at least 1 tier");
+
+    // controller caches the smallest page, each tier rounds requests to own pages
+    pageSize = this->tiers.empty() ? 0 : this->tiers[0]->getPageSize();
+    blockSize = this->tiers.empty() ? 0 : this->tiers[0]->getBlockSize();
+    for (const auto& tier : this->tiers)
+    {
+        pageSize = std::min(pageSize, tier->getPageSize());
+        blockSize = std::max(blockSize, tier->getBlockSize());
+    }
+
+    this->tiersCapacity = tiersCapacity;
+    this->tiersCapacity.resize(this->tiers.size(), 0);
+
+    tiersCounters = std::vector<MemoryCounters>(this->tiers.size());
+
+    LOGGER_LOG_DEBUG("Tiered Memory model created: {}", toStringFull());
+}
+
+MemoryModelTiered::MemoryModelTiered(const MemoryModelTiered& other)
+: MemoryModel(other), tiersCapacity{other.tiersCapacity}, tiersCounters{other.tiersCounters}, policy{std::unique_ptr<MigrationPolicy>(other.policy->clone())}, hints{other.hints}, currentHint{other.currentHint}, migrationTime{other.migrationTime}, migrationBytes{other.migrationBytes}, migrationOperations{other.migrationOperations}
+{
+    for (const auto& tier : other.tiers)
+        tiers.push_back(std::unique_ptr<MemoryModel>(tier->clone()));
+}
+
+MemoryModelTiered& MemoryModelTiered::operator=(const MemoryModelTiered& other)
+{
+    if (this == &other)
+        return *this;
+
+    MemoryModel::operator=(other);
+
+    tiers.clear();
+    for (const auto& tier : other.tiers)
+        tiers.push_back(std::unique_ptr<MemoryModel>(tier->clone()));
+
+    tiersCapacity = other.tiersCapacity;
+    tiersCounters = other.tiersCounters;
+    policy.reset(other.policy->clone());
+    hints = other.hints;
+    currentHint = other.currentHint;
+    migrationTime = other.migrationTime;
+    migrationBytes = other.migrationBytes;
+    migrationOperations = other.migrationOperations;
+
+    return *this;
+}
+
+MemoryModelTiered::HintState& MemoryModelTiered::getHintState(size_t hint) noexcept(true)
+{
+    auto it = hints.find(hint);
+    if (it != hints.end())
+        return it->second;
+
+    const size_t tier = std::min(policy->getTier(hint, 0, tiers.size(), tiers.size()), tiers.size() - 1);
+    LOGGER_LOG_TRACE("New placement hint {} placed on tier {}", hint, tier);
+
+    return hints[hint] = HintState{tier, 0, 0, 0};
+}
+
+double MemoryModelTiered::migrateHint(size_t hint, size_t tier) noexcept(true)
+{
+    HintState& state = hints[hint];
+    const size_t hintBytes = state.getBytes();
+    double time = 0.0;
+
+    if (hintBytes > 0)
+    {
+        const double readTime = tiers[state.tier]->readBytes(hintBytes);
+        const double writeTime = tiers[tier]->writeBytes(hintBytes);
+
+        tiersCounters[state.tier].pegCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME, readTime);
+        tiersCounters[state.tier].pegCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES, static_cast<long>(hintBytes));
+        tiersCounters[state.tier].pegCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS, 1L);
+
+        tiersCounters[tier].pegCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_TIME, writeTime);
+        tiersCounters[tier].pegCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES, static_cast<long>(hintBytes));
+        tiersCounters[tier].pegCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_OPERATIONS, 1L);
+
+        time = readTime + writeTime;
+
+        migrationTime += time;
+        migrationBytes += hintBytes;
+        ++migrationOperations;
+    }
+
+    LOGGER_LOG_TRACE("Hint {} with {} bytes migrated from tier {} to tier {}, took {}s", hint, hintBytes, state.tier, tier, time);
+
+    state.tier = tier;
+    state.accesses = 0;
+
+    return time;
+}
+
+double MemoryModelTiered::enforceCapacity(size_t tier, size_t hint) noexcept(true)
+{
+    double time = 0.0;
+
+    // the last tier keeps everything what does not fit above
+    for (size_t t = tier; t + 1 < tiers.size(); ++t)
+        while (tiersCapacity[t] > 0 && getTierUsedBytes(t) > tiersCapacity[t])
+        {
+            auto victim = hints.end();
+            for (auto it = hints.begin(); it != hints.end(); ++it)
+            {
+                if (it->second.tier != t)
+                    continue;
+
+                if (victim == hints.end() ||
+                    (victim->first == hint && it->first != hint) ||
+                    (it->first != hint && it->second.accesses < victim->second.accesses))
+                    victim = it;
+            }
+
+            time += migrateHint(victim->first, t + 1);
+        }
+
+    return time;
+}
+
+double MemoryModelTiered::accessTier(size_t bytes,
+                                     double (MemoryModel::*op)(size_t),
+                                     enum MemoryCounters::MemoryCountersD timeId,
+                                     enum MemoryCounters::MemoryCountersL bytesId,
+                                     enum MemoryCounters::MemoryCountersL opsId) noexcept(true)
+{
+    if (bytes == 0)
+        return 0.0;
+
+    const size_t tier = getHintState(currentHint).tier;
+    const double time = ((*tiers[tier]).*op)(bytes);
+
+    tiersCounters[tier].pegCounter(timeId, time);
+    tiersCounters[tier].pegCounter(bytesId, static_cast<long>(bytes));
+    tiersCounters[tier].pegCounter(opsId, 1L);
+
+    return time;
+}
+
+double MemoryModelTiered::setPlacementHint(size_t hint, size_t hintBytes) noexcept(true)
+{
+    HintState& state = getHintState(hint);
+
+    currentHint = hint;
+    state.bytes = hintBytes;
+    state.writtenBytes = 0;
+    ++state.accesses;
+
+    double time = 0.0;
+
+    const size_t oldTier = state.tier;
+    const size_t tier = std::min(policy->getTier(hint, state.accesses, oldTier, tiers.size()), tiers.size() - 1);
+    if (tier != oldTier)
+        time += migrateHint(hint, tier);
+
+    time += enforceCapacity(std::min(tier, oldTier), hint);
+
+    return time;
+}
+
+double MemoryModelTiered::writeBytes(size_t bytes) noexcept(true)
+{
+    double time = accessTier(bytes,
+                             &MemoryModel::writeBytes,
+                             MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_TIME,
+                             MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES,
+                             MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_OPERATIONS);
+
+    if (bytes == 0)
+        return time;
+
+    HintState& state = getHintState(currentHint);
+    state.writtenBytes += bytes;
+
+    time += enforceCapacity(state.tier, currentHint);
+
+    return time;
+}
+
+double MemoryModelTiered::overwriteBytes(size_t bytes) noexcept(true)
+{
+    return accessTier(bytes,
+                      &MemoryModel::overwriteBytes,
+                      MemoryCounters::MEMORY_COUNTER_RW_OVERWRITE_TOTAL_TIME,
+                      MemoryCounters::MEMORY_COUNTER_RW_OVERWRITE_TOTAL_BYTES,
+                      MemoryCounters::MEMORY_COUNTER_RW_OVERWRITE_TOTAL_OPERATIONS);
+}
+
+double MemoryModelTiered::readBytes(size_t bytes) noexcept(true)
+{
+    return accessTier(bytes,
+                      &MemoryModel::readBytes,
+                      MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME,
+                      MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES,
+                      MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS);
+}
+
+size_t MemoryModelTiered::getMemoryWearOut() const noexcept(true)
+{
+    size_t wearOut = 0;
+    for (const auto& tier : tiers)
+        wearOut += tier->getMemoryWearOut();
+
+    return wearOut;
+}
+
+size_t MemoryModelTiered::getTierUsedBytes(size_t tier) const noexcept(true)
+{
+    return std::accumulate(hints.begin(), hints.end(), static_cast<size_t>(0),
+                           [tier](size_t sum, const std::pair<const size_t, HintState>& hint)
+                           {
+                               return hint.second.tier == tier ? sum + hint.second.getBytes() : sum;
+                           });
+}
+
+size_t MemoryModelTiered::getHintTier(size_t hint) const noexcept(true)
+{
+    auto it = hints.find(hint);
+
+    return it == hints.end() ? tiers.size() : it->second.tier;
+}
+
+void MemoryModelTiered::setOverwriteBitChangeRatio(double ratio) noexcept(true)
+{
+    for (auto& tier : tiers)
+        tier->setOverwriteBitChangeRatio(ratio);
+}
+
+void MemoryModelTiered::enableWearTracking(size_t capacity, size_t sampleRate) noexcept(true)
+{
+    for (size_t i = 0; i < tiers.size(); ++i)
+        tiers[i]->enableWearTracking(tiersCapacity[i] > 0 ? tiersCapacity[i] : capacity, sampleRate);
+}
+
+void MemoryModelTiered::resetState() noexcept(true)
+{
+    MemoryModel::resetState();
+
+    for (auto& tier : tiers)
+        tier->resetState();
+
+    for (auto& counters : tiersCounters)
+        counters.resetAllCounters();
+
+    hints.clear();
+    currentHint = 0;
+    migrationTime = 0.0;
+    migrationBytes = 0;
+    migrationOperations = 0;
+}
+
+std::string MemoryModelTiered::toString(bool oneLine) const noexcept(true)
+{
+    auto buildStringFromTiers = [](const std::string &accumulator, const std::unique_ptr<MemoryModel> &tier)
+    {
+        return accumulator.empty() ? std::string(tier->getModelName()) : accumulator + "," + std::string(tier->getModelName());
+    };
+
+    const std::string tiersString = std::string("{") +
+                                    std::accumulate(std::begin(tiers), std::end(tiers), std::string(), buildStringFromTiers) +
+                                    std::string("}");
+
+    if (oneLine)
+        return std::string(std::string("MemoryModelTiered {") +
+                           std::string(" .name = ") + std::string(modelName) +
+                           std::string(" .pageSize = ") + std::to_string(pageSize) +
+                           std::string(" .blockSize = ") + std::to_string(blockSize) +
+                           std::string(" .tiers = ") + tiersString +
+                           std::string(" .policy = ") + (policy ? policy->toString() : std::string("{}")) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("MemoryModelTiered {\n") +
+                           std::string("\t.name = ") + std::string(modelName) + std::string("\n") +
+                           std::string("\t.pageSize = ") + std::to_string(pageSize) + std::string("\n") +
+                           std::string("\t.blockSize = ") + std::to_string(blockSize) + std::string("\n") +
+                           std::string("\t.tiers = ") + tiersString + std::string("\n") +
+                           std::string("\t.policy = ") + (policy ? policy->toString() : std::string("{}")) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string MemoryModelTiered::toStringFull(bool oneLine) const noexcept(true)
+{
+    auto buildStringFromTiers = [](const std::string &accumulator, const std::unique_ptr<MemoryModel> &tier)
+    {
+        return accumulator.empty() ? tier->toStringFull() : accumulator + "," + tier->toStringFull();
+    };
+
+    auto buildStringFromCapacity = [](const std::string &accumulator, const size_t &capacity)
+    {
+        return accumulator.empty() ? std::to_string(capacity) : accumulator + "," + std::to_string(capacity);
+    };
+
+    const std::string tiersString = std::string("{") +
+                                    std::accumulate(std::begin(tiers), std::end(tiers), std::string(), buildStringFromTiers) +
+                                    std::string("}");
+
+    const std::string capacityString = std::string("{") +
+                                       std::accumulate(std::begin(tiersCapacity), std::end(tiersCapacity), std::string(), buildStringFromCapacity) +
+                                       std::string("}");
+
+    if (oneLine)
+        return std::string(std::string("MemoryModelTiered {") +
+                           std::string(" .name = ") + std::string(modelName) +
+                           std::string(" .pageSize = ") + std::to_string(pageSize) +
+                           std::string(" .blockSize = ") + std::to_string(blockSize) +
+                           std::string(" .tiers = ") + tiersString +
+                           std::string(" .tiersCapacity = ") + capacityString +
+                           std::string(" .policy = ") + (policy ? policy->toString() : std::string("{}")) +
+                           std::string(" .numHints = ") + std::to_string(hints.size()) +
+                           std::string(" .currentHint = ") + std::to_string(currentHint) +
+                           std::string(" .migrationTime = ") + std::to_string(migrationTime) +
+                           std::string(" .migrationBytes = ") + std::to_string(migrationBytes) +
+                           std::string(" .migrationOperations = ") + std::to_string(migrationOperations) +
+                           std::string(" .touchedBytes = ") + std::to_string(getMemoryWearOut()) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("MemoryModelTiered {\n") +
+                           std::string("\t.name = ") + std::string(modelName) + std::string("\n") +
+                           std::string("\t.pageSize = ") + std::to_string(pageSize) + std::string("\n") +
+                           std::string("\t.blockSize = ") + std::to_string(blockSize) + std::string("\n") +
+                           std::string("\t.tiers = ") + tiersString + std::string("\n") +
+                           std::string("\t.tiersCapacity = ") + capacityString + std::string("\n") +
+                           std::string("\t.policy = ") + (policy ? policy->toString() : std::string("{}")) + std::string("\n") +
+                           std::string("\t.numHints = ") + std::to_string(hints.size()) + std::string("\n") +
+                           std::string("\t.currentHint = ") + std::to_string(currentHint) + std::string("\n") +
+                           std::string("\t.migrationTime = ") + std::to_string(migrationTime) + std::string("\n") +
+                           std::string("\t.migrationBytes = ") + std::to_string(migrationBytes) + std::string("\n") +
+                           std::string("\t.migrationOperations = ") + std::to_string(migrationOperations) + std::string("\n") +
+                           std::string("\t.touchedBytes = ") + std::to_string(getMemoryWearOut()) + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
@@ -0,0 +1,455 @@
+#include <storage/memoryModelZNS.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+
+double MemoryModelZNS::readPages(size_t pages) const noexcept(true)
+{
+    const double time = static_cast<double>(pages) * readTime;
+
+    LOGGER_LOG_TRACE("reading pages {}, took time {}", pages, time);
+    return time;
+}
+
+double MemoryModelZNS::resetZone(size_t zone) noexcept(true)
+{
+    zoneWritePointer[zone] = 0;
+    zoneValidPages[zone] = 0;
+    zoneState[zone] = ZONE_STATE_EMPTY;
+    ++zoneResetCount[zone];
+    ++zoneResets;
+
+    wearTracker.wearUnits(zone * bytesToBlocks(zoneSize), bytesToBlocks(zoneSize));
+
+    emptyZones.push_back(zone);
+
+    LOGGER_LOG_TRACE("resetting zone {}, took time {}", zone, zoneResetTime);
+    return zoneResetTime;
+}
+
+double MemoryModelZNS::finishZone(size_t zone) noexcept(true)
+{
+    for (auto it = openZones.begin(); it != openZones.end(); ++it)
+        if (it->second == zone)
+        {
+            openZones.erase(it);
+            break;
+        }
+
+    if (zoneWritePointer[zone] < zonePages)
+    {
+        ++finishedZones;
+        wastedPages += zonePages - zoneWritePointer[zone];
+    }
+
+    zoneState[zone] = ZONE_STATE_FULL;
+
+    if (zoneValidPages[zone] == 0)
+        return resetZone(zone);
+
+    return 0.0;
+}
+
+double MemoryModelZNS::getOpenZone(size_t stream, size_t& zone) noexcept(true)
+{
+    double time = 0.0;
+
+    // full zones are finished by appendPages, so open zone has free pages
+    auto it = openZones.find(stream);
+    if (it != openZones.end())
+    {
+        zone = it->second;
+        return time;
+    }
+
+    // GC copies pages to own stream, so it cannot wait for itself
+    if (!duringGarbageCollection)
+        while (emptyZones.size() <= gcEmptyZonesTreshold)
+        {
+            const size_t resetsBefore = zoneResets;
+            time += collectGarbage();
+
+            if (zoneResets == resetsBefore)
+                break;
+        }
+
+    // GC could finish some zones, so check limit after it
+    while (openZones.size() >= maxOpenZones)
+    {
+        auto lru = std::min_element(openZones.begin(), openZones.end(), [this](const std::pair<const size_t, size_t>& a, const std::pair<const size_t, size_t>& b){ return zoneLastWrite[a.second] < zoneLastWrite[b.second]; });
+        time += finishZone(lru->second);
+    }
+
+    if (emptyZones.empty())
+    {
+        LOGGER_LOG_ERROR("ZNS device is full, there is no empty zone");
+        zone = invalidZone;
+        return time;
+    }
+
+    zone = emptyZones.front();
+    emptyZones.pop_front();
+    zoneState[zone] = ZONE_STATE_OPEN;
+    openZones[stream] = zone;
+
+    return time;
+}
+
+double MemoryModelZNS::appendPages(size_t stream, size_t pages, std::vector<Extent>& extents) noexcept(true)
+{
+    double time = 0.0;
+
+    while (pages > 0)
+    {
+        size_t zone = invalidZone;
+        time += getOpenZone(stream, zone);
+
+        if (zone == invalidZone)
+            break;
+
+        const size_t pagesInZone = std::min(pages, zonePages - zoneWritePointer[zone]);
+        zoneWritePointer[zone] += pagesInZone;
+        zoneValidPages[zone] += pagesInZone;
+        zoneLastWrite[zone] = ++writeClock;
+
+        if (!extents.empty() && extents.back().zone == zone)
+            extents.back().pages += pagesInZone;
+        else
+            extents.push_back(Extent{zone, pagesInZone});
+
+        touchedBytes += pagesInZone * pageSize;
+        time += static_cast<double>(pagesInZone) * writeTime;
+        pages -= pagesInZone;
+
+        if (zoneWritePointer[zone] == zonePages)
+            time += finishZone(zone);
+    }
+
+    return time;
+}
+
+double MemoryModelZNS::appendHintPages(size_t hint, size_t pages) noexcept(true)
+{
+    std::vector<Extent> extents;
+    const double time = appendPages(getStream(hint), pages, extents);
+
+    std::deque<Extent>& hintData = hintExtents[hint];
+    for (const Extent& extent : extents)
+    {
+        if (!hintData.empty() && hintData.back().zone == extent.zone)
+            hintData.back().pages += extent.pages;
+        else
+            hintData.push_back(extent);
+
+        hintValidPages[hint] += extent.pages;
+    }
+
+    hostWrittenPages += pages;
+
+    LOGGER_LOG_TRACE("appending pages {} of hint {}, took time {}", pages, hint, time);
+    return time;
+}
+
+double MemoryModelZNS::invalidateHintPages(size_t hint, size_t validPages) noexcept(true)
+{
+    double time = 0.0;
+
+    auto it = hintExtents.find(hint);
+    if (it == hintExtents.end())
+        return time;
+
+    std::deque<Extent>& hintData = it->second;
+    size_t& hintPages = hintValidPages[hint];
+    while (hintPages > validPages && !hintData.empty())
+    {
+        Extent& extent = hintData.front();
+        const size_t pages = std::min(extent.pages, hintPages - validPages);
+        const size_t zone = extent.zone;
+
+        extent.pages -= pages;
+        hintPages -= pages;
+        zoneValidPages[zone] -= pages;
+
+        if (extent.pages == 0)
+            hintData.pop_front();
+
+        // open zone is still written, it will be reset when finished
+        if (zoneValidPages[zone] == 0 && zoneState[zone] == ZONE_STATE_FULL)
+            time += resetZone(zone);
+    }
+
+    return time;
+}
+
+double MemoryModelZNS::collectGarbage() noexcept(true)
+{
+    size_t victim = invalidZone;
+    for (size_t zone = 0; zone < numZones; ++zone)
+        if (zoneState[zone] == ZONE_STATE_FULL && (victim == invalidZone || zoneValidPages[zone] < zoneValidPages[victim]))
+            victim = zone;
+
+    // zone with only valid pages gives nothing
+    if (victim == invalidZone || zoneValidPages[victim] == zonePages)
+    {
+        LOGGER_LOG_WARN("There is no victim for garbage collection");
+        return 0.0;
+    }
+
+    const bool wasDuringGarbageCollection = duringGarbageCollection;
+    duringGarbageCollection = true;
+
+    double time = 0.0;
+    size_t copiedPages = 0;
+
+    // valid data is moved, but hint keeps order of its data
+    for (auto& hintData : hintExtents)
+    {
+        std::deque<Extent> movedData;
+        for (const Extent& extent : hintData.second)
+        {
+            if (extent.zone != victim)
+            {
+                movedData.push_back(extent);
+                continue;
+            }
+
+            std::vector<Extent> extents;
+            time += readPages(extent.pages);
+            time += appendPages(gcStream, extent.pages, extents);
+
+            zoneValidPages[victim] -= extent.pages;
+            copiedPages += extent.pages;
+            movedData.insert(movedData.end(), extents.begin(), extents.end());
+        }
+
+        hintData.second = std::move(movedData);
+    }
+
+    time += resetZone(victim);
+
+    gcWrittenPages += copiedPages;
+    ++gcOperations;
+
+    duringGarbageCollection = wasDuringGarbageCollection;
+
+    LOGGER_LOG_TRACE("GC reset zone {}, copied {} pages, took time {}", victim, copiedPages, time);
+
+    return time;
+}
+
+void MemoryModelZNS::formatDevice() noexcept(true)
+{
+    zoneWritePointer.assign(numZones, 0);
+    zoneValidPages.assign(numZones, 0);
+    zoneResetCount.assign(numZones, 0);
+    zoneLastWrite.assign(numZones, 0);
+    zoneState.assign(numZones, ZONE_STATE_EMPTY);
+
+    emptyZones.clear();
+    for (size_t zone = 0; zone < numZones; ++zone)
+        emptyZones.push_back(zone);
+
+    openZones.clear();
+    hintExtents.clear();
+    hintValidPages.clear();
+    currentHint = 0;
+
+    writeClock = 0;
+    duringGarbageCollection = false;
+
+    hostWrittenPages = 0;
+    gcWrittenPages = 0;
+    gcOperations = 0;
+    zoneResets = 0;
+    finishedZones = 0;
+    wastedPages = 0;
+}
+
+MemoryModelZNS::MemoryModelZNS(const char* modelName,
+                               size_t pageSize,
+                               size_t blockSize,
+                               double readTime,
+                               double writeTime,
+                               double zoneResetTime,
+                               size_t zoneSize,
+                               size_t numZones,
+                               size_t maxOpenZones)
+: MemoryModel(modelName, pageSize, blockSize), readTime{readTime}, writeTime{writeTime}, zoneResetTime{zoneResetTime}, zoneSize{zoneSize}, numZones{numZones}, maxOpenZones{maxOpenZones}, placementIsolation{false}
+{
+    zonePages = std::max(bytesToPages(zoneSize), static_cast<size_t>(1));
+    if (zonePages * pageSize != zoneSize)
+    {
+        LOGGER_LOG_WARN("Zone size {} is not aligned to page size {}, using {}", zoneSize, pageSize, zonePages * pageSize);
+        this->zoneSize = zonePages * pageSize;
+    }
+
+    // GC needs own zone and 1 zone for host writes
+    if (this->numZones < gcEmptyZonesTreshold + 2)
+    {
+        LOGGER_LOG_WARN("ZNS device needs at least {} zones, using {}", gcEmptyZonesTreshold + 2, gcEmptyZonesTreshold + 2);
+        this->numZones = gcEmptyZonesTreshold + 2;
+    }
+
+    if (this->maxOpenZones < 2)
+    {
+        LOGGER_LOG_WARN("ZNS device needs at least 2 open zones (host and GC), using 2");
+        this->maxOpenZones = 2;
+    }
+
+    formatDevice();
+
+    LOGGER_LOG_DEBUG("ZNS Memory model created: {}", toStringFull());
+}
+
+double MemoryModelZNS::setPlacementHint(size_t hint, size_t hintBytes) noexcept(true)
+{
+    currentHint = hint;
+
+    return invalidateHintPages(hint, bytesToPages(hintBytes));
+}
+
+void MemoryModelZNS::setPlacementIsolation(bool isolation) noexcept(true)
+{
+    placementIsolation = isolation;
+}
+
+double MemoryModelZNS::writeBytes(size_t bytes) noexcept(true)
+{
+    if (bytes == 0)
+        return 0.0;
+
+    return appendHintPages(currentHint, bytesToPages(bytes));
+}
+
+double MemoryModelZNS::overwriteBytes(size_t bytes) noexcept(true)
+{
+    double time = 0.0;
+
+    if (bytes == 0)
+        return 0.0;
+
+    /* read bytes to rewrite */
+    if (bytes % pageSize != 0)
+        time += readBytes(pageSize - bytes % pageSize);
+
+    /* zone is append only, so new version is appended and old version is invalid */
+    const size_t pages = bytesToPages(bytes);
+    const size_t hintPages = getHintValidPages(currentHint);
+
+    time += invalidateHintPages(currentHint, hintPages > pages ? hintPages - pages : 0);
+    time += appendHintPages(currentHint, pages);
+
+    return time;
+}
+
+double MemoryModelZNS::readBytes(size_t bytes) noexcept(true)
+{
+    if (bytes == 0)
+        return 0.0;
+
+    return readPages(bytesToPages(bytes));
+}
+
+size_t MemoryModelZNS::getHintValidPages(size_t hint) const noexcept(true)
+{
+    auto it = hintValidPages.find(hint);
+
+    return it == hintValidPages.end() ? 0 : it->second;
+}
+
+double MemoryModelZNS::getWriteAmplification() const noexcept(true)
+{
+    if (hostWrittenPages == 0)
+        return 1.0;
+
+    return static_cast<double>(hostWrittenPages + gcWrittenPages) / static_cast<double>(hostWrittenPages);
+}
+
+void MemoryModelZNS::resetState() noexcept(true)
+{
+    MemoryModel::resetState();
+
+    formatDevice();
+}
+
+std::string MemoryModelZNS::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("MemoryModelZNS {") +
+                           std::string(" .name = ") + std::string(modelName) +
+                           std::string(" .pageSize = ") + std::to_string(pageSize) +
+                           std::string(" .blockSize = ") + std::to_string(blockSize) +
+                           std::string(" .readTime = ") + std::to_string(readTime) +
+                           std::string(" .writeTime = ") + std::to_string(writeTime) +
+                           std::string(" .zoneResetTime = ") + std::to_string(zoneResetTime) +
+                           std::string(" .zoneSize = ") + std::to_string(zoneSize) +
+                           std::string(" .numZones = ") + std::to_string(numZones) +
+                           std::string(" .maxOpenZones = ") + std::to_string(maxOpenZones) +
+                           std::string(" .placementIsolation = ") + std::to_string(placementIsolation) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("MemoryModelZNS {\n") +
+                           std::string("\t.name = ") + std::string(modelName) + std::string("\n") +
+                           std::string("\t.pageSize = ") + std::to_string(pageSize) + std::string("\n") +
+                           std::string("\t.blockSize = ") + std::to_string(blockSize) + std::string("\n") +
+                           std::string("\t.readTime = ") + std::to_string(readTime) + std::string("\n") +
+                           std::string("\t.writeTime = ") + std::to_string(writeTime) + std::string("\n") +
+                           std::string("\t.zoneResetTime = ") + std::to_string(zoneResetTime) + std::string("\n") +
+                           std::string("\t.zoneSize = ") + std::to_string(zoneSize) + std::string("\n") +
+                           std::string("\t.numZones = ") + std::to_string(numZones) + std::string("\n") +
+                           std::string("\t.maxOpenZones = ") + std::to_string(maxOpenZones) + std::string("\n") +
+                           std::string("\t.placementIsolation = ") + std::to_string(placementIsolation) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string MemoryModelZNS::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("MemoryModelZNS {") +
+                           std::string(" .name = ") + std::string(modelName) +
+                           std::string(" .pageSize = ") + std::to_string(pageSize) +
+                           std::string(" .blockSize = ") + std::to_string(blockSize) +
+                           std::string(" .readTime = ") + std::to_string(readTime) +
+                           std::string(" .writeTime = ") + std::to_string(writeTime) +
+                           std::string(" .zoneResetTime = ") + std::to_string(zoneResetTime) +
+                           std::string(" .zoneSize = ") + std::to_string(zoneSize) +
+                           std::string(" .numZones = ") + std::to_string(numZones) +
+                           std::string(" .maxOpenZones = ") + std::to_string(maxOpenZones) +
+                           std::string(" .placementIsolation = ") + std::to_string(placementIsolation) +
+                           std::string(" .emptyZones = ") + std::to_string(emptyZones.size()) +
+                           std::string(" .openZones = ") + std::to_string(openZones.size()) +
+                           std::string(" .currentHint = ") + std::to_string(currentHint) +
+                           std::string(" .hostWrittenPages = ") + std::to_string(hostWrittenPages) +
+                           std::string(" .gcWrittenPages = ") + std::to_string(gcWrittenPages) +
+                           std::string(" .gcOperations = ") + std::to_string(gcOperations) +
+                           std::string(" .zoneResets = ") + std::to_string(zoneResets) +
+                           std::string(" .finishedZones = ") + std::to_string(finishedZones) +
+                           std::string(" .wastedPages = ") + std::to_string(wastedPages) +
+                           std::string(" .writeAmplification = ") + std::to_string(getWriteAmplification()) +
+                           std::string(" .touchedBytes = ") + std::to_string(touchedBytes) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("MemoryModelZNS {\n") +
+                           std::string("\t.name = ") + std::string(modelName) + std::string("\n") +
+                           std::string("\t.pageSize = ") + std::to_string(pageSize) + std::string("\n") +
+                           std::string("\t.blockSize = ") + std::to_string(blockSize) + std::string("\n") +
+                           std::string("\t.readTime = ") + std::to_string(readTime) + std::string("\n") +
+                           std::string("\t.writeTime = ") + std::to_string(writeTime) + std::string("\n") +
+                           std::string("\t.zoneResetTime = ") + std::to_string(zoneResetTime) + std::string("\n") +
+                           std::string("\t.zoneSize = ") + std::to_string(zoneSize) + std::string("\n") +
+                           std::string("\t.numZones = ") + std::to_string(numZones) + std::string("\n") +
+                           std::string("\t.maxOpenZones = ") + std::to_string(maxOpenZones) + std::string("\n") +
+                           std::string("\t.placementIsolation = ") + std::to_string(placementIsolation) + std::string("\n") +
+                           std::string("\t.emptyZones = ") + std::to_string(emptyZones.size()) + std::string("\n") +
+                           std::string("\t.openZones = ") + std::to_string(openZones.size()) + std::string("\n") +
+                           std::string("\t.currentHint = ") + std::to_string(currentHint) + std::string("\n") +
+                           std::string("\t.hostWrittenPages = ") + std::to_string(hostWrittenPages) + std::string("\n") +
+                           std::string("\t.gcWrittenPages = ") + std::to_string(gcWrittenPages) + std::string("\n") +
+                           std::string("\t.gcOperations = ") + std::to_string(gcOperations) + std::string("\n") +
+                           std::string("\t.zoneResets = ") + std::to_string(zoneResets) + std::string("\n") +
+                           std::string("\t.finishedZones = ") + std::to_string(finishedZones) + std::string("\n") +
+                           std::string("\t.wastedPages = ") + std::to_string(wastedPages) + std::string("\n") +
+                           std::string("\t.writeAmplification = ") + std::to_string(getWriteAmplification()) + std::string("\n") +
+                           std::string("\t.touchedBytes = ") + std::to_string(touchedBytes) + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
@@ -0,0 +1,374 @@
+#include <experiment/parameterSweep.hpp>
+#include <threadPool/dbThreadPool.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <limits>
+#include <numeric>
+#include <set>
+#include <sstream>
+
+ParameterSweep::Point::Point(const std::vector<std::pair<std::string, std::string>>& params)
+{
+    for (const auto& param : params)
+        set(param.first, param.second);
+}
+
+void ParameterSweep::Point::set(const std::string& name, const std::string& value) noexcept(true)
+{
+    params[name] = value;
+}
+
+std::string ParameterSweep::Point::get(const std::string& name) const noexcept(true)
+{
+    const auto it = params.find(name);
+    if (it == params.end())
+    {
+        LOGGER_LOG_ERROR("Point {} does not have parameter {}", getKey(), name);
+        return std::string();
+    }
+
+    return it->second;
+}
+
+size_t ParameterSweep::Point::getSizeT(const std::string& name) const noexcept(true)
+{
+    return static_cast<size_t>(std::strtoull(get(name).c_str(), nullptr, 10));
+}
+
+double ParameterSweep::Point::getDouble(const std::string& name) const noexcept(true)
+{
+    return std::strtod(get(name).c_str(), nullptr);
+}
+
+std::string ParameterSweep::Point::getKey() const noexcept(true)
+{
+    auto buildStringFromParams = [](const std::string &accumulator, const std::pair<const std::string, std::string>& param)
+    {
+        const std::string paramString = param.first + std::string("=") + param.second;
+        return accumulator.empty() ? paramString : accumulator + std::string(";") + paramString;
+    };
+
+    return std::accumulate(std::begin(params), std::end(params), std::string(), buildStringFromParams);
+}
+
+ParameterSweep::ParameterSweep(const std::string& name, const std::string& cacheDirectory, PointFunction pointFunction, CostFunction costFunction, ConfigFunction configFunction)
+: name{name}, cacheDirectory{cacheDirectory}, pointFunction{pointFunction}, costFunction{costFunction}, configFunction{configFunction}, numCachedPoints{0}, numExecutedPoints{0}
+{
+    std::error_code error;
+    std::filesystem::create_directories(this->cacheDirectory, error);
+    if (error)
+        LOGGER_LOG_ERROR("Cannot create cache directory {}: {}", this->cacheDirectory, error.message());
+
+    LOGGER_LOG_DEBUG("ParameterSweep created {}", toStringFull());
+}
+
+uint64_t ParameterSweep::hashKey(const std::string& key) noexcept(true)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (const char c : key)
+    {
+        hash ^= static_cast<uint64_t>(static_cast<unsigned char>(c));
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+std::string ParameterSweep::valueToString(double value) noexcept(true)
+{
+    // the shortest form which gives the same value, so 0.1 is not written as 0.10000000000000001
+    for (int precision = std::numeric_limits<double>::digits10; precision < std::numeric_limits<double>::max_digits10; ++precision)
+    {
+        std::ostringstream stream;
+        stream << std::setprecision(precision) << value;
+        if (std::strtod(stream.str().c_str(), nullptr) == value)
+            return stream.str();
+    }
+
+    std::ostringstream stream;
+    stream << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+
+    return stream.str();
+}
+
+std::string ParameterSweep::getCacheKey(const Point& point) const noexcept(true)
+{
+    if (!configFunction)
+        return point.getKey();
+
+    // key is the first line of cache file
+    std::string config = configFunction(point);
+    std::replace(config.begin(), config.end(), '\n', ' ');
+
+    return point.getKey() + std::string("|") + config;
+}
+
+std::string ParameterSweep::getCachePath(const std::string& cacheKey) const noexcept(true)
+{
+    std::ostringstream stream;
+    stream << std::hex << std::setw(16) << std::setfill('0') << hashKey(cacheKey);
+
+    return (std::filesystem::path(cacheDirectory) / (stream.str() + std::string(".txt"))).string();
+}
+
+bool ParameterSweep::loadResult(const Point& point, std::string& result) const noexcept(true)
+{
+    const std::string cacheKey = getCacheKey(point);
+    std::ifstream file(getCachePath(cacheKey), std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    // first line keeps cache key, so hash collision is not taken as a result
+    std::string key;
+    std::getline(file, key);
+    if (key != cacheKey)
+    {
+        LOGGER_LOG_WARN("Cache file {} belongs to other point, not to {}", getCachePath(cacheKey), point.getKey());
+        return false;
+    }
+
+    result = std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    return true;
+}
+
+void ParameterSweep::storeResult(const std::string& cacheKey, const std::string& result) const noexcept(true)
+{
+    const std::string path = getCachePath(cacheKey);
+    const std::string tmpPath = path + std::string(".tmp");
+
+    std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        LOGGER_LOG_ERROR("Cannot create cache file {}", tmpPath);
+        return;
+    }
+
+    file << cacheKey << '\n' << result;
+    file.close();
+
+    std::error_code error;
+    std::filesystem::rename(tmpPath, path, error);
+    if (error)
+        LOGGER_LOG_ERROR("Cannot rename {} to {}: {}", tmpPath, path, error.message());
+}
+
+void ParameterSweep::addParameter(const std::string& name, const std::vector<std::string>& values) noexcept(true)
+{
+    std::vector<std::string> uniqueValues;
+    for (const auto& value : values)
+        if (std::find(uniqueValues.begin(), uniqueValues.end(), value) == uniqueValues.end())
+            uniqueValues.push_back(value);
+
+    const auto it = std::find_if(parameters.begin(), parameters.end(), [&name](const auto& param) { return param.first == name; });
+    if (it != parameters.end())
+    {
+        LOGGER_LOG_WARN("Parameter {} is already in sweep, values are replaced", name);
+        it->second = uniqueValues;
+        return;
+    }
+
+    parameters.push_back(std::make_pair(name, uniqueValues));
+}
+
+void ParameterSweep::addParameter(const std::string& name, const std::vector<size_t>& values) noexcept(true)
+{
+    std::vector<std::string> stringValues;
+    for (const auto value : values)
+        stringValues.push_back(std::to_string(value));
+
+    addParameter(name, stringValues);
+}
+
+void ParameterSweep::addParameter(const std::string& name, const std::vector<double>& values) noexcept(true)
+{
+    std::vector<std::string> stringValues;
+    for (const auto value : values)
+        stringValues.push_back(valueToString(value));
+
+    addParameter(name, stringValues);
+}
+
+void ParameterSweep::addPoint(const Point& point) noexcept(true)
+{
+    extraPoints.push_back(point);
+}
+
+std::vector<ParameterSweep::Point> ParameterSweep::getPoints() const noexcept(true)
+{
+    std::vector<Point> points;
+
+    if (parameters.size() > 0)
+    {
+        size_t numPoints = 1;
+        for (const auto& param : parameters)
+            numPoints *= param.second.size();
+
+        // point i is a number in mixed radix, the last parameter changes the fastest
+        for (size_t i = 0; i < numPoints; ++i)
+        {
+            Point point;
+            size_t rest = i;
+            for (size_t j = parameters.size(); j > 0; --j)
+            {
+                const auto& param = parameters[j - 1];
+                point.set(param.first, param.second[rest % param.second.size()]);
+                rest /= param.second.size();
+            }
+
+            points.push_back(point);
+        }
+    }
+
+    points.insert(points.end(), extraPoints.begin(), extraPoints.end());
+
+    std::set<std::string> keys;
+    std::vector<Point> uniquePoints;
+    for (const auto& point : points)
+        if (keys.insert(point.getKey()).second)
+            uniquePoints.push_back(point);
+
+    return uniquePoints;
+}
+
+std::vector<ParameterSweep::Point> ParameterSweep::getPendingPoints() const noexcept(true)
+{
+    std::vector<Point> pendingPoints;
+    for (const auto& point : getPoints())
+    {
+        std::string result;
+        if (results.find(point.getKey()) == results.end() && !loadResult(point, result))
+            pendingPoints.push_back(point);
+    }
+
+    if (costFunction)
+    {
+        std::vector<std::pair<double, Point>> costs;
+        for (const auto& point : pendingPoints)
+            costs.push_back(std::make_pair(costFunction(point), point));
+
+        std::stable_sort(costs.begin(), costs.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+
+        for (size_t i = 0; i < costs.size(); ++i)
+            pendingPoints[i] = costs[i].second;
+    }
+
+    return pendingPoints;
+}
+
+void ParameterSweep::run() noexcept(true)
+{
+    const std::vector<Point> points = getPoints();
+
+    for (const auto& point : points)
+    {
+        std::string result;
+        if (results.find(point.getKey()) == results.end() && loadResult(point, result))
+        {
+            results[point.getKey()] = result;
+            ++numCachedPoints;
+        }
+    }
+
+    const std::vector<Point> pendingPoints = getPendingPoints();
+
+    LOGGER_LOG_INFO("Sweep {}: {} points, {} cached, {} to run", name, points.size(), points.size() - pendingPoints.size(), pendingPoints.size());
+
+    // own pool, so waiting here never blocks threads which point functions (or caller) wait for
+    thread_pool pool(DBThreadPool::threadPool.get_thread_count());
+
+    // thread pool takes tasks in FIFO order, so the most expensive points start first
+    std::vector<std::future<std::string>> futures;
+    for (const auto& point : pendingPoints)
+        futures.push_back(pool.submit([this, point, cacheKey = getCacheKey(point)]()
+        {
+            const std::string result = pointFunction(point);
+            storeResult(cacheKey, result);
+
+            return result;
+        }));
+
+    for (size_t i = 0; i < futures.size(); ++i)
+    {
+        results[pendingPoints[i].getKey()] = futures[i].get();
+        ++numExecutedPoints;
+
+        LOGGER_LOG_INFO("Sweep {}: point {} / {} finished: {}", name, i + 1, futures.size(), pendingPoints[i].getKey());
+    }
+}
+
+bool ParameterSweep::hasResult(const Point& point) const noexcept(true)
+{
+    return results.find(point.getKey()) != results.end();
+}
+
+std::string ParameterSweep::getResult(const Point& point) const noexcept(true)
+{
+    const auto it = results.find(point.getKey());
+    if (it == results.end())
+    {
+        LOGGER_LOG_ERROR("Sweep {} does not have result of point {}", name, point.getKey());
+        return std::string();
+    }
+
+    return it->second;
+}
+
+std::string ParameterSweep::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("ParameterSweep {") +
+                           std::string(" .name = ") + name +
+                           std::string(" .cacheDirectory = ") + cacheDirectory +
+                           std::string(" .numParameters = ") + std::to_string(parameters.size()) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("ParameterSweep {\n") +
+                           std::string("\t.name = ") + name + std::string("\n") +
+                           std::string("\t.cacheDirectory = ") + cacheDirectory + std::string("\n") +
+                           std::string("\t.numParameters = ") + std::to_string(parameters.size()) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string ParameterSweep::toStringFull(bool oneLine) const noexcept(true)
+{
+    auto buildStringFromParameters = [](const std::string &accumulator, const std::pair<std::string, std::vector<std::string>>& param)
+    {
+        auto buildStringFromValues = [](const std::string &accumulator, const std::string& value)
+        {
+            return accumulator.empty() ? value : accumulator + "," + value;
+        };
+
+        const std::string paramString = param.first + std::string(" = { ") + std::accumulate(std::begin(param.second), std::end(param.second), std::string(), buildStringFromValues) + std::string(" }");
+        return accumulator.empty() ? paramString : accumulator + "," + paramString;
+    };
+
+    const std::string parametersString = std::string("{ ") + std::accumulate(std::begin(parameters), std::end(parameters), std::string(), buildStringFromParameters) + std::string(" }");
+
+    if (oneLine)
+        return std::string(std::string("ParameterSweep {") +
+                           std::string(" .name = ") + name +
+                           std::string(" .cacheDirectory = ") + cacheDirectory +
+                           std::string(" .parameters = ") + parametersString +
+                           std::string(" .numExtraPoints = ") + std::to_string(extraPoints.size()) +
+                           std::string(" .numResults = ") + std::to_string(results.size()) +
+                           std::string(" .numCachedPoints = ") + std::to_string(numCachedPoints) +
+                           std::string(" .numExecutedPoints = ") + std::to_string(numExecutedPoints) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("ParameterSweep {\n") +
+                           std::string("\t.name = ") + name + std::string("\n") +
+                           std::string("\t.cacheDirectory = ") + cacheDirectory + std::string("\n") +
+                           std::string("\t.parameters = ") + parametersString + std::string("\n") +
+                           std::string("\t.numExtraPoints = ") + std::to_string(extraPoints.size()) + std::string("\n") +
+                           std::string("\t.numResults = ") + std::to_string(results.size()) + std::string("\n") +
+                           std::string("\t.numCachedPoints = ") + std::to_string(numCachedPoints) + std::string("\n") +
+                           std::string("\t.numExecutedPoints = ") + std::to_string(numExecutedPoints) + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
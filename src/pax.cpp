@@ -0,0 +1,377 @@
+#include <index/pax.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+void PAX::createMinipages() noexcept(true)
+{
+    // offset of each minipage + number of entries in page
+    pageHeaderSize = (columnsSize.size() + 1) * sizeof(uint16_t);
+
+    minipagesSize = std::vector<size_t>(columnsSize.size(), 0);
+    minipagesOffset = std::vector<size_t>(columnsSize.size(), 0);
+    minipagesOverflows = std::vector<size_t>(columnsSize.size(), 0);
+
+    const size_t diskPageSize = disk->getLowLevelController().getPageSize();
+    const size_t oldPageSize = pageSize;
+    while (true)
+    {
+        const size_t usableSize = pageSize > pageHeaderSize ? pageSize - pageHeaderSize : 0;
+
+        // minipage size is proportional to column size and aligned down, so some minipages keep less entries than others
+        size_t offset = pageHeaderSize;
+        entriesPerPage = usableSize / sizeRecord;
+        for (size_t i = 0; i < columnsSize.size(); ++i)
+        {
+            minipagesSize[i] = (((usableSize * columnsSize[i]) / sizeRecord) / minipageAlignment) * minipageAlignment;
+            minipagesOffset[i] = offset;
+            offset += minipagesSize[i];
+
+            entriesPerPage = std::min(entriesPerPage, minipagesSize[i] / columnsSize[i]);
+        }
+
+        if (entriesPerPage > 0)
+            break;
+
+        // each minipage needs at least 1 entry
+        pageSize = (pageSize / diskPageSize + 1) * diskPageSize;
+    }
+
+    if (pageSize != oldPageSize)
+        LOGGER_LOG_WARN("Record does not fit into minipages of page {}, using page {}", oldPageSize, pageSize);
+}
+
+size_t PAX::calculateNumOfPages(size_t numEntries) const noexcept(true)
+{
+    return (numEntries + entriesPerPage - 1) / entriesPerPage;
+}
+
+void PAX::overflowMinipages(size_t pages) noexcept(true)
+{
+    // only the smallest minipages are full when page cannot take more entries
+    for (size_t i = 0; i < columnsSize.size(); ++i)
+        if (getMinipageCapacity(i) == entriesPerPage)
+            minipagesOverflows[i] += pages;
+}
+
+double PAX::findKey() noexcept(true)
+{
+    double time = 0.0;
+
+    // keys are spread over all pages, key minipage cannot be read without whole page
+    const uintptr_t addr = disk->getCurrentMemoryAddr();
+    time += disk->readBytes(addr, calculateNumOfPages(numEntries) * pageSize);
+    time += disk->flushCache();
+
+    LOGGER_LOG_TRACE("Key found, took {}s", time);
+
+    return time;
+}
+
+double PAX::insertEntriesHelper(size_t numOperations) noexcept(true)
+{
+    double time = 0.0;
+
+    for (size_t i = 0; i < numOperations; ++i)
+    {
+        const uintptr_t addr = disk->getCurrentMemoryAddr();
+        const size_t entryInPage = numEntries % entriesPerPage;
+
+        if (entryInPage == 0)
+        {
+            // last page is full (or there is no page yet), so entry opens new page
+            if (numEntries > 0)
+                overflowMinipages(1);
+
+            time += disk->writeBytes(addr, pageSize);
+        }
+        else
+        {
+            // write entry to each minipage and update number of entries in header
+            for (size_t j = 0; j < columnsSize.size(); ++j)
+                time += disk->overwriteBytes(addr + minipagesOffset[j] + entryInPage * columnsSize[j], columnsSize[j]);
+
+            time += disk->overwriteBytes(addr + pageHeaderSize - sizeof(uint16_t), sizeof(uint16_t));
+        }
+
+        time += disk->flushCache();
+
+        ++numEntries;
+    }
+
+    return time;
+}
+
+double PAX::bulkloadEntriesHelper(size_t numEntries) noexcept(true)
+{
+    double time = 0.0;
+
+    const uintptr_t addr = disk->getCurrentMemoryAddr();
+    const size_t newPages = calculateNumOfPages(this->numEntries + numEntries) - calculateNumOfPages(this->numEntries);
+
+    // fill last page
+    if (this->numEntries % entriesPerPage != 0)
+    {
+        time += disk->overwriteBytes(addr, pageSize);
+        time += disk->flushCache();
+    }
+
+    if (newPages > 0)
+    {
+        overflowMinipages(this->numEntries > 0 ? newPages : newPages - 1);
+
+        time += disk->writeBytes(addr, newPages * pageSize);
+        time += disk->flushCache();
+    }
+
+    this->numEntries += numEntries;
+
+    return time;
+}
+
+double PAX::deleteEntriesHelper(size_t numOperations) noexcept(true)
+{
+    double time = 0.0;
+
+    const size_t entriesToDelete = std::min(numOperations, numEntries);
+    if (entriesToDelete < numOperations)
+        LOGGER_LOG_DEBUG("To many entries to delete, capped to {} from {}", entriesToDelete, numOperations);
+
+    for (size_t i = 0; i < entriesToDelete; ++i)
+    {
+        time += findKey();
+
+        const uintptr_t addr = disk->getCurrentMemoryAddr();
+
+        // delete 1 entry from each minipage and update number of entries in header
+        for (size_t j = 0; j < columnsSize.size(); ++j)
+            time += disk->overwriteBytes(addr + minipagesOffset[j], columnsSize[j]);
+
+        time += disk->overwriteBytes(addr + pageHeaderSize - sizeof(uint16_t), sizeof(uint16_t));
+        time += disk->flushCache();
+
+        --numEntries;
+    }
+
+    return time;
+}
+
+double PAX::findEntriesHelper(const std::vector<size_t>& columnsToFetch, size_t numEntries, size_t numOperations) noexcept(true)
+{
+    double time = 0.0;
+
+    std::vector colCopy = columnsToFetch;
+    std::sort(colCopy.begin(), colCopy.end());
+
+    if (colCopy[0] != 0)
+    {
+        LOGGER_LOG_ERROR("You need key column!");
+        return 0.0;
+    }
+
+    // key scan reads every page with all minipages, so fetched columns of found entries are already in memory
+    (void)numEntries;
+
+    for (size_t i = 0; i < numOperations; ++i)
+        time += findKey();
+
+    return time;
+}
+
+PAX::PAX(const char* name, Disk* disk, const std::vector<size_t>& columnsSize, size_t pageSize)
+: DBIndexColumn(name, disk, columnsSize), pageSize{pageSize}
+{
+    createMinipages();
+
+    LOGGER_LOG_DEBUG("PAX created {}", toStringFull());
+}
+
+PAX::PAX(Disk* disk, const std::vector<size_t>& columnsSize, size_t pageSize)
+: PAX("PAX", disk, columnsSize, pageSize)
+{
+
+}
+
+PAX::PAX(Disk* disk, const std::vector<size_t>& columnsSize)
+: PAX(disk, columnsSize, disk->getLowLevelController().getPageSize())
+{
+
+}
+
+PAX::PAX(const char* name, Disk* disk, const std::vector<size_t>& columnsSize)
+: PAX(name, disk, columnsSize, disk->getLowLevelController().getPageSize())
+{
+
+}
+
+void PAX::resetState() noexcept(true)
+{
+    DBIndexColumn::resetState();
+
+    minipagesOverflows = std::vector<size_t>(columnsSize.size(), 0);
+}
+
+std::string PAX::toString(bool oneLine) const noexcept(true)
+{
+    auto buildStringFromVector = [](const std::string &accumulator, const size_t &columnSize)
+    {
+        return accumulator.empty() ? std::to_string(columnSize) : accumulator + "," + std::to_string(columnSize);
+    };
+
+    const std::string columnsString = std::string("{ ") + std::accumulate(std::begin(columnsSize), std::end(columnsSize), std::string(), buildStringFromVector) + std::string(" }");
+
+    if (oneLine)
+        return std::string(std::string("PAX {") +
+                           std::string(" .sizeKey = ") + std::to_string(sizeKey) +
+                           std::string(" .sizeData = ") + std::to_string(sizeData) +
+                           std::string(" .sizeRecord = ") + std::to_string(sizeRecord) +
+                           std::string(" .columnsSize = ") + columnsString +
+                           std::string(" .pageSize = ") + std::to_string(pageSize) +
+                           std::string(" .entriesPerPage = ") + std::to_string(entriesPerPage) +
+                           std::string(" .numEntries = ") + std::to_string(numEntries) +
+                           std::string(" .disk = ") + disk->toString() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("PAX {\n") +
+                           std::string("\t.sizeKey = ") + std::to_string(sizeKey) + std::string("\n") +
+                           std::string("\t.sizeData = ") + std::to_string(sizeData) + std::string("\n") +
+                           std::string("\t.sizeRecord = ") + std::to_string(sizeRecord) + std::string("\n") +
+                           std::string("\t.columnsSize = ") + columnsString + std::string("\n") +
+                           std::string("\t.pageSize = ") + std::to_string(pageSize) + std::string("\n") +
+                           std::string("\t.entriesPerPage = ") + std::to_string(entriesPerPage) + std::string("\n") +
+                           std::string("\t.numEntries = ") + std::to_string(numEntries) + std::string("\n") +
+                           std::string("\t.disk = ") + disk->toString() + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string PAX::toStringFull(bool oneLine) const noexcept(true)
+{
+    auto buildStringFromVector = [](const std::string &accumulator, const size_t &columnSize)
+    {
+        return accumulator.empty() ? std::to_string(columnSize) : accumulator + "," + std::to_string(columnSize);
+    };
+
+    const std::string columnsString = std::string("{ ") + std::accumulate(std::begin(columnsSize), std::end(columnsSize), std::string(), buildStringFromVector) + std::string(" }");
+    const std::string minipagesString = std::string("{ ") + std::accumulate(std::begin(minipagesSize), std::end(minipagesSize), std::string(), buildStringFromVector) + std::string(" }");
+    const std::string overflowsString = std::string("{ ") + std::accumulate(std::begin(minipagesOverflows), std::end(minipagesOverflows), std::string(), buildStringFromVector) + std::string(" }");
+
+    if (oneLine)
+        return std::string(std::string("PAX {") +
+                           std::string(" .sizeKey = ") + std::to_string(sizeKey) +
+                           std::string(" .sizeData = ") + std::to_string(sizeData) +
+                           std::string(" .sizeRecord = ") + std::to_string(sizeRecord) +
+                           std::string(" .columnsSize = ") + columnsString +
+                           std::string(" .pageSize = ") + std::to_string(pageSize) +
+                           std::string(" .pageHeaderSize = ") + std::to_string(pageHeaderSize) +
+                           std::string(" .minipagesSize = ") + minipagesString +
+                           std::string(" .entriesPerPage = ") + std::to_string(entriesPerPage) +
+                           std::string(" .minipagesOverflows = ") + overflowsString +
+                           std::string(" .numEntries = ") + std::to_string(numEntries) +
+                           std::string(" .disk = ") + disk->toStringFull() +
+                           std::string(" .counters = ") + counters.toStringFull() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("PAX {\n") +
+                           std::string("\t.sizeKey = ") + std::to_string(sizeKey) + std::string("\n") +
+                           std::string("\t.sizeData = ") + std::to_string(sizeData) + std::string("\n") +
+                           std::string("\t.sizeRecord = ") + std::to_string(sizeRecord) + std::string("\n") +
+                           std::string("\t.columnsSize = ") + columnsString + std::string("\n") +
+                           std::string("\t.pageSize = ") + std::to_string(pageSize) + std::string("\n") +
+                           std::string("\t.pageHeaderSize = ") + std::to_string(pageHeaderSize) + std::string("\n") +
+                           std::string("\t.minipagesSize = ") + minipagesString + std::string("\n") +
+                           std::string("\t.entriesPerPage = ") + std::to_string(entriesPerPage) + std::string("\n") +
+                           std::string("\t.minipagesOverflows = ") + overflowsString + std::string("\n") +
+                           std::string("\t.numEntries = ") + std::to_string(numEntries) + std::string("\n") +
+                           std::string("\t.disk = ") + disk->toStringFull() + std::string("\n") +
+                           std::string("\t.counters = ") + counters.toStringFull() + std::string("\n") +
+                           std::string("}"));
+}
+
+bool PAX::isBulkloadSupported() const noexcept(true)
+{
+    return true;
+}
+
+double PAX::insertEntries(size_t numOperations) noexcept(true)
+{
+    const double time = insertEntriesHelper(numOperations);
+
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME, time);
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS, numOperations);
+
+    LOGGER_LOG_TRACE("Inserted {} entries, took {}s", numOperations, time);
+
+    return time;
+}
+
+double PAX::bulkloadEntries(size_t numEntries) noexcept(true)
+{
+    const double time = bulkloadEntriesHelper(numEntries);
+
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_BULKLOAD_TOTAL_TIME, time);
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_BULKLOAD_TOTAL_OPERATIONS, 1);
+
+    LOGGER_LOG_TRACE("Bulkloaded {} entries, took {}s", numEntries, time);
+
+    return time;
+}
+
+double PAX::deleteEntries(size_t numOperations) noexcept(true)
+{
+    const size_t realDeletion = std::min(numEntries, numOperations);
+    const double time = deleteEntriesHelper(numOperations);
+
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_DELETE_TOTAL_TIME, time);
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_DELETE_TOTAL_OPERATIONS, realDeletion);
+
+    LOGGER_LOG_TRACE("Deleted {} entries, took {}s", numOperations, time);
+
+    return time;
+}
+
+double PAX::findPointEntries(const std::vector<size_t>& columnsToFetch, size_t numOperations) noexcept(true)
+{
+    const double time = findEntriesHelper(columnsToFetch, 1, numOperations);
+
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_PSEARCH_TOTAL_TIME, time);
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_PSEARCH_TOTAL_OPERATIONS, numOperations);
+
+    LOGGER_LOG_TRACE("Found {} entries, took {}s", numOperations, time);
+
+    return time;
+}
+
+double PAX::findPointEntries(const std::vector<size_t>& columnsToFetch, double selectivity, size_t numOperations) noexcept(true)
+{
+    LOGGER_LOG_TRACE("selectivity={}, numOperations={}, call findPointEntries({})", selectivity, numOperations, static_cast<size_t>(static_cast<double>(numEntries) * selectivity) * numOperations);
+
+    return findPointEntries(columnsToFetch, static_cast<size_t>(static_cast<double>(numEntries) * selectivity) * numOperations);
+}
+
+double PAX::findRangeEntries(const std::vector<size_t>& columnsToFetch, size_t numEntries, size_t numOperations) noexcept(true)
+{
+    const double time = findEntriesHelper(columnsToFetch, numEntries, numOperations);
+
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_TIME, time);
+    counters.pegCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_OPERATIONS, numOperations);
+
+    LOGGER_LOG_TRACE("Found {} entries, took {}s", numOperations, time);
+
+    return time;
+}
+
+double PAX::findRangeEntries(const std::vector<size_t>& columnsToFetch, double selectivity, size_t numOperations) noexcept(true)
+{
+    LOGGER_LOG_TRACE("selectivity={}, numOperations={}, call findRangeEntries({}, {})", selectivity, numOperations, static_cast<size_t>(static_cast<double>(this->numEntries) * selectivity), numOperations);
+
+    return findRangeEntries(columnsToFetch, static_cast<size_t>(static_cast<double>(this->numEntries) * selectivity), numOperations);
+}
+
+void PAX::createTopologyAfterInsert(size_t numEntries) noexcept(true)
+{
+    LOGGER_LOG_DEBUG("Creating a topology now entries={}, inserting new {} entries, after we will have {} entries", this->numEntries, numEntries, this->numEntries + numEntries);
+
+    this->numEntries += numEntries;
+}
\ No newline at end of file
@@ -115,8 +115,8 @@ double SBPTree::insertEntriesHelper(size_t numOperations) noexcept(true)
         uintptr_t addr = disk->getCurrentMemoryAddr();
 
         // we need into a gap (or at the end + update bitmap)
-        time += disk->overwriteBytes(addr, sizeRecord);
-        time += disk->overwriteBytes(addr + nodeSize - 1, 1);
+        time += disk->overwriteBytes(addr, sizeRecord, appendBitChangeRatio);
+        time += disk->overwriteBytes(addr + nodeSize - 1, 1, MemoryController::bitmapBitChangeRatio);
 
         // split
         if (numEntries > 1 && diffLeaves > 0)
@@ -304,7 +304,7 @@ double SBPTree::deleteEntriesHelper(size_t numOperations) noexcept(true)
 
         // delete = update bitmap at the end of node
         uintptr_t addr = disk->getCurrentMemoryAddr();
-        time += disk->overwriteBytes(addr + nodeSize - 1, 1);
+        time += disk->overwriteBytes(addr + nodeSize - 1, 1, MemoryController::bitmapBitChangeRatio);
         time += disk->flushCache();
 
         // we need to merge leaves
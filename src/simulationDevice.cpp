@@ -0,0 +1,144 @@
+#include <simulation/simulationDevice.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+
+SimulationDevice::SimulationDevice(const char* name, SimulationEngine* engine, size_t numServers)
+: name{name}, engine{engine}, numServers{numServers}, busyServers{0}, busyTime{0.0}, foregroundWaitTime{0.0}, backgroundWaitTime{0.0}, numForegroundRequests{0}, numBackgroundRequests{0}, maxQueueLength{0}
+{
+    if (numServers == 0)
+    {
+        LOGGER_LOG_WARN("Device {} needs at least 1 server, got 0", name);
+        this->numServers = 1;
+    }
+
+    LOGGER_LOG_DEBUG("SimulationDevice created {}", toStringFull());
+}
+
+SimulationDevice::SimulationDevice(SimulationEngine* engine, size_t numServers)
+: SimulationDevice("SimulationDevice", engine, numServers)
+{
+
+}
+
+void SimulationDevice::submit(double serviceTime, CompletionAction onComplete, enum SimulationRequestPriority priority) noexcept(true)
+{
+    if (priority == SIMULATION_REQUEST_FOREGROUND)
+    {
+        foregroundQueue.emplace_back(serviceTime, engine->getClock(), std::move(onComplete));
+        ++numForegroundRequests;
+    }
+    else
+    {
+        backgroundQueue.emplace_back(serviceTime, engine->getClock(), std::move(onComplete));
+        ++numBackgroundRequests;
+    }
+
+    dispatch();
+
+    maxQueueLength = std::max(maxQueueLength, getQueueLength());
+}
+
+void SimulationDevice::dispatch() noexcept(true)
+{
+    while (busyServers < numServers && (!foregroundQueue.empty() || !backgroundQueue.empty()))
+    {
+        const bool isForeground = !foregroundQueue.empty();
+        std::deque<SimulationRequest>& queue = isForeground ? foregroundQueue : backgroundQueue;
+
+        SimulationRequest request = std::move(queue.front());
+        queue.pop_front();
+
+        const double waitTime = engine->getClock() - request.submitTime;
+        if (isForeground)
+            foregroundWaitTime += waitTime;
+        else
+            backgroundWaitTime += waitTime;
+
+        ++busyServers;
+        busyTime += request.serviceTime;
+
+        CompletionAction onComplete = std::move(request.onComplete);
+        engine->scheduleAfter(request.serviceTime, [this, onComplete]()
+        {
+            --busyServers;
+
+            if (onComplete)
+                onComplete(engine->getClock());
+
+            dispatch();
+        });
+    }
+}
+
+void SimulationDevice::resetState() noexcept(true)
+{
+    foregroundQueue.clear();
+    backgroundQueue.clear();
+
+    busyServers = 0;
+    busyTime = 0.0;
+    foregroundWaitTime = 0.0;
+    backgroundWaitTime = 0.0;
+    numForegroundRequests = 0;
+    numBackgroundRequests = 0;
+    maxQueueLength = 0;
+}
+
+double SimulationDevice::getUtilization(double elapsed) const noexcept(true)
+{
+    if (elapsed <= 0.0)
+        return 0.0;
+
+    return busyTime / (elapsed * static_cast<double>(numServers));
+}
+
+std::string SimulationDevice::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("SimulationDevice {") +
+                           std::string(" .name = ") + std::string(name) +
+                           std::string(" .numServers = ") + std::to_string(numServers) +
+                           std::string(" .busyServers = ") + std::to_string(busyServers) +
+                           std::string(" .queueLength = ") + std::to_string(getQueueLength()) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("SimulationDevice {\n") +
+                           std::string("\t.name = ") + std::string(name) + std::string("\n") +
+                           std::string("\t.numServers = ") + std::to_string(numServers) + std::string("\n") +
+                           std::string("\t.busyServers = ") + std::to_string(busyServers) + std::string("\n") +
+                           std::string("\t.queueLength = ") + std::to_string(getQueueLength()) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string SimulationDevice::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("SimulationDevice {") +
+                           std::string(" .name = ") + std::string(name) +
+                           std::string(" .numServers = ") + std::to_string(numServers) +
+                           std::string(" .busyServers = ") + std::to_string(busyServers) +
+                           std::string(" .queueLength = ") + std::to_string(getQueueLength()) +
+                           std::string(" .maxQueueLength = ") + std::to_string(maxQueueLength) +
+                           std::string(" .busyTime = ") + std::to_string(busyTime) +
+                           std::string(" .foregroundWaitTime = ") + std::to_string(foregroundWaitTime) +
+                           std::string(" .backgroundWaitTime = ") + std::to_string(backgroundWaitTime) +
+                           std::string(" .numForegroundRequests = ") + std::to_string(numForegroundRequests) +
+                           std::string(" .numBackgroundRequests = ") + std::to_string(numBackgroundRequests) +
+                           std::string(" .engine = ") + (engine == nullptr ? std::string("nullptr") : engine->toString()) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("SimulationDevice {\n") +
+                           std::string("\t.name = ") + std::string(name) + std::string("\n") +
+                           std::string("\t.numServers = ") + std::to_string(numServers) + std::string("\n") +
+                           std::string("\t.busyServers = ") + std::to_string(busyServers) + std::string("\n") +
+                           std::string("\t.queueLength = ") + std::to_string(getQueueLength()) + std::string("\n") +
+                           std::string("\t.maxQueueLength = ") + std::to_string(maxQueueLength) + std::string("\n") +
+                           std::string("\t.busyTime = ") + std::to_string(busyTime) + std::string("\n") +
+                           std::string("\t.foregroundWaitTime = ") + std::to_string(foregroundWaitTime) + std::string("\n") +
+                           std::string("\t.backgroundWaitTime = ") + std::to_string(backgroundWaitTime) + std::string("\n") +
+                           std::string("\t.numForegroundRequests = ") + std::to_string(numForegroundRequests) + std::string("\n") +
+                           std::string("\t.numBackgroundRequests = ") + std::to_string(numBackgroundRequests) + std::string("\n") +
+                           std::string("\t.engine = ") + (engine == nullptr ? std::string("nullptr") : engine->toString()) + std::string("\n") +
+                           std::string("}"));
+}
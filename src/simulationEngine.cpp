@@ -0,0 +1,103 @@
+#include <simulation/simulationEngine.hpp>
+#include <logger/logger.hpp>
+
+SimulationEngine::SimulationEngine()
+: clock{0.0}, nextSeq{0}, numProcessedEvents{0}
+{
+    LOGGER_LOG_DEBUG("SimulationEngine created {}", toStringFull());
+}
+
+void SimulationEngine::scheduleAt(double time, EventAction action) noexcept(true)
+{
+    if (time < clock)
+    {
+        LOGGER_LOG_WARN("Event scheduled in the past {} < {}, moving to now", time, clock);
+        time = clock;
+    }
+
+    events.emplace(time, nextSeq++, std::move(action));
+}
+
+void SimulationEngine::scheduleAfter(double delay, EventAction action) noexcept(true)
+{
+    scheduleAt(clock + (delay > 0.0 ? delay : 0.0), std::move(action));
+}
+
+bool SimulationEngine::step() noexcept(true)
+{
+    if (events.empty())
+        return false;
+
+    // action can schedule new events, so event has to be removed from queue before call
+    SimulationEvent event = events.top();
+    events.pop();
+
+    clock = event.time;
+    ++numProcessedEvents;
+
+    if (event.action)
+        event.action();
+
+    return true;
+}
+
+double SimulationEngine::run() noexcept(true)
+{
+    while (step())
+        ;
+
+    LOGGER_LOG_TRACE("Simulation finished at {}s after {} events", clock, numProcessedEvents);
+
+    return clock;
+}
+
+double SimulationEngine::runUntil(double endTime) noexcept(true)
+{
+    while (!events.empty() && events.top().time <= endTime)
+        step();
+
+    if (clock < endTime)
+        clock = endTime;
+
+    return clock;
+}
+
+void SimulationEngine::resetState() noexcept(true)
+{
+    events = decltype(events)();
+    clock = 0.0;
+    nextSeq = 0;
+    numProcessedEvents = 0;
+}
+
+std::string SimulationEngine::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("SimulationEngine {") +
+                           std::string(" .clock = ") + std::to_string(clock) +
+                           std::string(" .pendingEvents = ") + std::to_string(events.size()) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("SimulationEngine {\n") +
+                           std::string("\t.clock = ") + std::to_string(clock) + std::string("\n") +
+                           std::string("\t.pendingEvents = ") + std::to_string(events.size()) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string SimulationEngine::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("SimulationEngine {") +
+                           std::string(" .clock = ") + std::to_string(clock) +
+                           std::string(" .pendingEvents = ") + std::to_string(events.size()) +
+                           std::string(" .nextSeq = ") + std::to_string(nextSeq) +
+                           std::string(" .numProcessedEvents = ") + std::to_string(numProcessedEvents) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("SimulationEngine {\n") +
+                           std::string("\t.clock = ") + std::to_string(clock) + std::string("\n") +
+                           std::string("\t.pendingEvents = ") + std::to_string(events.size()) + std::string("\n") +
+                           std::string("\t.nextSeq = ") + std::to_string(nextSeq) + std::string("\n") +
+                           std::string("\t.numProcessedEvents = ") + std::to_string(numProcessedEvents) + std::string("\n") +
+                           std::string("}"));
+}
@@ -0,0 +1,266 @@
+#include <simulation/simulationWorkload.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+#include <numeric>
+
+SimulationWorkload::SimulationResult::SimulationResult()
+: numClients{0}, numOperations{0}, numBackgroundJobs{0}, makespan{0.0}, throughput{0.0}, avgLatency{0.0}, p50Latency{0.0}, p95Latency{0.0}, p99Latency{0.0}, maxLatency{0.0}, backgroundTime{0.0}, deviceUtilization{0.0}
+{
+
+}
+
+std::string SimulationWorkload::SimulationResult::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("SimulationResult {") +
+                           std::string(" .numClients = ") + std::to_string(numClients) +
+                           std::string(" .numOperations = ") + std::to_string(numOperations) +
+                           std::string(" .numBackgroundJobs = ") + std::to_string(numBackgroundJobs) +
+                           std::string(" .makespan = ") + std::to_string(makespan) +
+                           std::string(" .throughput = ") + std::to_string(throughput) +
+                           std::string(" .avgLatency = ") + std::to_string(avgLatency) +
+                           std::string(" .p50Latency = ") + std::to_string(p50Latency) +
+                           std::string(" .p95Latency = ") + std::to_string(p95Latency) +
+                           std::string(" .p99Latency = ") + std::to_string(p99Latency) +
+                           std::string(" .maxLatency = ") + std::to_string(maxLatency) +
+                           std::string(" .backgroundTime = ") + std::to_string(backgroundTime) +
+                           std::string(" .deviceUtilization = ") + std::to_string(deviceUtilization) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("SimulationResult {\n") +
+                           std::string("\t.numClients = ") + std::to_string(numClients) + std::string("\n") +
+                           std::string("\t.numOperations = ") + std::to_string(numOperations) + std::string("\n") +
+                           std::string("\t.numBackgroundJobs = ") + std::to_string(numBackgroundJobs) + std::string("\n") +
+                           std::string("\t.makespan = ") + std::to_string(makespan) + std::string("\n") +
+                           std::string("\t.throughput = ") + std::to_string(throughput) + std::string("\n") +
+                           std::string("\t.avgLatency = ") + std::to_string(avgLatency) + std::string("\n") +
+                           std::string("\t.p50Latency = ") + std::to_string(p50Latency) + std::string("\n") +
+                           std::string("\t.p95Latency = ") + std::to_string(p95Latency) + std::string("\n") +
+                           std::string("\t.p99Latency = ") + std::to_string(p99Latency) + std::string("\n") +
+                           std::string("\t.maxLatency = ") + std::to_string(maxLatency) + std::string("\n") +
+                           std::string("\t.backgroundTime = ") + std::to_string(backgroundTime) + std::string("\n") +
+                           std::string("\t.deviceUtilization = ") + std::to_string(deviceUtilization) + std::string("\n") +
+                           std::string("}"));
+}
+
+SimulationWorkload::SimulationWorkload(DBIndex* index, const std::vector<WorkloadStep*>& steps, size_t numClients, size_t deviceParallelism, double thinkTime)
+: name{"SimulationWorkload"}, rIndex{index}, cIndex{nullptr}, isColumnIndexMode{false}, steps{steps}, numClients{numClients}, deviceParallelism{deviceParallelism}, thinkTime{thinkTime}
+{
+    LOGGER_LOG_DEBUG("SimulationWorkload created {}", toStringFull());
+}
+
+SimulationWorkload::SimulationWorkload(DBIndexColumn* index, const std::vector<WorkloadStep*>& steps, size_t numClients, size_t deviceParallelism, double thinkTime)
+: name{"SimulationWorkload"}, rIndex{nullptr}, cIndex{index}, isColumnIndexMode{true}, steps{steps}, numClients{numClients}, deviceParallelism{deviceParallelism}, thinkTime{thinkTime}
+{
+    LOGGER_LOG_DEBUG("SimulationWorkload created {}", toStringFull());
+}
+
+SimulationWorkload::~SimulationWorkload()
+{
+    for (size_t i = 0; i < steps.size(); ++i)
+        delete steps[i];
+}
+
+SimulationWorkload::SimulationWorkload(const SimulationWorkload& other)
+: name{other.name}, rIndex{other.rIndex}, cIndex{other.cIndex}, isColumnIndexMode{other.isColumnIndexMode}, numClients{other.numClients}, deviceParallelism{other.deviceParallelism}, thinkTime{other.thinkTime}, backgroundJobSource{other.backgroundJobSource}, lastResult{other.lastResult}
+{
+    for (size_t i = 0; i < other.steps.size(); ++i)
+        steps.push_back(other.steps[i]->clone());
+}
+
+SimulationWorkload& SimulationWorkload::operator=(const SimulationWorkload& other)
+{
+    if (&other == this)
+        return *this;
+
+    for (size_t i = 0; i < steps.size(); ++i)
+        delete steps[i];
+    steps.clear();
+
+    name = other.name;
+    rIndex = other.rIndex;
+    cIndex = other.cIndex;
+    isColumnIndexMode = other.isColumnIndexMode;
+    numClients = other.numClients;
+    deviceParallelism = other.deviceParallelism;
+    thinkTime = other.thinkTime;
+    backgroundJobSource = other.backgroundJobSource;
+    lastResult = other.lastResult;
+
+    for (size_t i = 0; i < other.steps.size(); ++i)
+        steps.push_back(other.steps[i]->clone());
+
+    return *this;
+}
+
+double SimulationWorkload::executeRequest(size_t stepId) noexcept(true)
+{
+    if (isColumnIndexMode == false)
+        steps[stepId]->setDbIndex(rIndex);
+    else
+        steps[stepId]->setDbIndex(cIndex);
+
+    return steps[stepId]->executeStep();
+}
+
+double SimulationWorkload::getIndexBackgroundTime() const noexcept(true)
+{
+    if (isColumnIndexMode == false)
+        return rIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second;
+    else
+        return cIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second;
+}
+
+SimulationWorkload::SimulationResult SimulationWorkload::run() noexcept(true)
+{
+    SimulationResult result;
+    result.numClients = numClients;
+
+    if ((isColumnIndexMode == false && rIndex == nullptr) || (isColumnIndexMode == true && cIndex == nullptr))
+    {
+        LOGGER_LOG_ERROR("Index is not set (nullptr)");
+        lastResult = result;
+        return result;
+    }
+
+    if (numClients == 0 || steps.empty())
+    {
+        LOGGER_LOG_WARN("Nothing to simulate, clients={}, steps={}", numClients, steps.size());
+        lastResult = result;
+        return result;
+    }
+
+    SimulationEngine engine;
+    SimulationDevice device(&engine, deviceParallelism);
+
+    std::vector<double> latencies;
+    latencies.reserve(numClients * steps.size());
+
+    double lastCompletion = 0.0;
+
+    auto submitBackgroundJob = [&](double backgroundWork)
+    {
+        if (backgroundWork <= 0.0)
+            return;
+
+        ++result.numBackgroundJobs;
+        result.backgroundTime += backgroundWork;
+        device.submit(backgroundWork, [&lastCompletion](double finishTime) { lastCompletion = std::max(lastCompletion, finishTime); }, SimulationDevice::SIMULATION_REQUEST_BACKGROUND);
+    };
+
+    // client issues next request after completion of previous one (closed loop)
+    std::function<void(size_t, size_t)> issueRequest = [&](size_t clientId, size_t stepId)
+    {
+        const double issueTime = engine.getClock();
+        const double backgroundTimeBefore = getIndexBackgroundTime();
+
+        // index is modeled sequentially in event order, so index state is consistent between clients
+        const double serviceTime = executeRequest(stepId);
+
+        device.submit(serviceTime, [&, clientId, stepId, issueTime](double finishTime)
+        {
+            latencies.push_back(finishTime - issueTime);
+            lastCompletion = std::max(lastCompletion, finishTime);
+
+            if (stepId + 1 < steps.size())
+                engine.scheduleAfter(thinkTime, [&issueRequest, clientId, stepId]() { issueRequest(clientId, stepId + 1); });
+        });
+
+        // work moved by index out of request (compaction, merge, reorganization) competes for the same device
+        submitBackgroundJob(getIndexBackgroundTime() - backgroundTimeBefore);
+
+        if (backgroundJobSource)
+            submitBackgroundJob(backgroundJobSource());
+    };
+
+    for (size_t i = 0; i < numClients; ++i)
+        engine.scheduleAt(0.0, [&issueRequest, i]() { issueRequest(i, 0); });
+
+    engine.run();
+
+    result.numOperations = latencies.size();
+    result.makespan = lastCompletion;
+    result.throughput = lastCompletion > 0.0 ? static_cast<double>(result.numOperations) / lastCompletion : 0.0;
+    result.deviceUtilization = device.getUtilization(lastCompletion);
+
+    if (!latencies.empty())
+    {
+        result.avgLatency = std::accumulate(latencies.begin(), latencies.end(), 0.0) / static_cast<double>(latencies.size());
+
+        auto percentile = [&latencies](double p)
+        {
+            const size_t pos = std::min(latencies.size() - 1, static_cast<size_t>(p * static_cast<double>(latencies.size())));
+            std::nth_element(latencies.begin(), latencies.begin() + static_cast<long>(pos), latencies.end());
+            return latencies[pos];
+        };
+
+        result.p50Latency = percentile(0.50);
+        result.p95Latency = percentile(0.95);
+        result.p99Latency = percentile(0.99);
+        result.maxLatency = *std::max_element(latencies.begin(), latencies.end());
+    }
+
+    LOGGER_LOG_TRACE("Simulation of {} clients finished {}", numClients, result.toString());
+
+    lastResult = result;
+
+    return result;
+}
+
+std::string SimulationWorkload::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("SimulationWorkload {") +
+                           std::string(" .name = ") + std::string(name) +
+                           std::string(" .numClients = ") + std::to_string(numClients) +
+                           std::string(" .numSteps = ") + std::to_string(steps.size()) +
+                           std::string(" .deviceParallelism = ") + std::to_string(deviceParallelism) +
+                           std::string(" .thinkTime = ") + std::to_string(thinkTime) +
+                           std::string(" .isColumnIndexMode = ") + std::to_string(isColumnIndexMode) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("SimulationWorkload {\n") +
+                           std::string("\t.name = ") + std::string(name) + std::string("\n") +
+                           std::string("\t.numClients = ") + std::to_string(numClients) + std::string("\n") +
+                           std::string("\t.numSteps = ") + std::to_string(steps.size()) + std::string("\n") +
+                           std::string("\t.deviceParallelism = ") + std::to_string(deviceParallelism) + std::string("\n") +
+                           std::string("\t.thinkTime = ") + std::to_string(thinkTime) + std::string("\n") +
+                           std::string("\t.isColumnIndexMode = ") + std::to_string(isColumnIndexMode) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string SimulationWorkload::toStringFull(bool oneLine) const noexcept(true)
+{
+    auto buildStringSteps = [](const std::string &accumulator, const WorkloadStep* step)
+    {
+        return accumulator.empty() ? step->toString() : accumulator + "," + step->toString();
+    };
+
+    const std::string stepsString = std::string("{ ") + std::accumulate(std::begin(steps), std::end(steps), std::string(), buildStringSteps) + std::string(" }");
+
+    if (oneLine)
+        return std::string(std::string("SimulationWorkload {") +
+                           std::string(" .name = ") + std::string(name) +
+                           std::string(" .numClients = ") + std::to_string(numClients) +
+                           std::string(" .deviceParallelism = ") + std::to_string(deviceParallelism) +
+                           std::string(" .thinkTime = ") + std::to_string(thinkTime) +
+                           std::string(" .isColumnIndexMode = ") + std::to_string(isColumnIndexMode) +
+                           std::string(" .steps = ") + stepsString +
+                           std::string(" .rIndex = ") + (rIndex == nullptr ? std::string("nullptr") : rIndex->toString()) +
+                           std::string(" .cIndex = ") + (cIndex == nullptr ? std::string("nullptr") : cIndex->toString()) +
+                           std::string(" .lastResult = ") + lastResult.toString() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("SimulationWorkload {\n") +
+                           std::string("\t.name = ") + std::string(name) + std::string("\n") +
+                           std::string("\t.numClients = ") + std::to_string(numClients) + std::string("\n") +
+                           std::string("\t.deviceParallelism = ") + std::to_string(deviceParallelism) + std::string("\n") +
+                           std::string("\t.thinkTime = ") + std::to_string(thinkTime) + std::string("\n") +
+                           std::string("\t.isColumnIndexMode = ") + std::to_string(isColumnIndexMode) + std::string("\n") +
+                           std::string("\t.steps = ") + stepsString + std::string("\n") +
+                           std::string("\t.rIndex = ") + (rIndex == nullptr ? std::string("nullptr") : rIndex->toString()) + std::string("\n") +
+                           std::string("\t.cIndex = ") + (cIndex == nullptr ? std::string("nullptr") : cIndex->toString()) + std::string("\n") +
+                           std::string("\t.lastResult = ") + lastResult.toString() + std::string("\n") +
+                           std::string("}"));
+}
@@ -0,0 +1,71 @@
+#include <workload/sink/sinkCSV.hpp>
+#include <logger/logger.hpp>
+
+#include <limits>
+
+WorkloadSinkCSV::WorkloadSinkCSV(const char* filePath, char separator)
+: filePath{filePath}, separator{separator}, numRows{0}
+{
+    LOGGER_LOG_DEBUG("WorkloadSinkCSV created: filePath={}", this->filePath);
+}
+
+void WorkloadSinkCSV::beginWorkload(const std::vector<std::string>& indexesName) noexcept(true)
+{
+    file.open(filePath, std::ios::trunc);
+    if (!file.is_open())
+    {
+        LOGGER_LOG_ERROR("Cannot create CSV file {}", filePath);
+        return;
+    }
+
+    // times are very small, so keep all digits to read exactly the same values back
+    file.precision(std::numeric_limits<double>::max_digits10);
+
+    this->indexesName = indexesName;
+    numRows = 0;
+
+    const WorkloadCounters counters;
+    file << "Index" << separator << "Step";
+
+    for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_TIME; id < WorkloadCounters::WORKLOAD_COUNTER_D_MAX_ITERATOR; ++id)
+        file << separator << counters.getCounterName(id);
+
+    for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < WorkloadCounters::WORKLOAD_COUNTER_L_MAX_ITERATOR; ++id)
+        file << separator << counters.getCounterName(id);
+
+    file << '\n';
+}
+
+void WorkloadSinkCSV::consumeStep(size_t index, size_t step, const WorkloadCounters& counters) noexcept(true)
+{
+    if (!file.is_open())
+        return;
+
+    // steps are numbered from 1 like in analyzer files
+    if (index < indexesName.size())
+        file << indexesName[index];
+    else
+        file << index;
+
+    file << separator << step + 1;
+
+    for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_TIME; id < WorkloadCounters::WORKLOAD_COUNTER_D_MAX_ITERATOR; ++id)
+        file << separator << counters.getCounterValue(id);
+
+    for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < WorkloadCounters::WORKLOAD_COUNTER_L_MAX_ITERATOR; ++id)
+        file << separator << counters.getCounterValue(id);
+
+    file << '\n';
+
+    ++numRows;
+}
+
+void WorkloadSinkCSV::endWorkload() noexcept(true)
+{
+    if (!file.is_open())
+        return;
+
+    file.close();
+
+    LOGGER_LOG_DEBUG("CSV file {} written, rows={}", filePath, numRows);
+}
\ No newline at end of file
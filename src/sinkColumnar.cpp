@@ -0,0 +1,287 @@
+#include <workload/sink/sinkColumnar.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+
+static_assert(sizeof(long) == 8 && sizeof(double) == 8, "Columnar file keeps 8 bytes per value");
+
+/**
+ * @brief Read header of columnar file, after this call stream points to the first row group
+ *
+ * @param[in, out] file - opened columnar file
+ * @param[out] indexesName - names of indexes
+ * @param[out] columnsName - names of columns
+ * @param[out] columnsType - types of columns
+ * @return true if header is correct
+ */
+static bool readColumnarHeader(std::ifstream& file, std::vector<std::string>& indexesName, std::vector<std::string>& columnsName, std::vector<uint8_t>& columnsType)
+{
+    auto readString = [&file]()
+    {
+        uint32_t length = 0;
+        file.read(reinterpret_cast<char*>(&length), sizeof(length));
+
+        std::string str(length, '\0');
+        file.read(str.data(), length);
+
+        return str;
+    };
+
+    uint64_t magic = 0;
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    if (!file || magic != WorkloadSinkColumnar::columnarMagic)
+        return false;
+
+    uint32_t numIndexes = 0;
+    file.read(reinterpret_cast<char*>(&numIndexes), sizeof(numIndexes));
+    for (uint32_t i = 0; i < numIndexes && file; ++i)
+        indexesName.push_back(readString());
+
+    uint32_t numColumns = 0;
+    file.read(reinterpret_cast<char*>(&numColumns), sizeof(numColumns));
+    for (uint32_t i = 0; i < numColumns && file; ++i)
+    {
+        uint8_t type = 0;
+        file.read(reinterpret_cast<char*>(&type), sizeof(type));
+        columnsType.push_back(type);
+        columnsName.push_back(readString());
+    }
+
+    return static_cast<bool>(file);
+}
+
+WorkloadSinkColumnar::WorkloadSinkColumnar(const char* filePath, size_t rowGroupSize)
+: filePath{filePath}, rowGroupSize{rowGroupSize}, numRows{0}
+{
+    if (this->rowGroupSize == 0)
+    {
+        LOGGER_LOG_WARN("Row group needs at least 1 row, using 1");
+        this->rowGroupSize = 1;
+    }
+
+    LOGGER_LOG_DEBUG("WorkloadSinkColumnar created: filePath={}, rowGroupSize={}", this->filePath, this->rowGroupSize);
+}
+
+void WorkloadSinkColumnar::flushRowGroup() noexcept(true)
+{
+    const uint32_t rows = static_cast<uint32_t>(indexColumn.size());
+    if (rows == 0)
+        return;
+
+    file.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+    file.write(reinterpret_cast<const char*>(indexColumn.data()), rows * sizeof(long));
+    file.write(reinterpret_cast<const char*>(stepColumn.data()), rows * sizeof(long));
+
+    for (auto& column : doubleColumns)
+    {
+        file.write(reinterpret_cast<const char*>(column.data()), rows * sizeof(double));
+        column.clear();
+    }
+
+    for (auto& column : longColumns)
+    {
+        file.write(reinterpret_cast<const char*>(column.data()), rows * sizeof(long));
+        column.clear();
+    }
+
+    indexColumn.clear();
+    stepColumn.clear();
+}
+
+void WorkloadSinkColumnar::beginWorkload(const std::vector<std::string>& indexesName) noexcept(true)
+{
+    file.open(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        LOGGER_LOG_ERROR("Cannot create columnar file {}", filePath);
+        return;
+    }
+
+    numRows = 0;
+
+    auto writeString = [this](const std::string& str)
+    {
+        const uint32_t length = static_cast<uint32_t>(str.size());
+        file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        file.write(str.data(), length);
+    };
+
+    auto writeColumn = [this, &writeString](enum ColumnType type, const std::string& name)
+    {
+        const uint8_t columnType = type;
+        file.write(reinterpret_cast<const char*>(&columnType), sizeof(columnType));
+        writeString(name);
+    };
+
+    file.write(reinterpret_cast<const char*>(&columnarMagic), sizeof(columnarMagic));
+
+    const uint32_t numIndexes = static_cast<uint32_t>(indexesName.size());
+    file.write(reinterpret_cast<const char*>(&numIndexes), sizeof(numIndexes));
+    for (const auto& name : indexesName)
+        writeString(name);
+
+    const uint32_t numColumns = 2 + WorkloadCounters::WORKLOAD_COUNTER_D_MAX_ITERATOR + WorkloadCounters::WORKLOAD_COUNTER_L_MAX_ITERATOR;
+    file.write(reinterpret_cast<const char*>(&numColumns), sizeof(numColumns));
+
+    const WorkloadCounters counters;
+    writeColumn(COLUMN_TYPE_LONG, "Index");
+    writeColumn(COLUMN_TYPE_LONG, "Step");
+
+    for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_TIME; id < WorkloadCounters::WORKLOAD_COUNTER_D_MAX_ITERATOR; ++id)
+        writeColumn(COLUMN_TYPE_DOUBLE, counters.getCounterName(id));
+
+    for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < WorkloadCounters::WORKLOAD_COUNTER_L_MAX_ITERATOR; ++id)
+        writeColumn(COLUMN_TYPE_LONG, counters.getCounterName(id));
+
+    doubleColumns = std::vector<std::vector<double>>(WorkloadCounters::WORKLOAD_COUNTER_D_MAX_ITERATOR);
+    longColumns = std::vector<std::vector<long>>(WorkloadCounters::WORKLOAD_COUNTER_L_MAX_ITERATOR);
+    indexColumn.clear();
+    stepColumn.clear();
+}
+
+void WorkloadSinkColumnar::consumeStep(size_t index, size_t step, const WorkloadCounters& counters) noexcept(true)
+{
+    if (!file.is_open())
+        return;
+
+    // steps are numbered from 1 like in analyzer files
+    indexColumn.push_back(static_cast<long>(index));
+    stepColumn.push_back(static_cast<long>(step + 1));
+
+    for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_TIME; id < WorkloadCounters::WORKLOAD_COUNTER_D_MAX_ITERATOR; ++id)
+        doubleColumns[id].push_back(counters.getCounterValue(id));
+
+    for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < WorkloadCounters::WORKLOAD_COUNTER_L_MAX_ITERATOR; ++id)
+        longColumns[id].push_back(counters.getCounterValue(id));
+
+    ++numRows;
+
+    if (indexColumn.size() >= rowGroupSize)
+        flushRowGroup();
+}
+
+void WorkloadSinkColumnar::endWorkload() noexcept(true)
+{
+    if (!file.is_open())
+        return;
+
+    flushRowGroup();
+
+    const uint32_t lastRowGroup = 0;
+    const uint64_t totalRows = numRows;
+    file.write(reinterpret_cast<const char*>(&lastRowGroup), sizeof(lastRowGroup));
+    file.write(reinterpret_cast<const char*>(&totalRows), sizeof(totalRows));
+
+    file.close();
+
+    LOGGER_LOG_DEBUG("Columnar file {} written, rows={}", filePath, numRows);
+}
+
+std::vector<std::string> WorkloadSinkColumnar::readColumnsName(const char* filePath) noexcept(true)
+{
+    std::ifstream file(filePath, std::ios::binary);
+
+    std::vector<std::string> indexesName;
+    std::vector<std::string> columnsName;
+    std::vector<uint8_t> columnsType;
+    if (!readColumnarHeader(file, indexesName, columnsName, columnsType))
+    {
+        LOGGER_LOG_ERROR("{} is not a columnar file", filePath);
+        return std::vector<std::string>();
+    }
+
+    return columnsName;
+}
+
+std::vector<std::string> WorkloadSinkColumnar::readIndexesName(const char* filePath) noexcept(true)
+{
+    std::ifstream file(filePath, std::ios::binary);
+
+    std::vector<std::string> indexesName;
+    std::vector<std::string> columnsName;
+    std::vector<uint8_t> columnsType;
+    if (!readColumnarHeader(file, indexesName, columnsName, columnsType))
+    {
+        LOGGER_LOG_ERROR("{} is not a columnar file", filePath);
+        return std::vector<std::string>();
+    }
+
+    return indexesName;
+}
+
+std::vector<double> WorkloadSinkColumnar::readColumn(const char* filePath, const std::string& columnName) noexcept(true)
+{
+    std::vector<double> values;
+    std::ifstream file(filePath, std::ios::binary);
+
+    std::vector<std::string> indexesName;
+    std::vector<std::string> columnsName;
+    std::vector<uint8_t> columnsType;
+    if (!readColumnarHeader(file, indexesName, columnsName, columnsType))
+    {
+        LOGGER_LOG_ERROR("{} is not a columnar file", filePath);
+        return values;
+    }
+
+    auto it = std::find(columnsName.begin(), columnsName.end(), columnName);
+    if (it == columnsName.end())
+    {
+        LOGGER_LOG_ERROR("Column {} not found in {}", columnName, filePath);
+        return values;
+    }
+
+    const size_t column = static_cast<size_t>(it - columnsName.begin());
+    const size_t valueSize = 8;
+
+    while (true)
+    {
+        uint32_t rows = 0;
+        file.read(reinterpret_cast<char*>(&rows), sizeof(rows));
+        if (!file)
+        {
+            LOGGER_LOG_ERROR("Columnar file {} is truncated, row group header missing", filePath);
+            return std::vector<double>();
+        }
+
+        if (rows == 0)
+            break;
+
+        // skip columns before, read only requested one and skip the rest of row group
+        file.seekg(static_cast<std::streamoff>(column * rows * valueSize), std::ios::cur);
+
+        if (columnsType[column] == COLUMN_TYPE_LONG)
+        {
+            std::vector<long> buffer(rows);
+            if (!file.read(reinterpret_cast<char*>(buffer.data()), rows * valueSize))
+            {
+                LOGGER_LOG_ERROR("Columnar file {} is truncated, column {} has less than {} rows in row group", filePath, columnName, rows);
+                return std::vector<double>();
+            }
+
+            values.insert(values.end(), buffer.begin(), buffer.end());
+        }
+        else
+        {
+            std::vector<double> buffer(rows);
+            if (!file.read(reinterpret_cast<char*>(buffer.data()), rows * valueSize))
+            {
+                LOGGER_LOG_ERROR("Columnar file {} is truncated, column {} has less than {} rows in row group", filePath, columnName, rows);
+                return std::vector<double>();
+            }
+
+            values.insert(values.end(), buffer.begin(), buffer.end());
+        }
+
+        file.seekg(static_cast<std::streamoff>((columnsName.size() - column - 1) * rows * valueSize), std::ios::cur);
+    }
+
+    uint64_t totalRows = 0;
+    file.read(reinterpret_cast<char*>(&totalRows), sizeof(totalRows));
+    if (!file || totalRows != values.size())
+    {
+        LOGGER_LOG_ERROR("Columnar file {} is truncated, footer says {} rows, read {}", filePath, totalRows, values.size());
+        return std::vector<double>();
+    }
+
+    return values;
+}
\ No newline at end of file
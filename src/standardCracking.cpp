@@ -0,0 +1,13 @@
+#include <adaptiveMerging/standardCracking.hpp>
+
+StandardCracking::StandardCracking(const char* name, DBIndex* index, size_t startingEntries, size_t minPieceSize)
+: DatabaseCracking(name, index, startingEntries, minPieceSize, false)
+{
+    LOGGER_LOG_DEBUG("StandardCracking created {}", toStringFull());
+}
+
+StandardCracking::StandardCracking(DBIndex* index, size_t startingEntries, size_t minPieceSize)
+: StandardCracking("StandardCracking", index, startingEntries, minPieceSize)
+{
+
+}
\ No newline at end of file
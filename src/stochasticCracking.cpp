@@ -0,0 +1,13 @@
+#include <adaptiveMerging/stochasticCracking.hpp>
+
+StochasticCracking::StochasticCracking(const char* name, DBIndex* index, size_t startingEntries, size_t minPieceSize)
+: DatabaseCracking(name, index, startingEntries, minPieceSize, true)
+{
+    LOGGER_LOG_DEBUG("StochasticCracking created {}", toStringFull());
+}
+
+StochasticCracking::StochasticCracking(DBIndex* index, size_t startingEntries, size_t minPieceSize)
+: StochasticCracking("StochasticCracking", index, startingEntries, minPieceSize)
+{
+
+}
\ No newline at end of file
@@ -51,6 +51,14 @@ size_t UBPTree::calculateHeight() const noexcept(true)
     return height;
 }
 
+double UBPTree::calculateGapBitChangeRatio() const noexcept(true)
+{
+    const double changedKeyBits = static_cast<double>(sizeKey) * MemoryController::defaultBitChangeRatio / 2.0;
+    const double changedDataBits = static_cast<double>(sizeData) * MemoryController::defaultBitChangeRatio;
+
+    return (changedKeyBits + changedDataBits) / static_cast<double>(sizeRecord);
+}
+
 double UBPTree::findLeaf() noexcept(true)
 {
     double time = 0.0;
@@ -115,8 +123,8 @@ double UBPTree::insertEntriesHelper(size_t numOperations) noexcept(true)
         uintptr_t addr = disk->getCurrentMemoryAddr();
 
         // we need into a gap (or at the end + update bitmap)
-        time += disk->overwriteBytes(addr, sizeRecord);
-        time += disk->overwriteBytes(addr + nodeSize - 1, 1);
+        time += disk->overwriteBytes(addr, sizeRecord, calculateGapBitChangeRatio());
+        time += disk->overwriteBytes(addr + nodeSize - 1, 1, MemoryController::bitmapBitChangeRatio);
 
         // split
         if (numEntries > 1 && diffLeaves > 0)
@@ -304,7 +312,7 @@ double UBPTree::deleteEntriesHelper(size_t numOperations) noexcept(true)
 
         // delete = update bitmap at the end of node
         uintptr_t addr = disk->getCurrentMemoryAddr();
-        time += disk->overwriteBytes(addr + nodeSize - 1, 1);
+        time += disk->overwriteBytes(addr + nodeSize - 1, 1, MemoryController::bitmapBitChangeRatio);
         time += disk->flushCache();
 
         // we need to merge leaves
@@ -0,0 +1,218 @@
+#include <observability/wearTracker.hpp>
+#include <logger/logger.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+WearTracker::WearTracker(size_t numUnits, size_t sampleRate)
+: numUnits{numUnits}, sampleRate{sampleRate}, nextUnit{0}, writtenUnits{0}, rng{defaultSeed}
+{
+    if (this->sampleRate == 0)
+    {
+        LOGGER_LOG_WARN("Sample rate cannot be 0, using 1");
+        this->sampleRate = 1;
+    }
+
+    unitsWear = std::vector<uint32_t>((this->numUnits + this->sampleRate - 1) / this->sampleRate, 0);
+}
+
+size_t WearTracker::allocateNextUnits(size_t units) noexcept(true)
+{
+    const size_t firstUnit = nextUnit;
+
+    nextUnit = (firstUnit + units) % numUnits;
+    writtenUnits = firstUnit + units >= numUnits ? numUnits : std::max(writtenUnits, firstUnit + units);
+
+    return firstUnit;
+}
+
+size_t WearTracker::getUnitWear(size_t unit) const noexcept(true)
+{
+    if (unit >= numUnits || unit % sampleRate != 0)
+        return 0;
+
+    return unitsWear[unit / sampleRate];
+}
+
+void WearTracker::wearUnits(size_t firstUnit, size_t units) noexcept(true)
+{
+    if (!isEnabled() || units == 0)
+        return;
+
+    // each full pass over device wears every unit once
+    const uint32_t fullPasses = static_cast<uint32_t>(units / numUnits);
+    if (fullPasses > 0)
+        for (uint32_t& wear : unitsWear)
+            wear += fullPasses;
+
+    const size_t restUnits = units % numUnits;
+    const size_t start = firstUnit % numUnits;
+    const size_t end = start + restUnits;
+
+    // only sampled units, from the first multiple of sampleRate
+    for (size_t unit = (start + sampleRate - 1) / sampleRate * sampleRate; unit < end; unit += sampleRate)
+        ++unitsWear[(unit % numUnits) / sampleRate];
+}
+
+size_t WearTracker::writeUnits(size_t units) noexcept(true)
+{
+    if (!isEnabled() || units == 0)
+        return 0;
+
+    return allocateNextUnits(units);
+}
+
+size_t WearTracker::pickWrittenUnits(size_t units) noexcept(true)
+{
+    if (!isEnabled() || units == 0)
+        return 0;
+
+    if (writtenUnits == 0)
+        return allocateNextUnits(units);
+
+    return rng() % writtenUnits;
+}
+
+void WearTracker::wearNextUnits(size_t units) noexcept(true)
+{
+    if (!isEnabled() || units == 0)
+        return;
+
+    wearUnits(allocateNextUnits(units), units);
+}
+
+void WearTracker::wearWrittenUnits(size_t units) noexcept(true)
+{
+    if (!isEnabled() || units == 0)
+        return;
+
+    const bool isWritten = writtenUnits > 0;
+    const size_t firstUnit = pickWrittenUnits(units);
+
+    wearUnits(firstUnit, isWritten ? std::min(units, writtenUnits) : units);
+}
+
+size_t WearTracker::getMinWear() const noexcept(true)
+{
+    return unitsWear.empty() ? 0 : *std::min_element(unitsWear.begin(), unitsWear.end());
+}
+
+size_t WearTracker::getMaxWear() const noexcept(true)
+{
+    return unitsWear.empty() ? 0 : *std::max_element(unitsWear.begin(), unitsWear.end());
+}
+
+double WearTracker::getMeanWear() const noexcept(true)
+{
+    if (unitsWear.empty())
+        return 0.0;
+
+    double sum = 0.0;
+    for (const uint32_t wear : unitsWear)
+        sum += static_cast<double>(wear);
+
+    return sum / static_cast<double>(unitsWear.size());
+}
+
+double WearTracker::getStdDevWear() const noexcept(true)
+{
+    if (unitsWear.empty())
+        return 0.0;
+
+    const double mean = getMeanWear();
+
+    double sum = 0.0;
+    for (const uint32_t wear : unitsWear)
+        sum += (static_cast<double>(wear) - mean) * (static_cast<double>(wear) - mean);
+
+    return std::sqrt(sum / static_cast<double>(unitsWear.size()));
+}
+
+double WearTracker::getGiniWear() const noexcept(true)
+{
+    if (unitsWear.empty())
+        return 0.0;
+
+    std::vector<uint32_t> sortedWear(unitsWear);
+    std::sort(sortedWear.begin(), sortedWear.end());
+
+    double sum = 0.0;
+    double weightedSum = 0.0;
+    for (size_t i = 0; i < sortedWear.size(); ++i)
+    {
+        sum += static_cast<double>(sortedWear[i]);
+        weightedSum += static_cast<double>(i + 1) * static_cast<double>(sortedWear[i]);
+    }
+
+    if (sum == 0.0)
+        return 0.0;
+
+    const double n = static_cast<double>(sortedWear.size());
+
+    return 2.0 * weightedSum / (n * sum) - (n + 1.0) / n;
+}
+
+double WearTracker::estimateLifetime(size_t endurance, double time) const noexcept(true)
+{
+    const size_t maxWear = getMaxWear();
+    if (maxWear == 0)
+        return std::numeric_limits<double>::infinity();
+
+    return time * static_cast<double>(endurance) / static_cast<double>(maxWear);
+}
+
+void WearTracker::reset() noexcept(true)
+{
+    std::fill(unitsWear.begin(), unitsWear.end(), 0);
+
+    nextUnit = 0;
+    writtenUnits = 0;
+    rng.seed(defaultSeed);
+}
+
+std::string WearTracker::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("WearTracker {") +
+                           std::string(" .numUnits = ") + std::to_string(numUnits) +
+                           std::string(" .sampleRate = ") + std::to_string(sampleRate) +
+                           std::string(" .maxWear = ") + std::to_string(getMaxWear()) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("WearTracker {\n") +
+                           std::string("\t.numUnits = ") + std::to_string(numUnits) + std::string("\n") +
+                           std::string("\t.sampleRate = ") + std::to_string(sampleRate) + std::string("\n") +
+                           std::string("\t.maxWear = ") + std::to_string(getMaxWear()) + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string WearTracker::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("WearTracker {") +
+                           std::string(" .numUnits = ") + std::to_string(numUnits) +
+                           std::string(" .sampleRate = ") + std::to_string(sampleRate) +
+                           std::string(" .trackedUnits = ") + std::to_string(unitsWear.size()) +
+                           std::string(" .writtenUnits = ") + std::to_string(writtenUnits) +
+                           std::string(" .nextUnit = ") + std::to_string(nextUnit) +
+                           std::string(" .minWear = ") + std::to_string(getMinWear()) +
+                           std::string(" .maxWear = ") + std::to_string(getMaxWear()) +
+                           std::string(" .meanWear = ") + std::to_string(getMeanWear()) +
+                           std::string(" .stdDevWear = ") + std::to_string(getStdDevWear()) +
+                           std::string(" .giniWear = ") + std::to_string(getGiniWear()) +
+                           std::string(" }"));
+    else
+        return std::string(std::string("WearTracker {\n") +
+                           std::string("\t.numUnits = ") + std::to_string(numUnits) + std::string("\n") +
+                           std::string("\t.sampleRate = ") + std::to_string(sampleRate) + std::string("\n") +
+                           std::string("\t.trackedUnits = ") + std::to_string(unitsWear.size()) + std::string("\n") +
+                           std::string("\t.writtenUnits = ") + std::to_string(writtenUnits) + std::string("\n") +
+                           std::string("\t.nextUnit = ") + std::to_string(nextUnit) + std::string("\n") +
+                           std::string("\t.minWear = ") + std::to_string(getMinWear()) + std::string("\n") +
+                           std::string("\t.maxWear = ") + std::to_string(getMaxWear()) + std::string("\n") +
+                           std::string("\t.meanWear = ") + std::to_string(getMeanWear()) + std::string("\n") +
+                           std::string("\t.stdDevWear = ") + std::to_string(getStdDevWear()) + std::string("\n") +
+                           std::string("\t.giniWear = ") + std::to_string(getGiniWear()) + std::string("\n") +
+                           std::string("}"));
+}
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include <workload/workload.hpp>
 #include <logger/logger.hpp>
 
+#include <cstdio>
+#include <fstream>
 #include <numeric>
 
 void Workload::aggregateCounters(WorkloadCounters& total, const WorkloadCounters& step) noexcept(true)
@@ -13,14 +15,227 @@ void Workload::aggregateCounters(WorkloadCounters& total, const WorkloadCounters
 }
 
 
+std::vector<std::string> Workload::getIndexesName() const noexcept(true)
+{
+    std::vector<std::string> indexesName;
+
+    if (isColumnIndexMode == false)
+        for (const auto index : rIndexes)
+            indexesName.push_back(std::string(index->getName()));
+    else
+        for (const auto index : cIndexes)
+            indexesName.push_back(std::string(index->getName()));
+
+    return indexesName;
+}
+
+/**
+ * @brief Continue FNV-1a hash with string
+ *
+ * @param[in] hash - hash of previous data
+ * @param[in] str - string to hash
+ * @return hash
+ */
+static uint64_t fingerprintString(uint64_t hash, const std::string& str)
+{
+    for (const char c : str)
+    {
+        hash ^= static_cast<uint64_t>(static_cast<unsigned char>(c));
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+uint64_t Workload::getStepsFingerprint() const noexcept(true)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const auto step : steps)
+        hash = fingerprintString(hash, step->toString() + std::string("|"));
+
+    return hash;
+}
+
+std::vector<uint64_t> Workload::getIndexesFingerprint() const noexcept(true)
+{
+    std::vector<uint64_t> fingerprints;
+
+    if (isColumnIndexMode == false)
+        for (const auto index : rIndexes)
+            fingerprints.push_back(fingerprintString(0xcbf29ce484222325ULL, index->toStringFull()));
+    else
+        for (const auto index : cIndexes)
+            fingerprints.push_back(fingerprintString(0xcbf29ce484222325ULL, index->toStringFull()));
+
+    return fingerprints;
+}
+
+bool Workload::saveCheckpoint(size_t completedIndexes) const noexcept(true)
+{
+    const std::string tmpPath = checkpointPath + std::string(".tmp");
+
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            LOGGER_LOG_ERROR("Cannot open checkpoint file {}", tmpPath);
+            return false;
+        }
+
+        auto writeU32 = [&file](uint32_t value) { file.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+
+        file.write(reinterpret_cast<const char*>(&checkpointMagic), sizeof(checkpointMagic));
+
+        const std::vector<std::string> indexesName = getIndexesName();
+        writeU32(static_cast<uint32_t>(indexesName.size()));
+        for (size_t i = 0; i < indexesName.size(); ++i)
+        {
+            writeU32(static_cast<uint32_t>(indexesName[i].size()));
+            file.write(indexesName[i].data(), static_cast<std::streamsize>(indexesName[i].size()));
+            file.write(reinterpret_cast<const char*>(&indexesFingerprint[i]), sizeof(indexesFingerprint[i]));
+        }
+
+        const uint64_t fingerprint = getStepsFingerprint();
+        const uint8_t keepSteps = keepStepCounters ? 1 : 0;
+        writeU32(static_cast<uint32_t>(steps.size()));
+        file.write(reinterpret_cast<const char*>(&fingerprint), sizeof(fingerprint));
+        file.write(reinterpret_cast<const char*>(&keepSteps), sizeof(keepSteps));
+
+        writeU32(static_cast<uint32_t>(completedIndexes));
+        for (size_t i = 0; i < completedIndexes; ++i)
+        {
+            totalCounters[i].serialize(file);
+
+            const size_t numStepCounters = keepStepCounters ? stepCounters[i].size() : 0;
+            writeU32(static_cast<uint32_t>(numStepCounters));
+            for (size_t j = 0; j < numStepCounters; ++j)
+                stepCounters[i][j].serialize(file);
+        }
+
+        file.flush();
+        if (!file)
+        {
+            LOGGER_LOG_ERROR("Cannot write checkpoint file {}", tmpPath);
+            return false;
+        }
+    }
+
+    if (std::rename(tmpPath.c_str(), checkpointPath.c_str()) != 0)
+    {
+        LOGGER_LOG_ERROR("Cannot rename checkpoint file {} to {}", tmpPath, checkpointPath);
+        return false;
+    }
+
+    LOGGER_LOG_DEBUG("Checkpoint with {} completed indexes saved to {}", completedIndexes, checkpointPath);
+
+    return true;
+}
+
+size_t Workload::loadCheckpoint() noexcept(true)
+{
+    std::ifstream file(checkpointPath, std::ios::binary);
+    if (!file.is_open())
+        return 0;
+
+    auto readU32 = [&file]() { uint32_t value = 0; file.read(reinterpret_cast<char*>(&value), sizeof(value)); return value; };
+
+    uint64_t magic = 0;
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    if (!file || magic != checkpointMagic)
+    {
+        LOGGER_LOG_WARN("File {} is not a workload checkpoint, starting from the beginning", checkpointPath);
+        return 0;
+    }
+
+    const std::vector<std::string> indexesName = getIndexesName();
+    const uint32_t numIndexes = readU32();
+    if (!file || numIndexes != indexesName.size())
+    {
+        LOGGER_LOG_WARN("Checkpoint {} has {} indexes, workload has {}, starting from the beginning", checkpointPath, numIndexes, indexesName.size());
+        return 0;
+    }
+
+    for (size_t i = 0; i < indexesName.size(); ++i)
+    {
+        const uint32_t nameSize = readU32();
+        std::string savedName(file ? nameSize : 0, '\0');
+        file.read(savedName.data(), static_cast<std::streamsize>(savedName.size()));
+        if (!file || savedName != indexesName[i])
+        {
+            LOGGER_LOG_WARN("Checkpoint {} has index {} instead of {}, starting from the beginning", checkpointPath, savedName, indexesName[i]);
+            return 0;
+        }
+
+        uint64_t fingerprint = 0;
+        file.read(reinterpret_cast<char*>(&fingerprint), sizeof(fingerprint));
+        if (!file || fingerprint != indexesFingerprint[i])
+        {
+            LOGGER_LOG_WARN("Checkpoint {} has index {} with different configuration, starting from the beginning", checkpointPath, indexesName[i]);
+            return 0;
+        }
+    }
+
+    const uint32_t numSteps = readU32();
+    uint64_t fingerprint = 0;
+    uint8_t keepSteps = 0;
+    file.read(reinterpret_cast<char*>(&fingerprint), sizeof(fingerprint));
+    file.read(reinterpret_cast<char*>(&keepSteps), sizeof(keepSteps));
+    if (!file || numSteps != steps.size() || fingerprint != getStepsFingerprint() || (keepSteps == 1) != keepStepCounters)
+    {
+        LOGGER_LOG_WARN("Checkpoint {} was created for different steps, starting from the beginning", checkpointPath);
+        return 0;
+    }
+
+    const uint32_t completedIndexes = readU32();
+    if (!file || completedIndexes > numIndexes)
+    {
+        LOGGER_LOG_WARN("Checkpoint {} is broken, starting from the beginning", checkpointPath);
+        return 0;
+    }
+
+    std::vector<WorkloadCounters> restoredTotal(completedIndexes);
+    std::vector<std::vector<WorkloadCounters>> restoredSteps(completedIndexes);
+    for (size_t i = 0; i < completedIndexes; ++i)
+    {
+        if (!restoredTotal[i].deserialize(file))
+        {
+            LOGGER_LOG_WARN("Checkpoint {} is broken, starting from the beginning", checkpointPath);
+            return 0;
+        }
+
+        const uint32_t numStepCounters = readU32();
+        if (!file || numStepCounters != (keepStepCounters ? steps.size() : 0))
+        {
+            LOGGER_LOG_WARN("Checkpoint {} is broken, starting from the beginning", checkpointPath);
+            return 0;
+        }
+
+        restoredSteps[i] = std::vector<WorkloadCounters>(numStepCounters);
+        for (size_t j = 0; j < numStepCounters; ++j)
+            if (!restoredSteps[i][j].deserialize(file))
+            {
+                LOGGER_LOG_WARN("Checkpoint {} is broken, starting from the beginning", checkpointPath);
+                return 0;
+            }
+    }
+
+    totalCounters.insert(totalCounters.end(), restoredTotal.begin(), restoredTotal.end());
+    if (keepStepCounters)
+        stepCounters.insert(stepCounters.end(), restoredSteps.begin(), restoredSteps.end());
+
+    LOGGER_LOG_INFO("Restored {} completed indexes from checkpoint {}", completedIndexes, checkpointPath);
+
+    return completedIndexes;
+}
+
 Workload::Workload(const std::vector<DBIndex*>& indexes, const std::vector<WorkloadStep*>& steps)
-: steps{steps}, rIndexes{indexes}, isColumnIndexMode{false}
+: steps{steps}, rIndexes{indexes}, keepStepCounters{true}, isColumnIndexMode{false}, numRestoredIndexes{0}
 {
     LOGGER_LOG_DEBUG("Workload created {}", toStringFull());
 }
 
 Workload::Workload(const std::vector<DBIndexColumn*>& indexes, const std::vector<WorkloadStep*>& steps)
-: steps{steps}, cIndexes{indexes}, isColumnIndexMode{true}
+: steps{steps}, cIndexes{indexes}, keepStepCounters{true}, isColumnIndexMode{true}, numRestoredIndexes{0}
 {
     LOGGER_LOG_DEBUG("Workload created {}", toStringFull());
 }
@@ -38,6 +253,10 @@ Workload::Workload(const Workload& other)
     isColumnIndexMode = other.isColumnIndexMode;
     totalCounters = other.totalCounters;
     stepCounters = other.stepCounters;
+    keepStepCounters = other.keepStepCounters;
+    checkpointPath = other.checkpointPath;
+    numRestoredIndexes = other.numRestoredIndexes;
+    indexesFingerprint = other.indexesFingerprint;
 
     for (size_t i = 0; i < other.steps.size(); ++i)
         steps.push_back(other.steps[i]->clone());
@@ -53,6 +272,10 @@ Workload& Workload::operator=(const Workload& other)
     isColumnIndexMode = other.isColumnIndexMode;
     totalCounters = other.totalCounters;
     stepCounters = other.stepCounters;
+    keepStepCounters = other.keepStepCounters;
+    checkpointPath = other.checkpointPath;
+    numRestoredIndexes = other.numRestoredIndexes;
+    indexesFingerprint = other.indexesFingerprint;
 
     for (size_t i = 0; i < other.steps.size(); ++i)
         steps.push_back(other.steps[i]->clone());
@@ -65,6 +288,11 @@ void Workload::addStep(WorkloadStep* step) noexcept(true)
     steps.push_back(step);
 }
 
+void Workload::addSink(WorkloadSink* sink) noexcept(true)
+{
+    sinks.push_back(sink);
+}
+
 void Workload::addIndex(DBIndex* index) noexcept(true)
 {
     rIndexes.push_back(index);
@@ -81,7 +309,29 @@ void Workload::run() noexcept(true)
 {
     size_t indexesSize = isColumnIndexMode == false ? rIndexes.size() : cIndexes.size();
 
-    for (size_t i = 0; i < indexesSize; ++i)
+    const std::vector<std::string> indexesName = getIndexesName();
+    for (auto sink : sinks)
+        sink->beginWorkload(indexesName);
+
+    // counters of this run start at firstCounters, previous runs are kept in front of them
+    const size_t firstCounters = totalCounters.size();
+    numRestoredIndexes = 0;
+    if (!checkpointPath.empty() && firstCounters == 0)
+    {
+        indexesFingerprint = getIndexesFingerprint();
+        numRestoredIndexes = loadCheckpoint();
+
+        if (numRestoredIndexes > 0 && !keepStepCounters && !sinks.empty())
+            LOGGER_LOG_WARN("Step counters were not kept, sinks will not receive steps of {} restored indexes", numRestoredIndexes);
+
+        if (keepStepCounters)
+            for (size_t i = 0; i < numRestoredIndexes; ++i)
+                for (size_t j = 0; j < stepCounters[i].size(); ++j)
+                    for (auto sink : sinks)
+                        sink->consumeStep(i, j, stepCounters[i][j]);
+    }
+
+    for (size_t i = numRestoredIndexes; i < indexesSize; ++i)
     {
         WorkloadCounters totalStats;
         std::vector<WorkloadCounters> stepStats;
@@ -97,13 +347,29 @@ void Workload::run() noexcept(true)
             steps[j]->executeStep();
 
             const WorkloadCounters& stats = steps[j]->getCounters();
-            stepStats.push_back(stats);
+            if (keepStepCounters)
+                stepStats.push_back(stats);
+
             aggregateCounters(totalStats, stats);
+
+            for (auto sink : sinks)
+                sink->consumeStep(i, j, stats);
         }
 
         totalCounters.push_back(totalStats);
-        stepCounters.push_back(stepStats);
+        if (keepStepCounters)
+            stepCounters.push_back(stepStats);
+
+        if (!checkpointPath.empty() && firstCounters == 0)
+            saveCheckpoint(i + 1);
     }
+
+    // checkpoint is needed only to resume killed run, finished run would restore all indexes with stale state
+    if (!checkpointPath.empty() && firstCounters == 0)
+        std::remove(checkpointPath.c_str());
+
+    for (auto sink : sinks)
+        sink->endWorkload();
 }
 
 std::string Workload::toString(bool oneLine) const noexcept(true)
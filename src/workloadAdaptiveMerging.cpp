@@ -16,10 +16,15 @@ void WorkloadAdaptiveMerging::run() noexcept(true)
 {
     const size_t indexesSize = rIndexes.size();
 
+    const std::vector<std::string> indexesName = getIndexesName();
+    for (auto sink : sinks)
+        sink->beginWorkload(indexesName);
+
     for (size_t i = 0; i < indexesSize; ++i)
     {
         WorkloadCounters totalStats;
         std::vector<WorkloadCounters> stepStats;
+        size_t stepId = 0;
 
         // run steps for index(i)
         while (dynamic_cast<AdaptiveMergingFramework*>(rIndexes[i])->getMemoryManager().getNumEntries() > 0)
@@ -31,16 +36,27 @@ void WorkloadAdaptiveMerging::run() noexcept(true)
             step->executeStep();
 
             const WorkloadCounters& stats = step->getCounters();
-            stepStats.push_back(stats);
+            if (keepStepCounters)
+                stepStats.push_back(stats);
+
             aggregateCounters(totalStats, stats);
 
+            for (auto sink : sinks)
+                sink->consumeStep(i, stepId, stats);
+
+            ++stepId;
+
             if (i != 0)
                 delete step;
         }
 
         totalCounters.push_back(totalStats);
-        stepCounters.push_back(stepStats);
+        if (keepStepCounters)
+            stepCounters.push_back(stepStats);
     }
+
+    for (auto sink : sinks)
+        sink->endWorkload();
 }
 
 
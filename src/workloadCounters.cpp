@@ -1,5 +1,8 @@
 #include <observability/workloadCounters.hpp>
 
+#include <cstdint>
+#include <vector>
+
 #define TO_STRING_PRIV(X) #X
 #define TO_STRING(X) TO_STRING_PRIV(X)
 
@@ -24,6 +27,9 @@ WorkloadCounters::WorkloadCounters()
     countersDouble.addCounter(WORKLOAD_AM_COUNTER_RW_LOADING_AVG_TIME, std::string(TO_STRING(WORKLOAD_AM_COUNTER_RW_LOADING_AVG_TIME)));
     countersDouble.addCounter(WORKLOAD_AM_COUNTER_RW_TOTAL_TIME, std::string(TO_STRING(WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)));
 
+    countersDouble.addCounter(WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_TIME, std::string(TO_STRING(WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_TIME)));
+    countersDouble.addCounter(WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME, std::string(TO_STRING(WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)));
+
     // add long counters
     countersLong.addCounter(WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS, std::string(TO_STRING(WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS)));
     countersLong.addCounter(WORKLOAD_COUNTER_RW_BULKLOAD_TOTAL_OPERATIONS, std::string(TO_STRING(WORKLOAD_COUNTER_RW_BULKLOAD_TOTAL_OPERATIONS)));
@@ -38,6 +44,9 @@ WorkloadCounters::WorkloadCounters()
     countersLong.addCounter(WORKLOAD_AM_COUNTER_RW_LOADING_TOTAL_OPERATIONS, std::string(TO_STRING(WORKLOAD_AM_COUNTER_RW_LOADING_TOTAL_OPERATIONS)));
     countersLong.addCounter(WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS, std::string(TO_STRING(WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)));
 
+    countersLong.addCounter(WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS, std::string(TO_STRING(WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS)));
+    countersLong.addCounter(WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS, std::string(TO_STRING(WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)));
+
     LOGGER_LOG_DEBUG("Workload counters created {}", toStringFull());
 }
 
@@ -97,6 +106,65 @@ void WorkloadCounters::resetAllCounters() noexcept(true)
     countersDouble.resetAllCounters();
 }
 
+void WorkloadCounters::serialize(std::ostream& stream) const noexcept(true)
+{
+    const uint32_t numDouble = static_cast<uint32_t>(WORKLOAD_COUNTER_D_MAX_ITERATOR);
+    stream.write(reinterpret_cast<const char*>(&numDouble), sizeof(numDouble));
+    for (auto id = WORKLOAD_COUNTER_RW_INSERT_TOTAL_TIME; id < WORKLOAD_COUNTER_D_MAX_ITERATOR; ++id)
+    {
+        const double value = getCounterValue(id);
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    const uint32_t numLong = static_cast<uint32_t>(WORKLOAD_COUNTER_L_MAX_ITERATOR);
+    stream.write(reinterpret_cast<const char*>(&numLong), sizeof(numLong));
+    for (auto id = WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < WORKLOAD_COUNTER_L_MAX_ITERATOR; ++id)
+    {
+        const long value = getCounterValue(id);
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+}
+
+bool WorkloadCounters::deserialize(std::istream& stream) noexcept(true)
+{
+    uint32_t numDouble = 0;
+    stream.read(reinterpret_cast<char*>(&numDouble), sizeof(numDouble));
+    if (!stream || numDouble != static_cast<uint32_t>(WORKLOAD_COUNTER_D_MAX_ITERATOR))
+    {
+        LOGGER_LOG_ERROR("Cannot read double counters, numDouble = {}", numDouble);
+        return false;
+    }
+
+    std::vector<double> doubleValues(numDouble);
+    stream.read(reinterpret_cast<char*>(doubleValues.data()), numDouble * sizeof(double));
+
+    uint32_t numLong = 0;
+    stream.read(reinterpret_cast<char*>(&numLong), sizeof(numLong));
+    if (!stream || numLong != static_cast<uint32_t>(WORKLOAD_COUNTER_L_MAX_ITERATOR))
+    {
+        LOGGER_LOG_ERROR("Cannot read long counters, numLong = {}", numLong);
+        return false;
+    }
+
+    std::vector<long> longValues(numLong);
+    stream.read(reinterpret_cast<char*>(longValues.data()), numLong * sizeof(long));
+    if (!stream)
+    {
+        LOGGER_LOG_ERROR("Cannot read values of counters");
+        return false;
+    }
+
+    resetAllCounters();
+
+    for (auto id = WORKLOAD_COUNTER_RW_INSERT_TOTAL_TIME; id < WORKLOAD_COUNTER_D_MAX_ITERATOR; ++id)
+        pegCounter(id, doubleValues[id]);
+
+    for (auto id = WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < WORKLOAD_COUNTER_L_MAX_ITERATOR; ++id)
+        pegCounter(id, longValues[id]);
+
+    return true;
+}
+
 std::string WorkloadCounters::toString(bool oneLine) const noexcept(true)
 {
     if (oneLine)
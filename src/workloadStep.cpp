@@ -27,6 +27,9 @@ WorkloadCounters WorkloadStep::collectCounters() noexcept(true)
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_AM_COUNTER_RW_LOADING_AVG_TIME, rIndex->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_AVG_TIME).second);
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME, rIndex->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_TOTAL_TIME).second);
 
+        tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_TIME, rIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second);
+        tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME, rIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_TIME).second);
+
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS, rIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS).second);
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_BULKLOAD_TOTAL_OPERATIONS, rIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_BULKLOAD_TOTAL_OPERATIONS).second);
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_DELETE_TOTAL_OPERATIONS, rIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_DELETE_TOTAL_OPERATIONS).second);
@@ -39,6 +42,9 @@ WorkloadCounters WorkloadStep::collectCounters() noexcept(true)
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS, rIndex->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_INVALIDATION_TOTAL_OPERATIONS).second);
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_AM_COUNTER_RW_LOADING_TOTAL_OPERATIONS, rIndex->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_TOTAL_OPERATIONS).second);
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS, rIndex->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_TOTAL_OPERATIONS).second);
+
+        tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS, rIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS).second);
+        tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS, rIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_OPERATIONS).second);
     }
     else
     {
@@ -60,6 +66,9 @@ WorkloadCounters WorkloadStep::collectCounters() noexcept(true)
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_AM_COUNTER_RW_LOADING_AVG_TIME, cIndex->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_AVG_TIME).second);
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME, cIndex->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_TOTAL_TIME).second);
 
+        tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_TIME, cIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second);
+        tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME, cIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_TIME).second);
+
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS, cIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS).second);
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_BULKLOAD_TOTAL_OPERATIONS, cIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_BULKLOAD_TOTAL_OPERATIONS).second);
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_DELETE_TOTAL_OPERATIONS, cIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_DELETE_TOTAL_OPERATIONS).second);
@@ -72,6 +81,9 @@ WorkloadCounters WorkloadStep::collectCounters() noexcept(true)
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS, cIndex->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_INVALIDATION_TOTAL_OPERATIONS).second);
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_AM_COUNTER_RW_LOADING_TOTAL_OPERATIONS, cIndex->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_TOTAL_OPERATIONS).second);
         tempCounters.pegCounter(WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS, cIndex->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_TOTAL_OPERATIONS).second);
+
+        tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS, cIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS).second);
+        tempCounters.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS, cIndex->getCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_OPERATIONS).second);
     }
     return tempCounters;
 }
@@ -0,0 +1,322 @@
+#include <workload/workloadStepTrace.hpp>
+#include <logger/logger.hpp>
+
+#include <fstream>
+#include <sstream>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+static_assert(sizeof(WorkloadStepTrace::TraceRecord) == 24, "TraceRecord has to be packed into 24 bytes");
+static_assert(sizeof(WorkloadStepTrace::TraceHeader) == 16, "TraceHeader has to be packed into 16 bytes");
+
+// Already replayed part of mapping is dropped from page cache in windows of this size
+static constexpr size_t traceReleaseWindow = static_cast<size_t>(64) << 20;
+
+WorkloadStepTrace::WorkloadStepTrace(DBIndex* index, const std::string& tracePath, size_t maxBatchSize)
+: WorkloadStep("WorkloadStepTrace", index, 0, 0, 0.0), tracePath{tracePath}, maxBatchSize{maxBatchSize}, numBatches{0}, numRecordsReplayed{0}
+{
+
+}
+
+WorkloadStepTrace::WorkloadStepTrace(DBIndexColumn* index, const std::string& tracePath, size_t maxBatchSize)
+: WorkloadStep("WorkloadStepTrace", index, 0, 0, 0.0), tracePath{tracePath}, maxBatchSize{maxBatchSize}, numBatches{0}, numRecordsReplayed{0}
+{
+
+}
+
+WorkloadStepTrace::WorkloadStepTrace(DBIndexColumn* index, const std::string& tracePath, const std::vector<size_t>& col, size_t maxBatchSize)
+: WorkloadStep("WorkloadStepTrace", index, 0, 0, 0.0, col), tracePath{tracePath}, maxBatchSize{maxBatchSize}, numBatches{0}, numRecordsReplayed{0}
+{
+
+}
+
+WorkloadStepTrace::WorkloadStepTrace(const std::string& tracePath, size_t maxBatchSize)
+: WorkloadStep("WorkloadStepTrace", static_cast<DBIndex*>(nullptr), 0, 0, 0.0), tracePath{tracePath}, maxBatchSize{maxBatchSize}, numBatches{0}, numRecordsReplayed{0}
+{
+
+}
+
+WorkloadStepTrace::WorkloadStepTrace(const std::string& tracePath, const std::vector<size_t>& col, size_t maxBatchSize)
+: WorkloadStep("WorkloadStepTrace", static_cast<DBIndexColumn*>(nullptr), 0, 0, 0.0, col), tracePath{tracePath}, maxBatchSize{maxBatchSize}, numBatches{0}, numRecordsReplayed{0}
+{
+
+}
+
+double WorkloadStepTrace::executeBatch(uint8_t opType, uint32_t rangeLength, size_t batchSize) noexcept(true)
+{
+    ++numBatches;
+
+    if (isColumnIndexMode == false)
+    {
+        switch (opType)
+        {
+            case TRACE_OPERATION_INSERT:
+                return rIndex->insertEntries(batchSize);
+            case TRACE_OPERATION_BULKLOAD:
+                return rIndex->bulkloadEntries(batchSize);
+            case TRACE_OPERATION_DELETE:
+                return rIndex->deleteEntries(batchSize);
+            case TRACE_OPERATION_PSEARCH:
+                return rIndex->findPointEntries(batchSize);
+            case TRACE_OPERATION_RSEARCH:
+                return rIndex->findRangeEntries(static_cast<size_t>(rangeLength), batchSize);
+            default:
+                LOGGER_LOG_ERROR("Unknown trace operation {}", opType);
+                return 0.0;
+        }
+    }
+    else
+    {
+        switch (opType)
+        {
+            case TRACE_OPERATION_INSERT:
+                return cIndex->insertEntries(batchSize);
+            case TRACE_OPERATION_BULKLOAD:
+                return cIndex->bulkloadEntries(batchSize);
+            case TRACE_OPERATION_DELETE:
+                return cIndex->deleteEntries(batchSize);
+            case TRACE_OPERATION_PSEARCH:
+                return cIndex->findPointEntries(columnsToSearch, batchSize);
+            case TRACE_OPERATION_RSEARCH:
+                return cIndex->findRangeEntries(columnsToSearch, static_cast<size_t>(rangeLength), batchSize);
+            default:
+                LOGGER_LOG_ERROR("Unknown trace operation {}", opType);
+                return 0.0;
+        }
+    }
+}
+
+double WorkloadStepTrace::executeStep() noexcept(true)
+{
+    if ((isColumnIndexMode == false && rIndex == nullptr) || (isColumnIndexMode == true && cIndex == nullptr))
+    {
+        LOGGER_LOG_ERROR("Index is not set (nullptr)");
+        return 0.0;
+    }
+
+    numBatches = 0;
+    numRecordsReplayed = 0;
+
+    const int fd = open(tracePath.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        LOGGER_LOG_ERROR("Cannot open trace file {}", tracePath);
+        return 0.0;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(TraceHeader))
+    {
+        LOGGER_LOG_ERROR("Trace file {} is too small to contain header", tracePath);
+        close(fd);
+        return 0.0;
+    }
+
+    const size_t fileSize = static_cast<size_t>(st.st_size);
+    void* const mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        LOGGER_LOG_ERROR("Cannot mmap trace file {}", tracePath);
+        return 0.0;
+    }
+
+    madvise(mapping, fileSize, MADV_SEQUENTIAL);
+
+    const char* const base = static_cast<const char*>(mapping);
+    const TraceHeader* const header = reinterpret_cast<const TraceHeader*>(base);
+    if (header->magic != traceMagic)
+    {
+        LOGGER_LOG_ERROR("Trace file {} has wrong magic {}", tracePath, header->magic);
+        munmap(mapping, fileSize);
+        return 0.0;
+    }
+
+    const size_t recordsInFile = (fileSize - sizeof(TraceHeader)) / sizeof(TraceRecord);
+    size_t numRecords = static_cast<size_t>(header->numRecords);
+    if (numRecords > recordsInFile)
+    {
+        LOGGER_LOG_WARN("Trace file {} is truncated, header says {} records, file has {}", tracePath, numRecords, recordsInFile);
+        numRecords = recordsInFile;
+    }
+
+    const TraceRecord* const records = reinterpret_cast<const TraceRecord*>(base + sizeof(TraceHeader));
+
+    prepareStep();
+
+    double time = 0.0;
+    size_t released = 0;
+    size_t i = 0;
+    while (i < numRecords)
+    {
+        const uint8_t opType = records[i].opType;
+        const uint32_t rangeLength = records[i].rangeLength;
+
+        // bulkload is batched into 1 call with sum of entries, other operations are counted
+        size_t batchSize = opType == TRACE_OPERATION_BULKLOAD ? rangeLength : 1;
+        size_t j = i + 1;
+        while (j < numRecords && records[j].opType == opType && (maxBatchSize == 0 || j - i < maxBatchSize))
+        {
+            if (opType == TRACE_OPERATION_RSEARCH && records[j].rangeLength != rangeLength)
+                break;
+
+            batchSize += opType == TRACE_OPERATION_BULKLOAD ? records[j].rangeLength : 1;
+            ++j;
+        }
+
+        time += executeBatch(opType, rangeLength, batchSize);
+        numRecordsReplayed += j - i;
+        i = j;
+
+        // replayed records will never be touched again, so let kernel drop them
+        const size_t consumed = sizeof(TraceHeader) + i * sizeof(TraceRecord);
+        if (consumed - released >= traceReleaseWindow)
+        {
+            const size_t toRelease = ((consumed - released) / traceReleaseWindow) * traceReleaseWindow;
+            madvise(const_cast<char*>(base) + released, toRelease, MADV_DONTNEED);
+            released += toRelease;
+        }
+    }
+
+    finishStep();
+
+    munmap(mapping, fileSize);
+
+    LOGGER_LOG_TRACE("Trace {} replayed: records={}, batches={}, time={}", tracePath, numRecordsReplayed, numBatches, time);
+
+    return time;
+}
+
+size_t WorkloadStepTrace::convertCsvToTrace(const std::string& csvPath, const std::string& tracePath) noexcept(true)
+{
+    std::ifstream csv(csvPath);
+    if (!csv.is_open())
+    {
+        LOGGER_LOG_ERROR("Cannot open CSV trace {}", csvPath);
+        return 0;
+    }
+
+    std::ofstream trace(tracePath, std::ios::binary | std::ios::trunc);
+    if (!trace.is_open())
+    {
+        LOGGER_LOG_ERROR("Cannot create trace file {}", tracePath);
+        return 0;
+    }
+
+    // header is rewritten at the end when number of records is known
+    TraceHeader header{traceMagic, 0};
+    trace.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    auto parseOperation = [](const std::string& op) -> uint8_t
+    {
+        if (op == "INSERT" || op == "insert" || op == "I")
+            return TRACE_OPERATION_INSERT;
+        if (op == "BULKLOAD" || op == "bulkload" || op == "B")
+            return TRACE_OPERATION_BULKLOAD;
+        if (op == "DELETE" || op == "delete" || op == "D")
+            return TRACE_OPERATION_DELETE;
+        if (op == "PSEARCH" || op == "psearch" || op == "P")
+            return TRACE_OPERATION_PSEARCH;
+        if (op == "RSEARCH" || op == "rsearch" || op == "R")
+            return TRACE_OPERATION_RSEARCH;
+
+        return TRACE_OPERATION_MAX_ITERATOR;
+    };
+
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(csv, line))
+    {
+        ++lineNumber;
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::istringstream lineStream(line);
+        std::string op;
+        std::string key;
+        std::string rangeLength;
+        std::string timestamp;
+
+        std::getline(lineStream, op, ',');
+        std::getline(lineStream, key, ',');
+        std::getline(lineStream, rangeLength, ',');
+        std::getline(lineStream, timestamp, ',');
+
+        TraceRecord record;
+        std::memset(&record, 0, sizeof(record));
+
+        record.opType = parseOperation(op);
+        if (record.opType == TRACE_OPERATION_MAX_ITERATOR)
+        {
+            LOGGER_LOG_WARN("Skipping line {} of {}, unknown operation {}", lineNumber, csvPath, op);
+            continue;
+        }
+
+        try
+        {
+            record.key = key.empty() ? 0 : std::stoull(key);
+            record.rangeLength = rangeLength.empty() ? 0 : static_cast<uint32_t>(std::stoul(rangeLength));
+            record.timestamp = timestamp.empty() ? 0 : std::stoull(timestamp);
+        }
+        catch (const std::exception&)
+        {
+            LOGGER_LOG_WARN("Skipping line {} of {}, cannot parse numbers", lineNumber, csvPath);
+            continue;
+        }
+
+        trace.write(reinterpret_cast<const char*>(&record), sizeof(record));
+        ++header.numRecords;
+    }
+
+    trace.seekp(0);
+    trace.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    LOGGER_LOG_DEBUG("CSV trace {} converted into {}, records={}", csvPath, tracePath, header.numRecords);
+
+    return static_cast<size_t>(header.numRecords);
+}
+
+std::string WorkloadStepTrace::toString(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("WorkloadStepTrace {") +
+                           std::string(" .tracePath = ") + tracePath +
+                           std::string(" .maxBatchSize = ") + std::to_string(maxBatchSize) +
+                           std::string(" .numBatches = ") + std::to_string(numBatches) +
+                           std::string(" .numRecordsReplayed = ") + std::to_string(numRecordsReplayed) +
+                           std::string(" .step = ") + WorkloadStep::toString() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("WorkloadStepTrace {\n") +
+                           std::string("\t.tracePath = ") + tracePath + std::string("\n") +
+                           std::string("\t.maxBatchSize = ") + std::to_string(maxBatchSize) + std::string("\n") +
+                           std::string("\t.numBatches = ") + std::to_string(numBatches) + std::string("\n") +
+                           std::string("\t.numRecordsReplayed = ") + std::to_string(numRecordsReplayed) + std::string("\n") +
+                           std::string("\t.step = ") + WorkloadStep::toString() + std::string("\n") +
+                           std::string("}"));
+}
+
+std::string WorkloadStepTrace::toStringFull(bool oneLine) const noexcept(true)
+{
+    if (oneLine)
+        return std::string(std::string("WorkloadStepTrace {") +
+                           std::string(" .tracePath = ") + tracePath +
+                           std::string(" .maxBatchSize = ") + std::to_string(maxBatchSize) +
+                           std::string(" .numBatches = ") + std::to_string(numBatches) +
+                           std::string(" .numRecordsReplayed = ") + std::to_string(numRecordsReplayed) +
+                           std::string(" .step = ") + WorkloadStep::toStringFull() +
+                           std::string(" }"));
+    else
+        return std::string(std::string("WorkloadStepTrace {\n") +
+                           std::string("\t.tracePath = ") + tracePath + std::string("\n") +
+                           std::string("\t.maxBatchSize = ") + std::to_string(maxBatchSize) + std::string("\n") +
+                           std::string("\t.numBatches = ") + std::to_string(numBatches) + std::string("\n") +
+                           std::string("\t.numRecordsReplayed = ") + std::to_string(numRecordsReplayed) + std::string("\n") +
+                           std::string("\t.step = ") + WorkloadStep::toStringFull() + std::string("\n") +
+                           std::string("}"));
+}
@@ -1537,4 +1537,133 @@ GTEST_TEST(adaptiveMerging, singleBigDeletePCM)
     EXPECT_EQ(dynamic_cast<const AdaptiveMerging::AMPartitionManager&>(dynamic_cast<AdaptiveMerging*>(am)->getMemoryManager()).getPartitionsRef().size(), numPartitions);
 
     delete am;
-}
\ No newline at end of file
+}
+
+GTEST_TEST(adaptiveMerging, parallelLoadingSSD)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+
+    const size_t startingEntries = 1000000;
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize();
+    const size_t partitionSize = disk->getLowLevelController().getBlockSize();
+    const size_t numOperations = 10000;
+    const size_t streams = 4;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    AdaptiveMerging* am = new AdaptiveMerging(index, startingEntries, partitionSize);
+    AdaptiveMerging* amParallel = dynamic_cast<AdaptiveMerging*>(am->clone());
+
+    EXPECT_EQ(am->getLoadingStreams(), 1);
+
+    amParallel->setLoadingStreams(streams);
+    EXPECT_EQ(amParallel->getLoadingStreams(), streams);
+    EXPECT_EQ(dynamic_cast<const AdaptiveMerging::AMPartitionManager&>(amParallel->getMemoryManager()).getLoadingStreams(), streams);
+
+    const double time = am->findRangeEntries(numOperations);
+    const double timeParallel = amParallel->findRangeEntries(numOperations);
+
+    EXPECT_GT(timeParallel, 0.0);
+    EXPECT_LT(timeParallel, time);
+    EXPECT_LT(amParallel->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_TOTAL_TIME).second, am->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_TOTAL_TIME).second);
+
+    EXPECT_EQ(amParallel->getNumEntries(), am->getNumEntries());
+    EXPECT_EQ(amParallel->getMemoryManager().getNumEntries(), am->getMemoryManager().getNumEntries());
+    EXPECT_EQ(amParallel->getMemoryManager().getNumEntries(), startingEntries - numOperations);
+
+    amParallel->setLoadingStreams(0);
+    EXPECT_EQ(amParallel->getLoadingStreams(), 1);
+
+    delete amParallel;
+    delete am;
+}
+
+GTEST_TEST(adaptiveMerging, backgroundInvalidationSSD)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+
+    const size_t startingEntries = 1000000;
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize();
+    const size_t partitionSize = disk->getLowLevelController().getBlockSize();
+    const size_t numOperations = 10000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    AdaptiveMerging* am = new AdaptiveMerging(index, startingEntries, partitionSize);
+    AdaptiveMerging* amBackground = dynamic_cast<AdaptiveMerging*>(am->clone());
+
+    amBackground->setBackgroundInvalidation(true);
+    EXPECT_FALSE(am->getMemoryManager().isBackgroundInvalidation());
+    EXPECT_TRUE(amBackground->getMemoryManager().isBackgroundInvalidation());
+
+    const double time = am->findRangeEntries(numOperations);
+    const double timeBackground = amBackground->findRangeEntries(numOperations);
+
+    // query pays only for loading, invalidation is moved to background job
+    const double invalidationTime = amBackground->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_INVALIDATION_TOTAL_TIME).second;
+    EXPECT_GT(invalidationTime, 0.0);
+    EXPECT_DOUBLE_EQ(invalidationTime, am->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_INVALIDATION_TOTAL_TIME).second);
+    EXPECT_NEAR(timeBackground, time - invalidationTime, 1e-9);
+
+    EXPECT_DOUBLE_EQ(am->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second, 0.0);
+    EXPECT_EQ(am->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS).second, 0L);
+    EXPECT_DOUBLE_EQ(amBackground->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second, invalidationTime);
+    EXPECT_EQ(amBackground->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS).second, amBackground->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_INVALIDATION_TOTAL_OPERATIONS).second);
+    EXPECT_NEAR(amBackground->getCounter(IndexCounters::INDEX_COUNTER_RO_TOTAL_TIME).second, am->getCounter(IndexCounters::INDEX_COUNTER_RO_TOTAL_TIME).second - invalidationTime, 1e-9);
+
+    EXPECT_EQ(amBackground->getNumEntries(), am->getNumEntries());
+    EXPECT_EQ(amBackground->getMemoryManager().getNumEntries(), am->getMemoryManager().getNumEntries());
+
+    amBackground->resetCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME);
+    EXPECT_DOUBLE_EQ(amBackground->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second, 0.0);
+
+    delete amBackground;
+    delete am;
+}
+
+class AMPartitionManagerTest : public AdaptiveMerging::AMPartitionManager
+{
+public:
+    AMPartitionManagerTest(size_t numEntries, size_t recordSize, size_t partitionSize, size_t seed)
+    : AdaptiveMerging::AMPartitionManager(numEntries, recordSize, partitionSize, AdaptiveMergingFramework::AMUnsortedMemoryManager::AM_UNSORTED_MEMORY_INVALIDATION_FLAG)
+    {
+        rng.seed(seed);
+    }
+
+    using AdaptiveMerging::AMPartitionManager::takeEntriesFromPartitions;
+};
+
+GTEST_TEST(adaptiveMerging, takeEntriesFromSmallPartition)
+{
+    const size_t recordSize = 72;
+    const size_t entriesInPartition = 100;
+    const size_t partitionSize = recordSize * entriesInPartition;
+
+    // partitions {100, 1}, second round of taking must skip partition which already gave all entries, whatever the order
+    for (size_t seed = 0; seed < 16; ++seed)
+    {
+        AMPartitionManagerTest manager(entriesInPartition + 1, recordSize, partitionSize, seed);
+        ASSERT_EQ(manager.getPartitionsRef().size(), 2);
+        EXPECT_EQ(manager.getPartitionsRef()[1].getNumEntries(), 1);
+
+        const std::vector<size_t> toLoad = manager.takeEntriesFromPartitions(entriesInPartition + 1);
+        EXPECT_EQ(toLoad[0], entriesInPartition);
+        EXPECT_EQ(toLoad[1], 1);
+        EXPECT_EQ(manager.getPartitionsRef()[0].getNumEntries(), 0);
+        EXPECT_EQ(manager.getPartitionsRef()[1].getNumEntries(), 0);
+
+        AMPartitionManagerTest partial(entriesInPartition + 1, recordSize, partitionSize, seed);
+        const std::vector<size_t> partialLoad = partial.takeEntriesFromPartitions(60);
+        EXPECT_EQ(partialLoad[0] + partialLoad[1], 60);
+        EXPECT_LE(partialLoad[1], 1);
+        EXPECT_EQ(partial.getPartitionsRef()[0].getNumEntries() + partial.getPartitionsRef()[1].getNumEntries(), entriesInPartition + 1 - 60);
+
+        // cannot take more than partitions have
+        const std::vector<size_t> restLoad = partial.takeEntriesFromPartitions(1000);
+        EXPECT_EQ(restLoad[0] + restLoad[1], entriesInPartition + 1 - 60);
+        EXPECT_EQ(partial.getPartitionsRef()[0].getNumEntries(), 0);
+        EXPECT_EQ(partial.getPartitionsRef()[1].getNumEntries(), 0);
+    }
+}
@@ -12,6 +12,8 @@
 #include <index/bptree.hpp>
 #include <string>
 #include <iostream>
+#include <fstream>
+#include <cstdio>
 
 #include <gtest/gtest.h>
 
@@ -179,6 +181,60 @@ GTEST_TEST(analyzerFileTest, move)
     delete index2;
 }
 
+GTEST_TEST(analyzerFileTest, subscribe)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    Disk* disk2 = new DiskSSD_Samsung840();
+
+    BPTree* bp = new BPTree(disk, 8, 64, 1 << 14, true);
+    DBIndex* index = bp;
+
+    PhantomIndex* ph = new PhantomIndex(disk2, true);
+    DBIndex* index2 = ph;
+
+    std::vector<WorkloadStep*> steps;
+    std::vector<DBIndex*> indexes;
+
+    indexes.push_back(index);
+    indexes.push_back(index2);
+
+    steps.push_back(new WorkloadStepInsert(100));
+    steps.push_back(new WorkloadStepBulkload(200));
+    steps.push_back(new WorkloadStepDelete(200));
+    steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(100)));
+    steps.push_back(new WorkloadStepRSearch(static_cast<size_t>(10), 100));
+
+    Workload w(indexes, steps);
+    w.setKeepStepCounters(false);
+
+    EXPECT_FALSE(w.isKeepingStepCounters());
+
+    // steps aggregate counters during run, so workload does not need to keep step counters
+    WorkloadAnalyzer* a = new WorkloadAnalyzerFile("./analyzerFileTest_subscribe", std::vector<WorkloadAnalyzerStep*>{new WorkloadAnalyzerStepQueryTime(), new WorkloadAnalyzerStepTotalTime()});
+    a->subscribe(w);
+
+    w.run();
+
+    EXPECT_EQ(w.getAllStepCounters().size(), 0);
+    EXPECT_EQ(w.getAllTotalCounters().size(), 2);
+
+    a->runAnalyze(w);
+
+    std::ifstream file("./analyzerFileTest_subscribeQueryTime.txt");
+    const std::string result((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    EXPECT_EQ(result, std::string("Type\tB+Tree\tPhantomIndex\n1\t0.053520\t0.000000\n2\t0.000420\t0.000000\n3\t0.058206\t0.000000\n4\t0.004200\t0.000000\n5\t0.008400\t0.000000\n"));
+
+    std::remove("./analyzerFileTest_subscribeQueryTime.txt");
+    std::remove("./analyzerFileTest_subscribeTotalTime.txt");
+
+    delete a;
+
+    delete index;
+    delete index2;
+}
+
 GTEST_TEST(analyzerFileExtTest, interface)
 {
     Disk* disk = new DiskSSD_Samsung840();
@@ -107,6 +107,120 @@ GTEST_TEST(analyzerStepQueryTimeTestRaw, analyze)
     delete index2;
 }
 
+GTEST_TEST(analyzerStepQueryTimeTestRaw, analyzeOnline)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    Disk* disk2 = new DiskSSD_Samsung840();
+
+    BPTree* bp = new BPTree(disk, 8, 64, 1 << 14, true);
+    DBIndex* index = bp;
+
+    PhantomIndex* ph = new PhantomIndex(disk2, true);
+    DBIndex* index2 = ph;
+
+    std::vector<WorkloadStep*> steps;
+    std::vector<DBIndex*> indexes;
+
+    indexes.push_back(index);
+
+    steps.push_back(new WorkloadStepInsert(100));
+    steps.push_back(new WorkloadStepBulkload(200));
+    steps.push_back(new WorkloadStepDelete(200));
+    steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(100)));
+
+    Workload w(indexes, steps);
+
+    w.addIndex(index2);
+    indexes.push_back(index2);
+
+    WorkloadStep* step = new WorkloadStepRSearch(static_cast<size_t>(10), 100);
+    w.addStep(step);
+    steps.push_back(step);
+
+    EXPECT_EQ(w.getNumIndexes(), 2);
+    EXPECT_EQ(w.getNumSteps(), 5);
+
+    EXPECT_EQ(w.getAllTotalCounters().size(), 0);
+    EXPECT_EQ(w.getAllStepCounters().size(), 0);
+
+    WorkloadAnalyzerStepQueryTime analyzer;
+    w.addSink(&analyzer);
+    w.setKeepStepCounters(false);
+
+    w.run();
+
+    EXPECT_EQ(w.getAllStepCounters().size(), 0);
+    EXPECT_EQ(analyzer.getSeries().size(), 2);
+    EXPECT_EQ(analyzer.getSeries()[0].getNumValues(), 5);
+    EXPECT_EQ(analyzer.getSeries()[0].getBucketSize(), 1);
+    EXPECT_EQ(analyzer.analyzeWorkloadCounters(w), std::string("Type\tB+Tree\tPhantomIndex\n1\t0.053520\t0.000000\n2\t0.000420\t0.000000\n3\t0.058206\t0.000000\n4\t0.004200\t0.000000\n5\t0.008400\t0.000000\n"));
+
+    delete index;
+    delete index2;
+}
+
+GTEST_TEST(analyzerStepQueryTimeTestRaw, analyzeOnlineDownsampled)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    Disk* disk2 = new DiskSSD_Samsung840();
+
+    BPTree* bp = new BPTree(disk, 8, 64, 1 << 14, true);
+    DBIndex* index = bp;
+
+    PhantomIndex* ph = new PhantomIndex(disk2, true);
+    DBIndex* index2 = ph;
+
+    std::vector<WorkloadStep*> steps;
+    std::vector<DBIndex*> indexes;
+
+    indexes.push_back(index);
+
+    steps.push_back(new WorkloadStepInsert(100));
+    steps.push_back(new WorkloadStepBulkload(200));
+    steps.push_back(new WorkloadStepDelete(200));
+    steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(100)));
+
+    Workload w(indexes, steps);
+
+    w.addIndex(index2);
+    indexes.push_back(index2);
+
+    WorkloadStep* step = new WorkloadStepRSearch(static_cast<size_t>(10), 100);
+    w.addStep(step);
+    steps.push_back(step);
+
+    EXPECT_EQ(w.getNumIndexes(), 2);
+    EXPECT_EQ(w.getNumSteps(), 5);
+
+    EXPECT_EQ(w.getAllTotalCounters().size(), 0);
+    EXPECT_EQ(w.getAllStepCounters().size(), 0);
+
+    WorkloadAnalyzerStepQueryTime analyzer(2);
+    w.addSink(&analyzer);
+
+    w.run();
+
+    // 4 steps are merged into 1 point, the last step is in not full bucket
+    EXPECT_EQ(analyzer.getSeries().size(), 2);
+    EXPECT_EQ(analyzer.getSeries()[0].getBucketSize(), 4);
+    EXPECT_EQ(analyzer.getSeries()[0].getNumPoints(), 2);
+
+    double sum = 0.0;
+    for (size_t i = 0; i < 4; ++i)
+        sum += w.getStepCounters(0, i).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME);
+
+    EXPECT_DOUBLE_EQ(analyzer.getSeries()[0].getPoints()[0], sum / 4.0);
+    EXPECT_DOUBLE_EQ(analyzer.getSeries()[0].getPoints()[1], w.getStepCounters(0, 4).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME));
+    EXPECT_DOUBLE_EQ(analyzer.getSeries()[0].getSum(), w.getTotalCounters(0).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME));
+
+    const std::string result = analyzer.analyzeWorkloadCounters(w);
+    EXPECT_EQ(result.substr(0, result.find('\n') + 3), std::string("Type\tB+Tree\tPhantomIndex\n1\t"));
+    EXPECT_NE(result.find(std::string("\n5\t0.008400\t0.000000\n")), std::string::npos);
+
+    delete index;
+    delete index2;
+}
+
 GTEST_TEST(analyzerStepQueryTimeTestColumn, interface)
 {
     Disk* disk = new DiskSSD_Samsung840();
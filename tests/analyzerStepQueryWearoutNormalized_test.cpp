@@ -107,6 +107,58 @@ GTEST_TEST(analyzerStepQueryWearoutNormalizedTestRaw, analyze)
     delete index2;
 }
 
+GTEST_TEST(analyzerStepQueryWearoutNormalizedTestRaw, analyzeOnline)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    Disk* disk2 = new DiskSSD_Samsung840();
+
+    BPTree* bp = new BPTree(disk, 8, 64, 1 << 14, true);
+    DBIndex* index = bp;
+
+    PhantomIndex* ph = new PhantomIndex(disk2, true);
+    DBIndex* index2 = ph;
+
+    std::vector<WorkloadStep*> steps;
+    std::vector<DBIndex*> indexes;
+
+    indexes.push_back(index);
+
+    steps.push_back(new WorkloadStepInsert(100));
+    steps.push_back(new WorkloadStepBulkload(200));
+    steps.push_back(new WorkloadStepDelete(200));
+    steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(100)));
+
+    Workload w(indexes, steps);
+
+    w.addIndex(index2);
+    indexes.push_back(index2);
+
+    WorkloadStep* step = new WorkloadStepRSearch(static_cast<size_t>(10), 100);
+    w.addStep(step);
+    steps.push_back(step);
+
+    EXPECT_EQ(w.getNumIndexes(), 2);
+    EXPECT_EQ(w.getNumSteps(), 5);
+
+    EXPECT_EQ(w.getAllTotalCounters().size(), 0);
+    EXPECT_EQ(w.getAllStepCounters().size(), 0);
+
+    WorkloadAnalyzerStepQueryWearoutNormalized analyzer;
+    w.addSink(&analyzer);
+    w.setKeepStepCounters(false);
+
+    w.run();
+
+    EXPECT_EQ(w.getAllStepCounters().size(), 0);
+    EXPECT_EQ(analyzer.getSeries().size(), 2);
+    EXPECT_EQ(analyzer.getSeries()[0].getNumValues(), 5);
+    EXPECT_EQ(analyzer.getSeries()[0].getBucketSize(), 1);
+    EXPECT_EQ(analyzer.analyzeWorkloadCounters(w), std::string("Type\tB+Tree\tPhantomIndex\n1\t1.000000\t0.000000\n2\t1.000000\t0.000000\n3\t1.000000\t0.000000\n4\t0.000000\t0.000000\n5\t0.000000\t0.000000\n"));
+
+    delete index;
+    delete index2;
+}
+
 GTEST_TEST(analyzerStepQueryWearoutNormalizedTestColumn, interface)
 {
     Disk* disk = new DiskSSD_Samsung840();
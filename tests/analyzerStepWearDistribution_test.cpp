@@ -0,0 +1,144 @@
+#include <workload/analyzer/analyzerStepWearDistribution.hpp>
+#include <workload/workload.hpp>
+#include <workload/workloadStep.hpp>
+#include <workload/workloadStepInsert.hpp>
+#include <workload/workloadStepBulkload.hpp>
+#include <workload/workloadStepDelete.hpp>
+#include <workload/workloadStepPSearch.hpp>
+#include <workload/workloadStepRSearch.hpp>
+#include <disk/diskSSD.hpp>
+#include <disk/diskPCM.hpp>
+#include <index/phantomIndex.hpp>
+#include <index/bptree.hpp>
+#include <index/dbIndexRawToColumnWrapper.hpp>
+#include <index/dsm.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(analyzerStepWearDistributionTestRaw, interface)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    Disk* disk2 = new DiskSSD_Samsung840();
+    disk2->enableWearTracking(64 * 1024 * 1024);
+
+    PhantomIndex* ph = new PhantomIndex(disk, true);
+    DBIndex* index = ph;
+
+    BPTree* bp = new BPTree(disk2, 8, 64, 1 << 14, true);
+    DBIndex* index2 = bp;
+
+    std::vector<WorkloadStep*> steps;
+    std::vector<DBIndex*> indexes;
+
+    indexes.push_back(index);
+    indexes.push_back(index2);
+
+    steps.push_back(new WorkloadStepInsert(100));
+    steps.push_back(new WorkloadStepBulkload(200));
+    steps.push_back(new WorkloadStepDelete(200));
+    steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(100)));
+    steps.push_back(new WorkloadStepRSearch(static_cast<size_t>(10), 100));
+
+    Workload w(indexes, steps);
+
+    WorkloadAnalyzerStepWearDistribution analyzer;
+    EXPECT_EQ(analyzer.getName(), std::string("WearDistribution"));
+    EXPECT_EQ(analyzer.getEndurance(), 100000);
+    EXPECT_EQ(analyzer.analyzeWorkloadCounters(w), std::string(""));
+
+    w.run();
+
+    EXPECT_NE(analyzer.analyzeWorkloadCounters(w), std::string(""));
+
+    WorkloadAnalyzerStepWearDistribution pcmAnalyzer(100000000);
+    EXPECT_EQ(pcmAnalyzer.getEndurance(), 100000000);
+
+    delete index;
+    delete index2;
+}
+
+GTEST_TEST(analyzerStepWearDistributionTestRaw, analyze)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    Disk* disk2 = new DiskPCM_DefaultModel();
+    disk2->enableWearTracking(64 * 1024 * 1024);
+
+    PhantomIndex* ph = new PhantomIndex(disk, true);
+    DBIndex* index = ph;
+
+    BPTree* bp = new BPTree(disk2, 8, 64, 1 << 14, true);
+    DBIndex* index2 = bp;
+
+    std::vector<WorkloadStep*> steps;
+    std::vector<DBIndex*> indexes;
+
+    indexes.push_back(index);
+    indexes.push_back(index2);
+
+    steps.push_back(new WorkloadStepInsert(100));
+    steps.push_back(new WorkloadStepBulkload(200));
+    steps.push_back(new WorkloadStepDelete(200));
+    steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(100)));
+
+    Workload w(indexes, steps);
+    w.run();
+
+    WorkloadAnalyzerStepWearDistribution analyzer;
+    const std::string result = analyzer.analyzeWorkloadCounters(w);
+
+    // device without wear tracking has empty row
+    EXPECT_EQ(result.find("Type\tMinWear\tMaxWear\tMeanWear\tStdDevWear\tGini\tLifetime\n"), 0);
+    EXPECT_NE(result.find("PhantomIndex\t0\t0\t0.000000\t0.000000\t0.000000\tinf\n"), std::string::npos);
+
+    const WearTracker& tracker = index2->getDisk().getLowLevelController().getMemoryModel().getWearTracker();
+    EXPECT_GT(tracker.getMaxWear(), 0);
+    EXPECT_GT(tracker.getGiniWear(), 0.0);
+
+    const double time = w.getAllTotalCounters()[1].getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME);
+    EXPECT_NE(result.find(std::string("B+Tree\t") + std::to_string(tracker.getMinWear()) + std::string("\t") + std::to_string(tracker.getMaxWear()) + std::string("\t")), std::string::npos);
+    EXPECT_NE(result.find(std::to_string(tracker.estimateLifetime(100000, time)) + std::string("\n")), std::string::npos);
+
+    delete index;
+    delete index2;
+}
+
+GTEST_TEST(analyzerStepWearDistributionTestColumn, analyze)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    Disk* disk2 = new DiskSSD_Samsung840();
+    disk->enableWearTracking(64 * 1024 * 1024);
+
+    DSM* dsm = new DSM(disk, std::vector<size_t>{8, 16, 32, 4, 4, 8});
+    DBIndexColumn* index = dsm;
+    index->insertEntries(1000);
+
+    PhantomIndex* ph = new PhantomIndex(disk2, true);
+    DBIndexColumn* index2 = new DBIndexRawToColumnWrapper(ph, std::vector<size_t>{8, 16, 32, 4, 4, 8});
+    index2->insertEntries(1000);
+
+    std::vector<WorkloadStep*> steps;
+    std::vector<DBIndexColumn*> indexes;
+
+    indexes.push_back(index);
+    indexes.push_back(index2);
+
+    steps.push_back(new WorkloadStepInsert(100));
+    steps.push_back(new WorkloadStepBulkload(200));
+    steps.push_back(new WorkloadStepDelete(200));
+    steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(100), std::vector<size_t>{0, 2, 3, 4}));
+
+    Workload w(indexes, steps);
+    w.run();
+
+    WorkloadAnalyzerStepWearDistribution analyzer;
+    const std::string result = analyzer.analyzeWorkloadCounters(w);
+
+    EXPECT_EQ(result.find("Type\tMinWear\tMaxWear\tMeanWear\tStdDevWear\tGini\tLifetime\n"), 0);
+    EXPECT_NE(result.find("DSM\t"), std::string::npos);
+    EXPECT_NE(result.find("PhantomIndex\t0\t0\t0.000000\t0.000000\t0.000000\tinf\n"), std::string::npos);
+
+    delete index;
+    delete index2;
+}
\ No newline at end of file
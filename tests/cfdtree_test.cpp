@@ -820,4 +820,74 @@ GTEST_TEST(cfdtreeBasicTest, bigFindRangeBatch)
     EXPECT_DOUBLE_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_TIME).second, 0.0020790000000000001);
 
     delete index;
+}
+
+GTEST_TEST(cfdtreeBasicTest, concurrentColumns)
+{
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t numColumns = columns.size();
+    const size_t numBatches = 20;
+    const size_t batchSize = 5000;
+
+    CFDTree* sequential = new CFDTree(new DiskSSD_Samsung840(), columns);
+    CFDTree* concurrent = new CFDTree(new DiskSSD_Samsung840(), columns);
+    CFDTree* limited = new CFDTree(new DiskSSD_Samsung840(), columns);
+
+    concurrent->setColumnsParallelism(0);
+    limited->setColumnsParallelism(2);
+
+    double sumConcurrentTime = 0.0;
+    for (size_t i = 0; i < numBatches; ++i)
+    {
+        const double sequentialTime = sequential->insertEntries(batchSize);
+        const double concurrentTime = concurrent->insertEntries(batchSize);
+        const double limitedTime = limited->insertEntries(batchSize);
+        sumConcurrentTime += concurrentTime;
+
+        // the longest column is the critical path
+        EXPECT_LE(concurrentTime, limitedTime);
+        EXPECT_LE(limitedTime, sequentialTime);
+        EXPECT_GE(concurrentTime * numColumns, sequentialTime);
+        EXPECT_GE(limitedTime * 2, sequentialTime);
+
+        EXPECT_DOUBLE_EQ(concurrent->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, sumConcurrentTime);
+        EXPECT_EQ(concurrent->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS).second, (i + 1) * batchSize);
+    }
+
+    EXPECT_GT(sequential->getHeight(), 1);
+    EXPECT_LT(concurrent->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, sequential->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second);
+
+    // columns are maintained by different threads, but I/O is the same
+    EXPECT_EQ(concurrent->getHeight(), sequential->getHeight());
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES; id < MemoryCounters::MEMORY_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(concurrent->getDisk().getDiskCounter(id).second, sequential->getDisk().getDiskCounter(id).second);
+
+    for (size_t lvl = 0; lvl <= sequential->getHeight(); ++lvl)
+        for (size_t j = 0; j < numColumns; ++j)
+            EXPECT_EQ(concurrent->getCFDLvl(lvl, j).getNumEntries(), sequential->getCFDLvl(lvl, j).getNumEntries());
+
+    const std::vector<size_t> columnsToFetch {3, 0, 2};
+    const double sequentialFindTime = sequential->findRangeEntries(columnsToFetch, 0.1);
+    const double concurrentFindTime = concurrent->findRangeEntries(columnsToFetch, 0.1);
+    EXPECT_GT(concurrentFindTime, 0.0);
+    EXPECT_LT(concurrentFindTime, sequentialFindTime);
+    EXPECT_GE(concurrentFindTime * columnsToFetch.size(), sequentialFindTime);
+
+    // operations are counted by key column, concurrent execution hides only time
+    const double sequentialDeleteTime = sequential->deleteEntries(batchSize);
+    const double concurrentDeleteTime = concurrent->deleteEntries(batchSize);
+    EXPECT_LT(concurrentDeleteTime, sequentialDeleteTime);
+    EXPECT_EQ(concurrent->getCounter(IndexCounters::INDEX_COUNTER_RW_DELETE_TOTAL_OPERATIONS).second, sequential->getCounter(IndexCounters::INDEX_COUNTER_RW_DELETE_TOTAL_OPERATIONS).second);
+    EXPECT_DOUBLE_EQ(concurrent->getCounter(IndexCounters::INDEX_COUNTER_RW_DELETE_TOTAL_TIME).second, concurrentDeleteTime);
+
+    // bulkload is unsupported
+    const size_t entriesBefore = concurrent->getNumEntries();
+    EXPECT_FALSE(concurrent->isBulkloadSupported());
+    EXPECT_DOUBLE_EQ(concurrent->bulkloadEntries(batchSize), 0.0);
+    EXPECT_EQ(concurrent->getNumEntries(), entriesBefore);
+    EXPECT_DOUBLE_EQ(concurrent->getCounter(IndexCounters::INDEX_COUNTER_RW_BULKLOAD_TOTAL_TIME).second, 0.0);
+
+    delete sequential;
+    delete concurrent;
+    delete limited;
 }
\ No newline at end of file
@@ -0,0 +1,275 @@
+#include <advisor/columnGroupAdvisor.hpp>
+#include <index/bptree.hpp>
+#include <index/dbIndexRawToColumnWrapper.hpp>
+#include <index/dsm.hpp>
+#include <disk/diskSSD.hpp>
+#include <table/dbTableTPCC.hpp>
+#include <workload/workloadStepInsert.hpp>
+#include <workload/workloadStepPSearch.hpp>
+#include <workload/workloadStepRSearch.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(columnGroupAdvisorBasicTest, interface)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+    DBTable* table = new DBTable_TPCC_Warehouse();
+
+    const size_t numEntries = 100000;
+    WorkloadStep* step = new WorkloadStepPSearch(10UL, std::vector<size_t>{0, 1, 2});
+
+    ColumnGroupAdvisor advisor(*table, ssd, numEntries, std::vector<WorkloadStep*>{step});
+
+    EXPECT_EQ(advisor.getLayoutModel(), ColumnGroupAdvisor::LAYOUT_MODEL_DSM);
+    EXPECT_EQ(advisor.getNumEvaluatedLayouts(), 0);
+    EXPECT_EQ(advisor.getNumIterations(), 0);
+    EXPECT_DOUBLE_EQ(advisor.getBestTime(), 0.0);
+    EXPECT_EQ(advisor.getBestLayout().size(), 0);
+
+    const size_t numColumns = table->getAllColumnSize().size();
+    EXPECT_EQ(ColumnGroupAdvisor::getNSMLayout(numColumns).size(), 1);
+    EXPECT_EQ(ColumnGroupAdvisor::getNSMLayout(numColumns)[0].size(), numColumns);
+    EXPECT_EQ(ColumnGroupAdvisor::getDSMLayout(numColumns).size(), numColumns);
+    for (size_t i = 0; i < numColumns; ++i)
+        EXPECT_EQ(ColumnGroupAdvisor::getDSMLayout(numColumns)[i], std::vector<size_t>{i});
+
+    delete step;
+    delete table;
+    delete ssd;
+}
+
+GTEST_TEST(columnGroupAdvisorBasicTest, evaluateLayout)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+    const std::vector<size_t> columns = {8, 16, 32, 4};
+    DBTable table("table", columns);
+
+    const size_t numEntries = 100000;
+    WorkloadStep* psearch = new WorkloadStepPSearch(10UL, std::vector<size_t>{0, 2});
+    WorkloadStep* rsearch = new WorkloadStepRSearch(1000UL, std::vector<size_t>{0, 3}, 5);
+    WorkloadStep* insert = new WorkloadStepInsert(100);
+
+    ColumnGroupAdvisor advisor(table, ssd, numEntries, std::vector<WorkloadStep*>{psearch, insert, rsearch});
+
+    // layout {0,3},{1,2} is DSM with 2 wide columns
+    DSM* dsm = new DSM(ssd->clone(), std::vector<size_t>{8 + 4, 16 + 32});
+    dsm->createTopologyAfterInsert(numEntries);
+
+    double expectedTime = 0.0;
+    expectedTime += dsm->findPointEntries(std::vector<size_t>{0, 1}, 10UL);
+    expectedTime += dsm->insertEntries(100);
+    expectedTime += dsm->findRangeEntries(std::vector<size_t>{0}, 1000UL, 5UL);
+
+    EXPECT_DOUBLE_EQ(advisor.evaluateLayout(ColumnGroupAdvisor::ColumnGroups{{2, 1}, {3, 0}}), expectedTime);
+    EXPECT_EQ(advisor.getNumEvaluatedLayouts(), 1);
+
+    // the same layout is taken from cache
+    EXPECT_DOUBLE_EQ(advisor.evaluateLayout(ColumnGroupAdvisor::ColumnGroups{{0, 3}, {1, 2}}), expectedTime);
+    EXPECT_EQ(advisor.getNumEvaluatedLayouts(), 1);
+
+    // invalid layouts are not simulated
+    EXPECT_DOUBLE_EQ(advisor.evaluateLayout(ColumnGroupAdvisor::ColumnGroups{{0, 3}, {1}}), 0.0);
+    EXPECT_DOUBLE_EQ(advisor.evaluateLayout(ColumnGroupAdvisor::ColumnGroups{{0, 3}, {1, 2, 3}}), 0.0);
+    EXPECT_DOUBLE_EQ(advisor.evaluateLayout(ColumnGroupAdvisor::ColumnGroups{{0, 3}, {1, 2, 4}}), 0.0);
+    EXPECT_EQ(advisor.getNumEvaluatedLayouts(), 1);
+
+    delete dsm;
+    delete psearch;
+    delete rsearch;
+    delete insert;
+    delete ssd;
+}
+
+GTEST_TEST(columnGroupAdvisorBasicTest, stepWithoutKeyColumn)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+    const std::vector<size_t> columns = {8, 16, 32, 4};
+    DBTable table("table", columns);
+
+    const size_t numEntries = 100000;
+    WorkloadStep* psearch = new WorkloadStepPSearch(10UL, std::vector<size_t>{2});
+    WorkloadStep* rsearch = new WorkloadStepRSearch(1000UL, std::vector<size_t>{3}, 5);
+
+    ColumnGroupAdvisor advisor(table, ssd, numEntries, std::vector<WorkloadStep*>{psearch, rsearch});
+
+    // layout {0,1},{2,3} is DSM with 2 wide columns, key group is searched although steps do not fetch key
+    DSM* dsm = new DSM(ssd->clone(), std::vector<size_t>{8 + 16, 32 + 4});
+    dsm->createTopologyAfterInsert(numEntries);
+
+    double expectedTime = 0.0;
+    expectedTime += dsm->findPointEntries(std::vector<size_t>{0, 1}, 10UL);
+    expectedTime += dsm->findRangeEntries(std::vector<size_t>{0, 1}, 1000UL, 5UL);
+
+    const double time = advisor.evaluateLayout(ColumnGroupAdvisor::ColumnGroups{{0, 1}, {2, 3}});
+    EXPECT_GT(time, 0.0);
+    EXPECT_DOUBLE_EQ(time, expectedTime);
+
+    // splitting fetched columns from key is not free
+    const double dsmTime = advisor.evaluateLayout(ColumnGroupAdvisor::getDSMLayout(columns.size()));
+    EXPECT_GT(dsmTime, 0.0);
+
+    advisor.findBestLayout();
+    EXPECT_GT(advisor.getBestTime(), 0.0);
+
+    delete dsm;
+    delete psearch;
+    delete rsearch;
+    delete ssd;
+}
+
+GTEST_TEST(columnGroupAdvisorBasicTest, pointSearchMergesColumns)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+    DBTable* table = new DBTable_TPCC_Warehouse();
+    const size_t numColumns = table->getAllColumnSize().size();
+
+    const size_t numEntries = 100000;
+    std::vector<size_t> allColumns(numColumns);
+    for (size_t i = 0; i < numColumns; ++i)
+        allColumns[i] = i;
+
+    WorkloadStep* step = new WorkloadStepPSearch(100UL, allColumns);
+
+    ColumnGroupAdvisor advisor(*table, ssd, numEntries, std::vector<WorkloadStep*>{step});
+
+    const double nsmTime = advisor.evaluateLayout(ColumnGroupAdvisor::getNSMLayout(numColumns));
+    const double dsmTime = advisor.evaluateLayout(ColumnGroupAdvisor::getDSMLayout(numColumns));
+
+    // DSM scans key column to find entry, NSM finds whole record by key in row index
+    const ColumnGroupAdvisor::ColumnGroups expectedLayout = ColumnGroupAdvisor::getNSMLayout(numColumns);
+    EXPECT_LT(nsmTime, dsmTime);
+
+    const double bestTime = advisor.findBestLayout();
+    EXPECT_DOUBLE_EQ(bestTime, advisor.getBestTime());
+    EXPECT_DOUBLE_EQ(bestTime, nsmTime);
+    EXPECT_EQ(advisor.getBestLayout(), expectedLayout);
+    EXPECT_GT(advisor.getNumEvaluatedLayouts(), 2);
+
+    delete step;
+    delete table;
+    delete ssd;
+}
+
+GTEST_TEST(columnGroupAdvisorBasicTest, nsmLayoutIsRowIndex)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+    const std::vector<size_t> columns = {8, 16, 32, 4};
+    DBTable table("table", columns);
+
+    const size_t numEntries = 100000;
+    WorkloadStep* psearch = new WorkloadStepPSearch(10UL, std::vector<size_t>{0, 2});
+    WorkloadStep* rsearch = new WorkloadStepRSearch(1000UL, std::vector<size_t>{0, 3}, 5);
+    WorkloadStep* insert = new WorkloadStepInsert(100);
+
+    ColumnGroupAdvisor advisor(table, ssd, numEntries, std::vector<WorkloadStep*>{psearch, insert, rsearch});
+
+    // 1 group is stored row by row, not as 1 wide column
+    DBIndexColumn* nsm = new DBIndexRawToColumnWrapper(new BPTree(ssd->clone(), 8, 16 + 32 + 4), columns);
+    nsm->createTopologyAfterInsert(numEntries);
+
+    double expectedTime = 0.0;
+    expectedTime += nsm->findPointEntries(std::vector<size_t>{0}, 10UL);
+    expectedTime += nsm->insertEntries(100);
+    expectedTime += nsm->findRangeEntries(std::vector<size_t>{0}, 1000UL, 5UL);
+
+    EXPECT_DOUBLE_EQ(advisor.evaluateLayout(ColumnGroupAdvisor::getNSMLayout(columns.size())), expectedTime);
+
+    delete nsm;
+    delete psearch;
+    delete rsearch;
+    delete insert;
+    delete ssd;
+}
+
+GTEST_TEST(columnGroupAdvisorBasicTest, scanSplitsColumns)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+    DBTable* table = new DBTable_TPCC_Warehouse();
+    const size_t numColumns = table->getAllColumnSize().size();
+
+    const size_t numEntries = 1000000;
+
+    // scans touch only key and column 1, the rest is read by rare point searches
+    WorkloadStep* scan = new WorkloadStepRSearch(0.5, std::vector<size_t>{0, 1}, 10);
+    WorkloadStep* point = new WorkloadStepPSearch(1UL, std::vector<size_t>{0, 2, 3, 4, 5, 6, 7, 8});
+
+    ColumnGroupAdvisor advisor(*table, ssd, numEntries, std::vector<WorkloadStep*>{scan, point});
+
+    const double nsmTime = advisor.evaluateLayout(ColumnGroupAdvisor::getNSMLayout(numColumns));
+    const double dsmTime = advisor.evaluateLayout(ColumnGroupAdvisor::getDSMLayout(numColumns));
+
+    const double bestTime = advisor.findBestLayout();
+    EXPECT_LT(bestTime, nsmTime);
+    EXPECT_LE(bestTime, dsmTime);
+
+    // key group has only scanned columns
+    const ColumnGroupAdvisor::ColumnGroups& bestLayout = advisor.getBestLayout();
+    ASSERT_GT(bestLayout.size(), 1);
+    for (const size_t column : bestLayout[0])
+        EXPECT_LE(column, 1);
+
+    delete scan;
+    delete point;
+    delete table;
+    delete ssd;
+}
+
+GTEST_TEST(columnGroupAdvisorBasicTest, paxModel)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+    DBTable* table = new DBTable_TPCC_Warehouse();
+    const size_t numColumns = table->getAllColumnSize().size();
+
+    const size_t numEntries = 100000;
+    WorkloadStep* scan = new WorkloadStepRSearch(0.1, std::vector<size_t>{0, 3}, 10);
+    WorkloadStep* insert = new WorkloadStepInsert(1000);
+
+    ColumnGroupAdvisor advisor(*table, ssd, numEntries, std::vector<WorkloadStep*>{scan, insert}, ColumnGroupAdvisor::LAYOUT_MODEL_PAX);
+    EXPECT_EQ(advisor.getLayoutModel(), ColumnGroupAdvisor::LAYOUT_MODEL_PAX);
+
+    const double nsmTime = advisor.evaluateLayout(ColumnGroupAdvisor::getNSMLayout(numColumns));
+    const double dsmTime = advisor.evaluateLayout(ColumnGroupAdvisor::getDSMLayout(numColumns));
+    EXPECT_GT(nsmTime, 0.0);
+    EXPECT_GT(dsmTime, 0.0);
+
+    const double bestTime = advisor.findBestLayout();
+    EXPECT_LE(bestTime, nsmTime);
+    EXPECT_LE(bestTime, dsmTime);
+    EXPECT_DOUBLE_EQ(advisor.evaluateLayout(advisor.getBestLayout()), bestTime);
+
+    delete scan;
+    delete insert;
+    delete table;
+    delete ssd;
+}
+
+GTEST_TEST(columnGroupAdvisorBasicTest, copy)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+    DBTable* table = new DBTable_TPCC_Warehouse();
+
+    const size_t numEntries = 100000;
+    WorkloadStep* scan = new WorkloadStepRSearch(0.1, std::vector<size_t>{0, 3}, 10);
+
+    ColumnGroupAdvisor advisor(*table, ssd, numEntries, std::vector<WorkloadStep*>{scan});
+    advisor.findBestLayout();
+
+    ColumnGroupAdvisor copy(advisor);
+    EXPECT_EQ(copy.getBestLayout(), advisor.getBestLayout());
+    EXPECT_DOUBLE_EQ(copy.getBestTime(), advisor.getBestTime());
+    EXPECT_EQ(copy.getNumEvaluatedLayouts(), advisor.getNumEvaluatedLayouts());
+    EXPECT_EQ(copy.toStringFull(), advisor.toStringFull());
+
+    ColumnGroupAdvisor copy2(*table, ssd, 1, std::vector<WorkloadStep*>{});
+    copy2 = copy;
+    EXPECT_EQ(copy2.toStringFull(), advisor.toStringFull());
+
+    // copy keeps own workload, so search gives the same result
+    EXPECT_DOUBLE_EQ(copy2.findBestLayout(), advisor.getBestTime());
+
+    delete scan;
+    delete table;
+    delete ssd;
+}
\ No newline at end of file
@@ -0,0 +1,321 @@
+#include <index/columnLSMTree.hpp>
+#include <index/lsmtree.hpp>
+#include <disk/diskSSD.hpp>
+#include <string>
+#include <iostream>
+#include <numeric>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(columnLSMTreeBasicTest, interface)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 16 + 32 + 4 + 4 + 8;
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t recordSize = keySize + dataSize;
+    const size_t nodeSize = ssd->getLowLevelController().getPageSize() * 10;
+    const size_t memtableSize = nodeSize;
+    const size_t lvlRatio = 5;
+
+    ColumnLSMTree* clsm = new ColumnLSMTree(ssd, columns, std::vector<std::vector<size_t>>(), nodeSize, memtableSize, lvlRatio);
+    DBIndexColumn* index = clsm;
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME; id < MemoryCounters::MEMORY_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_DOUBLE_EQ(index->getDisk().getDiskCounter(id).second, 0.0);
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES; id < MemoryCounters::MEMORY_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(index->getDisk().getDiskCounter(id).second, 0L);
+
+    for (auto id = IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME; id < IndexCounters::INDEX_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_DOUBLE_EQ(index->getCounter(id).second, 0.0);
+
+    for (auto id = IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < IndexCounters::INDEX_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(index->getCounter(id).second, 0L);
+
+    EXPECT_EQ(index->getDisk().getLowLevelController().getMemoryWearOut(), 0);
+
+    EXPECT_EQ(index->getNumEntries(), 0);
+    EXPECT_EQ(index->getKeySize(), keySize);
+    EXPECT_EQ(index->getDataSize(), dataSize);
+    EXPECT_EQ(index->getRecordSize(), recordSize);
+    EXPECT_EQ(index->isBulkloadSupported(), false);
+
+    EXPECT_EQ(index->getNumOfColumns(), columns.size());
+    for (size_t i = 0; i < columns.size(); ++i)
+        EXPECT_EQ(index->getColumnSize(i), columns[i]);
+
+    // specific for ColumnLSMTree, by default each column has own group
+    EXPECT_EQ(clsm->getHeight(), 0);
+    EXPECT_EQ(clsm->getNumOfGroups(), columns.size());
+    for (size_t i = 0; i < columns.size(); ++i)
+    {
+        EXPECT_EQ(clsm->getColumnGroup(i), std::vector<size_t>{i});
+        EXPECT_EQ(clsm->getColumnLSMLvl(0, i).getNumEntries(), 0);
+        EXPECT_EQ(clsm->getColumnLSMLvl(0, i).getMaxEntries(), memtableSize / recordSize);
+    }
+
+    delete index;
+}
+
+GTEST_TEST(columnLSMTreeBasicTest, columnGroups)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t nodeSize = ssd->getLowLevelController().getPageSize() * 10;
+    const size_t memtableSize = nodeSize;
+    const size_t lvlRatio = 5;
+
+    // key group is moved to the front and columns are sorted
+    const std::vector<std::vector<size_t>> groups = {{3, 2}, {5, 0}, {1, 4}};
+    ColumnLSMTree* clsm = new ColumnLSMTree(ssd->clone(), columns, groups, nodeSize, memtableSize, lvlRatio);
+
+    EXPECT_EQ(clsm->getNumOfGroups(), groups.size());
+    EXPECT_EQ(clsm->getColumnGroup(0), (std::vector<size_t>{0, 5}));
+    EXPECT_EQ(clsm->getColumnGroup(1), (std::vector<size_t>{2, 3}));
+    EXPECT_EQ(clsm->getColumnGroup(2), (std::vector<size_t>{1, 4}));
+
+    // all groups keep the same number of entries in memtable
+    const size_t memtableEntries = memtableSize / clsm->getRecordSize();
+    for (size_t i = 0; i < clsm->getNumOfGroups(); ++i)
+        EXPECT_EQ(clsm->getColumnLSMLvl(0, i).getMaxEntries(), memtableEntries);
+
+    delete clsm;
+
+    // invalid groups (missing column, duplicated column, column out of range) fallback to 1 group per column
+    const std::vector<std::vector<std::vector<size_t>>> invalidGroups = {{{0, 1}, {2, 3}}, {{0, 1, 2}, {2, 3, 4, 5}}, {{0, 1, 2}, {3, 4, 5, 6}}, {{0, 1, 2, 3, 4, 5}, {}}};
+    for (const auto& invalid : invalidGroups)
+    {
+        clsm = new ColumnLSMTree(ssd->clone(), columns, invalid, nodeSize, memtableSize, lvlRatio);
+
+        EXPECT_EQ(clsm->getNumOfGroups(), columns.size());
+        for (size_t i = 0; i < columns.size(); ++i)
+            EXPECT_EQ(clsm->getColumnGroup(i), std::vector<size_t>{i});
+
+        delete clsm;
+    }
+
+    delete ssd;
+}
+
+GTEST_TEST(columnLSMTreeBasicTest, insertIntoMemtable)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t recordSize = std::accumulate(columns.begin(), columns.end(), 0UL);
+    const size_t nodeSize = ssd->getLowLevelController().getPageSize() * 10;
+    const size_t memtableSize = nodeSize;
+    const size_t lvlRatio = 5;
+    const size_t numOperations = (memtableSize / recordSize) - 1;
+
+    ColumnLSMTree* clsm = new ColumnLSMTree(ssd, columns, std::vector<std::vector<size_t>>{{0, 1, 2}, {3, 4, 5}}, nodeSize, memtableSize, lvlRatio);
+    DBIndexColumn* index = clsm;
+
+    for (size_t i = 0; i < numOperations; ++i)
+    {
+        EXPECT_DOUBLE_EQ(index->insertEntries(), 0.0);
+
+        EXPECT_EQ(index->getNumEntries(), i + 1);
+        EXPECT_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS).second, i + 1);
+        EXPECT_DOUBLE_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, 0.0);
+
+        EXPECT_EQ(clsm->getHeight(), 0);
+        for (size_t g = 0; g < clsm->getNumOfGroups(); ++g)
+            EXPECT_EQ(clsm->getColumnLSMLvl(0, g).getNumEntries(), i + 1);
+    }
+
+    EXPECT_EQ(index->getDisk().getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES).second, 0L);
+
+    delete index;
+}
+
+GTEST_TEST(columnLSMTreeBasicTest, insertWithFlush)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t keySize = columns[0];
+    const size_t recordSize = std::accumulate(columns.begin(), columns.end(), 0UL);
+    const size_t nodeSize = ssd->getLowLevelController().getPageSize() * 10;
+    const size_t memtableSize = nodeSize;
+    const size_t lvlRatio = 5;
+    const size_t numOperations = 20000;
+
+    // 1 group with all columns behaves like LSMTree
+    ColumnLSMTree* clsm = new ColumnLSMTree(ssd->clone(), columns, std::vector<std::vector<size_t>>{{0, 1, 2, 3, 4, 5}}, nodeSize, memtableSize, lvlRatio);
+    LSMTree* lsm = new LSMTree(ssd->clone(), keySize, recordSize - keySize, nodeSize, (memtableSize / recordSize) * recordSize, lvlRatio);
+
+    EXPECT_DOUBLE_EQ(clsm->insertEntries(numOperations), lsm->insertEntries(numOperations));
+    EXPECT_EQ(clsm->getNumEntries(), lsm->getNumEntries());
+    EXPECT_EQ(clsm->getHeight(), lsm->getHeight());
+    EXPECT_GT(clsm->getHeight(), 0);
+    EXPECT_EQ(clsm->getDisk().getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES).second, lsm->getDisk().getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES).second);
+
+    delete clsm;
+    delete lsm;
+
+    // groups flush together and disk stats are a sum of all groups
+    clsm = new ColumnLSMTree(ssd->clone(), columns, std::vector<std::vector<size_t>>{{0, 1}, {2}, {3, 4, 5}}, nodeSize, memtableSize, lvlRatio);
+    const std::vector<std::vector<size_t>> groupsColumns = {{0, 1}, {0, 2}, {0, 3, 4, 5}};
+    const size_t memtableEntries = memtableSize / recordSize;
+
+    double expectedTime = 0.0;
+    long expectedBytes = 0;
+    std::vector<LSMTree*> lsms;
+    for (const auto& group : groupsColumns)
+    {
+        size_t groupDataSize = 0;
+        for (size_t i = 1; i < group.size(); ++i)
+            groupDataSize += columns[group[i]];
+
+        lsms.push_back(new LSMTree(ssd->clone(), keySize, groupDataSize, nodeSize, memtableEntries * (keySize + groupDataSize), lvlRatio));
+        expectedTime += lsms.back()->insertEntries(numOperations);
+        expectedBytes += lsms.back()->getDisk().getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES).second;
+    }
+
+    EXPECT_NEAR(clsm->insertEntries(numOperations), expectedTime, 0.000001);
+    EXPECT_NEAR(clsm->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, expectedTime, 0.000001);
+    EXPECT_EQ(clsm->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS).second, numOperations);
+    EXPECT_EQ(clsm->getDisk().getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES).second, expectedBytes);
+
+    for (size_t g = 0; g < lsms.size(); ++g)
+    {
+        EXPECT_EQ(clsm->getColumnLSMLvl(0, g).getNumEntries(), lsms[g]->getLSMLvl(0).getNumEntries());
+        delete lsms[g];
+    }
+
+    delete clsm;
+    delete ssd;
+}
+
+GTEST_TEST(columnLSMTreeBasicTest, findOnlyNeededGroups)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t nodeSize = ssd->getLowLevelController().getPageSize() * 10;
+    const size_t memtableSize = nodeSize;
+    const size_t lvlRatio = 5;
+    const size_t numOperations = 20000;
+    const size_t numEntries = 1000;
+
+    ColumnLSMTree* clsm = new ColumnLSMTree(ssd, columns, std::vector<std::vector<size_t>>{{0, 1}, {2}, {3, 4, 5}}, nodeSize, memtableSize, lvlRatio);
+    DBIndexColumn* index = clsm;
+
+    index->insertEntries(numOperations);
+
+    ColumnLSMTree* copy = new ColumnLSMTree(*clsm);
+
+    // key group is always read, so fetching only key is the cheapest
+    const double keyTime = index->findPointEntries(std::vector<size_t>{0}, 10UL);
+    const double oneGroupTime = copy->findPointEntries(std::vector<size_t>{0, 1}, 10UL);
+    EXPECT_GT(keyTime, 0.0);
+    EXPECT_DOUBLE_EQ(keyTime, oneGroupTime);
+
+    const double twoGroupsTime = copy->findPointEntries(std::vector<size_t>{0, 4}, 10UL);
+    const double allGroupsTime = copy->findPointEntries(std::vector<size_t>{0, 1, 2, 3, 4, 5}, 10UL);
+    EXPECT_GT(twoGroupsTime, oneGroupTime);
+    EXPECT_GT(allGroupsTime, twoGroupsTime);
+
+    EXPECT_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_PSEARCH_TOTAL_OPERATIONS).second, 10);
+    EXPECT_DOUBLE_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_PSEARCH_TOTAL_TIME).second, keyTime);
+
+    const double rangeTime = index->findRangeEntries(std::vector<size_t>{2, 0}, numEntries, 5UL);
+    EXPECT_GT(rangeTime, 0.0);
+    EXPECT_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_OPERATIONS).second, 5);
+    EXPECT_DOUBLE_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_TIME).second, rangeTime);
+
+    // without key column nothing is searched
+    EXPECT_DOUBLE_EQ(index->findPointEntries(std::vector<size_t>{1, 2}), 0.0);
+
+    delete copy;
+    delete index;
+}
+
+GTEST_TEST(columnLSMTreeBasicTest, deleteEntries)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t nodeSize = ssd->getLowLevelController().getPageSize() * 10;
+    const size_t memtableSize = nodeSize;
+    const size_t lvlRatio = 5;
+    const size_t numOperations = 20000;
+
+    ColumnLSMTree* clsm = new ColumnLSMTree(ssd, columns, std::vector<std::vector<size_t>>{{0, 1, 2}, {3, 4, 5}}, nodeSize, memtableSize, lvlRatio);
+    DBIndexColumn* index = clsm;
+
+    index->insertEntries(numOperations);
+
+    const double time = index->deleteEntries(numOperations / 2);
+    EXPECT_GE(time, 0.0);
+    EXPECT_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_DELETE_TOTAL_OPERATIONS).second, numOperations / 2);
+    EXPECT_DOUBLE_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_DELETE_TOTAL_TIME).second, time);
+
+    for (size_t g = 1; g < clsm->getNumOfGroups(); ++g)
+        EXPECT_EQ(clsm->getColumnLSMLvl(0, g).getNumEntries(), clsm->getColumnLSMLvl(0, 0).getNumEntries());
+
+    delete index;
+}
+
+GTEST_TEST(columnLSMTreeBasicTest, copy)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t nodeSize = ssd->getLowLevelController().getPageSize() * 10;
+    const size_t memtableSize = nodeSize;
+    const size_t lvlRatio = 5;
+    const size_t numOperations = 20000;
+
+    ColumnLSMTree* clsm = new ColumnLSMTree(ssd, columns, std::vector<std::vector<size_t>>{{0, 1}, {2, 3, 4, 5}}, nodeSize, memtableSize, lvlRatio);
+    clsm->insertEntries(numOperations);
+
+    ColumnLSMTree copy(*clsm);
+    EXPECT_EQ(copy.getNumEntries(), clsm->getNumEntries());
+    EXPECT_EQ(copy.getHeight(), clsm->getHeight());
+    EXPECT_EQ(copy.getNumOfGroups(), clsm->getNumOfGroups());
+    EXPECT_EQ(copy.toStringFull(), clsm->toStringFull());
+
+    ColumnLSMTree copy2(ssd->clone(), columns);
+    copy2 = copy;
+    EXPECT_EQ(copy2.toStringFull(), clsm->toStringFull());
+
+    // copies are independent
+    copy.insertEntries(numOperations);
+    EXPECT_EQ(copy.getNumEntries(), 2 * numOperations);
+    EXPECT_EQ(clsm->getNumEntries(), numOperations);
+    EXPECT_EQ(copy2.getNumEntries(), numOperations);
+
+    delete clsm;
+}
+
+GTEST_TEST(columnLSMTreeBasicTest, concurrentGroups)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t nodeSize = ssd->getLowLevelController().getPageSize() * 10;
+    const size_t memtableSize = nodeSize;
+    const size_t lvlRatio = 5;
+    const size_t numOperations = 20000;
+
+    ColumnLSMTree* clsm = new ColumnLSMTree(ssd, columns, std::vector<std::vector<size_t>>{{0, 1}, {2}, {3, 4, 5}}, nodeSize, memtableSize, lvlRatio);
+    ColumnLSMTree* parallel = new ColumnLSMTree(*clsm);
+    parallel->setColumnsParallelism(0);
+
+    const double sequentialTime = clsm->insertEntries(numOperations);
+    const double parallelTime = parallel->insertEntries(numOperations);
+
+    EXPECT_GT(parallelTime, 0.0);
+    EXPECT_LT(parallelTime, sequentialTime);
+
+    // the same work is done on disk
+    EXPECT_EQ(parallel->getDisk().getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES).second, clsm->getDisk().getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES).second);
+
+    delete parallel;
+    delete clsm;
+}
\ No newline at end of file
@@ -99,4 +99,26 @@ GTEST_TEST(dbTableTest, move)
     EXPECT_EQ(copy2.getNumColumns(), cols.size());
     for (size_t i = 0; i < cols.size(); ++i)
         EXPECT_EQ(copy2.getColumnSize(i), cols[i]);
+}
+
+GTEST_TEST(dbTableTest, compression)
+{
+    std::vector<size_t> cols {8, 24, 32};
+    std::string name("test");
+
+    DBTable plain(name.c_str(), cols);
+    EXPECT_EQ(plain.getAllColumnCompressionRatio(), std::vector<double>(cols.size(), 1.0));
+    EXPECT_DOUBLE_EQ(plain.getRecordCompressionRatio(), 1.0);
+
+    // missing columns are not compressible
+    DBTable table(name.c_str(), cols, std::vector<double>{0.5, 0.25});
+    EXPECT_EQ(table.getRecordSize(), 8 + 24 + 32);
+    EXPECT_DOUBLE_EQ(table.getColumnCompressionRatio(0), 0.5);
+    EXPECT_DOUBLE_EQ(table.getColumnCompressionRatio(1), 0.25);
+    EXPECT_DOUBLE_EQ(table.getColumnCompressionRatio(2), 1.0);
+    EXPECT_DOUBLE_EQ(table.getColumnCompressionRatio(3), 1.0);
+    EXPECT_DOUBLE_EQ(table.getRecordCompressionRatio(), (4.0 + 6.0 + 32.0) / 64.0);
+
+    DBTable copy(table);
+    EXPECT_EQ(copy.getAllColumnCompressionRatio(), table.getAllColumnCompressionRatio());
 }
\ No newline at end of file
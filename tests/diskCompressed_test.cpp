@@ -0,0 +1,140 @@
+#include <disk/diskCompressed.hpp>
+#include <disk/diskSSD.hpp>
+#include <index/dsm.hpp>
+#include <index/cfdtree.hpp>
+#include <index/lsmtree.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(diskCompressedBasicTest, interface)
+{
+    DiskSSD_Samsung840 ssd;
+
+    DiskCompressed disk(ssd, 0.5, 1000.0 * 1000.0 * 1000.0, 2000.0 * 1000.0 * 1000.0);
+
+    EXPECT_EQ(std::string(disk.getLowLevelController().getModelName()), std::string("Compressed"));
+    EXPECT_EQ(disk.getLowLevelController().getPageSize(), ssd.getLowLevelController().getPageSize());
+    EXPECT_EQ(disk.getLowLevelController().getBlockSize(), ssd.getLowLevelController().getBlockSize());
+    EXPECT_EQ(std::string(disk.getCompressedModel().getModel().getModelName()), std::string(ssd.getLowLevelController().getModelName()));
+    EXPECT_DOUBLE_EQ(disk.getCompressedModel().getCompressionRatio(), 0.5);
+    EXPECT_EQ(disk.getLowLevelController().getMemoryWearOut(), 0);
+}
+
+GTEST_TEST(diskCompressedBasicTest, table)
+{
+    DiskSSD_Samsung840 ssd;
+    DBTable table("table", std::vector<size_t>{8, 24, 32}, std::vector<double>{1.0, 0.5, 0.25});
+
+    DiskCompressed disk(ssd, table, 0.0, 0.0);
+
+    EXPECT_DOUBLE_EQ(disk.getCompressedModel().getHintCompressionRatio(0), 1.0);
+    EXPECT_DOUBLE_EQ(disk.getCompressedModel().getHintCompressionRatio(1), 0.5);
+    EXPECT_DOUBLE_EQ(disk.getCompressedModel().getHintCompressionRatio(2), 0.25);
+    EXPECT_DOUBLE_EQ(disk.getCompressedModel().getHintCompressionRatio(3), (8.0 + 12.0 + 8.0) / 64.0);
+    EXPECT_DOUBLE_EQ(disk.getCompressedModel().getCompressionRatio(), (8.0 + 12.0 + 8.0) / 64.0);
+
+    disk.setHintCompressionRatio(0, 0.75);
+    EXPECT_DOUBLE_EQ(disk.getCompressedModel().getHintCompressionRatio(0), 0.75);
+}
+
+GTEST_TEST(diskCompressedBasicTest, copy)
+{
+    DiskSSD_Samsung840 ssd;
+    const size_t pageSize = ssd.getLowLevelController().getPageSize();
+
+    DiskCompressed disk(ssd, 0.5, 0.0, 0.0);
+    disk.setHintCompressionRatio(1, 0.25);
+    EXPECT_DOUBLE_EQ(disk.writeBytes(0, 8 * pageSize), 0.0);
+
+    Disk* copy = disk.clone();
+    EXPECT_DOUBLE_EQ(dynamic_cast<DiskCompressed*>(copy)->getCompressedModel().getHintCompressionRatio(1), 0.25);
+
+    // hint change flushes pending pages with ratio of previous hint
+    EXPECT_GT(copy->setPlacementHint(1), 0.0);
+    EXPECT_EQ(copy->getLowLevelController().getMemoryWearOut(), 4 * pageSize);
+    EXPECT_EQ(disk.getLowLevelController().getMemoryWearOut(), 0);
+
+    DiskCompressed copy2;
+    copy2 = *dynamic_cast<DiskCompressed*>(copy);
+    EXPECT_DOUBLE_EQ(copy2.getCompressedModel().getCurrentCompressionRatio(), 0.25);
+
+    DiskCompressed moved(std::move(copy2));
+    EXPECT_EQ(moved.getLowLevelController().getMemoryWearOut(), 4 * pageSize);
+
+    delete copy;
+}
+
+GTEST_TEST(diskCompressedBasicTest, dsmColumns)
+{
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const std::vector<double> compression = {1.0, 0.5, 0.25, 1.0, 1.0, 0.5};
+    const size_t numEntries = 100000;
+
+    DBTable table("table", columns, compression);
+    DiskSSD_Samsung840 ssd;
+
+    DSM* plain = new DSM(new DiskSSD_Samsung840(), columns);
+    DSM* compressed = new DSM(new DiskCompressed(ssd, table, 0.0, 0.0), columns);
+
+    const double plainTime = plain->bulkloadEntries(numEntries);
+    const double compressedTime = compressed->bulkloadEntries(numEntries);
+
+    EXPECT_GT(compressedTime, 0.0);
+    EXPECT_LT(compressedTime, plainTime);
+    EXPECT_LT(compressed->getDisk().getLowLevelController().getMemoryWearOut(), plain->getDisk().getLowLevelController().getMemoryWearOut());
+
+    // each column is compressed with its own ratio
+    const MemoryModelCompressed& model = dynamic_cast<const DiskCompressed&>(compressed->getDisk()).getCompressedModel();
+    EXPECT_EQ(model.getRawBytes(), plain->getDisk().getLowLevelController().getCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES).second);
+    EXPECT_LT(model.getCompressedBytes(), model.getRawBytes());
+    EXPECT_GT(model.getCompressedBytes(), static_cast<size_t>(static_cast<double>(model.getRawBytes()) * 0.25));
+
+    // key column is not compressed, so scanning only key costs the same
+    EXPECT_DOUBLE_EQ(compressed->findRangeEntries(std::vector<size_t>{0}, 0.5), plain->findRangeEntries(std::vector<size_t>{0}, 0.5));
+    EXPECT_LT(compressed->findRangeEntries(std::vector<size_t>{0, 2}, 0.5), plain->findRangeEntries(std::vector<size_t>{0, 2}, 0.5));
+
+    delete plain;
+    delete compressed;
+}
+
+GTEST_TEST(diskCompressedBasicTest, cfdtreeColumns)
+{
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const std::vector<double> compression = {1.0, 0.5, 0.25, 1.0, 1.0, 0.5};
+    const size_t numEntries = 10000;
+
+    DBTable table("table", columns, compression);
+    DiskSSD_Samsung840 ssd;
+
+    CFDTree* plain = new CFDTree(new DiskSSD_Samsung840(), columns);
+    CFDTree* compressed = new CFDTree(new DiskCompressed(ssd, table, 0.0, 0.0), columns);
+
+    EXPECT_GT(plain->insertEntries(numEntries), 0.0);
+    EXPECT_GT(compressed->insertEntries(numEntries), 0.0);
+
+    EXPECT_LT(compressed->getDisk().getLowLevelController().getMemoryWearOut(), plain->getDisk().getLowLevelController().getMemoryWearOut());
+
+    delete plain;
+    delete compressed;
+}
+
+GTEST_TEST(diskCompressedBasicTest, cpuCost)
+{
+    DiskSSD_Samsung840 ssd;
+    const size_t pageSize = ssd.getLowLevelController().getPageSize();
+
+    // slow CPU makes compression a loss, fast CPU a gain
+    DiskCompressed slowCpu(ssd, 0.5, 1000.0, 1000.0);
+    DiskCompressed fastCpu(ssd, 0.5, 0.0, 0.0);
+    DiskSSD_Samsung840 plain;
+
+    const double slowTime = slowCpu.writeBytes(0, 64 * pageSize) + slowCpu.flushCache();
+    const double fastTime = fastCpu.writeBytes(0, 64 * pageSize) + fastCpu.flushCache();
+    const double plainTime = plain.writeBytes(0, 64 * pageSize) + plain.flushCache();
+
+    EXPECT_LT(fastTime, plainTime);
+    EXPECT_GT(slowTime, plainTime);
+    EXPECT_DOUBLE_EQ(slowTime - fastTime, 64.0 * pageSize / 1000.0);
+}
\ No newline at end of file
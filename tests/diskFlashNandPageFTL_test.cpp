@@ -0,0 +1,81 @@
+#include <disk/diskFlashNandPageFTL.hpp>
+#include <index/lsmtree.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(diskFlashNandPageFTLBasicTest, interface)
+{
+    DiskFlashNandPageFTL* disk = new DiskFlashNandPageFTL_SamsungK9F1G08U0D();
+
+    EXPECT_EQ(std::string(disk->getLowLevelController().getModelName()), std::string("FlashNandPageFTL:samsungK9F1G08U0D"));
+    EXPECT_EQ(disk->getPageFTLModel().getLogicalPages(), 128 * 1024 * 1024 / 2048);
+    EXPECT_DOUBLE_EQ(disk->getPageFTLModel().getWriteAmplification(), 1.0);
+
+    delete disk;
+}
+
+GTEST_TEST(diskFlashNandPageFTLBasicTest, lsmWriteAmplification)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 8;
+
+    // small device, so LSM compactions rewrite logical space many times
+    Disk* disk = new DiskFlashNandPageFTL(new MemoryControllerFlashNandPageFTL(new MemoryModelFlashNandPageFTL("flash", pageSize, blockSize, 1.0, 10.0, 100.0, 64 * pageSize, 0.25)));
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = 2048;
+    const size_t headTreeSize = 2 * nodeSize;
+    const size_t lvlRatio = 2;
+
+    LSMTree* lsm = new LSMTree(disk, keySize, dataSize, nodeSize, headTreeSize, lvlRatio);
+
+    EXPECT_GT(lsm->insertEntries(5000), 0.0);
+    EXPECT_GT(lsm->deleteEntries(1000), 0.0);
+
+    const MemoryModelFlashNandPageFTL& flash = dynamic_cast<const DiskFlashNandPageFTL&>(lsm->getDisk()).getPageFTLModel();
+
+    EXPECT_GT(flash.getHostWrittenPages(), flash.getLogicalPages());
+    EXPECT_GT(flash.getErasedBlocks(), 0);
+    EXPECT_GE(flash.getWriteAmplification(), 1.0);
+    EXPECT_EQ(flash.getMemoryWearOut(), (flash.getHostWrittenPages() + flash.getGCWrittenPages() + flash.getWearLevelingWrittenPages()) * pageSize);
+
+    delete lsm;
+}
+
+GTEST_TEST(diskFlashNandPageFTLBasicTest, copy)
+{
+    Disk* disk = new DiskFlashNandPageFTL_SamsungK9F1G08U0D();
+    const double readTime = 35.0 / 1000000.0;
+
+    uintptr_t addr = 0;
+
+    EXPECT_DOUBLE_EQ(disk->readBytes(addr, 100), readTime);
+    EXPECT_DOUBLE_EQ(disk->readBytes(addr + 10000, 100), readTime);
+
+    EXPECT_EQ(disk->getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 2);
+    EXPECT_EQ(disk->getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES).second, 200);
+    EXPECT_DOUBLE_EQ(disk->getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME).second, readTime * 2);
+
+    DiskFlashNandPageFTL* copy = new DiskFlashNandPageFTL(*dynamic_cast<DiskFlashNandPageFTL*>(disk));
+
+    EXPECT_EQ(copy->getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 2);
+    EXPECT_DOUBLE_EQ(copy->getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME).second, readTime * 2);
+    EXPECT_EQ(copy->getPageFTLModel().getLogicalPages(), 128 * 1024 * 1024 / 2048);
+
+    DiskFlashNandPageFTL copy2;
+    copy2 = *copy;
+
+    EXPECT_EQ(copy2.getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 2);
+    EXPECT_DOUBLE_EQ(copy2.getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME).second, readTime * 2);
+
+    DiskFlashNandPageFTL copy3(std::move(copy2));
+
+    EXPECT_EQ(copy3.getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 2);
+    EXPECT_DOUBLE_EQ(copy3.getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME).second, readTime * 2);
+
+    delete copy;
+    delete disk;
+}
\ No newline at end of file
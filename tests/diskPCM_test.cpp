@@ -10,6 +10,31 @@ GTEST_TEST(diskPCMBasicTest, interface)
     delete disk;
 }
 
+GTEST_TEST(diskPCMBasicTest, wearLeveling)
+{
+    DiskPCM* disk = new DiskPCM_DefaultModel();
+    const size_t lineSize = disk->getLowLevelController().getPageSize();
+
+    EXPECT_EQ(disk->getPCMModel().getWearLeveling(), MemoryModelPCM::WEAR_LEVELING_NONE);
+
+    // cached writes are flushed with the old mapping
+    EXPECT_DOUBLE_EQ(disk->writeBytes(0, 10 * lineSize), 0.0);
+    EXPECT_GT(disk->setWearLeveling(MemoryModelPCM::WEAR_LEVELING_START_GAP, 1024 * lineSize, 10), 0.0);
+    EXPECT_EQ(disk->getPCMModel().getWearLeveling(), MemoryModelPCM::WEAR_LEVELING_START_GAP);
+    EXPECT_EQ(disk->getPCMModel().getLevelingLines(), 1024);
+    EXPECT_EQ(disk->getPCMModel().getLevelingMoves(), 0);
+
+    disk->writeBytes(0, 100 * lineSize);
+    disk->flushCache();
+    EXPECT_EQ(disk->getPCMModel().getLevelingMoves(), 10);
+
+    Disk* copy = disk->clone();
+    EXPECT_EQ(dynamic_cast<DiskPCM*>(copy)->getPCMModel().getLevelingMoves(), 10);
+
+    delete copy;
+    delete disk;
+}
+
 GTEST_TEST(diskPCMBasicTest, copy)
 {
     Disk* disk = new DiskPCM_DefaultModel();
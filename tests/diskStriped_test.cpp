@@ -0,0 +1,89 @@
+#include <disk/diskStriped.hpp>
+#include <disk/diskSSD.hpp>
+#include <disk/diskPCM.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(diskStripedBasicTest, interface)
+{
+    DiskSSD_Samsung840 ssd;
+    const size_t pageSize = ssd.getLowLevelController().getPageSize();
+
+    DiskStriped disk(ssd, 4, 4 * pageSize);
+
+    EXPECT_EQ(std::string(disk.getLowLevelController().getModelName()), std::string("RAID-0"));
+    EXPECT_EQ(disk.getLowLevelController().getPageSize(), pageSize);
+    EXPECT_EQ(disk.getLowLevelController().getBlockSize(), ssd.getLowLevelController().getBlockSize());
+    EXPECT_EQ(disk.getStripedModel().getNumDisks(), 4);
+    EXPECT_EQ(disk.getStripedModel().getStripeUnit(), 4 * pageSize);
+    EXPECT_EQ(std::string(disk.getStripedModel().getMember(0).getModelName()), std::string("SSD:samsung840"));
+    EXPECT_EQ(disk.getLowLevelController().getMemoryWearOut(), 0);
+}
+
+GTEST_TEST(diskStripedBasicTest, copy)
+{
+    DiskSSD_Samsung840 ssd;
+    const size_t pageSize = ssd.getLowLevelController().getPageSize();
+
+    DiskStriped disk(ssd, 2, pageSize, true);
+
+    EXPECT_DOUBLE_EQ(disk.writeBytes(0, 8 * pageSize), 0.0);
+    EXPECT_GT(disk.flushCache(), 0.0);
+
+    Disk* copy = disk.clone();
+    EXPECT_EQ(copy->getLowLevelController().getMemoryWearOut(), 2 * 8 * pageSize);
+    EXPECT_EQ(dynamic_cast<DiskStriped*>(copy)->getStripedModel().getNumMembers(), 4);
+
+    DiskStriped copy2;
+    copy2 = *dynamic_cast<DiskStriped*>(copy);
+    EXPECT_EQ(copy2.getLowLevelController().getMemoryWearOut(), 2 * 8 * pageSize);
+
+    DiskStriped moved(std::move(copy2));
+    EXPECT_EQ(moved.getLowLevelController().getMemoryWearOut(), 2 * 8 * pageSize);
+
+    delete copy;
+}
+
+GTEST_TEST(diskStripedBasicTest, scaling)
+{
+    DiskSSD_Samsung840 ssd;
+    const size_t pageSize = ssd.getLowLevelController().getPageSize();
+    const size_t bytes = 64 * pageSize;
+
+    DiskStriped disk2(ssd, 2, 4 * pageSize);
+    DiskStriped disk4(ssd, 4, 4 * pageSize);
+
+    const double readTime = ssd.readBytes(0, bytes);
+    const double readTime2 = disk2.readBytes(0, bytes);
+    const double readTime4 = disk4.readBytes(0, bytes);
+
+    EXPECT_DOUBLE_EQ(readTime2, readTime / 2.0);
+    EXPECT_DOUBLE_EQ(readTime4, readTime / 4.0);
+
+    EXPECT_EQ(disk4.getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES).second, bytes);
+    for (size_t i = 0; i < 4; ++i)
+        EXPECT_EQ(disk4.getStripedModel().getMemberCounter(i, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES).second, bytes / 4);
+}
+
+GTEST_TEST(diskStripedBasicTest, mirroredPCM)
+{
+    DiskPCM_DefaultModel pcm;
+    const size_t pageSize = pcm.getLowLevelController().getPageSize();
+    const size_t bytes = 16 * pageSize;
+
+    DiskStriped raid0(pcm, 2, pageSize);
+    DiskStriped raid10(pcm, 2, pageSize, true);
+
+    EXPECT_DOUBLE_EQ(raid0.writeBytes(0, bytes), 0.0);
+    EXPECT_DOUBLE_EQ(raid10.writeBytes(0, bytes), 0.0);
+
+    // mirror is written in parallel, but wear-out is doubled
+    EXPECT_DOUBLE_EQ(raid0.flushCache(), raid10.flushCache());
+    EXPECT_EQ(raid0.getLowLevelController().getMemoryWearOut(), bytes);
+    EXPECT_EQ(raid10.getLowLevelController().getMemoryWearOut(), 2 * bytes);
+
+    // mirrors serve reads
+    EXPECT_LT(raid10.readBytes(0, bytes), raid0.readBytes(0, bytes));
+}
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include <disk/diskTiered.hpp>
+#include <disk/diskSSD.hpp>
+#include <disk/diskPCM.hpp>
+#include <disk/diskFlashNandFTL.hpp>
+#include <index/lsmtree.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(diskTieredBasicTest, interface)
+{
+    DiskPCM_DefaultModel pcm;
+    DiskFlashNandFTL_SamsungK9F1G08U0D flash;
+
+    DiskTiered disk(pcm, flash, 1 << 20, new MemoryModelTiered::LevelPolicy(2));
+
+    EXPECT_EQ(std::string(disk.getLowLevelController().getModelName()), std::string("Tiered"));
+    EXPECT_EQ(disk.getLowLevelController().getPageSize(), pcm.getLowLevelController().getPageSize());
+    EXPECT_EQ(disk.getLowLevelController().getBlockSize(), flash.getLowLevelController().getBlockSize());
+    EXPECT_EQ(disk.getTieredModel().getNumTiers(), 2);
+    EXPECT_EQ(disk.getTieredModel().getTierCapacity(0), 1 << 20);
+    EXPECT_EQ(disk.getTieredModel().getTierCapacity(1), 0);
+    EXPECT_EQ(std::string(disk.getTieredModel().getTier(0).getModelName()), std::string("PCM:defaultModel"));
+    EXPECT_EQ(std::string(disk.getTieredModel().getTier(1).getModelName()), std::string("FlashNandFTL:samsungK9F1G08U0D"));
+
+    // plain disks ignore hints
+    DiskSSD_Samsung840 ssd;
+    EXPECT_DOUBLE_EQ(ssd.setPlacementHint(1, 1000), 0.0);
+}
+
+GTEST_TEST(diskTieredBasicTest, copy)
+{
+    DiskPCM_DefaultModel pcm;
+    DiskFlashNandFTL_SamsungK9F1G08U0D flash;
+
+    DiskTiered disk(std::vector<const Disk*>{&pcm, &flash}, std::vector<size_t>{0, 0}, new MemoryModelTiered::LevelPolicy(1));
+    EXPECT_DOUBLE_EQ(disk.setPlacementHint(1), 0.0);
+    EXPECT_DOUBLE_EQ(disk.writeBytes(0, 4096), 0.0);
+
+    Disk* copy = disk.clone();
+    EXPECT_EQ(dynamic_cast<DiskTiered*>(copy)->getTieredModel().getCurrentHint(), 1);
+
+    // hint change flushes pending pages to the tier of previous hint
+    EXPECT_GT(copy->setPlacementHint(0), 0.0);
+    EXPECT_EQ(dynamic_cast<DiskTiered*>(copy)->getTieredModel().getTierWearOut(1), 4096);
+    EXPECT_EQ(disk.getTieredModel().getTierWearOut(1), 0);
+
+    DiskTiered copy2;
+    copy2 = *dynamic_cast<DiskTiered*>(copy);
+    EXPECT_EQ(copy2.getTieredModel().getCurrentHint(), 0);
+
+    DiskTiered moved(std::move(copy2));
+    EXPECT_EQ(moved.getLowLevelController().getMemoryWearOut(), 4096);
+
+    delete copy;
+}
+
+GTEST_TEST(diskTieredBasicTest, lsmLevels)
+{
+    DiskPCM_DefaultModel pcm;
+    DiskFlashNandFTL_SamsungK9F1G08U0D flash;
+    Disk* disk = new DiskTiered(pcm, flash, 0, new MemoryModelTiered::LevelPolicy(2));
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = 2048;
+    const size_t headTreeSize = 2 * nodeSize;
+    const size_t lvlRatio = 2;
+
+    LSMTree* lsm = new LSMTree(disk, keySize, dataSize, nodeSize, headTreeSize, lvlRatio);
+
+    EXPECT_GT(lsm->insertEntries(2000), 0.0);
+    ASSERT_GE(lsm->getHeight(), 3);
+    EXPECT_GT(lsm->findPointEntries(static_cast<size_t>(10)), 0.0);
+
+    const MemoryModelTiered& tiered = dynamic_cast<const DiskTiered&>(lsm->getDisk()).getTieredModel();
+
+    // LVL1 on PCM, deeper levels on Flash
+    EXPECT_EQ(tiered.getHintTier(1), 0);
+    EXPECT_EQ(tiered.getHintTier(2), 1);
+    EXPECT_EQ(tiered.getHintTier(3), 1);
+
+    EXPECT_GT(tiered.getTierWearOut(0), 0);
+    EXPECT_GT(tiered.getTierWearOut(1), 0);
+    EXPECT_GT(tiered.getTierCounter(0, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 0);
+    EXPECT_GT(tiered.getTierCounter(1, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 0);
+    EXPECT_EQ(tiered.getMemoryWearOut(), tiered.getTierWearOut(0) + tiered.getTierWearOut(1));
+    EXPECT_EQ(tiered.getMigrationOperations(), 0);
+
+    delete lsm;
+}
+
+GTEST_TEST(diskTieredBasicTest, lsmMigrations)
+{
+    DiskPCM_DefaultModel pcm;
+    DiskFlashNandFTL_SamsungK9F1G08U0D flash;
+    Disk* disk = new DiskTiered(pcm, flash, 16 * 1024, new MemoryModelTiered::PromotionPolicy(2));
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = 2048;
+    const size_t headTreeSize = 2 * nodeSize;
+    const size_t lvlRatio = 2;
+
+    LSMTree* lsm = new LSMTree(disk, keySize, dataSize, nodeSize, headTreeSize, lvlRatio);
+
+    EXPECT_GT(lsm->insertEntries(2000), 0.0);
+    EXPECT_GT(lsm->findPointEntries(static_cast<size_t>(10)), 0.0);
+
+    const MemoryModelTiered& tiered = dynamic_cast<const DiskTiered&>(lsm->getDisk()).getTieredModel();
+
+    // hot levels are promoted, capacity of PCM pushes big levels back to Flash
+    EXPECT_GT(tiered.getMigrationOperations(), 0);
+    EXPECT_GT(tiered.getMigrationBytes(), 0);
+    EXPECT_GT(tiered.getMigrationTime(), 0.0);
+    EXPECT_LE(tiered.getTierUsedBytes(0), 16 * 1024);
+    EXPECT_EQ(tiered.getHintTier(lsm->getHeight()), 1);
+
+    delete lsm;
+}
\ No newline at end of file
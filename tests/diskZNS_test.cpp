@@ -0,0 +1,122 @@
+#include <disk/diskZNS.hpp>
+#include <index/lsmtree.hpp>
+#include <index/falsmtree.hpp>
+#include <string>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(diskZNSBasicTest, interface)
+{
+    DiskZNS* disk = new DiskZNS_SamsungK9F1G08U0D();
+
+    EXPECT_EQ(std::string(disk->getLowLevelController().getModelName()), std::string("ZNS:samsungK9F1G08U0D"));
+    EXPECT_EQ(disk->getZNSModel().getNumZones(), 128);
+    EXPECT_FALSE(disk->getZNSModel().isPlacementIsolation());
+
+    disk->setPlacementIsolation(true);
+    EXPECT_TRUE(disk->getZNSModel().isPlacementIsolation());
+
+    delete disk;
+}
+
+GTEST_TEST(diskZNSBasicTest, lsmZonePerLevel)
+{
+    const size_t pageSize = 2048;
+    const size_t zoneSize = pageSize * 32;
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = 2048;
+    const size_t headTreeSize = 2 * nodeSize;
+    const size_t lvlRatio = 2;
+
+    LSMTree* shared = new LSMTree(new DiskZNS(new MemoryControllerZNS(new MemoryModelZNS("zns", pageSize, zoneSize, 1.0, 10.0, 100.0, zoneSize, 16, 8))), keySize, dataSize, nodeSize, headTreeSize, lvlRatio);
+    LSMTree* isolated = new LSMTree(new DiskZNS(new MemoryControllerZNS(new MemoryModelZNS("zns", pageSize, zoneSize, 1.0, 10.0, 100.0, zoneSize, 16, 8))), keySize, dataSize, nodeSize, headTreeSize, lvlRatio);
+
+    EXPECT_FALSE(isolated->isZonePerLevel());
+    isolated->setZonePerLevel(true);
+    EXPECT_TRUE(isolated->isZonePerLevel());
+
+    const double sharedTime = shared->insertEntries(5000);
+    const double isolatedTime = isolated->insertEntries(5000);
+
+    const MemoryModelZNS& sharedZNS = dynamic_cast<const DiskZNS&>(shared->getDisk()).getZNSModel();
+    const MemoryModelZNS& isolatedZNS = dynamic_cast<const DiskZNS&>(isolated->getDisk()).getZNSModel();
+
+    // the same data is written, but each level has its own zones, so dropped level frees whole zones
+    EXPECT_EQ(isolatedZNS.getHostWrittenPages(), sharedZNS.getHostWrittenPages());
+    EXPECT_EQ(isolatedZNS.getGCWrittenPages(), 0);
+    EXPECT_DOUBLE_EQ(isolatedZNS.getWriteAmplification(), 1.0);
+    EXPECT_GT(isolatedZNS.getOpenZones(), sharedZNS.getOpenZones());
+    EXPECT_LE(isolatedTime, sharedTime);
+
+    delete shared;
+    delete isolated;
+}
+
+GTEST_TEST(diskZNSBasicTest, falsmZonePerLevel)
+{
+    const size_t pageSize = 2048;
+    const size_t zoneSize = pageSize * 32;
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = 2048;
+    const size_t headTreeSize = 2 * nodeSize;
+    const size_t lvlRatio = 2;
+
+    FALSMTree* shared = new FALSMTree(new DiskZNS(new MemoryControllerZNS(new MemoryModelZNS("zns", pageSize, zoneSize, 1.0, 10.0, 100.0, zoneSize, 16, 8))), keySize, dataSize, nodeSize, headTreeSize, lvlRatio, 2);
+    FALSMTree* isolated = new FALSMTree(new DiskZNS(new MemoryControllerZNS(new MemoryModelZNS("zns", pageSize, zoneSize, 1.0, 10.0, 100.0, zoneSize, 16, 8))), keySize, dataSize, nodeSize, headTreeSize, lvlRatio, 2);
+    isolated->setZonePerLevel(true);
+
+    const double sharedTime = shared->insertEntries(5000);
+    const double isolatedTime = isolated->insertEntries(5000);
+
+    const MemoryModelZNS& sharedZNS = dynamic_cast<const DiskZNS&>(shared->getDisk()).getZNSModel();
+    const MemoryModelZNS& isolatedZNS = dynamic_cast<const DiskZNS&>(isolated->getDisk()).getZNSModel();
+
+    // the same data is written, but each level has its own zones, so dropped level frees whole zones
+    EXPECT_EQ(isolatedZNS.getHostWrittenPages(), sharedZNS.getHostWrittenPages());
+    EXPECT_EQ(isolatedZNS.getGCWrittenPages(), 0);
+    EXPECT_DOUBLE_EQ(isolatedZNS.getWriteAmplification(), 1.0);
+    EXPECT_GT(isolatedZNS.getOpenZones(), sharedZNS.getOpenZones());
+    EXPECT_LE(isolatedTime, sharedTime);
+
+    delete shared;
+    delete isolated;
+}
+
+GTEST_TEST(diskZNSBasicTest, copy)
+{
+    Disk* disk = new DiskZNS_SamsungK9F1G08U0D();
+    const double readTime = 35.0 / 1000000.0;
+
+    uintptr_t addr = 0;
+
+    EXPECT_DOUBLE_EQ(disk->readBytes(addr, 100), readTime);
+    EXPECT_DOUBLE_EQ(disk->readBytes(addr + 10000, 100), readTime);
+
+    EXPECT_EQ(disk->getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 2);
+    EXPECT_EQ(disk->getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES).second, 200);
+    EXPECT_DOUBLE_EQ(disk->getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME).second, readTime * 2);
+
+    DiskZNS* copy = new DiskZNS(*dynamic_cast<DiskZNS*>(disk));
+
+    EXPECT_EQ(copy->getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 2);
+    EXPECT_DOUBLE_EQ(copy->getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME).second, readTime * 2);
+    EXPECT_EQ(copy->getZNSModel().getNumZones(), 128);
+
+    DiskZNS copy2;
+    copy2 = *copy;
+
+    EXPECT_EQ(copy2.getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 2);
+    EXPECT_DOUBLE_EQ(copy2.getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME).second, readTime * 2);
+
+    DiskZNS copy3(std::move(copy2));
+
+    EXPECT_EQ(copy3.getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 2);
+    EXPECT_DOUBLE_EQ(copy3.getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME).second, readTime * 2);
+
+    delete copy;
+    delete disk;
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include <observability/downsampledSeries.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(downsampledSeriesBasicTest, interface)
+{
+    DownsampledSeries series(8);
+
+    EXPECT_EQ(series.getMaxPoints(), 8);
+    EXPECT_EQ(series.getBucketSize(), 1);
+    EXPECT_EQ(series.getNumValues(), 0);
+    EXPECT_EQ(series.getNumPoints(), 0);
+    EXPECT_DOUBLE_EQ(series.getSum(), 0.0);
+    EXPECT_DOUBLE_EQ(series.getMin(), 0.0);
+    EXPECT_DOUBLE_EQ(series.getMax(), 0.0);
+    EXPECT_DOUBLE_EQ(series.getMean(), 0.0);
+    EXPECT_EQ(series.getPoints().size(), 0);
+
+    // max points has to be even and at least 2
+    EXPECT_EQ(DownsampledSeries(0).getMaxPoints(), 2);
+    EXPECT_EQ(DownsampledSeries(1).getMaxPoints(), 2);
+    EXPECT_EQ(DownsampledSeries(7).getMaxPoints(), 8);
+}
+
+GTEST_TEST(downsampledSeriesBasicTest, withoutDownsampling)
+{
+    DownsampledSeries series(8);
+
+    for (size_t i = 0; i < 7; ++i)
+        series.addValue(static_cast<double>(i));
+
+    EXPECT_EQ(series.getBucketSize(), 1);
+    EXPECT_EQ(series.getNumValues(), 7);
+    EXPECT_EQ(series.getNumPoints(), 7);
+    EXPECT_DOUBLE_EQ(series.getSum(), 21.0);
+    EXPECT_DOUBLE_EQ(series.getMin(), 0.0);
+    EXPECT_DOUBLE_EQ(series.getMax(), 6.0);
+    EXPECT_DOUBLE_EQ(series.getMean(), 3.0);
+
+    const std::vector<double> points = series.getPoints();
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(points[i], static_cast<double>(i));
+        EXPECT_EQ(series.getPointFirstValue(i), i);
+    }
+}
+
+GTEST_TEST(downsampledSeriesBasicTest, downsampling)
+{
+    DownsampledSeries series(4);
+
+    // 4 full buckets are merged into 2 buckets of 2 values
+    for (size_t i = 0; i < 4; ++i)
+        series.addValue(static_cast<double>(i));
+
+    EXPECT_EQ(series.getBucketSize(), 2);
+    EXPECT_EQ(series.getNumPoints(), 2);
+    EXPECT_DOUBLE_EQ(series.getPoints()[0], 0.5);
+    EXPECT_DOUBLE_EQ(series.getPoints()[1], 2.5);
+
+    // not full bucket is visible as the last point
+    series.addValue(4.0);
+    EXPECT_EQ(series.getNumPoints(), 3);
+    EXPECT_DOUBLE_EQ(series.getPoints()[2], 4.0);
+
+    series.addValue(6.0);
+    EXPECT_EQ(series.getNumPoints(), 3);
+    EXPECT_DOUBLE_EQ(series.getPoints()[2], 5.0);
+
+    for (size_t i = 6; i < 8; ++i)
+        series.addValue(static_cast<double>(i));
+
+    EXPECT_EQ(series.getBucketSize(), 4);
+    EXPECT_EQ(series.getNumPoints(), 2);
+    EXPECT_DOUBLE_EQ(series.getPoints()[0], 1.5);
+    EXPECT_DOUBLE_EQ(series.getPoints()[1], 5.75);
+    EXPECT_EQ(series.getPointFirstValue(1), 4);
+
+    // aggregates are exact
+    EXPECT_EQ(series.getNumValues(), 8);
+    EXPECT_DOUBLE_EQ(series.getSum(), 29.0);
+    EXPECT_DOUBLE_EQ(series.getMin(), 0.0);
+    EXPECT_DOUBLE_EQ(series.getMax(), 7.0);
+    EXPECT_DOUBLE_EQ(series.getMean(), 29.0 / 8.0);
+}
+
+GTEST_TEST(downsampledSeriesBasicTest, constantMemory)
+{
+    DownsampledSeries series(16);
+
+    for (size_t i = 0; i < 100000; ++i)
+        series.addValue(1.0);
+
+    EXPECT_LE(series.getNumPoints(), 16);
+    EXPECT_EQ(series.getNumValues(), 100000);
+    EXPECT_DOUBLE_EQ(series.getSum(), 100000.0);
+
+    for (const auto point : series.getPoints())
+        EXPECT_DOUBLE_EQ(point, 1.0);
+}
+
+GTEST_TEST(downsampledSeriesBasicTest, reset)
+{
+    DownsampledSeries series(2);
+
+    for (size_t i = 0; i < 10; ++i)
+        series.addValue(static_cast<double>(i));
+
+    EXPECT_GT(series.getBucketSize(), 1);
+
+    series.reset();
+
+    EXPECT_EQ(series.getMaxPoints(), 2);
+    EXPECT_EQ(series.getBucketSize(), 1);
+    EXPECT_EQ(series.getNumValues(), 0);
+    EXPECT_EQ(series.getNumPoints(), 0);
+    EXPECT_DOUBLE_EQ(series.getSum(), 0.0);
+}
+
+GTEST_TEST(downsampledSeriesBasicTest, copy)
+{
+    DownsampledSeries series(4);
+    for (size_t i = 0; i < 5; ++i)
+        series.addValue(static_cast<double>(i));
+
+    DownsampledSeries copy(series);
+    EXPECT_EQ(copy.getBucketSize(), series.getBucketSize());
+    EXPECT_EQ(copy.getPoints(), series.getPoints());
+    EXPECT_EQ(copy.toStringFull(), series.toStringFull());
+
+    DownsampledSeries copy2;
+    copy2 = copy;
+    EXPECT_EQ(copy2.getPoints(), series.getPoints());
+    EXPECT_DOUBLE_EQ(copy2.getSum(), series.getSum());
+}
\ No newline at end of file
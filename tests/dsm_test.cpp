@@ -513,3 +513,111 @@ GTEST_TEST(dsmBasicTest, delete)
 
     delete index;
 }
+
+GTEST_TEST(dsmBasicTest, concurrentColumns)
+{
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t numEntries = 512; // pages of columns = {1, 1, 2, 1, 1, 1}
+    const double writeTime = 45.0 / 1000000.0;
+    const double readTime = 21.0 / 1000000.0;
+
+    // parallelism -> critical path in pages
+    const std::vector<std::pair<size_t, size_t>> expectedPages = { {1, 7}, {0, 2}, {2, 4}, {3, 3}, {6, 2}, {10, 2} };
+    for (const auto& [parallelism, pages] : expectedPages)
+    {
+        DSM* dsm = new DSM(new DiskSSD_Samsung840(), columns);
+        DBIndexColumn* index = dsm;
+
+        EXPECT_EQ(index->getColumnsParallelism(), 1);
+        index->setColumnsParallelism(parallelism);
+        EXPECT_EQ(index->getColumnsParallelism(), parallelism);
+
+        EXPECT_DOUBLE_EQ(index->bulkloadEntries(numEntries), pages * writeTime);
+
+        // copy keeps parallelism
+        DBIndexColumn* copy = index->clone();
+        EXPECT_EQ(copy->getColumnsParallelism(), parallelism);
+        delete copy;
+
+        // I/O is the same, only time is different
+        EXPECT_EQ(index->getDisk().getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES).second, numEntries * std::accumulate(columns.begin(), columns.end(), 0));
+
+        // key is scanned before other columns
+        const std::vector<size_t> columnsToFetch {3, 0, 2};
+        EXPECT_DOUBLE_EQ(index->findRangeEntries(columnsToFetch, static_cast<size_t>(1)), readTime + (parallelism == 1 ? 2.0 : 1.0) * readTime);
+        EXPECT_DOUBLE_EQ(index->findRangeEntries({0}, static_cast<size_t>(1)), readTime);
+
+        delete index;
+    }
+}
+
+GTEST_TEST(dsmBasicTest, findPredicate)
+{
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t numEntries = 1024 * 1024; // 1024 pages of key column
+    const double readTime = 21.0 / 1000000.0;
+    const double seqReadTime = 14.0 / 1000000.0;
+    const std::vector<size_t> columnsToFetch {3, 0, 2};
+
+    DSM* dsm = new DSM(new DiskSSD_Samsung840(), columns);
+    DBIndexColumn* index = dsm;
+
+    EXPECT_GT(index->bulkloadEntries(numEntries), 0.0);
+    EXPECT_EQ(dsm->getZoneMapEntries(), 0);
+
+    // 10485 contiguous entries, column 3 has 2048 entries per page, column 2 has 256 entries per page
+    const double lateMaterializationTime = (6 + 41) * seqReadTime;
+    EXPECT_NEAR(index->findPredicateEntries(columnsToFetch, 0.01, 1.0), 1024 * seqReadTime + lateMaterializationTime, 0.000001);
+
+    // contiguous qualifying entries cost the same as range search
+    EXPECT_NEAR(index->findPredicateEntries(columnsToFetch, 0.01, 1.0), index->findRangeEntries(columnsToFetch, 0.01), 0.000001);
+
+    // zone maps skip zones without qualifying keys
+    dsm->setZoneMapEntries(1024);
+    EXPECT_EQ(dsm->getZoneMapEntries(), 1024);
+    EXPECT_NEAR(index->findPredicateEntries(columnsToFetch, 0.01, 1.0), 11 * seqReadTime + lateMaterializationTime, 0.000001);
+
+    // 104 entries spread over all pages, each touched page is a random read
+    EXPECT_NEAR(index->findPredicateEntries(columnsToFetch, 0.0001, 0.0), (100 + 95 + 104) * readTime, 0.000001);
+    EXPECT_LT(index->findPredicateEntries(columnsToFetch, 0.0001, 1.0), index->findPredicateEntries(columnsToFetch, 0.0001, 0.5));
+    EXPECT_LT(index->findPredicateEntries(columnsToFetch, 0.0001, 0.5), index->findPredicateEntries(columnsToFetch, 0.0001, 0.0));
+
+    // nothing qualifies
+    EXPECT_DOUBLE_EQ(index->findPredicateEntries(columnsToFetch, 0.0, 0.0), 0.0);
+
+    EXPECT_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_OPERATIONS).second, 10);
+
+    DSM* copy = new DSM(*dsm);
+    EXPECT_EQ(copy->getZoneMapEntries(), 1024);
+    delete copy;
+
+    delete index;
+}
+
+GTEST_TEST(dsmBasicTest, findPredicateLowClustering)
+{
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t numEntries = 1024 * 1024; // 1024 pages of key column
+    const double seqReadTime = 14.0 / 1000000.0;
+    const std::vector<size_t> columnsToFetch {3, 0, 2};
+
+    DSM* dsm = new DSM(new DiskSSD_Samsung840(), columns);
+    DBIndexColumn* index = dsm;
+
+    EXPECT_GT(index->bulkloadEntries(numEntries), 0.0);
+
+    // spread entries touch almost every zone and page, so random reads would cost more than sequential scan of columns
+    const double scanTime = (1024 + 512 + 4096) * seqReadTime;
+    const double withoutZoneMaps = index->findPredicateEntries(columnsToFetch, 0.01, 0.0);
+    EXPECT_NEAR(withoutZoneMaps, scanTime, 0.000001);
+
+    dsm->setZoneMapEntries(1024);
+    const double withZoneMaps = index->findPredicateEntries(columnsToFetch, 0.01, 0.0);
+    EXPECT_NEAR(withZoneMaps, scanTime, 0.000001);
+    EXPECT_LE(withZoneMaps, withoutZoneMaps);
+
+    // zone maps still help when entries are clustered
+    EXPECT_LT(index->findPredicateEntries(columnsToFetch, 0.01, 1.0), withoutZoneMaps);
+
+    delete index;
+}
@@ -2060,4 +2060,100 @@ GTEST_TEST(falsmtreeBasicTest, findRangeOverflowNode)
     }
 
     delete index;
-}
\ No newline at end of file
+}
+
+GTEST_TEST(falsmtreeBasicTest, backgroundCompaction)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t recordSize = keySize + dataSize;
+    const size_t nodeSize = ssd->getLowLevelController().getPageSize() * 10;
+    const size_t headTreeSize = nodeSize;
+    const size_t lvlRatio = 5;
+    const size_t numOperations = (headTreeSize / recordSize) * 50;
+
+    FALSMTree* foreground = new FALSMTree(ssd, keySize, dataSize, nodeSize, headTreeSize, lvlRatio);
+    FALSMTree* stalled = new FALSMTree(ssd->clone(), keySize, dataSize, nodeSize, headTreeSize, lvlRatio);
+    FALSMTree* background = new FALSMTree(ssd->clone(), keySize, dataSize, nodeSize, headTreeSize, lvlRatio);
+
+    stalled->setBackgroundCompaction(1, 1);
+    background->setBackgroundCompaction(4, 4);
+
+    EXPECT_FALSE(foreground->getBackgroundCompaction().isEnabled());
+    EXPECT_TRUE(background->getBackgroundCompaction().isEnabled());
+
+    for (size_t i = 0; i < numOperations; ++i)
+    {
+        foreground->insertEntries(1);
+        stalled->insertEntries(1);
+        background->insertEntries(1);
+    }
+
+    // topology does not depend on where merges are executed
+    EXPECT_EQ(background->getHeight(), foreground->getHeight());
+    EXPECT_EQ(background->getNumEntries(), foreground->getNumEntries());
+
+    EXPECT_DOUBLE_EQ(foreground->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second, 0.0);
+    EXPECT_EQ(foreground->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS).second, 0L);
+
+    EXPECT_GT(background->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second, 0.0);
+    EXPECT_GT(background->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS).second, 0L);
+    EXPECT_EQ(std::string(background->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).first), std::string("INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME"));
+
+    // foreground pays only for stalls
+    EXPECT_LT(background->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, foreground->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second);
+    EXPECT_LE(stalled->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, foreground->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second);
+    EXPECT_GT(stalled->getCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_OPERATIONS).second, 0L);
+    EXPECT_GE(stalled->getCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_TIME).second, background->getCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_TIME).second);
+    // with more threads merges overlap each other, so writes wait shorter than merges run
+    EXPECT_LT(background->getCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_TIME).second, background->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second);
+
+    background->resetCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME);
+    EXPECT_DOUBLE_EQ(background->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second, 0.0);
+    EXPECT_GT(background->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS).second, 0L);
+
+    background->resetAllCounters();
+    EXPECT_EQ(background->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS).second, 0L);
+    EXPECT_DOUBLE_EQ(background->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, 0.0);
+
+    delete foreground;
+    delete stalled;
+    delete background;
+}
+
+GTEST_TEST(falsmtreeBasicTest, backgroundCompactionOverlapsSearches)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t recordSize = keySize + dataSize;
+    const size_t nodeSize = ssd->getLowLevelController().getPageSize() * 10;
+    const size_t headTreeSize = nodeSize;
+    const size_t lvlRatio = 5;
+    const size_t entriesInBuffer = headTreeSize / recordSize;
+    const size_t numOperations = entriesInBuffer * 50;
+
+    FALSMTree* lsm = new FALSMTree(ssd, keySize, dataSize, nodeSize, headTreeSize, lvlRatio);
+    lsm->setBackgroundCompaction(1, 1);
+
+    // searches between flushes are foreground work, merges run while they are executed
+    for (size_t i = 0; i < numOperations; ++i)
+    {
+        lsm->insertEntries(1);
+        if (i % (entriesInBuffer / 4) == 0)
+            lsm->findPointEntries(static_cast<size_t>(1));
+    }
+
+    const double stall = lsm->getCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_TIME).second;
+    const double merge = lsm->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second;
+
+    EXPECT_GT(lsm->getCounter(IndexCounters::INDEX_COUNTER_RW_PSEARCH_TOTAL_TIME).second, 0.0);
+    EXPECT_GT(merge, 0.0);
+    EXPECT_LT(stall, merge);
+    EXPECT_LT(lsm->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, merge);
+
+    delete lsm;
+}
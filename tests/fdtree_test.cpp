@@ -1231,4 +1231,48 @@ GTEST_TEST(fdtreeBasicTest, bigFindRangeBatch)
     EXPECT_DOUBLE_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_TIME).second, 0.10079999999999958);
 
     delete index;
-}
\ No newline at end of file
+}
+
+GTEST_TEST(fdtreeBasicTest, backgroundMerge)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t recordSize = keySize + dataSize;
+    const size_t nodeSize = ssd->getLowLevelController().getPageSize();
+    const size_t headTreeSize = nodeSize;
+    const size_t lvlRatio = 5;
+    const size_t numOperations = (headTreeSize / recordSize) * 50;
+
+    FDTree* foreground = new FDTree(ssd, keySize, dataSize, nodeSize, headTreeSize, lvlRatio);
+    FDTree* background = new FDTree(ssd->clone(), keySize, dataSize, nodeSize, headTreeSize, lvlRatio);
+
+    background->setBackgroundCompaction(4, 4);
+
+    EXPECT_FALSE(foreground->getBackgroundCompaction().isEnabled());
+    EXPECT_TRUE(background->getBackgroundCompaction().isEnabled());
+
+    for (size_t i = 0; i < numOperations; ++i)
+    {
+        foreground->insertEntries(1);
+        background->insertEntries(1);
+    }
+
+    // topology does not depend on where merges are executed
+    EXPECT_EQ(background->getHeight(), foreground->getHeight());
+    EXPECT_EQ(background->getNumEntries(), foreground->getNumEntries());
+
+    EXPECT_DOUBLE_EQ(foreground->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second, 0.0);
+    EXPECT_EQ(foreground->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS).second, 0L);
+
+    EXPECT_GT(background->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second, 0.0);
+    EXPECT_GT(background->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS).second, 0L);
+
+    // foreground pays only for head tree and stalls
+    EXPECT_LT(background->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, foreground->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second);
+    EXPECT_LT(background->getCounter(IndexCounters::INDEX_COUNTER_RW_STALL_TOTAL_TIME).second, background->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second);
+
+    delete foreground;
+    delete background;
+}
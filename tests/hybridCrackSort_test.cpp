@@ -0,0 +1,328 @@
+#include <adaptiveMerging/hybridCrackSort.hpp>
+#include <disk/diskSSD.hpp>
+#include <disk/diskPCM.hpp>
+#include <string>
+#include <iostream>
+#include <index/bptree.hpp>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(hybridCrackSort, interfaceSSD)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t recordSize = keySize + dataSize;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize();
+    const size_t partitionSize = disk->getLowLevelController().getBlockSize();
+    const size_t startingEntries = 1000000;
+    const size_t numPartitions =  (startingEntries + (partitionSize / recordSize) - 1) / (partitionSize / recordSize);
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* hcs = new HybridCrackSort(index, startingEntries, partitionSize);
+
+    // check how to get some statistics
+    EXPECT_EQ(std::string(hcs->getName()), std::string("HybridCrackSort"));
+    EXPECT_EQ(hcs->getDisk().getLowLevelController().getMemoryWearOut(), 0);
+
+    for (auto id = IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME; id < IndexCounters::INDEX_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_DOUBLE_EQ(hcs->getCounter(id).second, 0.0);
+
+    for (auto id = IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < IndexCounters::INDEX_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(hcs->getCounter(id).second, 0L);
+
+    EXPECT_EQ(hcs->getNumEntries(), startingEntries);
+    EXPECT_EQ(hcs->getKeySize(), keySize);
+    EXPECT_EQ(hcs->getDataSize(), dataSize);
+    EXPECT_EQ(hcs->getRecordSize(), recordSize);
+    EXPECT_EQ(hcs->isBulkloadSupported(), false);
+
+    const HybridCrackSort::HCSPartitionManager& manager = dynamic_cast<const HybridCrackSort::HCSPartitionManager&>(dynamic_cast<HybridCrackSort*>(hcs)->getMemoryManager());
+    EXPECT_EQ(manager.getNumEntries(), startingEntries);
+    EXPECT_EQ(manager.getPartitionsRef().size(), numPartitions);
+    EXPECT_EQ(manager.getCracksRef().size(), numPartitions);
+    EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getCrackerIndexSize(), 0);
+
+    DBIndex* copy = hcs->clone();
+    EXPECT_EQ(std::string(copy->getName()), std::string("HybridCrackSort"));
+
+    delete copy;
+    delete hcs;
+}
+
+GTEST_TEST(hybridCrackSort, singleFindRangeSSD)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize();
+    const size_t partitionSize = disk->getLowLevelController().getBlockSize();
+    const size_t startingEntries = 1000000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* hcs = new HybridCrackSort(index, startingEntries, partitionSize);
+
+    EXPECT_GT(hcs->findRangeEntries(static_cast<size_t>(1)), 0.0);
+
+    EXPECT_NE(hcs->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, 0.0);
+    EXPECT_EQ(hcs->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS).second, 1);
+
+    EXPECT_EQ(hcs->getNumEntries(), startingEntries);
+    EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getMemoryManager().getNumEntries(), startingEntries - 1);
+    EXPECT_EQ(index->getNumEntries(), 1);
+
+    // 1 entry touches only 1 partition, which gets 2 cracks
+    EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getCrackerIndexSize(), 2 * (keySize + sizeof(uintptr_t)));
+    EXPECT_EQ(hcs->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_TOTAL_OPERATIONS).second, 1);
+
+    delete hcs;
+}
+
+GTEST_TEST(hybridCrackSort, cracksLoadedPartitionsSSD)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t recordSize = keySize + dataSize;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize();
+    const size_t partitionSize = disk->getLowLevelController().getBlockSize();
+    const size_t startingEntries = 100000;
+    const size_t entriesInPartition = partitionSize / recordSize;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    HybridCrackSort* hcs = new HybridCrackSort(index, startingEntries, partitionSize);
+    HybridCrackSort* hcsSameSeed = dynamic_cast<HybridCrackSort*>(hcs->clone());
+
+    for (size_t i = 0; i < 5; ++i)
+    {
+        hcs->findRangeEntries(static_cast<size_t>(3));
+        hcsSameSeed->findRangeEntries(static_cast<size_t>(3));
+    }
+
+    const HybridCrackSort::HCSPartitionManager& manager = dynamic_cast<const HybridCrackSort::HCSPartitionManager&>(hcs->getMemoryManager());
+
+    // partition is cracked if and only if query loaded entries from it
+    size_t entriesInPartitions = 0;
+    for (size_t i = 0; i < manager.getPartitionsRef().size(); ++i)
+    {
+        const size_t partitionEntries = std::min(entriesInPartition, startingEntries - i * entriesInPartition);
+        EXPECT_EQ(manager.getCracksRef()[i] > 0, manager.getPartitionsRef()[i].getNumEntries() < partitionEntries);
+
+        entriesInPartitions += manager.getPartitionsRef()[i].getNumEntries();
+    }
+
+    EXPECT_EQ(entriesInPartitions, manager.getNumEntries());
+    EXPECT_EQ(manager.getNumEntries() + index->getNumEntries(), startingEntries);
+
+    // partitions are chosen by seeded generator
+    EXPECT_EQ(manager.getCracksRef(), dynamic_cast<const HybridCrackSort::HCSPartitionManager&>(hcsSameSeed->getMemoryManager()).getCracksRef());
+
+    delete hcsSameSeed;
+    delete hcs;
+}
+
+GTEST_TEST(hybridCrackSort, fullFindRangeSSD)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize();
+    const size_t partitionSize = disk->getLowLevelController().getBlockSize();
+    const size_t startingEntries = 10000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* hcs = new HybridCrackSort(index, startingEntries, partitionSize);
+
+    size_t lastCrackerIndexSize = 0;
+    while (dynamic_cast<HybridCrackSort*>(hcs)->getMemoryManager().getNumEntries() > 0)
+    {
+        EXPECT_GT(hcs->findRangeEntries(0.1), 0.0);
+
+        EXPECT_EQ(hcs->getNumEntries(), startingEntries);
+        EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getMemoryManager().getNumEntries() + index->getNumEntries(), startingEntries);
+
+        EXPECT_GE(dynamic_cast<HybridCrackSort*>(hcs)->getCrackerIndexSize(), lastCrackerIndexSize);
+        lastCrackerIndexSize = dynamic_cast<HybridCrackSort*>(hcs)->getCrackerIndexSize();
+    }
+
+    EXPECT_EQ(index->getNumEntries(), startingEntries);
+    EXPECT_GT(dynamic_cast<HybridCrackSort*>(hcs)->getCrackerIndexSize(), 0);
+
+    EXPECT_NE(hcs->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_TOTAL_OPERATIONS).second, 0);
+    EXPECT_NE(hcs->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS).second, 0);
+
+    hcs->resetState();
+    EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getMemoryManager().getNumEntries(), startingEntries);
+    EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getCrackerIndexSize(), 0);
+
+    delete hcs;
+}
+
+GTEST_TEST(hybridCrackSort, singleDeleteSSD)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize();
+    const size_t partitionSize = disk->getLowLevelController().getBlockSize();
+    const size_t startingEntries = 1000000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* hcs = new HybridCrackSort(index, startingEntries, partitionSize);
+
+    EXPECT_GT(hcs->deleteEntries(), 0.0);
+
+    EXPECT_EQ(hcs->getNumEntries(), startingEntries - 1);
+    EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getMemoryManager().getNumEntries(), startingEntries - 1);
+    EXPECT_EQ(index->getNumEntries(), 0);
+
+    EXPECT_GT(hcs->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_INVALIDATION_TOTAL_TIME).second, 0.0);
+    EXPECT_EQ(hcs->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_INVALIDATION_TOTAL_OPERATIONS).second, 1);
+
+    delete hcs;
+}
+
+GTEST_TEST(hybridCrackSort, interfacePCM)
+{
+    Disk* disk = new DiskPCM_DefaultModel();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t recordSize = keySize + dataSize;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize() * 10;
+    const size_t pagesInPartition = 10 * 100;
+    const size_t partitionSize = disk->getLowLevelController().getPageSize() * pagesInPartition;
+    const size_t startingEntries = 1000000;
+    const size_t numPartitions =  (startingEntries + (partitionSize / recordSize) - 1) / (partitionSize / recordSize);
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* hcs = new HybridCrackSort(index, startingEntries, partitionSize);
+
+    // check how to get some statistics
+    EXPECT_EQ(std::string(hcs->getName()), std::string("HybridCrackSort"));
+    EXPECT_EQ(hcs->getDisk().getLowLevelController().getMemoryWearOut(), 0);
+
+    for (auto id = IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME; id < IndexCounters::INDEX_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_DOUBLE_EQ(hcs->getCounter(id).second, 0.0);
+
+    for (auto id = IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < IndexCounters::INDEX_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(hcs->getCounter(id).second, 0L);
+
+    EXPECT_EQ(hcs->getNumEntries(), startingEntries);
+    EXPECT_EQ(hcs->getKeySize(), keySize);
+    EXPECT_EQ(hcs->getDataSize(), dataSize);
+    EXPECT_EQ(hcs->getRecordSize(), recordSize);
+    EXPECT_EQ(hcs->isBulkloadSupported(), false);
+
+    const HybridCrackSort::HCSPartitionManager& manager = dynamic_cast<const HybridCrackSort::HCSPartitionManager&>(dynamic_cast<HybridCrackSort*>(hcs)->getMemoryManager());
+    EXPECT_EQ(manager.getNumEntries(), startingEntries);
+    EXPECT_EQ(manager.getPartitionsRef().size(), numPartitions);
+    EXPECT_EQ(manager.getCracksRef().size(), numPartitions);
+    EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getCrackerIndexSize(), 0);
+
+    DBIndex* copy = hcs->clone();
+    EXPECT_EQ(std::string(copy->getName()), std::string("HybridCrackSort"));
+
+    delete copy;
+    delete hcs;
+}
+
+GTEST_TEST(hybridCrackSort, singleFindRangePCM)
+{
+    Disk* disk = new DiskPCM_DefaultModel();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize() * 10;
+    const size_t pagesInPartition = 10 * 100;
+    const size_t partitionSize = disk->getLowLevelController().getPageSize() * pagesInPartition;
+    const size_t startingEntries = 1000000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* hcs = new HybridCrackSort(index, startingEntries, partitionSize);
+
+    EXPECT_GT(hcs->findRangeEntries(static_cast<size_t>(1)), 0.0);
+
+    EXPECT_NE(hcs->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, 0.0);
+    EXPECT_EQ(hcs->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS).second, 1);
+
+    EXPECT_EQ(hcs->getNumEntries(), startingEntries);
+    EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getMemoryManager().getNumEntries(), startingEntries - 1);
+    EXPECT_EQ(index->getNumEntries(), 1);
+
+    // 1 entry touches only 1 partition, which gets 2 cracks
+    EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getCrackerIndexSize(), 2 * (keySize + sizeof(uintptr_t)));
+    EXPECT_EQ(hcs->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_TOTAL_OPERATIONS).second, 1);
+
+    delete hcs;
+}
+
+GTEST_TEST(hybridCrackSort, fullFindRangePCM)
+{
+    Disk* disk = new DiskPCM_DefaultModel();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize() * 10;
+    const size_t pagesInPartition = 10 * 100;
+    const size_t partitionSize = disk->getLowLevelController().getPageSize() * pagesInPartition;
+    const size_t startingEntries = 10000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* hcs = new HybridCrackSort(index, startingEntries, partitionSize);
+
+    size_t lastCrackerIndexSize = 0;
+    while (dynamic_cast<HybridCrackSort*>(hcs)->getMemoryManager().getNumEntries() > 0)
+    {
+        EXPECT_GT(hcs->findRangeEntries(0.1), 0.0);
+
+        EXPECT_EQ(hcs->getNumEntries(), startingEntries);
+        EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getMemoryManager().getNumEntries() + index->getNumEntries(), startingEntries);
+
+        EXPECT_GE(dynamic_cast<HybridCrackSort*>(hcs)->getCrackerIndexSize(), lastCrackerIndexSize);
+        lastCrackerIndexSize = dynamic_cast<HybridCrackSort*>(hcs)->getCrackerIndexSize();
+    }
+
+    EXPECT_EQ(index->getNumEntries(), startingEntries);
+    EXPECT_GT(dynamic_cast<HybridCrackSort*>(hcs)->getCrackerIndexSize(), 0);
+
+    EXPECT_NE(hcs->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_TOTAL_OPERATIONS).second, 0);
+    EXPECT_NE(hcs->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS).second, 0);
+
+    hcs->resetState();
+    EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getMemoryManager().getNumEntries(), startingEntries);
+    EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getCrackerIndexSize(), 0);
+
+    delete hcs;
+}
+
+GTEST_TEST(hybridCrackSort, singleDeletePCM)
+{
+    Disk* disk = new DiskPCM_DefaultModel();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize() * 10;
+    const size_t pagesInPartition = 10 * 100;
+    const size_t partitionSize = disk->getLowLevelController().getPageSize() * pagesInPartition;
+    const size_t startingEntries = 1000000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* hcs = new HybridCrackSort(index, startingEntries, partitionSize);
+
+    EXPECT_GT(hcs->deleteEntries(), 0.0);
+
+    EXPECT_EQ(hcs->getNumEntries(), startingEntries - 1);
+    EXPECT_EQ(dynamic_cast<HybridCrackSort*>(hcs)->getMemoryManager().getNumEntries(), startingEntries - 1);
+    EXPECT_EQ(index->getNumEntries(), 0);
+
+    EXPECT_GT(hcs->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_INVALIDATION_TOTAL_TIME).second, 0.0);
+    EXPECT_EQ(hcs->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_INVALIDATION_TOTAL_OPERATIONS).second, 1);
+
+    delete hcs;
+}
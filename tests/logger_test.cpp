@@ -0,0 +1,116 @@
+#include <logger/logger.hpp>
+#include <spdlog/sinks/null_sink.h>
+#include <spdlog/sinks/ostream_sink.h>
+#include <string>
+#include <sstream>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+static size_t numBuiltStrings = 0;
+
+static std::string buildExpensiveString()
+{
+    ++numBuiltStrings;
+
+    return std::string("expensive");
+}
+
+GTEST_TEST(loggerTest, argumentsNotEvaluatedBelowActiveLevel)
+{
+    numBuiltStrings = 0;
+
+    // tests are compiled with LOGGER_ACTIVE_LEVEL=10, so every call is discarded in compile time
+    LOGGER_LOG_TRACE("{}", buildExpensiveString());
+    LOGGER_LOG_DEBUG("{}", buildExpensiveString());
+    LOGGER_LOG_INFO("{}", buildExpensiveString());
+    LOGGER_LOG_WARN("{}", buildExpensiveString());
+    LOGGER_LOG_ERROR("{}", buildExpensiveString());
+    LOGGER_LOG_CRITICAL("{}", buildExpensiveString());
+
+    EXPECT_EQ(numBuiltStrings, 0);
+}
+
+GTEST_TEST(loggerTest, macroAsSingleStatement)
+{
+    numBuiltStrings = 0;
+
+    if (numBuiltStrings == 0)
+        LOGGER_LOG_ERROR("{}", buildExpensiveString());
+    else
+        buildExpensiveString();
+
+    EXPECT_EQ(numBuiltStrings, 0);
+}
+
+// below tests check runtime path of macros, so compile time filter is disabled from here
+#undef LOGGER_ACTIVE_LEVEL
+#define LOGGER_ACTIVE_LEVEL 0
+
+GTEST_TEST(loggerTest, argumentsNotEvaluatedBelowRuntimeLevel)
+{
+    numBuiltStrings = 0;
+
+    const std::shared_ptr<spdlog::logger> prevLogger = spdlog::default_logger();
+    const spdlog::level::level_enum prevLevel = spdlog::get_level();
+
+    spdlog::set_default_logger(std::make_shared<spdlog::logger>("loggerTest", std::make_shared<spdlog::sinks::null_sink_st>()));
+    loggerSetLevel(LOGGER_LEVEL_ERROR);
+
+    LOGGER_LOG_TRACE("{}", buildExpensiveString());
+    LOGGER_LOG_DEBUG("{}", buildExpensiveString());
+    LOGGER_LOG_INFO("{}", buildExpensiveString());
+    LOGGER_LOG_WARN("{}", buildExpensiveString());
+
+    EXPECT_EQ(numBuiltStrings, 0);
+
+    LOGGER_LOG_ERROR("{}", buildExpensiveString());
+    LOGGER_LOG_CRITICAL("{}", buildExpensiveString());
+
+    EXPECT_EQ(numBuiltStrings, 2);
+
+    // level OFF filters everything
+    loggerSetLevel(LOGGER_LEVEL_OFF);
+    LOGGER_LOG_CRITICAL("{}", buildExpensiveString());
+
+    EXPECT_EQ(numBuiltStrings, 2);
+
+    spdlog::set_default_logger(prevLogger);
+    spdlog::set_level(prevLevel);
+}
+
+GTEST_TEST(loggerTest, stopDrainsAsyncQueue)
+{
+    const size_t numMessages = 10000;
+
+    const std::shared_ptr<spdlog::logger> prevLogger = spdlog::default_logger();
+    const spdlog::level::level_enum prevLevel = spdlog::get_level();
+
+    std::ostringstream output;
+    std::shared_ptr<spdlog::sinks::ostream_sink_st> sink = std::make_shared<spdlog::sinks::ostream_sink_st>(output);
+    sink->set_pattern("%v");
+
+    loggerStart(std::vector<spdlog::sink_ptr>{sink});
+    loggerSetLevel(LOGGER_LEVEL_INFO);
+
+    for (size_t i = 0; i < numMessages; ++i)
+        LOGGER_LOG_INFO("loggerTestMessage {}", i);
+
+    // writer thread may be still behind, stop has to write all queued messages
+    loggerStop();
+
+    std::istringstream lines(output.str());
+    std::string line;
+    size_t numLines = 0;
+    while (std::getline(lines, line))
+        if (line.rfind("loggerTestMessage ", 0) == 0)
+        {
+            EXPECT_EQ(line, std::string("loggerTestMessage ") + std::to_string(numLines));
+            ++numLines;
+        }
+
+    EXPECT_EQ(numLines, numMessages);
+
+    spdlog::set_default_logger(prevLogger);
+    spdlog::set_level(prevLevel);
+}
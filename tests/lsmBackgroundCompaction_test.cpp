@@ -0,0 +1,96 @@
+#include <index/lsmBackgroundCompaction.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(lsmBackgroundCompactionTest, interface)
+{
+    LSMBackgroundCompaction compaction(2, 4);
+
+    EXPECT_TRUE(compaction.isEnabled());
+    EXPECT_EQ(compaction.getCompactionThreads(), 2);
+    EXPECT_EQ(compaction.getWriteStallThreshold(), 4);
+    EXPECT_DOUBLE_EQ(compaction.getClock(), 0.0);
+    EXPECT_EQ(compaction.getNumPendingCompactions(), 0);
+    EXPECT_DOUBLE_EQ(compaction.getBackgroundTime(), 0.0);
+    EXPECT_EQ(compaction.getBackgroundOperations(), 0);
+    EXPECT_DOUBLE_EQ(compaction.getStallTime(), 0.0);
+    EXPECT_EQ(compaction.getStallOperations(), 0);
+
+    LSMBackgroundCompaction fixed(1, 0);
+    EXPECT_EQ(fixed.getWriteStallThreshold(), 1);
+}
+
+GTEST_TEST(lsmBackgroundCompactionTest, foregroundMode)
+{
+    LSMBackgroundCompaction compaction;
+
+    EXPECT_FALSE(compaction.isEnabled());
+    EXPECT_DOUBLE_EQ(compaction.chargeCompaction(10.0), 10.0);
+
+    compaction.advanceClock(5.0);
+    EXPECT_DOUBLE_EQ(compaction.getClock(), 0.0);
+    EXPECT_EQ(compaction.getBackgroundOperations(), 0);
+}
+
+GTEST_TEST(lsmBackgroundCompactionTest, singleThreadStall)
+{
+    LSMBackgroundCompaction compaction(1, 1);
+
+    // first merge goes to background
+    EXPECT_DOUBLE_EQ(compaction.chargeCompaction(10.0), 0.0);
+    EXPECT_EQ(compaction.getNumPendingCompactions(), 1);
+
+    // second flush has to wait for first merge
+    compaction.advanceClock(4.0);
+    EXPECT_DOUBLE_EQ(compaction.chargeCompaction(10.0), 6.0);
+    EXPECT_DOUBLE_EQ(compaction.getClock(), 10.0);
+
+    // merge finished during foreground work, no stall
+    compaction.advanceClock(10.0);
+    EXPECT_DOUBLE_EQ(compaction.chargeCompaction(10.0), 0.0);
+
+    EXPECT_DOUBLE_EQ(compaction.getBackgroundTime(), 30.0);
+    EXPECT_EQ(compaction.getBackgroundOperations(), 3);
+    EXPECT_DOUBLE_EQ(compaction.getStallTime(), 6.0);
+    EXPECT_EQ(compaction.getStallOperations(), 1);
+
+    compaction.resetCounters();
+    EXPECT_DOUBLE_EQ(compaction.getBackgroundTime(), 0.0);
+    EXPECT_EQ(compaction.getStallOperations(), 0);
+    EXPECT_EQ(compaction.getNumPendingCompactions(), 1);
+
+    compaction.resetState();
+    EXPECT_DOUBLE_EQ(compaction.getClock(), 0.0);
+    EXPECT_EQ(compaction.getNumPendingCompactions(), 0);
+}
+
+GTEST_TEST(lsmBackgroundCompactionTest, multipleThreads)
+{
+    LSMBackgroundCompaction compaction(2, 2);
+
+    // 2 merges run in parallel
+    EXPECT_DOUBLE_EQ(compaction.chargeCompaction(10.0), 0.0);
+    EXPECT_DOUBLE_EQ(compaction.chargeCompaction(10.0), 0.0);
+    EXPECT_EQ(compaction.getNumPendingCompactions(), 2);
+
+    // third waits only for the earliest one
+    EXPECT_DOUBLE_EQ(compaction.chargeCompaction(10.0), 10.0);
+    EXPECT_EQ(compaction.getNumPendingCompactions(), 1);
+    EXPECT_EQ(compaction.getStallOperations(), 1);
+}
+
+GTEST_TEST(lsmBackgroundCompactionTest, threadsQueue)
+{
+    // high threshold: merges queue on single thread without stalls
+    LSMBackgroundCompaction compaction(1, 10);
+
+    for (size_t i = 0; i < 5; ++i)
+        EXPECT_DOUBLE_EQ(compaction.chargeCompaction(10.0), 0.0);
+
+    EXPECT_EQ(compaction.getNumPendingCompactions(), 5);
+
+    compaction.advanceClock(25.0);
+    EXPECT_EQ(compaction.getNumPendingCompactions(), 3);
+}
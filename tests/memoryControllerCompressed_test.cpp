@@ -0,0 +1,63 @@
+#include <storage/memoryControllerCompressed.hpp>
+#include <storage/memoryModelSSD.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(compressedControllerBasicTest, interface)
+{
+    MemoryModelSSD ssd("ssd", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+
+    MemoryControllerCompressed controller(new MemoryModelCompressed(ssd, 0.5, 0.0, 0.0));
+
+    EXPECT_EQ(std::string(controller.getModelName()), std::string("Compressed"));
+    EXPECT_EQ(controller.getPageSize(), 2048);
+    EXPECT_EQ(controller.getBlockSize(), 2048 * 32);
+    EXPECT_EQ(controller.getMemoryWearOut(), 0);
+    EXPECT_DOUBLE_EQ(controller.getCompressedModel().getCompressionRatio(), 0.5);
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME; id < MemoryCounters::MEMORY_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_DOUBLE_EQ(controller.getCounter(id).second, 0.0);
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES; id < MemoryCounters::MEMORY_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(controller.getCounter(id).second, 0L);
+}
+
+GTEST_TEST(compressedControllerBasicTest, readWrite)
+{
+    MemoryModelSSD ssd("ssd", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+
+    MemoryControllerCompressed controller(new MemoryModelCompressed(ssd, 0.5, 0.0, 0.0));
+    controller.setHintCompressionRatio(1, 0.25);
+
+    EXPECT_DOUBLE_EQ(controller.writeBytes(0, 8 * 2048), 0.0);
+    EXPECT_DOUBLE_EQ(controller.flushCache(), 4 * 0.2);
+
+    // controller counts raw bytes, device gets compressed bytes
+    EXPECT_EQ(controller.getCounter(MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES).second, 8 * 2048);
+    EXPECT_EQ(controller.getMemoryWearOut(), 4 * 2048);
+
+    EXPECT_DOUBLE_EQ(controller.setPlacementHint(1, 8 * 2048), 0.0);
+    EXPECT_DOUBLE_EQ(controller.readBytes(0, 16 * 2048), 4 * 0.1);
+}
+
+GTEST_TEST(compressedControllerBasicTest, copy)
+{
+    MemoryModelSSD ssd("ssd", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+
+    MemoryControllerCompressed controller(new MemoryModelCompressed(ssd, 0.5, 0.0, 0.0));
+    controller.setHintCompressionRatio(1, 0.25);
+
+    MemoryController* copy = controller.clone();
+    EXPECT_DOUBLE_EQ(dynamic_cast<MemoryControllerCompressed*>(copy)->getCompressedModel().getHintCompressionRatio(1), 0.25);
+
+    MemoryControllerCompressed copy2;
+    copy2 = *dynamic_cast<MemoryControllerCompressed*>(copy);
+    EXPECT_DOUBLE_EQ(copy2.getCompressedModel().getHintCompressionRatio(1), 0.25);
+
+    MemoryControllerCompressed moved(std::move(copy2));
+    EXPECT_DOUBLE_EQ(moved.getCompressedModel().getCompressionRatio(), 0.5);
+
+    delete copy;
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include <storage/memoryControllerFlashNandPageFTL.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(flashNandPageFTLControllerBasicTest, interface)
+{
+    const char* const modelName = "flashNandPageFTL";
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelFlashNandPageFTL* memory = new MemoryModelFlashNandPageFTL(modelName, pageSize, blockSize, 1.0, 10.0, 100.0, 16 * pageSize, 0.25);
+    MemoryControllerFlashNandPageFTL controller(memory);
+
+    EXPECT_EQ(std::string(controller.getModelName()), std::string(modelName));
+    EXPECT_EQ(controller.getPageSize(), pageSize);
+    EXPECT_EQ(controller.getBlockSize(), blockSize);
+    EXPECT_EQ(controller.getMemoryWearOut(), 0);
+    EXPECT_EQ(controller.getPageFTLModel().getLogicalPages(), 16);
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME; id < MemoryCounters::MEMORY_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_DOUBLE_EQ(controller.getCounter(id).second, 0.0);
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES; id < MemoryCounters::MEMORY_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(controller.getCounter(id).second, 0L);
+
+    MemoryModel* generalMemory = new MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D();
+    MemoryController generalController(generalMemory);
+    EXPECT_EQ(std::string(generalController.getModelName()), std::string("FlashNandPageFTL:samsungK9F1G08U0D"));
+    EXPECT_EQ(generalController.getPageSize(), 2048);
+    EXPECT_EQ(generalController.getBlockSize(), 2048 * 32);
+    EXPECT_EQ(generalController.getMemoryWearOut(), 0);
+}
+
+GTEST_TEST(flashNandPageFTLControllerBasicTest, garbageCollection)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelFlashNandPageFTL* memory = new MemoryModelFlashNandPageFTL("flashNandPageFTL", pageSize, blockSize, 1.0, 10.0, 100.0, 16 * pageSize, 0.25);
+    MemoryControllerFlashNandPageFTL controller(memory);
+
+    uintptr_t addr = 0;
+    // writes wait in cache until flush
+    EXPECT_DOUBLE_EQ(controller.writeBytes(addr, 16 * pageSize), 0.0);
+    EXPECT_GT(controller.flushCache(), 0.0);
+
+    for (size_t i = 0; i < 200; ++i)
+    {
+        EXPECT_DOUBLE_EQ(controller.overwriteBytes(addr, pageSize), 0.0);
+        EXPECT_GT(controller.flushCache(), 0.0);
+    }
+
+    EXPECT_GT(controller.getPageFTLModel().getGCOperations(), 0);
+    EXPECT_GT(controller.getPageFTLModel().getWriteAmplification(), 1.0);
+    EXPECT_EQ(controller.getMemoryWearOut(), (controller.getPageFTLModel().getHostWrittenPages() + controller.getPageFTLModel().getGCWrittenPages()) * pageSize);
+
+    controller.resetState();
+    EXPECT_EQ(controller.getMemoryWearOut(), 0);
+    EXPECT_EQ(controller.getPageFTLModel().getGCOperations(), 0);
+    EXPECT_DOUBLE_EQ(controller.getPageFTLModel().getWriteAmplification(), 1.0);
+}
+
+GTEST_TEST(flashNandPageFTLControllerBasicTest, copy)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelFlashNandPageFTL* memory = new MemoryModelFlashNandPageFTL("flashNandPageFTL", pageSize, blockSize, 1.0, 10.0, 100.0, 16 * pageSize, 0.25);
+    MemoryControllerFlashNandPageFTL* controller = new MemoryControllerFlashNandPageFTL(memory);
+
+    uintptr_t addr = 0;
+    EXPECT_DOUBLE_EQ(controller->readBytes(addr, 100), 1.0);
+    EXPECT_EQ(controller->getCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 1);
+
+    MemoryControllerFlashNandPageFTL* copy = new MemoryControllerFlashNandPageFTL(*controller);
+    EXPECT_EQ(copy->getCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 1);
+    EXPECT_EQ(copy->getPageFTLModel().getLogicalPages(), 16);
+
+    MemoryControllerFlashNandPageFTL copy2(*copy);
+    EXPECT_EQ(copy2.getCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 1);
+
+    MemoryControllerFlashNandPageFTL copy3(std::move(copy2));
+    EXPECT_EQ(copy3.getCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 1);
+    EXPECT_EQ(copy3.getPageFTLModel().getLogicalPages(), 16);
+
+    delete copy;
+    delete controller;
+}
\ No newline at end of file
@@ -34,6 +34,52 @@ GTEST_TEST(pcmControllerBasicTest, interface)
     EXPECT_EQ(generalController.getMemoryWearOut(), 0);
 }
 
+GTEST_TEST(pcmControllerBasicTest, wearLeveling)
+{
+    const size_t pageSize = 8;
+    const double readTime = 0.1;
+    const double writeTime = 2.0;
+
+    MemoryModelPCM* memory = new MemoryModelPCM("pcm", pageSize, readTime, writeTime);
+    MemoryControllerPCM controller(memory);
+
+    EXPECT_DOUBLE_EQ(controller.setWearLeveling(MemoryModelPCM::WEAR_LEVELING_SECURITY_REFRESH, 64 * pageSize, 8), 0.0);
+    EXPECT_EQ(controller.getPCMModel().getWearLeveling(), MemoryModelPCM::WEAR_LEVELING_SECURITY_REFRESH);
+    EXPECT_EQ(controller.getPCMModel().getLevelingLines(), 64);
+
+    EXPECT_DOUBLE_EQ(controller.writeBytes(0, 16 * pageSize), 0.0);
+    EXPECT_GE(controller.flushCache(), 16 * writeTime);
+    EXPECT_EQ(controller.getPCMModel().getLevelingMoves(), 2);
+}
+
+GTEST_TEST(pcmControllerBasicTest, differentialWrite)
+{
+    const size_t pageSize = 8;
+    const double readTime = 0.1;
+    const double writeTime = 2.0;
+
+    MemoryModelPCM* memory = new MemoryModelPCM("pcm", pageSize, readTime, writeTime);
+    MemoryControllerPCM controller(memory);
+
+    EXPECT_DOUBLE_EQ(controller.writeBytes(0, 4 * pageSize), 0.0);
+    EXPECT_DOUBLE_EQ(controller.setDifferentialWrite(MemoryModelPCM::DIFFERENTIAL_WRITE_DCW), 4.0 * writeTime);
+    EXPECT_EQ(controller.getPCMModel().getDifferentialWrite(), MemoryModelPCM::DIFFERENTIAL_WRITE_DCW);
+
+    // 2 bytes with half of bits changed = 1 byte of 8 bytes in line, rest of the line is read before write
+    EXPECT_DOUBLE_EQ(controller.getBitChangeRatio(), MemoryController::defaultBitChangeRatio);
+    EXPECT_DOUBLE_EQ(controller.overwriteBytes(0, 2), 0.0);
+    EXPECT_DOUBLE_EQ(controller.flushCache(), readTime + readTime + writeTime / 8.0);
+    EXPECT_DOUBLE_EQ(controller.getPCMModel().getOverwriteBitChangeRatio(), 1.0 / 8.0);
+
+    // ratios of requests are summed for each line
+    controller.setBitChangeRatio(0.25);
+    EXPECT_DOUBLE_EQ(controller.overwriteBytes(0, pageSize), 0.0);
+    controller.setBitChangeRatio(0.5);
+    EXPECT_DOUBLE_EQ(controller.overwriteBytes(pageSize, pageSize), 0.0);
+    EXPECT_DOUBLE_EQ(controller.flushCache(), 2.0 * readTime + 2.0 * writeTime * 0.375);
+    EXPECT_DOUBLE_EQ(controller.getPCMModel().getOverwriteBitChangeRatio(), 0.375);
+}
+
 GTEST_TEST(pcmControllerBasicTest, copy)
 {
     const char* const modelName = "pcm";
@@ -0,0 +1,75 @@
+#include <storage/memoryControllerStriped.hpp>
+#include <storage/memoryModelSSD.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(stripedControllerBasicTest, interface)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 32;
+    const size_t numDisks = 4;
+    const size_t stripeUnit = 4 * pageSize;
+
+    MemoryModelSSD ssd("ssd", pageSize, blockSize, 1.0, 2.0, 0.1, 0.2, 10.0);
+    MemoryControllerStriped controller(new MemoryModelStriped(ssd, numDisks, stripeUnit));
+
+    EXPECT_EQ(std::string(controller.getModelName()), std::string("RAID-0"));
+    EXPECT_EQ(controller.getPageSize(), pageSize);
+    EXPECT_EQ(controller.getBlockSize(), blockSize);
+    EXPECT_EQ(controller.getMemoryWearOut(), 0);
+    EXPECT_EQ(controller.getStripedModel().getNumDisks(), numDisks);
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME; id < MemoryCounters::MEMORY_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_DOUBLE_EQ(controller.getCounter(id).second, 0.0);
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES; id < MemoryCounters::MEMORY_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(controller.getCounter(id).second, 0L);
+}
+
+GTEST_TEST(stripedControllerBasicTest, copy)
+{
+    const size_t pageSize = 2048;
+    const size_t numDisks = 4;
+    const size_t stripeUnit = 4 * pageSize;
+
+    MemoryModelSSD ssd("ssd", pageSize, pageSize * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+    MemoryControllerStriped controller(new MemoryModelStriped(ssd, numDisks, stripeUnit, true));
+
+    MemoryController* copy = controller.clone();
+    EXPECT_EQ(std::string(copy->getModelName()), std::string("RAID-10"));
+    EXPECT_EQ(dynamic_cast<MemoryControllerStriped*>(copy)->getStripedModel().getNumMembers(), 2 * numDisks);
+
+    MemoryControllerStriped copy2;
+    copy2 = *dynamic_cast<MemoryControllerStriped*>(copy);
+    EXPECT_EQ(copy2.getStripedModel().getNumMembers(), 2 * numDisks);
+
+    MemoryControllerStriped moved(std::move(copy2));
+    EXPECT_EQ(moved.getStripedModel().getStripeUnit(), stripeUnit);
+
+    delete copy;
+}
+
+GTEST_TEST(stripedControllerBasicTest, readWrite)
+{
+    const size_t pageSize = 2048;
+    const double readSeqTime = 0.1;
+    const double writeSeqTime = 0.2;
+    const size_t numDisks = 4;
+    const size_t stripeUnit = 4 * pageSize;
+
+    MemoryModelSSD ssd("ssd", pageSize, pageSize * 32, 1.0, 2.0, readSeqTime, writeSeqTime, 10.0);
+    MemoryControllerStriped controller(new MemoryModelStriped(ssd, numDisks, stripeUnit));
+
+    EXPECT_DOUBLE_EQ(controller.readBytes(0, 16 * pageSize), 4.0 * readSeqTime);
+    EXPECT_DOUBLE_EQ(controller.getCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME).second, 4.0 * readSeqTime);
+    EXPECT_EQ(controller.getCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES).second, 16 * pageSize);
+
+    EXPECT_DOUBLE_EQ(controller.writeBytes(0, 16 * pageSize), 0.0);
+    EXPECT_DOUBLE_EQ(controller.flushCache(), 4.0 * writeSeqTime);
+    EXPECT_EQ(controller.getMemoryWearOut(), 16 * pageSize);
+
+    for (size_t i = 0; i < numDisks; ++i)
+        EXPECT_EQ(controller.getStripedModel().getMemberWearOut(i), stripeUnit);
+}
\ No newline at end of file
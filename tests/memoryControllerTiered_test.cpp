@@ -0,0 +1,67 @@
+#include <storage/memoryControllerTiered.hpp>
+#include <storage/memoryModelSSD.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(tieredControllerBasicTest, interface)
+{
+    MemoryModelSSD fast("fast", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+    MemoryModelSSD slow("slow", 4096, 4096 * 32, 10.0, 20.0, 1.0, 2.0, 100.0);
+
+    MemoryControllerTiered controller(new MemoryModelTiered(std::vector<const MemoryModel*>{&fast, &slow}, std::vector<size_t>{0, 0}, new MemoryModelTiered::LevelPolicy(1)));
+
+    EXPECT_EQ(std::string(controller.getModelName()), std::string("Tiered"));
+    EXPECT_EQ(controller.getPageSize(), 2048);
+    EXPECT_EQ(controller.getBlockSize(), 4096 * 32);
+    EXPECT_EQ(controller.getMemoryWearOut(), 0);
+    EXPECT_EQ(controller.getTieredModel().getNumTiers(), 2);
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME; id < MemoryCounters::MEMORY_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_DOUBLE_EQ(controller.getCounter(id).second, 0.0);
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES; id < MemoryCounters::MEMORY_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(controller.getCounter(id).second, 0L);
+}
+
+GTEST_TEST(tieredControllerBasicTest, copy)
+{
+    MemoryModelSSD fast("fast", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+    MemoryModelSSD slow("slow", 4096, 4096 * 32, 10.0, 20.0, 1.0, 2.0, 100.0);
+
+    MemoryControllerTiered controller(new MemoryModelTiered(std::vector<const MemoryModel*>{&fast, &slow}, std::vector<size_t>{0, 0}, new MemoryModelTiered::LevelPolicy(1)));
+    EXPECT_DOUBLE_EQ(controller.setPlacementHint(2, 0), 0.0);
+
+    MemoryController* copy = controller.clone();
+    EXPECT_EQ(dynamic_cast<MemoryControllerTiered*>(copy)->getTieredModel().getCurrentHint(), 2);
+
+    MemoryControllerTiered copy2;
+    copy2 = *dynamic_cast<MemoryControllerTiered*>(copy);
+    EXPECT_EQ(copy2.getTieredModel().getHintTier(2), 1);
+
+    MemoryControllerTiered moved(std::move(copy2));
+    EXPECT_EQ(moved.getTieredModel().getHintTier(2), 1);
+
+    delete copy;
+}
+
+GTEST_TEST(tieredControllerBasicTest, readWrite)
+{
+    MemoryModelSSD fast("fast", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+    MemoryModelSSD slow("slow", 4096, 4096 * 32, 10.0, 20.0, 1.0, 2.0, 100.0);
+
+    MemoryControllerTiered controller(new MemoryModelTiered(std::vector<const MemoryModel*>{&fast, &slow}, std::vector<size_t>{0, 0}, new MemoryModelTiered::LevelPolicy(1)));
+
+    EXPECT_DOUBLE_EQ(controller.setPlacementHint(0, 0), 0.0);
+    EXPECT_DOUBLE_EQ(controller.readBytes(0, 8 * 2048), 8 * 0.1);
+    EXPECT_DOUBLE_EQ(controller.flushCache(), 0.0);
+
+    EXPECT_DOUBLE_EQ(controller.setPlacementHint(1, 0), 0.0);
+    EXPECT_DOUBLE_EQ(controller.writeBytes(0, 8 * 2048), 0.0);
+    EXPECT_DOUBLE_EQ(controller.flushCache(), 4 * 2.0);
+
+    EXPECT_EQ(controller.getTieredModel().getTierWearOut(0), 0);
+    EXPECT_EQ(controller.getTieredModel().getTierWearOut(1), 8 * 2048);
+    EXPECT_EQ(controller.getMemoryWearOut(), 8 * 2048);
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include <storage/memoryControllerZNS.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(znsControllerBasicTest, interface)
+{
+    const char* const modelName = "zns";
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelZNS* memory = new MemoryModelZNS(modelName, pageSize, blockSize, 1.0, 10.0, 100.0, blockSize, 8, 3);
+    MemoryControllerZNS controller(memory);
+
+    EXPECT_EQ(std::string(controller.getModelName()), std::string(modelName));
+    EXPECT_EQ(controller.getPageSize(), pageSize);
+    EXPECT_EQ(controller.getBlockSize(), blockSize);
+    EXPECT_EQ(controller.getMemoryWearOut(), 0);
+    EXPECT_EQ(controller.getZNSModel().getNumZones(), 8);
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME; id < MemoryCounters::MEMORY_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_DOUBLE_EQ(controller.getCounter(id).second, 0.0);
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES; id < MemoryCounters::MEMORY_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(controller.getCounter(id).second, 0L);
+
+    MemoryModel* generalMemory = new MemoryModelZNS_SamsungK9F1G08U0D();
+    MemoryController generalController(generalMemory);
+    EXPECT_EQ(std::string(generalController.getModelName()), std::string("ZNS:samsungK9F1G08U0D"));
+    EXPECT_EQ(generalController.getPageSize(), 2048);
+    EXPECT_EQ(generalController.getBlockSize(), 2048 * 32);
+    EXPECT_EQ(generalController.getMemoryWearOut(), 0);
+}
+
+GTEST_TEST(znsControllerBasicTest, placement)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelZNS* memory = new MemoryModelZNS("zns", pageSize, blockSize, 1.0, 10.0, 100.0, blockSize, 8, 3);
+    MemoryControllerZNS controller(memory);
+
+    controller.setPlacementIsolation(true);
+    EXPECT_TRUE(controller.getZNSModel().isPlacementIsolation());
+
+    uintptr_t addr = 0;
+    EXPECT_DOUBLE_EQ(controller.setPlacementHint(1, 0), 0.0);
+
+    // writes wait in cache until flush
+    EXPECT_DOUBLE_EQ(controller.writeBytes(addr, 4 * pageSize), 0.0);
+    EXPECT_DOUBLE_EQ(controller.flushCache(), 4 * 10.0);
+    EXPECT_EQ(controller.getZNSModel().getHintValidPages(1), 4);
+    EXPECT_EQ(controller.getZNSModel().getZoneState(0), MemoryModelZNS::ZONE_STATE_FULL);
+
+    // overwrite is appended
+    EXPECT_DOUBLE_EQ(controller.overwriteBytes(addr, pageSize), 0.0);
+    EXPECT_DOUBLE_EQ(controller.flushCache(), 10.0);
+    EXPECT_EQ(controller.getZNSModel().getZoneWritePointer(1), pageSize);
+    EXPECT_EQ(controller.getZNSModel().getHintValidPages(1), 4);
+
+    EXPECT_DOUBLE_EQ(controller.setPlacementHint(1, 0), 100.0);
+    EXPECT_EQ(controller.getZNSModel().getZoneResets(), 1);
+    EXPECT_EQ(controller.getMemoryWearOut(), 5 * pageSize);
+}
+
+GTEST_TEST(znsControllerBasicTest, copy)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelZNS* memory = new MemoryModelZNS("zns", pageSize, blockSize, 1.0, 10.0, 100.0, blockSize, 8, 3);
+    MemoryControllerZNS* controller = new MemoryControllerZNS(memory);
+
+    uintptr_t addr = 0;
+    EXPECT_DOUBLE_EQ(controller->readBytes(addr, 100), 1.0);
+    EXPECT_EQ(controller->getCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 1);
+
+    MemoryControllerZNS* copy = new MemoryControllerZNS(*controller);
+    EXPECT_EQ(copy->getCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 1);
+    EXPECT_EQ(copy->getZNSModel().getNumZones(), 8);
+
+    MemoryControllerZNS copy2(*copy);
+    EXPECT_EQ(copy2.getCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 1);
+
+    MemoryControllerZNS copy3(std::move(copy2));
+    EXPECT_EQ(copy3.getCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 1);
+    EXPECT_EQ(copy3.getZNSModel().getNumZones(), 8);
+
+    delete copy;
+    delete controller;
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+#include <storage/memoryModelCompressed.hpp>
+#include <storage/memoryModelSSD.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(compressedBasicTest, interface)
+{
+    MemoryModelSSD ssd("ssd", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+
+    MemoryModelCompressed compressed(ssd, 0.5, 2048.0 * 1000.0, 4096.0 * 1000.0);
+
+    EXPECT_EQ(std::string(compressed.getModelName()), std::string("Compressed"));
+    EXPECT_EQ(std::string(compressed.getModel().getModelName()), std::string("ssd"));
+    EXPECT_EQ(compressed.getPageSize(), 2048);
+    EXPECT_EQ(compressed.getBlockSize(), 2048 * 32);
+    EXPECT_EQ(compressed.getMemoryWearOut(), 0);
+    EXPECT_DOUBLE_EQ(compressed.getCompressionRatio(), 0.5);
+    EXPECT_DOUBLE_EQ(compressed.getCurrentCompressionRatio(), 0.5);
+    EXPECT_DOUBLE_EQ(compressed.getHintCompressionRatio(7), 0.5);
+    EXPECT_DOUBLE_EQ(compressed.getCompressThroughput(), 2048.0 * 1000.0);
+    EXPECT_DOUBLE_EQ(compressed.getDecompressThroughput(), 4096.0 * 1000.0);
+    EXPECT_EQ(compressed.getRawBytes(), 0);
+    EXPECT_EQ(compressed.getCompressedBytes(), 0);
+    EXPECT_DOUBLE_EQ(compressed.getCompressTime(), 0.0);
+    EXPECT_DOUBLE_EQ(compressed.getDecompressTime(), 0.0);
+
+    // ratio out of range means no compression
+    MemoryModelCompressed wrong(ssd, 2.0, 0.0, 0.0);
+    EXPECT_DOUBLE_EQ(wrong.getCompressionRatio(), 1.0);
+}
+
+GTEST_TEST(compressedBasicTest, readWrite)
+{
+    MemoryModelSSD ssd("ssd", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+    const double compressThroughput = 2048.0 * 1000.0;
+    const double decompressThroughput = 4096.0 * 1000.0;
+
+    MemoryModelCompressed compressed(ssd, 0.5, compressThroughput, decompressThroughput);
+
+    // 8 pages compressed to 4 pages (sequential)
+    EXPECT_DOUBLE_EQ(compressed.writeBytes(8 * 2048), 4 * 0.2 + 8 * 2048 / compressThroughput);
+    EXPECT_EQ(compressed.getMemoryWearOut(), 4 * 2048);
+    EXPECT_EQ(compressed.getRawBytes(), 8 * 2048);
+    EXPECT_EQ(compressed.getCompressedBytes(), 4 * 2048);
+
+    EXPECT_DOUBLE_EQ(compressed.readBytes(8 * 2048), 4 * 0.1 + 8 * 2048 / decompressThroughput);
+    EXPECT_DOUBLE_EQ(compressed.getDecompressTime(), 8 * 2048 / decompressThroughput);
+
+    // device below sees the same compressed requests
+    MemoryModelSSD reference(ssd);
+    (void)reference.writeBytes(4 * 2048);
+    (void)reference.readBytes(4 * 2048);
+    EXPECT_DOUBLE_EQ(compressed.overwriteBytes(8 * 2048), reference.overwriteBytes(4 * 2048) + 8 * 2048 / compressThroughput);
+    EXPECT_EQ(compressed.getMemoryWearOut(), reference.getMemoryWearOut());
+    EXPECT_EQ(compressed.getRawBytes(), 2 * 8 * 2048);
+    EXPECT_DOUBLE_EQ(compressed.getCompressTime(), 2 * 8 * 2048 / compressThroughput);
+
+    // free CPU
+    MemoryModelCompressed noCpu(ssd, 0.25, 0.0, 0.0);
+    EXPECT_DOUBLE_EQ(noCpu.writeBytes(8 * 2048), 2 * 2.0);
+    EXPECT_DOUBLE_EQ(noCpu.readBytes(8 * 2048), 2 * 1.0);
+    EXPECT_EQ(noCpu.getMemoryWearOut(), 2 * 2048);
+
+    compressed.resetState();
+    EXPECT_EQ(compressed.getMemoryWearOut(), 0);
+    EXPECT_EQ(compressed.getRawBytes(), 0);
+    EXPECT_DOUBLE_EQ(compressed.getCompressTime(), 0.0);
+}
+
+GTEST_TEST(compressedBasicTest, hints)
+{
+    MemoryModelSSD ssd("ssd", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+
+    MemoryModelCompressed compressed(ssd, 0.5, 0.0, 0.0);
+    compressed.setHintCompressionRatio(1, 0.25);
+    compressed.setHintCompressionRatio(2, 1.0);
+    compressed.setHintCompressionRatio(3, 0.0);
+
+    EXPECT_DOUBLE_EQ(compressed.getHintCompressionRatio(1), 0.25);
+    EXPECT_DOUBLE_EQ(compressed.getHintCompressionRatio(2), 1.0);
+    EXPECT_DOUBLE_EQ(compressed.getHintCompressionRatio(3), 1.0);
+    EXPECT_DOUBLE_EQ(compressed.getHintCompressionRatio(4), 0.5);
+
+    EXPECT_DOUBLE_EQ(compressed.setPlacementHint(1, 0), 0.0);
+    EXPECT_DOUBLE_EQ(compressed.getCurrentCompressionRatio(), 0.25);
+    EXPECT_DOUBLE_EQ(compressed.writeBytes(16 * 2048), 4 * 0.2);
+
+    EXPECT_DOUBLE_EQ(compressed.setPlacementHint(2, 0), 0.0);
+    EXPECT_DOUBLE_EQ(compressed.writeBytes(16 * 2048), 16 * 0.2);
+
+    EXPECT_DOUBLE_EQ(compressed.setPlacementHint(4, 0), 0.0);
+    EXPECT_DOUBLE_EQ(compressed.writeBytes(16 * 2048), 8 * 0.2);
+
+    EXPECT_EQ(compressed.getMemoryWearOut(), (4 + 16 + 8) * 2048);
+
+    // tiny request takes at least 1 byte
+    EXPECT_DOUBLE_EQ(compressed.writeBytes(1), 2.0);
+
+    // ratio of hint survives reset
+    EXPECT_DOUBLE_EQ(compressed.setPlacementHint(1, 0), 0.0);
+    compressed.resetState();
+    EXPECT_DOUBLE_EQ(compressed.getCurrentCompressionRatio(), 0.25);
+}
+
+GTEST_TEST(compressedBasicTest, copy)
+{
+    MemoryModelSSD ssd("ssd", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+
+    MemoryModelCompressed compressed(ssd, 0.5, 0.0, 0.0);
+    compressed.setHintCompressionRatio(1, 0.25);
+    EXPECT_GT(compressed.writeBytes(8 * 2048), 0.0);
+
+    MemoryModel* clone = compressed.clone();
+    MemoryModelCompressed* copy = dynamic_cast<MemoryModelCompressed*>(clone);
+    EXPECT_EQ(copy->getMemoryWearOut(), 4 * 2048);
+    EXPECT_DOUBLE_EQ(copy->getHintCompressionRatio(1), 0.25);
+
+    // copies do not share device
+    EXPECT_GT(copy->writeBytes(8 * 2048), 0.0);
+    EXPECT_EQ(copy->getMemoryWearOut(), 8 * 2048);
+    EXPECT_EQ(compressed.getMemoryWearOut(), 4 * 2048);
+
+    MemoryModelCompressed copy2;
+    copy2 = *copy;
+    EXPECT_EQ(copy2.getMemoryWearOut(), 8 * 2048);
+    EXPECT_EQ(copy2.getRawBytes(), 2 * 8 * 2048);
+
+    MemoryModelCompressed moved(std::move(copy2));
+    EXPECT_EQ(moved.getMemoryWearOut(), 8 * 2048);
+    EXPECT_DOUBLE_EQ(moved.getHintCompressionRatio(1), 0.25);
+
+    delete clone;
+}
\ No newline at end of file
@@ -0,0 +1,277 @@
+#include <storage/memoryModelFlashNandPageFTL.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+static size_t sumValidPages(const MemoryModelFlashNandPageFTL& flash)
+{
+    size_t validPages = 0;
+    for (size_t block = 0; block < flash.getPhysicalBlocks(); ++block)
+        validPages += flash.getBlockValidPages(block);
+
+    return validPages;
+}
+
+GTEST_TEST(flashPageFTLBasicTest, interface)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelFlashNandPageFTL flash("flash", pageSize, blockSize, 1.0, 10.0, 100.0, 16 * pageSize, 0.25);
+
+    EXPECT_EQ(std::string(flash.getModelName()), std::string("flash"));
+    EXPECT_EQ(flash.getPageSize(), pageSize);
+    EXPECT_EQ(flash.getBlockSize(), blockSize);
+    EXPECT_EQ(flash.getMemoryWearOut(), 0);
+
+    EXPECT_EQ(flash.getLogicalPages(), 16);
+    EXPECT_EQ(flash.getPhysicalBlocks(), 5 + 2);
+    EXPECT_EQ(flash.getFreeBlocks(), 5 + 2);
+    EXPECT_DOUBLE_EQ(flash.getOverProvisioning(), 0.25);
+    EXPECT_EQ(flash.getVictimPolicy(), MemoryModelFlashNandPageFTL::VICTIM_POLICY_GREEDY);
+    EXPECT_EQ(flash.getWearLevelingTreshold(), 0);
+    EXPECT_DOUBLE_EQ(flash.getWriteAmplification(), 1.0);
+    EXPECT_EQ(flash.getMaxEraseCount(), 0);
+    EXPECT_EQ(flash.getMinEraseCount(), 0);
+
+    MemoryModelFlashNandPageFTL_SamsungK9F1G08U0D samsung;
+    EXPECT_EQ(samsung.getLogicalPages(), 128 * 1024 * 1024 / 2048);
+    EXPECT_GT(samsung.getPhysicalBlocks() * 32, samsung.getLogicalPages());
+}
+
+GTEST_TEST(flashPageFTLBasicTest, readWrite)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelFlashNandPageFTL flash("flash", pageSize, blockSize, 1.0, 10.0, 100.0, 16 * pageSize, 0.25);
+
+    EXPECT_DOUBLE_EQ(flash.writeBytes(8 * pageSize), 8 * 10.0);
+    EXPECT_EQ(flash.getMemoryWearOut(), 8 * pageSize);
+    EXPECT_EQ(flash.getHostWrittenPages(), 8);
+    EXPECT_EQ(flash.getWrittenLogicalPages(), 8);
+    EXPECT_EQ(flash.getFreeBlocks(), 5);
+    EXPECT_EQ(sumValidPages(flash), 8);
+
+    // partial page
+    EXPECT_DOUBLE_EQ(flash.writeBytes(100), 10.0);
+    EXPECT_EQ(flash.getWrittenLogicalPages(), 9);
+
+    EXPECT_DOUBLE_EQ(flash.readBytes(3 * pageSize), 3 * 1.0);
+    EXPECT_DOUBLE_EQ(flash.readBytes(0), 0.0);
+    EXPECT_DOUBLE_EQ(flash.writeBytes(0), 0.0);
+    EXPECT_DOUBLE_EQ(flash.overwriteBytes(0), 0.0);
+
+    // overwrite does not add logical pages, old copies are invalid
+    EXPECT_DOUBLE_EQ(flash.overwriteBytes(2 * pageSize), 2 * 10.0);
+    EXPECT_EQ(flash.getWrittenLogicalPages(), 9);
+    EXPECT_EQ(sumValidPages(flash), 9);
+    EXPECT_EQ(flash.getHostWrittenPages(), 11);
+    EXPECT_DOUBLE_EQ(flash.getWriteAmplification(), 1.0);
+
+    flash.resetState();
+    EXPECT_EQ(flash.getMemoryWearOut(), 0);
+    EXPECT_EQ(flash.getHostWrittenPages(), 0);
+    EXPECT_EQ(flash.getWrittenLogicalPages(), 0);
+    EXPECT_EQ(flash.getFreeBlocks(), flash.getPhysicalBlocks());
+    EXPECT_EQ(sumValidPages(flash), 0);
+}
+
+GTEST_TEST(flashPageFTLBasicTest, sequentialWritesNoAmplification)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelFlashNandPageFTL flash("flash", pageSize, blockSize, 1.0, 10.0, 100.0, 16 * pageSize, 0.25);
+
+    // log over whole device invalidates whole blocks, GC has nothing to copy
+    for (size_t i = 0; i < 10; ++i)
+        EXPECT_GT(flash.writeBytes(16 * pageSize), 0.0);
+
+    EXPECT_EQ(flash.getHostWrittenPages(), 10 * 16);
+    EXPECT_EQ(flash.getGCWrittenPages(), 0);
+    EXPECT_GT(flash.getErasedBlocks(), 0);
+    EXPECT_DOUBLE_EQ(flash.getWriteAmplification(), 1.0);
+    EXPECT_EQ(flash.getMemoryWearOut(), 10 * 16 * pageSize);
+    EXPECT_EQ(sumValidPages(flash), 16);
+    EXPECT_GE(flash.getFreeBlocks(), 1);
+}
+
+GTEST_TEST(flashPageFTLBasicTest, randomOverwritesGreedy)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelFlashNandPageFTL flash("flash", pageSize, blockSize, 1.0, 10.0, 100.0, 16 * pageSize, 0.25);
+
+    EXPECT_GT(flash.writeBytes(16 * pageSize), 0.0);
+    for (size_t i = 0; i < 500; ++i)
+        EXPECT_GT(flash.overwriteBytes(pageSize), 0.0);
+
+    EXPECT_EQ(flash.getHostWrittenPages(), 16 + 500);
+    EXPECT_GT(flash.getGCWrittenPages(), 0);
+    EXPECT_GT(flash.getGCOperations(), 0);
+    EXPECT_GT(flash.getWriteAmplification(), 1.0);
+    EXPECT_EQ(flash.getMemoryWearOut(), (flash.getHostWrittenPages() + flash.getGCWrittenPages()) * pageSize);
+    EXPECT_EQ(sumValidPages(flash), 16);
+    EXPECT_GT(flash.getMaxEraseCount(), 0);
+}
+
+GTEST_TEST(flashPageFTLBasicTest, overProvisioning)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    // more spare blocks means GC finds emptier victims
+    MemoryModelFlashNandPageFTL small("flash", pageSize, blockSize, 1.0, 10.0, 100.0, 64 * pageSize, 0.0);
+    MemoryModelFlashNandPageFTL big("flash", pageSize, blockSize, 1.0, 10.0, 100.0, 64 * pageSize, 1.0);
+
+    double smallTime = small.writeBytes(64 * pageSize);
+    double bigTime = big.writeBytes(64 * pageSize);
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        smallTime += small.overwriteBytes(pageSize);
+        bigTime += big.overwriteBytes(pageSize);
+    }
+
+    EXPECT_GT(small.getWriteAmplification(), big.getWriteAmplification());
+    EXPECT_GT(smallTime, bigTime);
+    EXPECT_GT(small.getMemoryWearOut(), big.getMemoryWearOut());
+    EXPECT_EQ(sumValidPages(small), 64);
+    EXPECT_EQ(sumValidPages(big), 64);
+}
+
+GTEST_TEST(flashPageFTLBasicTest, costBenefit)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelFlashNandPageFTL flash("flash", pageSize, blockSize, 1.0, 10.0, 100.0, 64 * pageSize, 0.25, MemoryModelFlashNandPageFTL::VICTIM_POLICY_COST_BENEFIT);
+    EXPECT_EQ(flash.getVictimPolicy(), MemoryModelFlashNandPageFTL::VICTIM_POLICY_COST_BENEFIT);
+
+    EXPECT_GT(flash.writeBytes(64 * pageSize), 0.0);
+    for (size_t i = 0; i < 2000; ++i)
+        EXPECT_GT(flash.overwriteBytes(pageSize), 0.0);
+
+    EXPECT_GT(flash.getGCWrittenPages(), 0);
+    EXPECT_GT(flash.getWriteAmplification(), 1.0);
+    EXPECT_EQ(sumValidPages(flash), 64);
+    EXPECT_EQ(flash.getMemoryWearOut(), (flash.getHostWrittenPages() + flash.getGCWrittenPages()) * pageSize);
+}
+
+GTEST_TEST(flashPageFTLBasicTest, wearLeveling)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+    const size_t treshold = 2;
+
+    MemoryModelFlashNandPageFTL noLeveling("flash", pageSize, blockSize, 1.0, 10.0, 100.0, 64 * pageSize, 0.25);
+    MemoryModelFlashNandPageFTL leveling("flash", pageSize, blockSize, 1.0, 10.0, 100.0, 64 * pageSize, 0.25, MemoryModelFlashNandPageFTL::VICTIM_POLICY_GREEDY, treshold);
+
+    EXPECT_GT(noLeveling.writeBytes(64 * pageSize), 0.0);
+    EXPECT_GT(leveling.writeBytes(64 * pageSize), 0.0);
+
+    MemoryModelFlashNandPageFTL* flashes[] = {&noLeveling, &leveling};
+    for (MemoryModelFlashNandPageFTL* flash : flashes)
+        for (size_t i = 0; i < 200; ++i)
+        {
+            EXPECT_GT(flash->writeBytes(8 * pageSize), 0.0);
+            EXPECT_GT(flash->writeBytes(56 * pageSize), 0.0);
+        }
+
+    EXPECT_EQ(noLeveling.getWearLevelingOperations(), 0);
+    EXPECT_GT(leveling.getWearLevelingOperations(), 0);
+    EXPECT_GT(leveling.getWearLevelingWrittenPages(), 0);
+
+    // erases are spread over all blocks at the cost of extra copies
+    EXPECT_LT(leveling.getMaxEraseCount() - leveling.getMinEraseCount(), noLeveling.getMaxEraseCount() - noLeveling.getMinEraseCount());
+    EXPECT_LT(leveling.getMaxEraseCount(), noLeveling.getMaxEraseCount());
+    EXPECT_GT(leveling.getWriteAmplification(), noLeveling.getWriteAmplification());
+}
+
+GTEST_TEST(flashPageFTLBasicTest, cleaningKeepsValidPages)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+    const size_t logicalPages = 64;
+
+    // no spare blocks and aggressive wear leveling, victims are cleaned when free blocks are scarce
+    MemoryModelFlashNandPageFTL greedy("flash", pageSize, blockSize, 1.0, 10.0, 100.0, logicalPages * pageSize, 0.0, MemoryModelFlashNandPageFTL::VICTIM_POLICY_GREEDY, 1);
+    MemoryModelFlashNandPageFTL costBenefit("flash", pageSize, blockSize, 1.0, 10.0, 100.0, logicalPages * pageSize, 0.0, MemoryModelFlashNandPageFTL::VICTIM_POLICY_COST_BENEFIT, 1);
+
+    MemoryModelFlashNandPageFTL* flashes[] = {&greedy, &costBenefit};
+    for (MemoryModelFlashNandPageFTL* flash : flashes)
+    {
+        EXPECT_GT(flash->writeBytes(logicalPages * pageSize), 0.0);
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            EXPECT_GT(flash->overwriteBytes(pageSize), 0.0);
+            EXPECT_GT(flash->writeBytes(3 * pageSize), 0.0);
+
+            // valid page is never lost during copying
+            ASSERT_EQ(sumValidPages(*flash), logicalPages);
+        }
+
+        EXPECT_GT(flash->getGCOperations(), 0);
+        EXPECT_EQ(flash->getMemoryWearOut(), (flash->getHostWrittenPages() + flash->getGCWrittenPages() + flash->getWearLevelingWrittenPages()) * pageSize);
+    }
+}
+
+GTEST_TEST(flashPageFTLBasicTest, wearTracking)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelFlashNandPageFTL flash("flash", pageSize, blockSize, 1.0, 10.0, 100.0, 64 * pageSize, 0.25);
+    flash.enableWearTracking(flash.getPhysicalBlocks() * blockSize);
+    EXPECT_EQ(flash.getWearTracker().getNumUnits(), flash.getPhysicalBlocks());
+
+    EXPECT_GT(flash.writeBytes(64 * pageSize), 0.0);
+    for (size_t i = 0; i < 500; ++i)
+        EXPECT_GT(flash.overwriteBytes(pageSize), 0.0);
+
+    // FTL knows erased blocks, so tracker has exact erase counters
+    size_t erases = 0;
+    for (size_t block = 0; block < flash.getPhysicalBlocks(); ++block)
+    {
+        EXPECT_EQ(flash.getWearTracker().getUnitWear(block), flash.getBlockEraseCount(block));
+        erases += flash.getWearTracker().getUnitWear(block);
+    }
+
+    EXPECT_EQ(erases, flash.getErasedBlocks());
+    EXPECT_EQ(flash.getWearTracker().getMaxWear(), flash.getMaxEraseCount());
+    EXPECT_EQ(flash.getWearTracker().getMinWear(), flash.getMinEraseCount());
+}
+
+GTEST_TEST(flashPageFTLBasicTest, copy)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelFlashNandPageFTL flash("flash", pageSize, blockSize, 1.0, 10.0, 100.0, 16 * pageSize, 0.25);
+    EXPECT_GT(flash.writeBytes(16 * pageSize), 0.0);
+
+    MemoryModel* clone = flash.clone();
+    MemoryModelFlashNandPageFTL* copy = dynamic_cast<MemoryModelFlashNandPageFTL*>(clone);
+    EXPECT_EQ(copy->getHostWrittenPages(), 16);
+    EXPECT_EQ(copy->getFreeBlocks(), flash.getFreeBlocks());
+
+    // copies have own mapping
+    for (size_t i = 0; i < 100; ++i)
+        EXPECT_GT(copy->overwriteBytes(pageSize), 0.0);
+
+    EXPECT_EQ(flash.getHostWrittenPages(), 16);
+    EXPECT_EQ(sumValidPages(flash), 16);
+    EXPECT_EQ(sumValidPages(*copy), 16);
+
+    MemoryModelFlashNandPageFTL copy2;
+    copy2 = *copy;
+    EXPECT_EQ(copy2.getHostWrittenPages(), 116);
+
+    MemoryModelFlashNandPageFTL moved(std::move(copy2));
+    EXPECT_EQ(moved.getHostWrittenPages(), 116);
+    EXPECT_EQ(sumValidPages(moved), 16);
+
+    delete clone;
+}
\ No newline at end of file
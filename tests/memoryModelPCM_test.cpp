@@ -1,6 +1,7 @@
 #include <storage/memoryModelPCM.hpp>
 #include <string>
 #include <iostream>
+#include <set>
 
 #include <gtest/gtest.h>
 
@@ -217,3 +218,205 @@ GTEST_TEST(pcmBasicTest, overwrite)
     EXPECT_EQ(pcm.getMemoryWearOut(), 1 + pageSize / 2 + pageSize + pageSize + 1 + 3 * pageSize + 100);
 }
 
+
+
+GTEST_TEST(pcmBasicTest, wearTracking)
+{
+    const char* const modelName = "pcm";
+    const size_t pageSize = 8;
+    const double readTime = 0.1;
+    const double writeTime = 2.0;
+
+    MemoryModelPCM pcm(modelName, pageSize, readTime, writeTime);
+    EXPECT_FALSE(pcm.getWearTracker().isEnabled());
+
+    pcm.enableWearTracking(100 * pageSize);
+    EXPECT_EQ(pcm.getWearTracker().getNumUnits(), 100);
+
+    // writes go to next lines
+    EXPECT_DOUBLE_EQ(pcm.writeBytes(10 * pageSize), 10.0 * writeTime);
+    EXPECT_EQ(pcm.getWearTracker().getWrittenUnits(), 10);
+    EXPECT_EQ(pcm.getWearTracker().getMaxWear(), 1);
+
+    // overwrites hit only lines with data
+    for (size_t i = 0; i < 100; ++i)
+        EXPECT_DOUBLE_EQ(pcm.overwriteBytes(pageSize), writeTime);
+
+    EXPECT_EQ(pcm.getWearTracker().getWrittenUnits(), 10);
+    EXPECT_EQ(pcm.getMemoryWearOut(), 110 * pageSize);
+    EXPECT_GT(pcm.getWearTracker().getMaxWear(), 10);
+    EXPECT_EQ(pcm.getWearTracker().getUnitWear(50), 0);
+
+    pcm.resetState();
+    EXPECT_TRUE(pcm.getWearTracker().isEnabled());
+    EXPECT_EQ(pcm.getWearTracker().getMaxWear(), 0);
+}
+
+GTEST_TEST(pcmBasicTest, startGap)
+{
+    const size_t pageSize = 8;
+    const double readTime = 0.1;
+    const double writeTime = 2.0;
+    const size_t lines = 16;
+    const size_t interval = 4;
+
+    MemoryModelPCM pcm("pcm", pageSize, readTime, writeTime);
+    EXPECT_EQ(pcm.getWearLeveling(), MemoryModelPCM::WEAR_LEVELING_NONE);
+    EXPECT_EQ(pcm.getPhysicalLine(5), 5);
+
+    pcm.setWearLeveling(MemoryModelPCM::WEAR_LEVELING_START_GAP, lines * pageSize, interval);
+    EXPECT_EQ(pcm.getWearLeveling(), MemoryModelPCM::WEAR_LEVELING_START_GAP);
+    EXPECT_EQ(pcm.getLevelingLines(), lines);
+    EXPECT_EQ(pcm.getLevelingInterval(), interval);
+
+    // every interval line writes gap moves, it costs 1 line read and 1 line write
+    EXPECT_DOUBLE_EQ(pcm.writeBytes((interval - 1) * pageSize), (interval - 1) * writeTime);
+    EXPECT_DOUBLE_EQ(pcm.writeBytes(pageSize), writeTime + readTime + writeTime);
+    EXPECT_EQ(pcm.getLevelingMoves(), 1);
+    EXPECT_EQ(pcm.getLevelingWrittenLines(), 1);
+    EXPECT_DOUBLE_EQ(pcm.getLevelingTime(), readTime + writeTime);
+    EXPECT_EQ(pcm.getMemoryWearOut(), (interval + 1) * pageSize);
+
+    // mapping is always a bijection into lines + 1 physical lines, after lines + 1 moves all lines are rotated by 1
+    for (size_t move = 1; move <= lines + 1; ++move)
+    {
+        std::set<size_t> physicalLines;
+        for (size_t line = 0; line < lines; ++line)
+        {
+            EXPECT_LE(pcm.getPhysicalLine(line), lines);
+            physicalLines.insert(pcm.getPhysicalLine(line));
+        }
+
+        EXPECT_EQ(physicalLines.size(), lines);
+
+        pcm.writeBytes(interval * pageSize);
+    }
+
+    EXPECT_EQ(pcm.getLevelingMoves(), lines + 2);
+    EXPECT_EQ(pcm.getPhysicalLine(lines - 1), 0);
+    EXPECT_EQ(pcm.getPhysicalLine(0), 1);
+    EXPECT_EQ(pcm.getPhysicalLine(lines - 2), lines);
+
+    pcm.resetState();
+    EXPECT_EQ(pcm.getLevelingMoves(), 0);
+    EXPECT_EQ(pcm.getPhysicalLine(3), 3);
+}
+
+GTEST_TEST(pcmBasicTest, securityRefresh)
+{
+    const size_t pageSize = 8;
+    const double readTime = 0.1;
+    const double writeTime = 2.0;
+    const size_t interval = 4;
+
+    MemoryModelPCM pcm("pcm", pageSize, readTime, writeTime);
+
+    // lines are rounded down to power of 2
+    pcm.setWearLeveling(MemoryModelPCM::WEAR_LEVELING_SECURITY_REFRESH, 20 * pageSize, interval);
+    EXPECT_EQ(pcm.getLevelingLines(), 16);
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        std::set<size_t> physicalLines;
+        for (size_t line = 0; line < 16; ++line)
+        {
+            EXPECT_LT(pcm.getPhysicalLine(line), 16);
+            physicalLines.insert(pcm.getPhysicalLine(line));
+        }
+
+        EXPECT_EQ(physicalLines.size(), 16);
+
+        pcm.writeBytes(interval * pageSize);
+    }
+
+    // each swap rewrites 2 lines
+    EXPECT_EQ(pcm.getLevelingMoves(), 100);
+    EXPECT_EQ(pcm.getLevelingWrittenLines() % 2, 0);
+    EXPECT_GT(pcm.getLevelingWrittenLines(), 0);
+    EXPECT_DOUBLE_EQ(pcm.getLevelingTime(), pcm.getLevelingWrittenLines() * (readTime + writeTime));
+}
+
+GTEST_TEST(pcmBasicTest, wearLevelingLifetime)
+{
+    const size_t pageSize = 8;
+    const double readTime = 0.1;
+    const double writeTime = 2.0;
+    const size_t lines = 64;
+    const size_t writes = 100000;
+
+    MemoryModelPCM noLeveling("pcm", pageSize, readTime, writeTime);
+    MemoryModelPCM startGap("pcm", pageSize, readTime, writeTime);
+    MemoryModelPCM securityRefresh("pcm", pageSize, readTime, writeTime);
+
+    startGap.setWearLeveling(MemoryModelPCM::WEAR_LEVELING_START_GAP, lines * pageSize, 4);
+    securityRefresh.setWearLeveling(MemoryModelPCM::WEAR_LEVELING_SECURITY_REFRESH, lines * pageSize, 4);
+
+    MemoryModelPCM* pcms[] = {&noLeveling, &startGap, &securityRefresh};
+    double times[3] = {0.0, 0.0, 0.0};
+    for (size_t i = 0; i < 3; ++i)
+    {
+        // 1 hot line is overwritten all the time
+        pcms[i]->enableWearTracking((lines + 1) * pageSize);
+        times[i] += pcms[i]->writeBytes(pageSize);
+        for (size_t w = 0; w < writes; ++w)
+            times[i] += pcms[i]->overwriteBytes(pageSize);
+    }
+
+    EXPECT_EQ(noLeveling.getWearTracker().getMaxWear(), writes + 1);
+
+    // hot line is moved over all lines, so device lives much longer at cost of extra writes
+    for (size_t i = 1; i < 3; ++i)
+    {
+        EXPECT_LT(pcms[i]->getWearTracker().getMaxWear() * 10, noLeveling.getWearTracker().getMaxWear());
+        EXPECT_GT(pcms[i]->getWearTracker().estimateLifetime(100000000, times[i]), 10.0 * noLeveling.getWearTracker().estimateLifetime(100000000, times[0]));
+        EXPECT_GT(times[i], times[0]);
+        EXPECT_GT(pcms[i]->getMemoryWearOut(), noLeveling.getMemoryWearOut());
+    }
+}
+
+GTEST_TEST(pcmBasicTest, differentialWrite)
+{
+    const size_t pageSize = 8;
+    const double readTime = 0.1;
+    const double writeTime = 2.0;
+
+    MemoryModelPCM pcm("pcm", pageSize, readTime, writeTime);
+    pcm.enableWearTracking(4 * pageSize);
+
+    EXPECT_EQ(pcm.getDifferentialWrite(), MemoryModelPCM::DIFFERENTIAL_WRITE_NONE);
+    EXPECT_DOUBLE_EQ(pcm.writeBytes(4 * pageSize), 4.0 * writeTime);
+    EXPECT_EQ(pcm.getMemoryWearOut(), 4 * pageSize);
+
+    // without differential write all bits are programmed
+    pcm.setOverwriteBitChangeRatio(0.25);
+    EXPECT_DOUBLE_EQ(pcm.getOverwriteBitChangeRatio(), 0.25);
+    EXPECT_DOUBLE_EQ(pcm.overwriteBytes(2 * pageSize), 2.0 * writeTime);
+    EXPECT_EQ(pcm.getMemoryWearOut(), 6 * pageSize);
+    EXPECT_DOUBLE_EQ(pcm.getWearTracker().getMeanWear(), 1.5);
+
+    // lines are compared before write, only 1/4 of bits is programmed, lines are worn when whole line is programmed
+    pcm.setDifferentialWrite(MemoryModelPCM::DIFFERENTIAL_WRITE_DCW);
+    EXPECT_DOUBLE_EQ(pcm.overwriteBytes(2 * pageSize), 2.0 * readTime + 2.0 * writeTime * 0.25);
+    EXPECT_EQ(pcm.getMemoryWearOut(), 6 * pageSize + 4);
+    EXPECT_DOUBLE_EQ(pcm.getWearTracker().getMeanWear(), 1.5);
+    EXPECT_DOUBLE_EQ(pcm.overwriteBytes(2 * pageSize), 2.0 * readTime + 2.0 * writeTime * 0.25);
+    EXPECT_EQ(pcm.getMemoryWearOut(), 6 * pageSize + 8);
+    EXPECT_DOUBLE_EQ(pcm.getWearTracker().getMeanWear(), 1.75);
+
+    // DCW pays for every changed bit, Flip-N-Write inverts line when it is cheaper
+    pcm.setOverwriteBitChangeRatio(0.75);
+    EXPECT_DOUBLE_EQ(pcm.overwriteBytes(2 * pageSize), 2.0 * readTime + 2.0 * writeTime * 0.75);
+
+    pcm.setDifferentialWrite(MemoryModelPCM::DIFFERENTIAL_WRITE_FLIP_N_WRITE);
+    EXPECT_EQ(pcm.getDifferentialWrite(), MemoryModelPCM::DIFFERENTIAL_WRITE_FLIP_N_WRITE);
+    EXPECT_DOUBLE_EQ(pcm.overwriteBytes(2 * pageSize), 2.0 * readTime + 2.0 * writeTime * 0.25);
+
+    pcm.setOverwriteBitChangeRatio(2.0);
+    EXPECT_DOUBLE_EQ(pcm.getOverwriteBitChangeRatio(), 1.0);
+    EXPECT_DOUBLE_EQ(pcm.overwriteBytes(2 * pageSize), 2.0 * readTime);
+
+    // mode and ratio stay in copy
+    MemoryModelPCM copy(pcm);
+    EXPECT_EQ(copy.getDifferentialWrite(), MemoryModelPCM::DIFFERENTIAL_WRITE_FLIP_N_WRITE);
+    EXPECT_DOUBLE_EQ(copy.getOverwriteBitChangeRatio(), 1.0);
+}
\ No newline at end of file
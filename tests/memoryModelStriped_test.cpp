@@ -0,0 +1,207 @@
+#include <storage/memoryModelStriped.hpp>
+#include <storage/memoryModelSSD.hpp>
+#include <string>
+#include <algorithm>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(stripedBasicTest, interface)
+{
+    const char* const modelName = "ssd";
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 32;
+    const double readRandomTime = 1.0;
+    const double writeRandomTime = 2.0;
+    const double readSeqTime = 0.1;
+    const double writeSeqTime = 0.2;
+    const double eraseTime = 10.0;
+    const size_t numDisks = 4;
+    const size_t stripeUnit = 4 * pageSize;
+
+    MemoryModelSSD ssd(modelName, pageSize, blockSize, readRandomTime, writeRandomTime, readSeqTime, writeSeqTime, eraseTime);
+    MemoryModelStriped striped(ssd, numDisks, stripeUnit);
+
+    EXPECT_EQ(std::string(striped.getModelName()), std::string("RAID-0"));
+    EXPECT_EQ(striped.getPageSize(), pageSize);
+    EXPECT_EQ(striped.getBlockSize(), blockSize);
+    EXPECT_EQ(striped.getMemoryWearOut(), 0);
+    EXPECT_EQ(striped.getNumDisks(), numDisks);
+    EXPECT_EQ(striped.getStripeUnit(), stripeUnit);
+    EXPECT_FALSE(striped.isMirrored());
+    EXPECT_EQ(striped.getNumMembers(), numDisks);
+
+    for (size_t i = 0; i < striped.getNumMembers(); ++i)
+    {
+        EXPECT_EQ(std::string(striped.getMember(i).getModelName()), std::string(modelName));
+        EXPECT_EQ(striped.getMemberWearOut(i), 0);
+    }
+
+    MemoryModelStriped mirrored(ssd, numDisks, stripeUnit, true);
+    EXPECT_EQ(std::string(mirrored.getModelName()), std::string("RAID-10"));
+    EXPECT_TRUE(mirrored.isMirrored());
+    EXPECT_EQ(mirrored.getNumDisks(), numDisks);
+    EXPECT_EQ(mirrored.getNumMembers(), 2 * numDisks);
+
+    // stripe unit is aligned to pages, at least 1 disk is needed
+    MemoryModelStriped aligned(ssd, 0, pageSize + 1);
+    EXPECT_EQ(aligned.getNumDisks(), 1);
+    EXPECT_EQ(aligned.getNumMembers(), 1);
+    EXPECT_EQ(aligned.getStripeUnit(), 2 * pageSize);
+}
+
+GTEST_TEST(stripedBasicTest, copy)
+{
+    const size_t pageSize = 2048;
+    const size_t numDisks = 4;
+    const size_t stripeUnit = 4 * pageSize;
+
+    MemoryModelSSD ssd("ssd", pageSize, pageSize * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+    MemoryModelStriped striped(ssd, numDisks, stripeUnit);
+
+    EXPECT_GT(striped.writeBytes(16 * pageSize), 0.0);
+    EXPECT_EQ(striped.getMemoryWearOut(), 16 * pageSize);
+
+    MemoryModelStriped copy(striped);
+    EXPECT_EQ(copy.getNumDisks(), numDisks);
+    EXPECT_EQ(copy.getStripeUnit(), stripeUnit);
+    EXPECT_EQ(copy.getMemoryWearOut(), 16 * pageSize);
+    for (size_t i = 0; i < numDisks; ++i)
+        EXPECT_EQ(copy.getMemberCounter(i, MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES).second, 4 * pageSize);
+
+    MemoryModel* clone = striped.clone();
+    EXPECT_EQ(clone->getMemoryWearOut(), 16 * pageSize);
+    EXPECT_EQ(dynamic_cast<MemoryModelStriped*>(clone)->getNumMembers(), numDisks);
+
+    // copies do not share members
+    EXPECT_GT(copy.writeBytes(16 * pageSize), 0.0);
+    EXPECT_EQ(copy.getMemoryWearOut(), 32 * pageSize);
+    EXPECT_EQ(striped.getMemoryWearOut(), 16 * pageSize);
+    EXPECT_EQ(clone->getMemoryWearOut(), 16 * pageSize);
+
+    MemoryModelStriped copy2;
+    copy2 = copy;
+    EXPECT_EQ(copy2.getNumMembers(), numDisks);
+    EXPECT_EQ(copy2.getMemoryWearOut(), 32 * pageSize);
+
+    delete clone;
+}
+
+GTEST_TEST(stripedBasicTest, move)
+{
+    const size_t pageSize = 2048;
+    const size_t numDisks = 4;
+    const size_t stripeUnit = 4 * pageSize;
+
+    MemoryModelSSD ssd("ssd", pageSize, pageSize * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+    MemoryModelStriped striped(ssd, numDisks, stripeUnit, true);
+
+    EXPECT_GT(striped.writeBytes(16 * pageSize), 0.0);
+
+    MemoryModelStriped moved(std::move(striped));
+    EXPECT_EQ(moved.getNumMembers(), 2 * numDisks);
+    EXPECT_EQ(moved.getMemoryWearOut(), 2 * 16 * pageSize);
+
+    MemoryModelStriped moved2;
+    moved2 = std::move(moved);
+    EXPECT_EQ(moved2.getNumMembers(), 2 * numDisks);
+    EXPECT_EQ(moved2.getMemoryWearOut(), 2 * 16 * pageSize);
+}
+
+GTEST_TEST(stripedBasicTest, read)
+{
+    const size_t pageSize = 2048;
+    const double readRandomTime = 1.0;
+    const double readSeqTime = 0.1;
+    const size_t numDisks = 4;
+    const size_t stripeUnit = 4 * pageSize;
+
+    MemoryModelSSD ssd("ssd", pageSize, pageSize * 32, readRandomTime, 2.0, readSeqTime, 0.2, 10.0);
+    MemoryModelStriped striped(ssd, numDisks, stripeUnit);
+
+    // each disk reads 4 pages in parallel
+    EXPECT_DOUBLE_EQ(striped.readBytes(16 * pageSize), 4.0 * readSeqTime);
+    EXPECT_DOUBLE_EQ(ssd.readBytes(16 * pageSize), 16.0 * readSeqTime);
+
+    for (size_t i = 0; i < numDisks; ++i)
+    {
+        EXPECT_DOUBLE_EQ(striped.getMemberCounter(i, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME).second, 4.0 * readSeqTime);
+        EXPECT_EQ(striped.getMemberCounter(i, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES).second, stripeUnit);
+        EXPECT_EQ(striped.getMemberCounter(i, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 1);
+    }
+
+    // small requests go to the next disks
+    EXPECT_DOUBLE_EQ(striped.readBytes(pageSize), readRandomTime);
+    EXPECT_DOUBLE_EQ(striped.readBytes(pageSize), readRandomTime);
+    EXPECT_EQ(striped.getMemberCounter(0, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 2);
+    EXPECT_EQ(striped.getMemberCounter(1, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 2);
+    EXPECT_EQ(striped.getMemberCounter(2, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 1);
+    EXPECT_EQ(striped.getMemberCounter(3, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 1);
+
+    // reads do not wear memory
+    EXPECT_EQ(striped.getMemoryWearOut(), 0);
+}
+
+GTEST_TEST(stripedBasicTest, write)
+{
+    const size_t pageSize = 2048;
+    const double writeRandomTime = 2.0;
+    const double writeSeqTime = 0.2;
+    const size_t numDisks = 4;
+    const size_t stripeUnit = 4 * pageSize;
+
+    MemoryModelSSD ssd("ssd", pageSize, pageSize * 32, 1.0, writeRandomTime, 0.1, writeSeqTime, 10.0);
+    MemoryModelStriped striped(ssd, numDisks, stripeUnit);
+
+    EXPECT_DOUBLE_EQ(striped.writeBytes(16 * pageSize), 4.0 * writeSeqTime);
+    EXPECT_EQ(striped.getMemoryWearOut(), 16 * pageSize);
+
+    for (size_t i = 0; i < numDisks; ++i)
+    {
+        EXPECT_EQ(striped.getMemberWearOut(i), stripeUnit);
+        EXPECT_EQ(striped.getMemberCounter(i, MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES).second, stripeUnit);
+        EXPECT_EQ(striped.getMemberCounter(i, MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_OPERATIONS).second, 1);
+    }
+
+    // not full stripe unit, remaining bytes go to the next disk
+    EXPECT_DOUBLE_EQ(striped.writeBytes(5 * pageSize), std::max(4.0 * writeSeqTime, writeRandomTime));
+    EXPECT_EQ(striped.getMemberWearOut(0), 2 * stripeUnit);
+    EXPECT_EQ(striped.getMemberWearOut(1), stripeUnit + pageSize);
+    EXPECT_EQ(striped.getMemoryWearOut(), 21 * pageSize);
+
+    EXPECT_DOUBLE_EQ(striped.overwriteBytes(pageSize), writeRandomTime);
+    EXPECT_EQ(striped.getMemberCounter(2, MemoryCounters::MEMORY_COUNTER_RW_OVERWRITE_TOTAL_OPERATIONS).second, 1);
+    EXPECT_EQ(striped.getMemoryWearOut(), 22 * pageSize);
+
+    striped.resetState();
+    EXPECT_EQ(striped.getMemoryWearOut(), 0);
+    for (size_t i = 0; i < numDisks; ++i)
+        EXPECT_EQ(striped.getMemberCounter(i, MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_OPERATIONS).second, 0);
+}
+
+GTEST_TEST(stripedBasicTest, mirrored)
+{
+    const size_t pageSize = 2048;
+    const double readSeqTime = 0.1;
+    const double writeSeqTime = 0.2;
+    const size_t numDisks = 2;
+    const size_t stripeUnit = 4 * pageSize;
+
+    MemoryModelSSD ssd("ssd", pageSize, pageSize * 32, 1.0, 2.0, readSeqTime, writeSeqTime, 10.0);
+    MemoryModelStriped striped(ssd, numDisks, stripeUnit, true);
+
+    // each disk and its mirror write 8 pages
+    EXPECT_DOUBLE_EQ(striped.writeBytes(16 * pageSize), 8.0 * writeSeqTime);
+    EXPECT_EQ(striped.getMemoryWearOut(), 2 * 16 * pageSize);
+
+    for (size_t i = 0; i < striped.getNumMembers(); ++i)
+    {
+        EXPECT_EQ(striped.getMemberWearOut(i), 8 * pageSize);
+        EXPECT_EQ(striped.getMemberCounter(i, MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_OPERATIONS).second, 1);
+    }
+
+    // reads are spread over disks and mirrors
+    EXPECT_DOUBLE_EQ(striped.readBytes(16 * pageSize), 4.0 * readSeqTime);
+    for (size_t i = 0; i < striped.getNumMembers(); ++i)
+        EXPECT_EQ(striped.getMemberCounter(i, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES).second, stripeUnit);
+}
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include <storage/memoryModelTiered.hpp>
+#include <storage/memoryModelSSD.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(tieredBasicTest, interface)
+{
+    MemoryModelSSD fast("fast", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+    MemoryModelSSD slow("slow", 4096, 4096 * 32, 10.0, 20.0, 1.0, 2.0, 100.0);
+    const size_t fastCapacity = 1000000;
+
+    MemoryModelTiered tiered(std::vector<const MemoryModel*>{&fast, &slow}, std::vector<size_t>{fastCapacity}, new MemoryModelTiered::LevelPolicy(2));
+
+    EXPECT_EQ(std::string(tiered.getModelName()), std::string("Tiered"));
+    EXPECT_EQ(tiered.getPageSize(), 2048);
+    EXPECT_EQ(tiered.getBlockSize(), 4096 * 32);
+    EXPECT_EQ(tiered.getMemoryWearOut(), 0);
+    EXPECT_EQ(tiered.getNumTiers(), 2);
+    EXPECT_EQ(std::string(tiered.getTier(0).getModelName()), std::string("fast"));
+    EXPECT_EQ(std::string(tiered.getTier(1).getModelName()), std::string("slow"));
+    EXPECT_EQ(tiered.getTierCapacity(0), fastCapacity);
+    EXPECT_EQ(tiered.getTierCapacity(1), 0);
+    EXPECT_EQ(tiered.getTierUsedBytes(0), 0);
+    EXPECT_EQ(tiered.getHintTier(0), 2);
+    EXPECT_EQ(tiered.getCurrentHint(), 0);
+    EXPECT_DOUBLE_EQ(tiered.getMigrationTime(), 0.0);
+    EXPECT_EQ(tiered.getMigrationBytes(), 0);
+    EXPECT_EQ(tiered.getMigrationOperations(), 0);
+}
+
+GTEST_TEST(tieredBasicTest, copy)
+{
+    MemoryModelSSD fast("fast", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+    MemoryModelSSD slow("slow", 4096, 4096 * 32, 10.0, 20.0, 1.0, 2.0, 100.0);
+
+    MemoryModelTiered tiered(std::vector<const MemoryModel*>{&fast, &slow}, std::vector<size_t>{0, 0}, new MemoryModelTiered::LevelPolicy(1));
+
+    EXPECT_DOUBLE_EQ(tiered.setPlacementHint(1, 0), 0.0);
+    EXPECT_GT(tiered.writeBytes(4096), 0.0);
+    EXPECT_EQ(tiered.getTierWearOut(1), 4096);
+
+    MemoryModel* clone = tiered.clone();
+    MemoryModelTiered* copy = dynamic_cast<MemoryModelTiered*>(clone);
+    EXPECT_EQ(copy->getNumTiers(), 2);
+    EXPECT_EQ(copy->getHintTier(1), 1);
+    EXPECT_EQ(copy->getCurrentHint(), 1);
+    EXPECT_EQ(copy->getMemoryWearOut(), 4096);
+    EXPECT_EQ(copy->getPolicy().toString(), tiered.getPolicy().toString());
+
+    // copies do not share tiers
+    EXPECT_GT(copy->writeBytes(4096), 0.0);
+    EXPECT_EQ(copy->getMemoryWearOut(), 2 * 4096);
+    EXPECT_EQ(tiered.getMemoryWearOut(), 4096);
+
+    MemoryModelTiered copy2;
+    copy2 = *copy;
+    EXPECT_EQ(copy2.getMemoryWearOut(), 2 * 4096);
+    EXPECT_EQ(copy2.getHintTier(1), 1);
+
+    MemoryModelTiered moved(std::move(copy2));
+    EXPECT_EQ(moved.getMemoryWearOut(), 2 * 4096);
+
+    delete clone;
+}
+
+GTEST_TEST(tieredBasicTest, levelPolicy)
+{
+    MemoryModelSSD fast("fast", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+    MemoryModelSSD slow("slow", 4096, 4096 * 32, 10.0, 20.0, 1.0, 2.0, 100.0);
+
+    MemoryModelTiered tiered(std::vector<const MemoryModel*>{&fast, &slow}, std::vector<size_t>{0, 0}, new MemoryModelTiered::LevelPolicy(1));
+
+    // hint 0 on fast tier
+    EXPECT_DOUBLE_EQ(tiered.setPlacementHint(0, 0), 0.0);
+    EXPECT_EQ(tiered.getHintTier(0), 0);
+    EXPECT_DOUBLE_EQ(tiered.readBytes(8 * 2048), 8 * 0.1);
+
+    // other hints on slow tier
+    EXPECT_DOUBLE_EQ(tiered.setPlacementHint(3, 0), 0.0);
+    EXPECT_EQ(tiered.getHintTier(3), 1);
+    EXPECT_DOUBLE_EQ(tiered.readBytes(8 * 2048), 4 * 1.0);
+    EXPECT_DOUBLE_EQ(tiered.writeBytes(4096), 20.0);
+
+    EXPECT_EQ(tiered.getTierCounter(0, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 1);
+    EXPECT_EQ(tiered.getTierCounter(0, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES).second, 8 * 2048);
+    EXPECT_EQ(tiered.getTierCounter(1, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 1);
+    EXPECT_DOUBLE_EQ(tiered.getTierCounter(1, MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_TIME).second, 20.0);
+    EXPECT_EQ(tiered.getTierWearOut(0), 0);
+    EXPECT_EQ(tiered.getTierWearOut(1), 4096);
+    EXPECT_EQ(tiered.getMigrationOperations(), 0);
+
+    tiered.resetState();
+    EXPECT_EQ(tiered.getMemoryWearOut(), 0);
+    EXPECT_EQ(tiered.getHintTier(3), 2);
+    EXPECT_EQ(tiered.getTierCounter(1, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 0);
+}
+
+GTEST_TEST(tieredBasicTest, capacity)
+{
+    MemoryModelSSD fast("fast", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+    MemoryModelSSD slow("slow", 4096, 4096 * 32, 10.0, 20.0, 1.0, 2.0, 100.0);
+    const size_t fastCapacity = 10 * 2048;
+
+    MemoryModelTiered tiered(std::vector<const MemoryModel*>{&fast, &slow}, std::vector<size_t>{fastCapacity, 0}, new MemoryModelTiered::LevelPolicy(2));
+
+    EXPECT_DOUBLE_EQ(tiered.setPlacementHint(0, 8 * 2048), 0.0);
+    EXPECT_EQ(tiered.getTierUsedBytes(0), 8 * 2048);
+
+    // hint 1 does not fit, hint 0 is demoted: read 8 pages from fast, write 4 pages to slow
+    EXPECT_DOUBLE_EQ(tiered.setPlacementHint(1, 8 * 2048), 8 * 0.1 + 4 * 2.0);
+    EXPECT_EQ(tiered.getHintTier(0), 1);
+    EXPECT_EQ(tiered.getHintTier(1), 0);
+    EXPECT_EQ(tiered.getTierUsedBytes(0), 8 * 2048);
+    EXPECT_EQ(tiered.getTierUsedBytes(1), 8 * 2048);
+
+    EXPECT_DOUBLE_EQ(tiered.getMigrationTime(), 8 * 0.1 + 4 * 2.0);
+    EXPECT_EQ(tiered.getMigrationBytes(), 8 * 2048);
+    EXPECT_EQ(tiered.getMigrationOperations(), 1);
+    EXPECT_EQ(tiered.getTierWearOut(1), 8 * 2048);
+
+    // hint bigger than tier goes down
+    EXPECT_DOUBLE_EQ(tiered.setPlacementHint(1, 16 * 2048), 16 * 0.1 + 8 * 2.0);
+    EXPECT_EQ(tiered.getHintTier(1), 1);
+    EXPECT_EQ(tiered.getTierUsedBytes(0), 0);
+    EXPECT_EQ(tiered.getMigrationOperations(), 2);
+}
+
+GTEST_TEST(tieredBasicTest, capacityWithoutHints)
+{
+    MemoryModelSSD fast("fast", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+    MemoryModelSSD slow("slow", 4096, 4096 * 32, 10.0, 20.0, 1.0, 2.0, 100.0);
+    const size_t fastCapacity = 10 * 2048;
+
+    MemoryModelTiered tiered(std::vector<const MemoryModel*>{&fast, &slow}, std::vector<size_t>{fastCapacity, 0}, new MemoryModelTiered::LevelPolicy(1));
+
+    // index never reports hint size, written bytes are accounted to hint 0
+    EXPECT_DOUBLE_EQ(tiered.writeBytes(8 * 2048), 8 * 0.2);
+    EXPECT_EQ(tiered.getHintTier(0), 0);
+    EXPECT_EQ(tiered.getTierUsedBytes(0), 8 * 2048);
+
+    // tier is full after write, hint 0 is demoted: read 12 pages from fast, write 6 pages to slow
+    EXPECT_DOUBLE_EQ(tiered.writeBytes(4 * 2048), 4 * 0.2 + 12 * 0.1 + 6 * 2.0);
+    EXPECT_EQ(tiered.getHintTier(0), 1);
+    EXPECT_EQ(tiered.getTierUsedBytes(0), 0);
+    EXPECT_EQ(tiered.getTierUsedBytes(1), 12 * 2048);
+    EXPECT_EQ(tiered.getMigrationBytes(), 12 * 2048);
+    EXPECT_EQ(tiered.getMigrationOperations(), 1);
+
+    // next writes go to slow tier
+    EXPECT_DOUBLE_EQ(tiered.writeBytes(4096), 20.0);
+    EXPECT_EQ(tiered.getTierUsedBytes(1), 12 * 2048 + 4096);
+    EXPECT_EQ(tiered.getTierCounter(1, MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_OPERATIONS).second, 2);
+
+    // overwrite does not grow hint
+    EXPECT_GT(tiered.overwriteBytes(4096), 0.0);
+    EXPECT_EQ(tiered.getTierUsedBytes(1), 12 * 2048 + 4096);
+}
+
+GTEST_TEST(tieredBasicTest, promotionPolicy)
+{
+    MemoryModelSSD fast("fast", 2048, 2048 * 32, 1.0, 2.0, 0.1, 0.2, 10.0);
+    MemoryModelSSD slow("slow", 4096, 4096 * 32, 10.0, 20.0, 1.0, 2.0, 100.0);
+
+    MemoryModelTiered tiered(std::vector<const MemoryModel*>{&fast, &slow}, std::vector<size_t>{0, 0}, new MemoryModelTiered::PromotionPolicy(2));
+
+    // new hint starts on slow tier
+    EXPECT_DOUBLE_EQ(tiered.setPlacementHint(5, 4096), 0.0);
+    EXPECT_EQ(tiered.getHintTier(5), 1);
+
+    // second access promotes hint: read 1 page from slow, write 2 pages to fast
+    EXPECT_DOUBLE_EQ(tiered.setPlacementHint(5, 4096), 10.0 + 2 * 2.0);
+    EXPECT_EQ(tiered.getHintTier(5), 0);
+    EXPECT_EQ(tiered.getTierCounter(1, MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES).second, 4096);
+    EXPECT_EQ(tiered.getTierCounter(0, MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES).second, 4096);
+
+    // fastest tier is the last stop
+    EXPECT_DOUBLE_EQ(tiered.setPlacementHint(5, 4096), 0.0);
+    EXPECT_DOUBLE_EQ(tiered.setPlacementHint(5, 4096), 0.0);
+    EXPECT_EQ(tiered.getHintTier(5), 0);
+    EXPECT_EQ(tiered.getMigrationOperations(), 1);
+}
\ No newline at end of file
@@ -0,0 +1,216 @@
+#include <storage/memoryModelZNS.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(znsBasicTest, interface)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+    const size_t zoneSize = blockSize;
+
+    MemoryModelZNS zns("zns", pageSize, blockSize, 1.0, 10.0, 100.0, zoneSize, 8, 3);
+
+    EXPECT_EQ(std::string(zns.getModelName()), std::string("zns"));
+    EXPECT_EQ(zns.getPageSize(), pageSize);
+    EXPECT_EQ(zns.getBlockSize(), blockSize);
+    EXPECT_EQ(zns.getMemoryWearOut(), 0);
+
+    EXPECT_EQ(zns.getZoneSize(), zoneSize);
+    EXPECT_EQ(zns.getNumZones(), 8);
+    EXPECT_EQ(zns.getMaxOpenZones(), 3);
+    EXPECT_EQ(zns.getEmptyZones(), 8);
+    EXPECT_EQ(zns.getOpenZones(), 0);
+    EXPECT_FALSE(zns.isPlacementIsolation());
+    EXPECT_DOUBLE_EQ(zns.getWriteAmplification(), 1.0);
+
+    for (size_t zone = 0; zone < zns.getNumZones(); ++zone)
+    {
+        EXPECT_EQ(zns.getZoneState(zone), MemoryModelZNS::ZONE_STATE_EMPTY);
+        EXPECT_EQ(zns.getZoneWritePointer(zone), 0);
+    }
+
+    MemoryModelZNS_SamsungK9F1G08U0D samsung;
+    EXPECT_EQ(std::string(samsung.getModelName()), std::string("ZNS:samsungK9F1G08U0D"));
+    EXPECT_EQ(samsung.getZoneSize() * samsung.getNumZones(), 128 * 1024 * 1024);
+}
+
+GTEST_TEST(znsBasicTest, appendOnly)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelZNS zns("zns", pageSize, blockSize, 1.0, 10.0, 100.0, blockSize, 8, 3);
+
+    EXPECT_DOUBLE_EQ(zns.writeBytes(6 * pageSize), 6 * 10.0);
+    EXPECT_EQ(zns.getMemoryWearOut(), 6 * pageSize);
+    EXPECT_EQ(zns.getHostWrittenPages(), 6);
+    EXPECT_EQ(zns.getHintValidPages(0), 6);
+
+    EXPECT_EQ(zns.getZoneState(0), MemoryModelZNS::ZONE_STATE_FULL);
+    EXPECT_EQ(zns.getZoneWritePointer(0), 4 * pageSize);
+    EXPECT_EQ(zns.getZoneState(1), MemoryModelZNS::ZONE_STATE_OPEN);
+    EXPECT_EQ(zns.getZoneWritePointer(1), 2 * pageSize);
+    EXPECT_EQ(zns.getEmptyZones(), 6);
+
+    // overwrite is appended at write pointer, the oldest page is invalid now
+    EXPECT_DOUBLE_EQ(zns.overwriteBytes(pageSize), 10.0);
+    EXPECT_EQ(zns.getZoneWritePointer(1), 3 * pageSize);
+    EXPECT_EQ(zns.getZoneValidPages(0), 3);
+    EXPECT_EQ(zns.getHintValidPages(0), 6);
+    EXPECT_EQ(zns.getHostWrittenPages(), 7);
+
+    // partial page has to be read first
+    EXPECT_DOUBLE_EQ(zns.overwriteBytes(100), 1.0 + 10.0);
+
+    EXPECT_DOUBLE_EQ(zns.readBytes(3 * pageSize), 3 * 1.0);
+    EXPECT_DOUBLE_EQ(zns.readBytes(0), 0.0);
+    EXPECT_DOUBLE_EQ(zns.writeBytes(0), 0.0);
+    EXPECT_DOUBLE_EQ(zns.overwriteBytes(0), 0.0);
+    EXPECT_DOUBLE_EQ(zns.getWriteAmplification(), 1.0);
+}
+
+GTEST_TEST(znsBasicTest, zoneReset)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelZNS zns("zns", pageSize, blockSize, 1.0, 10.0, 100.0, blockSize, 8, 3);
+
+    EXPECT_DOUBLE_EQ(zns.setPlacementHint(1, 0), 0.0);
+    EXPECT_DOUBLE_EQ(zns.writeBytes(6 * pageSize), 6 * 10.0);
+    EXPECT_EQ(zns.getCurrentHint(), 1);
+
+    // hint keeps only 2 pages, so first zone has no valid data and is reset
+    EXPECT_DOUBLE_EQ(zns.setPlacementHint(1, 2 * pageSize), 100.0);
+    EXPECT_EQ(zns.getZoneResets(), 1);
+    EXPECT_EQ(zns.getZoneResetCount(0), 1);
+    EXPECT_EQ(zns.getZoneState(0), MemoryModelZNS::ZONE_STATE_EMPTY);
+    EXPECT_EQ(zns.getZoneWritePointer(0), 0);
+    EXPECT_EQ(zns.getHintValidPages(1), 2);
+
+    // open zone waits until it is full
+    EXPECT_DOUBLE_EQ(zns.setPlacementHint(1, 0), 0.0);
+    EXPECT_EQ(zns.getZoneState(1), MemoryModelZNS::ZONE_STATE_OPEN);
+    EXPECT_EQ(zns.getZoneValidPages(1), 0);
+
+    EXPECT_DOUBLE_EQ(zns.writeBytes(2 * pageSize), 2 * 10.0);
+    EXPECT_DOUBLE_EQ(zns.setPlacementHint(1, 0), 100.0);
+    EXPECT_EQ(zns.getZoneState(1), MemoryModelZNS::ZONE_STATE_EMPTY);
+    EXPECT_EQ(zns.getZoneResets(), 2);
+    EXPECT_EQ(zns.getGCWrittenPages(), 0);
+}
+
+GTEST_TEST(znsBasicTest, placementIsolation)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelZNS shared("zns", pageSize, blockSize, 1.0, 10.0, 100.0, blockSize, 10, 3);
+    MemoryModelZNS isolated("zns", pageSize, blockSize, 1.0, 10.0, 100.0, blockSize, 10, 3);
+    isolated.setPlacementIsolation(true);
+    EXPECT_TRUE(isolated.isPlacementIsolation());
+
+    // hot hint 1 is rewritten all the time, cold hint 2 grows slowly
+    MemoryModelZNS* models[] = {&shared, &isolated};
+    for (MemoryModelZNS* zns : models)
+        for (size_t i = 0; i < 200; ++i)
+        {
+            EXPECT_GE(zns->setPlacementHint(1, 2 * pageSize), 0.0);
+            EXPECT_GT(zns->writeBytes(2 * pageSize), 0.0);
+
+            if (i % 10 == 0)
+            {
+                EXPECT_GE(zns->setPlacementHint(2, zns->getHintValidPages(2) * pageSize), 0.0);
+                EXPECT_GT(zns->writeBytes(pageSize), 0.0);
+            }
+        }
+
+    EXPECT_EQ(shared.getHostWrittenPages(), isolated.getHostWrittenPages());
+    EXPECT_EQ(shared.getHintValidPages(2), 20);
+    EXPECT_EQ(isolated.getHintValidPages(2), 20);
+
+    // shared zones keep cold pages, so GC has to copy them before reset
+    EXPECT_GT(shared.getGCWrittenPages(), 0);
+    EXPECT_GT(shared.getWriteAmplification(), 1.0);
+
+    EXPECT_EQ(isolated.getGCWrittenPages(), 0);
+    EXPECT_DOUBLE_EQ(isolated.getWriteAmplification(), 1.0);
+    EXPECT_LT(isolated.getMemoryWearOut(), shared.getMemoryWearOut());
+    EXPECT_EQ(isolated.getMemoryWearOut(), isolated.getHostWrittenPages() * pageSize);
+}
+
+GTEST_TEST(znsBasicTest, openZonesLimit)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelZNS zns("zns", pageSize, blockSize, 1.0, 10.0, 100.0, blockSize, 8, 2);
+    zns.setPlacementIsolation(true);
+
+    EXPECT_GE(zns.setPlacementHint(1, 0), 0.0);
+    EXPECT_GT(zns.writeBytes(pageSize), 0.0);
+    EXPECT_GE(zns.setPlacementHint(2, 0), 0.0);
+    EXPECT_GT(zns.writeBytes(pageSize), 0.0);
+    EXPECT_EQ(zns.getOpenZones(), 2);
+    EXPECT_EQ(zns.getFinishedZones(), 0);
+
+    // third stream has to finish the least recently written zone
+    EXPECT_GE(zns.setPlacementHint(3, 0), 0.0);
+    EXPECT_GT(zns.writeBytes(pageSize), 0.0);
+    EXPECT_EQ(zns.getOpenZones(), 2);
+    EXPECT_EQ(zns.getFinishedZones(), 1);
+    EXPECT_EQ(zns.getWastedPages(), 3);
+    EXPECT_EQ(zns.getZoneState(0), MemoryModelZNS::ZONE_STATE_FULL);
+}
+
+GTEST_TEST(znsBasicTest, resetState)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelZNS zns("zns", pageSize, blockSize, 1.0, 10.0, 100.0, blockSize, 8, 3);
+    zns.setPlacementIsolation(true);
+
+    EXPECT_GE(zns.setPlacementHint(1, 0), 0.0);
+    EXPECT_GT(zns.writeBytes(10 * pageSize), 0.0);
+
+    zns.resetState();
+    EXPECT_EQ(zns.getMemoryWearOut(), 0);
+    EXPECT_EQ(zns.getHostWrittenPages(), 0);
+    EXPECT_EQ(zns.getEmptyZones(), 8);
+    EXPECT_EQ(zns.getOpenZones(), 0);
+    EXPECT_EQ(zns.getHintValidPages(1), 0);
+    EXPECT_EQ(zns.getCurrentHint(), 0);
+    EXPECT_TRUE(zns.isPlacementIsolation());
+}
+
+GTEST_TEST(znsBasicTest, copy)
+{
+    const size_t pageSize = 2048;
+    const size_t blockSize = pageSize * 4;
+
+    MemoryModelZNS zns("zns", pageSize, blockSize, 1.0, 10.0, 100.0, blockSize, 8, 3);
+    EXPECT_GT(zns.writeBytes(6 * pageSize), 0.0);
+
+    MemoryModel* clone = zns.clone();
+    MemoryModelZNS* copy = dynamic_cast<MemoryModelZNS*>(clone);
+    EXPECT_EQ(copy->getHostWrittenPages(), 6);
+    EXPECT_EQ(copy->getZoneWritePointer(1), 2 * pageSize);
+
+    // copies have own zones
+    EXPECT_DOUBLE_EQ(copy->setPlacementHint(0, 0), 100.0);
+    EXPECT_EQ(zns.getZoneValidPages(0), 4);
+    EXPECT_EQ(copy->getZoneValidPages(0), 0);
+
+    MemoryModelZNS copy2;
+    copy2 = *copy;
+    EXPECT_EQ(copy2.getZoneResets(), 1);
+
+    MemoryModelZNS moved(std::move(copy2));
+    EXPECT_EQ(moved.getZoneResets(), 1);
+    EXPECT_EQ(moved.getHostWrittenPages(), 6);
+
+    delete clone;
+}
\ No newline at end of file
@@ -0,0 +1,296 @@
+#include <experiment/parameterSweep.hpp>
+#include <threadPool/dbThreadPool.hpp>
+#include <string>
+#include <iostream>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(parameterSweepBasicTest, point)
+{
+    ParameterSweep::Point point;
+    point.set("disk", "samsung");
+    point.set("bufferSize", "4096");
+    point.set("sel", "0.01");
+
+    EXPECT_TRUE(point.has("disk"));
+    EXPECT_FALSE(point.has("table"));
+    EXPECT_EQ(point.get("disk"), std::string("samsung"));
+    EXPECT_EQ(point.get("table"), std::string(""));
+    EXPECT_EQ(point.getSizeT("bufferSize"), 4096);
+    EXPECT_DOUBLE_EQ(point.getDouble("sel"), 0.01);
+
+    // key does not depend on order of parameters
+    EXPECT_EQ(point.getKey(), std::string("bufferSize=4096;disk=samsung;sel=0.01"));
+
+    ParameterSweep::Point point2({{"sel", "0.01"}, {"disk", "samsung"}, {"bufferSize", "4096"}});
+    EXPECT_TRUE(point == point2);
+    EXPECT_EQ(point.getKey(), point2.getKey());
+
+    point2.set("disk", "intel");
+    EXPECT_FALSE(point == point2);
+}
+
+GTEST_TEST(parameterSweepBasicTest, hash)
+{
+    // FNV-1a values are fixed, so cache from previous runs can be found
+    EXPECT_EQ(ParameterSweep::hashKey(""), 14695981039346656037ULL);
+    EXPECT_EQ(ParameterSweep::hashKey("a"), 0xaf63dc4c8601ec8cULL);
+    EXPECT_NE(ParameterSweep::hashKey("disk=samsung"), ParameterSweep::hashKey("disk=intel"));
+
+    EXPECT_EQ(ParameterSweep::valueToString(0.01), std::string("0.01"));
+    EXPECT_EQ(ParameterSweep::valueToString(5.0), std::string("5"));
+    EXPECT_DOUBLE_EQ(std::stod(ParameterSweep::valueToString(1.0 / 3.0)), 1.0 / 3.0);
+}
+
+GTEST_TEST(parameterSweepBasicTest, cartesianProduct)
+{
+    const std::string cacheDirectory("./parameterSweepTest_cartesianProduct");
+
+    ParameterSweep sweep("sweep", cacheDirectory, [](const ParameterSweep::Point& point) { return point.getKey(); });
+
+    EXPECT_EQ(sweep.getName(), std::string("sweep"));
+    EXPECT_EQ(sweep.getCacheDirectory(), cacheDirectory);
+    EXPECT_TRUE(std::filesystem::is_directory(cacheDirectory));
+    EXPECT_EQ(sweep.getPoints().size(), 0);
+
+    sweep.addParameter("disk", std::vector<std::string>{"samsung", "toshiba", "intel", "samsung"});
+    sweep.addParameter("rsearches", std::vector<size_t>{20, 40});
+    sweep.addParameter("sel", std::vector<double>{0.01, 0.1});
+
+    // duplicated values are ignored
+    std::vector<ParameterSweep::Point> points = sweep.getPoints();
+    EXPECT_EQ(points.size(), 3 * 2 * 2);
+
+    // the last parameter changes the fastest
+    EXPECT_EQ(points[0].getKey(), std::string("disk=samsung;rsearches=20;sel=0.01"));
+    EXPECT_EQ(points[1].getKey(), std::string("disk=samsung;rsearches=20;sel=0.1"));
+    EXPECT_EQ(points[2].getKey(), std::string("disk=samsung;rsearches=40;sel=0.01"));
+    EXPECT_EQ(points[11].getKey(), std::string("disk=intel;rsearches=40;sel=0.1"));
+
+    // extra points are deduplicated with product
+    sweep.addPoint(ParameterSweep::Point({{"disk", "samsung"}, {"rsearches", "20"}, {"sel", "0.01"}}));
+    sweep.addPoint(ParameterSweep::Point({{"disk", "samsung"}, {"rsearches", "250"}, {"sel", "0.01"}}));
+    sweep.addPoint(ParameterSweep::Point({{"disk", "samsung"}, {"rsearches", "250"}, {"sel", "0.01"}}));
+
+    points = sweep.getPoints();
+    EXPECT_EQ(points.size(), 3 * 2 * 2 + 1);
+    EXPECT_EQ(points.back().getKey(), std::string("disk=samsung;rsearches=250;sel=0.01"));
+
+    std::filesystem::remove_all(cacheDirectory);
+}
+
+GTEST_TEST(parameterSweepBasicTest, run)
+{
+    const std::string cacheDirectory("./parameterSweepTest_run");
+    std::filesystem::remove_all(cacheDirectory);
+
+    std::atomic<size_t> executed{0};
+    auto pointFunction = [&executed](const ParameterSweep::Point& point)
+    {
+        ++executed;
+        return std::to_string(point.getSizeT("a") * point.getSizeT("b")) + std::string("\nsecond line\n");
+    };
+
+    {
+        ParameterSweep sweep("multiply", cacheDirectory, pointFunction);
+        sweep.addParameter("a", std::vector<size_t>{1, 2, 3});
+        sweep.addParameter("b", std::vector<size_t>{10, 20});
+
+        EXPECT_EQ(sweep.getPendingPoints().size(), 6);
+
+        sweep.run();
+
+        EXPECT_EQ(executed, 6);
+        EXPECT_EQ(sweep.getNumExecutedPoints(), 6);
+        EXPECT_EQ(sweep.getNumCachedPoints(), 0);
+        EXPECT_EQ(sweep.getPendingPoints().size(), 0);
+
+        const ParameterSweep::Point point({{"a", "3"}, {"b", "20"}});
+        EXPECT_TRUE(sweep.hasResult(point));
+        EXPECT_EQ(sweep.getResult(point), std::string("60\nsecond line\n"));
+
+        // second run of the same object does nothing
+        sweep.run();
+        EXPECT_EQ(executed, 6);
+        EXPECT_EQ(sweep.getNumExecutedPoints(), 6);
+    }
+
+    // rerun skips completed points
+    {
+        ParameterSweep sweep("multiply", cacheDirectory, pointFunction);
+        sweep.addParameter("a", std::vector<size_t>{1, 2, 3});
+        sweep.addParameter("b", std::vector<size_t>{10, 20});
+
+        sweep.run();
+
+        EXPECT_EQ(executed, 6);
+        EXPECT_EQ(sweep.getNumExecutedPoints(), 0);
+        EXPECT_EQ(sweep.getNumCachedPoints(), 6);
+        EXPECT_EQ(sweep.getResult(ParameterSweep::Point({{"a", "2"}, {"b", "10"}})), std::string("20\nsecond line\n"));
+    }
+
+    // overlapping sweep runs only new points
+    {
+        ParameterSweep sweep("multiply", cacheDirectory, pointFunction);
+        sweep.addParameter("b", std::vector<size_t>{20, 30});
+        sweep.addParameter("a", std::vector<size_t>{3, 4});
+
+        sweep.run();
+
+        EXPECT_EQ(executed, 6 + 3);
+        EXPECT_EQ(sweep.getNumExecutedPoints(), 3);
+        EXPECT_EQ(sweep.getNumCachedPoints(), 1);
+        EXPECT_EQ(sweep.getResult(ParameterSweep::Point({{"a", "4"}, {"b", "30"}})), std::string("120\nsecond line\n"));
+    }
+
+    // name is only a label, other sweep of the same experiment uses results of this sweep
+    {
+        ParameterSweep sweep("multiplyAgain", cacheDirectory, pointFunction);
+        sweep.addParameter("a", std::vector<size_t>{1});
+        sweep.addParameter("b", std::vector<size_t>{10});
+
+        EXPECT_EQ(sweep.getPendingPoints().size(), 0);
+    }
+
+    // other experiment does not use results of this sweep
+    {
+        auto configFunction = [](const ParameterSweep::Point& point) { return std::string("add ") + point.getKey(); };
+        ParameterSweep sweep("add", cacheDirectory, pointFunction, ParameterSweep::CostFunction(), configFunction);
+        sweep.addParameter("a", std::vector<size_t>{1});
+        sweep.addParameter("b", std::vector<size_t>{10});
+
+        EXPECT_EQ(sweep.getPendingPoints().size(), 1);
+    }
+
+    std::filesystem::remove_all(cacheDirectory);
+}
+
+GTEST_TEST(parameterSweepBasicTest, longestFirst)
+{
+    const std::string cacheDirectory("./parameterSweepTest_longestFirst");
+    std::filesystem::remove_all(cacheDirectory);
+
+    auto pointFunction = [](const ParameterSweep::Point& point) { return point.get("rsearches"); };
+    auto costFunction = [](const ParameterSweep::Point& point) { return static_cast<double>(point.getSizeT("rsearches")) * (point.get("table") == std::string("customer") ? 10.0 : 1.0); };
+
+    ParameterSweep sweep("longestFirst", cacheDirectory, pointFunction, costFunction);
+    sweep.addParameter("table", std::vector<std::string>{"warehouse", "customer"});
+    sweep.addParameter("rsearches", std::vector<size_t>{20, 250, 100});
+
+    const std::vector<ParameterSweep::Point> points = sweep.getPendingPoints();
+    ASSERT_EQ(points.size(), 6);
+    EXPECT_EQ(points[0].getKey(), std::string("rsearches=250;table=customer"));
+    EXPECT_EQ(points[1].getKey(), std::string("rsearches=100;table=customer"));
+    EXPECT_EQ(points[2].getKey(), std::string("rsearches=250;table=warehouse"));
+    EXPECT_EQ(points[3].getKey(), std::string("rsearches=20;table=customer"));
+    EXPECT_EQ(points[4].getKey(), std::string("rsearches=100;table=warehouse"));
+    EXPECT_EQ(points[5].getKey(), std::string("rsearches=20;table=warehouse"));
+
+    sweep.run();
+    for (const auto& point : points)
+        EXPECT_EQ(sweep.getResult(point), point.get("rsearches"));
+
+    std::filesystem::remove_all(cacheDirectory);
+}
+
+GTEST_TEST(parameterSweepBasicTest, corruptedCache)
+{
+    const std::string cacheDirectory("./parameterSweepTest_corruptedCache");
+    std::filesystem::remove_all(cacheDirectory);
+
+    size_t executed = 0;
+    auto pointFunction = [&executed](const ParameterSweep::Point& point) { ++executed; return point.get("a"); };
+
+    ParameterSweep sweep("corrupted", cacheDirectory, pointFunction);
+    sweep.addParameter("a", std::vector<std::string>{"x"});
+    sweep.run();
+    EXPECT_EQ(executed, 1);
+
+    // file of point belongs to other key now, so point has to be executed again
+    for (const auto& entry : std::filesystem::directory_iterator(cacheDirectory))
+    {
+        std::ofstream file(entry.path(), std::ios::trunc);
+        file << "otherKey\nresult";
+    }
+
+    ParameterSweep sweep2("corrupted", cacheDirectory, pointFunction);
+    sweep2.addParameter("a", std::vector<std::string>{"x"});
+    sweep2.run();
+    EXPECT_EQ(executed, 2);
+    EXPECT_EQ(sweep2.getNumCachedPoints(), 0);
+    ParameterSweep::Point point;
+    point.set("a", "x");
+    EXPECT_EQ(sweep2.getResult(point), std::string("x"));
+
+    std::filesystem::remove_all(cacheDirectory);
+}
+
+GTEST_TEST(parameterSweepBasicTest, configInCacheKey)
+{
+    const std::string cacheDirectory("./parameterSweepTest_configInCacheKey");
+    std::filesystem::remove_all(cacheDirectory);
+
+    size_t executed = 0;
+    size_t hardcodedEntries = 1000;
+    auto pointFunction = [&executed, &hardcodedEntries](const ParameterSweep::Point& point) { ++executed; return std::to_string(point.getSizeT("a") * hardcodedEntries); };
+
+    // config has more than 1 line like toStringFull(false)
+    auto configFunction = [&hardcodedEntries](const ParameterSweep::Point& point) { return std::string("Experiment {\n\t.entries = ") + std::to_string(hardcodedEntries) + std::string("\n\t.a = ") + point.get("a") + std::string("\n}"); };
+
+    {
+        ParameterSweep sweep("config", cacheDirectory, pointFunction, ParameterSweep::CostFunction(), configFunction);
+        sweep.addParameter("a", std::vector<size_t>{1, 2});
+        sweep.run();
+
+        EXPECT_EQ(executed, 2);
+        EXPECT_EQ(sweep.getResult(ParameterSweep::Point(std::vector<std::pair<std::string, std::string>>{{"a", "2"}})), std::string("2000"));
+    }
+
+    // the same config is taken from cache
+    {
+        ParameterSweep sweep("config", cacheDirectory, pointFunction, ParameterSweep::CostFunction(), configFunction);
+        sweep.addParameter("a", std::vector<size_t>{1, 2});
+        sweep.run();
+
+        EXPECT_EQ(executed, 2);
+        EXPECT_EQ(sweep.getNumCachedPoints(), 2);
+        EXPECT_EQ(sweep.getResult(ParameterSweep::Point(std::vector<std::pair<std::string, std::string>>{{"a", "2"}})), std::string("2000"));
+    }
+
+    // value which is not a parameter changed, so the same points are executed again
+    hardcodedEntries = 10;
+    {
+        ParameterSweep sweep("config", cacheDirectory, pointFunction, ParameterSweep::CostFunction(), configFunction);
+        sweep.addParameter("a", std::vector<size_t>{1, 2});
+        sweep.run();
+
+        EXPECT_EQ(executed, 4);
+        EXPECT_EQ(sweep.getNumCachedPoints(), 0);
+        EXPECT_EQ(sweep.getResult(ParameterSweep::Point(std::vector<std::pair<std::string, std::string>>{{"a", "2"}})), std::string("20"));
+    }
+
+    std::filesystem::remove_all(cacheDirectory);
+}
+
+GTEST_TEST(parameterSweepBasicTest, runFromThreadPoolTask)
+{
+    const std::string cacheDirectory("./parameterSweepTest_runFromThreadPoolTask");
+    std::filesystem::remove_all(cacheDirectory);
+
+    auto pointFunction = [](const ParameterSweep::Point& point) { return point.get("a"); };
+
+    ParameterSweep sweep("fromTask", cacheDirectory, pointFunction);
+    sweep.addParameter("a", std::vector<size_t>{1, 2, 3, 4, 5, 6, 7, 8});
+
+    // task of DBThreadPool::threadPool waits for sweep, points do not need free thread of DBThreadPool::threadPool
+    std::future<bool> future = DBThreadPool::threadPool.submit([&sweep]() { sweep.run(); return true; });
+
+    EXPECT_TRUE(future.get());
+    EXPECT_EQ(sweep.getNumExecutedPoints(), 8);
+    EXPECT_EQ(sweep.getResult(ParameterSweep::Point(std::vector<std::pair<std::string, std::string>>{{"a", "8"}})), std::string("8"));
+
+    std::filesystem::remove_all(cacheDirectory);
+}
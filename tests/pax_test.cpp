@@ -0,0 +1,316 @@
+#include <index/pax.hpp>
+#include <index/dsm.hpp>
+#include <disk/diskSSD.hpp>
+#include <string>
+#include <iostream>
+#include <numeric>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(paxBasicTest, interface)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 16 + 32 + 4 + 4 + 8;
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t recordSize = keySize + dataSize;
+
+    PAX* pax = new PAX(ssd, columns);
+    DBIndexColumn* index = pax;
+
+    // check how to get some statistics
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_TIME; id < MemoryCounters::MEMORY_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_DOUBLE_EQ(index->getDisk().getDiskCounter(id).second, 0.0);
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_BYTES; id < MemoryCounters::MEMORY_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(index->getDisk().getDiskCounter(id).second, 0L);
+
+    for (auto id = IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME; id < IndexCounters::INDEX_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_DOUBLE_EQ(index->getCounter(id).second, 0.0);
+
+    for (auto id = IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < IndexCounters::INDEX_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(index->getCounter(id).second, 0L);
+
+    EXPECT_EQ(index->getDisk().getLowLevelController().getMemoryWearOut(), 0);
+
+    EXPECT_EQ(index->getNumEntries(), 0);
+    EXPECT_EQ(index->getKeySize(), keySize);
+    EXPECT_EQ(index->getDataSize(), dataSize);
+    EXPECT_EQ(index->getRecordSize(), recordSize);
+    EXPECT_EQ(index->isBulkloadSupported(), true);
+
+    EXPECT_EQ(index->getNumOfColumns(), columns.size());
+    for (size_t i = 0; i < columns.size(); ++i)
+        EXPECT_EQ(index->getColumnSize(i), columns[i]);
+
+    EXPECT_EQ(pax->getPageSize(), ssd->getLowLevelController().getPageSize());
+    EXPECT_EQ(pax->getNumOfPages(), 0);
+
+    delete index;
+}
+
+GTEST_TEST(paxBasicTest, minipages)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+
+    PAX* pax = new PAX(ssd, columns);
+
+    // 8192 - 14 bytes of header, minipages are proportional to columns and aligned to 8 bytes
+    const std::vector<size_t> minipages = {904, 1816, 3632, 448, 448, 904};
+    const std::vector<size_t> capacities = {113, 113, 113, 112, 112, 113};
+    for (size_t i = 0; i < columns.size(); ++i)
+    {
+        EXPECT_EQ(pax->getMinipageSize(i), minipages[i]);
+        EXPECT_EQ(pax->getMinipageCapacity(i), capacities[i]);
+    }
+
+    EXPECT_EQ(pax->getEntriesPerPage(), 112);
+
+    // only minipages of 4-byte columns are full when page overflows
+    EXPECT_GT(pax->insertEntries(2 * 112 + 1), 0.0);
+    EXPECT_EQ(pax->getNumOfPages(), 3);
+    for (size_t i = 0; i < columns.size(); ++i)
+        EXPECT_EQ(pax->getMinipageOverflows(i), capacities[i] == 112 ? 2 : 0);
+
+    EXPECT_GT(pax->bulkloadEntries(3 * 112), 0.0);
+    EXPECT_EQ(pax->getNumOfPages(), 6);
+    for (size_t i = 0; i < columns.size(); ++i)
+        EXPECT_EQ(pax->getMinipageOverflows(i), capacities[i] == 112 ? 5 : 0);
+
+    pax->resetState();
+    for (size_t i = 0; i < columns.size(); ++i)
+        EXPECT_EQ(pax->getMinipageOverflows(i), 0);
+
+    delete pax;
+}
+
+GTEST_TEST(paxBasicTest, bigRecord)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 8000, 500};
+
+    // record does not fit into 1 disk page, so PAX page has 2 disk pages
+    PAX* pax = new PAX(ssd, columns);
+
+    EXPECT_EQ(pax->getPageSize(), 2 * ssd->getLowLevelController().getPageSize());
+    EXPECT_EQ(pax->getEntriesPerPage(), 1);
+
+    delete pax;
+}
+
+GTEST_TEST(paxBasicTest, topology)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t numEntries = 1000000000;
+
+    PAX* pax = new PAX(ssd, columns);
+    DBIndexColumn* index = pax;
+
+    index->createTopologyAfterInsert(numEntries);
+
+    EXPECT_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS).second, 0);
+    EXPECT_DOUBLE_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, 0.0);
+
+    EXPECT_EQ(index->getNumEntries(), numEntries);
+    EXPECT_EQ(pax->getNumOfPages(), (numEntries + 111) / 112);
+
+    delete index;
+}
+
+GTEST_TEST(paxBasicTest, insert)
+{
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t numOperations = 1000;
+
+    DBIndexColumn* pax = new PAX(new DiskSSD_Samsung840(), columns);
+    DBIndexColumn* dsm = new DSM(new DiskSSD_Samsung840(), columns);
+
+    double paxTime = 0.0;
+    double dsmTime = 0.0;
+    for (size_t i = 0; i < numOperations; ++i)
+    {
+        paxTime += pax->insertEntries();
+        dsmTime += dsm->insertEntries();
+
+        EXPECT_EQ(pax->getNumEntries(), i + 1);
+        EXPECT_EQ(pax->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS).second, (i + 1));
+        EXPECT_DOUBLE_EQ(pax->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, paxTime);
+    }
+
+    // PAX rewrites 1 page per insert, DSM 1 page per column
+    EXPECT_LT(paxTime * 3.0, dsmTime);
+    EXPECT_LT(pax->getDisk().getLowLevelController().getMemoryWearOut() * 3, dsm->getDisk().getLowLevelController().getMemoryWearOut());
+
+    delete pax;
+    delete dsm;
+}
+
+GTEST_TEST(paxBasicTest, bulkload)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t numEntries = 112 * 10;
+    const double writeTime = 45.0 / 1000000.0;
+    const double seqWriteTime = 15.3 / 1000000.0;
+
+    PAX* pax = new PAX(ssd, columns);
+    DBIndexColumn* index = pax;
+
+    EXPECT_DOUBLE_EQ(index->bulkloadEntries(numEntries), 10.0 * seqWriteTime);
+    EXPECT_EQ(index->getNumEntries(), numEntries);
+    EXPECT_EQ(pax->getNumOfPages(), 10);
+
+    EXPECT_DOUBLE_EQ(index->bulkloadEntries(1), writeTime);
+    EXPECT_EQ(pax->getNumOfPages(), 11);
+
+    EXPECT_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_BULKLOAD_TOTAL_OPERATIONS).second, 2);
+
+    delete index;
+}
+
+GTEST_TEST(paxBasicTest, copy)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+
+    PAX* pax = new PAX(ssd, columns);
+    EXPECT_GT(pax->insertEntries(200), 0.0);
+
+    PAX* copy = new PAX(*pax);
+
+    EXPECT_EQ(copy->getNumEntries(), pax->getNumEntries());
+    EXPECT_EQ(copy->getPageSize(), pax->getPageSize());
+    EXPECT_EQ(copy->getEntriesPerPage(), pax->getEntriesPerPage());
+    EXPECT_EQ(copy->getNumOfPages(), 2);
+    for (size_t i = 0; i < columns.size(); ++i)
+        EXPECT_EQ(copy->getMinipageOverflows(i), pax->getMinipageOverflows(i));
+
+    EXPECT_EQ(copy->toStringFull(), pax->toStringFull());
+
+    PAX copy2(new DiskSSD_Samsung840(), columns);
+    copy2 = *copy;
+    EXPECT_EQ(copy2.toStringFull(), pax->toStringFull());
+
+    delete copy;
+    delete pax;
+}
+
+GTEST_TEST(paxBasicTest, move)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+
+    PAX* pax = new PAX(ssd, columns);
+    EXPECT_GT(pax->insertEntries(200), 0.0);
+    const std::string expected = pax->toStringFull();
+
+    PAX* moved = new PAX(std::move(*pax));
+    EXPECT_EQ(moved->toStringFull(), expected);
+    EXPECT_EQ(moved->getNumOfPages(), 2);
+
+    delete moved;
+    delete pax;
+}
+
+GTEST_TEST(paxBasicTest, findPoint)
+{
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t numEntries = 50000;
+    const double readTime = 21.0 / 1000000.0;
+    const double seqReadTime = 14.0 / 1000000.0;
+
+    Disk* ssd = new DiskSSD_Samsung840();
+    PAX* pax = new PAX(ssd, columns);
+    DBIndexColumn* index = pax;
+    DBIndexColumn* dsm = new DSM(new DiskSSD_Samsung840(), columns);
+
+    EXPECT_GT(index->bulkloadEntries(numEntries), 0.0);
+    EXPECT_GT(dsm->bulkloadEntries(numEntries), 0.0);
+
+    // key is checked in every page
+    const size_t pages = (numEntries + 111) / 112;
+    const double findKeyTime = seqReadTime * pages;
+
+    // key scan reads whole pages, so fetching more columns costs nothing more
+    EXPECT_DOUBLE_EQ(index->findPointEntries({0}), findKeyTime);
+    EXPECT_DOUBLE_EQ(index->findPointEntries({0, 2}), findKeyTime);
+    EXPECT_DOUBLE_EQ(index->findPointEntries({0, 1, 2, 3, 4, 5}), findKeyTime);
+    EXPECT_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_PSEARCH_TOTAL_OPERATIONS).second, 3);
+
+    // DSM scans only key column, but each column costs 1 more page
+    const double dsmFindKeyTime = dsm->findPointEntries({0});
+    EXPECT_LT(dsmFindKeyTime, findKeyTime);
+    EXPECT_DOUBLE_EQ(dsm->findPointEntries({0, 1, 2, 3, 4, 5}), dsmFindKeyTime + 5.0 * readTime);
+
+    delete index;
+    delete dsm;
+}
+
+GTEST_TEST(paxBasicTest, findRange)
+{
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t numEntries = 50000;
+    const size_t rangeEntries = 5000;
+    const double seqReadTime = 14.0 / 1000000.0;
+
+    Disk* ssd = new DiskSSD_Samsung840();
+    PAX* pax = new PAX(ssd, columns);
+    DBIndexColumn* index = pax;
+    DBIndexColumn* dsm = new DSM(new DiskSSD_Samsung840(), columns);
+
+    EXPECT_GT(index->bulkloadEntries(numEntries), 0.0);
+    EXPECT_GT(dsm->bulkloadEntries(numEntries), 0.0);
+
+    const double findKeyTime = seqReadTime * ((numEntries + 111) / 112);
+    const double fetchTime = seqReadTime * ((rangeEntries + 111) / 112);
+
+    // found pages were read by key scan
+    EXPECT_DOUBLE_EQ(index->findRangeEntries({0}, rangeEntries), findKeyTime);
+    EXPECT_DOUBLE_EQ(index->findRangeEntries({0, 3}, rangeEntries), findKeyTime);
+    EXPECT_DOUBLE_EQ(index->findRangeEntries({0, 1, 2, 3, 4, 5}, rangeEntries), findKeyTime);
+    EXPECT_DOUBLE_EQ(index->findRangeEntries({0, 1, 2, 3, 4, 5}, 0.1), findKeyTime);
+    EXPECT_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_OPERATIONS).second, 4);
+
+    // DSM scans only key column and pays for each fetched column, still less than PAX reading whole pages
+    const double dsmFindKeyTime = dsm->findRangeEntries({0}, rangeEntries);
+    EXPECT_LT(dsmFindKeyTime, findKeyTime);
+    EXPECT_GT(dsm->findRangeEntries({0, 3}, rangeEntries), dsmFindKeyTime);
+    EXPECT_LT(dsm->findRangeEntries({0, 3}, rangeEntries) - dsmFindKeyTime, fetchTime);
+
+    delete index;
+    delete dsm;
+}
+
+GTEST_TEST(paxBasicTest, delete)
+{
+    Disk* ssd = new DiskSSD_Samsung840();
+
+    const std::vector<size_t> columns = {8, 16, 32, 4, 4, 8};
+    const size_t numEntries = 1000;
+    const double seqReadTime = 14.0 / 1000000.0;
+
+    PAX* pax = new PAX(ssd, columns);
+    DBIndexColumn* index = pax;
+
+    EXPECT_GT(index->bulkloadEntries(numEntries), 0.0);
+
+    const double findKeyTime = seqReadTime * pax->getNumOfPages();
+    EXPECT_GT(index->deleteEntries(), findKeyTime);
+    EXPECT_EQ(index->getNumEntries(), numEntries - 1);
+
+    EXPECT_GT(index->deleteEntries(numEntries), 0.0);
+    EXPECT_EQ(index->getNumEntries(), 0);
+    EXPECT_EQ(pax->getNumOfPages(), 0);
+    EXPECT_EQ(index->getCounter(IndexCounters::INDEX_COUNTER_RW_DELETE_TOTAL_OPERATIONS).second, numEntries);
+
+    delete index;
+}
\ No newline at end of file
@@ -1060,6 +1060,36 @@ GTEST_TEST(sbptreeBasicPCMTest, insertIntoRoot)
     delete index;
 }
 
+GTEST_TEST(sbptreeBasicPCMTest, differentialWrite)
+{
+    DiskPCM* disk = new DiskPCM_DefaultModel();
+    disk->setDifferentialWrite(MemoryModelPCM::DIFFERENTIAL_WRITE_DCW);
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t recordSize = keySize + dataSize;
+    const size_t lineSize = disk->getLowLevelController().getPageSize();
+    const size_t nodeSize = lineSize * 8;
+    const size_t numOperations = nodeSize / recordSize - 1;
+    const double readTime = 50.0 / 1000000000.0;
+    const double writeTime = 1.0 / 1000000;
+
+    SBPTree* sbp = new SBPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* index = sbp;
+
+    // record is appended into free space (half of bits change) and 1 bit of bitmap is set
+    const double bitChangeRatio = (static_cast<double>(recordSize) * 0.5 + 1.0 / 8.0) / static_cast<double>(3 * lineSize);
+    for (size_t i = 0; i < numOperations; ++i)
+    {
+        const double expectedTime = 2.0 * readTime + 3.0 * readTime + 3.0 * writeTime * bitChangeRatio;
+        EXPECT_DOUBLE_EQ(index->insertEntries(), expectedTime);
+
+        EXPECT_DOUBLE_EQ(disk->getPCMModel().getOverwriteBitChangeRatio(), bitChangeRatio);
+    }
+
+    delete index;
+}
+
 GTEST_TEST(sbptreeBasicPCMTest, insertIntoInner)
 {
     Disk* disk = new DiskPCM_DefaultModel();
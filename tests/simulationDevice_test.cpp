@@ -0,0 +1,79 @@
+#include <simulation/simulationDevice.hpp>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(simulationDeviceTest, interface)
+{
+    SimulationEngine engine;
+    SimulationDevice device("SSD", &engine, 4);
+
+    EXPECT_EQ(std::string(device.getName()), std::string("SSD"));
+    EXPECT_EQ(device.getNumServers(), 4);
+    EXPECT_EQ(device.getNumBusyServers(), 0);
+    EXPECT_EQ(device.getQueueLength(), 0);
+    EXPECT_DOUBLE_EQ(device.getBusyTime(), 0.0);
+    EXPECT_DOUBLE_EQ(device.getUtilization(1.0), 0.0);
+
+    SimulationDevice device2(&engine, 0);
+    EXPECT_EQ(device2.getNumServers(), 1);
+}
+
+GTEST_TEST(simulationDeviceTest, singleServerQueue)
+{
+    SimulationEngine engine;
+    SimulationDevice device(&engine, 1);
+    std::vector<double> finish;
+
+    for (size_t i = 0; i < 3; ++i)
+        device.submit(1.0, [&finish](double t){ finish.push_back(t); });
+
+    EXPECT_EQ(device.getNumBusyServers(), 1);
+    EXPECT_EQ(device.getQueueLength(), 2);
+
+    EXPECT_DOUBLE_EQ(engine.run(), 3.0);
+    EXPECT_EQ(finish, std::vector<double>({1.0, 2.0, 3.0}));
+
+    EXPECT_DOUBLE_EQ(device.getBusyTime(), 3.0);
+    EXPECT_DOUBLE_EQ(device.getForegroundWaitTime(), 0.0 + 1.0 + 2.0);
+    EXPECT_EQ(device.getMaxQueueLength(), 2);
+    EXPECT_DOUBLE_EQ(device.getUtilization(3.0), 1.0);
+}
+
+GTEST_TEST(simulationDeviceTest, parallelServers)
+{
+    SimulationEngine engine;
+    SimulationDevice device(&engine, 2);
+    std::vector<double> finish;
+
+    for (size_t i = 0; i < 4; ++i)
+        device.submit(1.0, [&finish](double t){ finish.push_back(t); });
+
+    EXPECT_DOUBLE_EQ(engine.run(), 2.0);
+    EXPECT_EQ(finish, std::vector<double>({1.0, 1.0, 2.0, 2.0}));
+    EXPECT_DOUBLE_EQ(device.getUtilization(2.0), 1.0);
+}
+
+GTEST_TEST(simulationDeviceTest, foregroundFirst)
+{
+    SimulationEngine engine;
+    SimulationDevice device(&engine, 1);
+    std::vector<std::string> order;
+
+    device.submit(1.0, [&order](double){ order.push_back("fg1"); });
+    device.submit(1.0, [&order](double){ order.push_back("bg1"); }, SimulationDevice::SIMULATION_REQUEST_BACKGROUND);
+    device.submit(1.0, [&order](double){ order.push_back("fg2"); });
+
+    engine.run();
+
+    EXPECT_EQ(order, std::vector<std::string>({"fg1", "fg2", "bg1"}));
+    EXPECT_EQ(device.getNumForegroundRequests(), 2);
+    EXPECT_EQ(device.getNumBackgroundRequests(), 1);
+    EXPECT_DOUBLE_EQ(device.getBackgroundWaitTime(), 2.0);
+
+    device.resetState();
+    EXPECT_EQ(device.getNumForegroundRequests(), 0);
+    EXPECT_DOUBLE_EQ(device.getBusyTime(), 0.0);
+}
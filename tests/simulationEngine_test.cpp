@@ -0,0 +1,82 @@
+#include <simulation/simulationEngine.hpp>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(simulationEngineTest, interface)
+{
+    SimulationEngine engine;
+
+    EXPECT_DOUBLE_EQ(engine.getClock(), 0.0);
+    EXPECT_EQ(engine.getNumPendingEvents(), 0);
+    EXPECT_EQ(engine.getNumProcessedEvents(), 0);
+    EXPECT_FALSE(engine.step());
+
+    engine.scheduleAt(1.0, [](){});
+    engine.scheduleAfter(2.0, [](){});
+
+    EXPECT_EQ(engine.getNumPendingEvents(), 2);
+    EXPECT_DOUBLE_EQ(engine.run(), 2.0);
+    EXPECT_EQ(engine.getNumPendingEvents(), 0);
+    EXPECT_EQ(engine.getNumProcessedEvents(), 2);
+
+    engine.resetState();
+    EXPECT_DOUBLE_EQ(engine.getClock(), 0.0);
+    EXPECT_EQ(engine.getNumProcessedEvents(), 0);
+}
+
+GTEST_TEST(simulationEngineTest, order)
+{
+    SimulationEngine engine;
+    std::vector<int> order;
+
+    engine.scheduleAt(3.0, [&order](){ order.push_back(3); });
+    engine.scheduleAt(1.0, [&order](){ order.push_back(1); });
+    engine.scheduleAt(2.0, [&order](){ order.push_back(2); });
+
+    // the same time -> FIFO
+    engine.scheduleAt(1.0, [&order](){ order.push_back(11); });
+
+    engine.run();
+
+    EXPECT_EQ(order, std::vector<int>({1, 11, 2, 3}));
+}
+
+GTEST_TEST(simulationEngineTest, nestedEvents)
+{
+    SimulationEngine engine;
+    std::vector<double> times;
+
+    engine.scheduleAt(1.0, [&]()
+    {
+        times.push_back(engine.getClock());
+        engine.scheduleAfter(0.5, [&]()
+        {
+            times.push_back(engine.getClock());
+
+            // past is moved to now
+            engine.scheduleAt(0.0, [&]() { times.push_back(engine.getClock()); });
+        });
+    });
+
+    EXPECT_DOUBLE_EQ(engine.run(), 1.5);
+    EXPECT_EQ(times, std::vector<double>({1.0, 1.5, 1.5}));
+}
+
+GTEST_TEST(simulationEngineTest, runUntil)
+{
+    SimulationEngine engine;
+    size_t fired = 0;
+
+    for (size_t i = 1; i <= 10; ++i)
+        engine.scheduleAt(static_cast<double>(i), [&fired](){ ++fired; });
+
+    EXPECT_DOUBLE_EQ(engine.runUntil(4.5), 4.5);
+    EXPECT_EQ(fired, 4);
+    EXPECT_EQ(engine.getNumPendingEvents(), 6);
+
+    EXPECT_DOUBLE_EQ(engine.run(), 10.0);
+    EXPECT_EQ(fired, 10);
+}
@@ -0,0 +1,190 @@
+#include <simulation/simulationWorkload.hpp>
+#include <workload/workloadStepPSearch.hpp>
+#include <workload/workloadStepInsert.hpp>
+#include <disk/diskSSD.hpp>
+#include <index/phantomIndex.hpp>
+#include <index/bptree.hpp>
+#include <index/dsm.hpp>
+#include <index/lsmtree.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+static std::vector<WorkloadStep*> createSearchSteps(size_t numSteps)
+{
+    std::vector<WorkloadStep*> steps;
+    for (size_t i = 0; i < numSteps; ++i)
+        steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(1)));
+
+    return steps;
+}
+
+GTEST_TEST(simulationWorkloadTest, interface)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    BPTree* bp = new BPTree(disk, 8, 64, 1 << 14, true);
+    DBIndex* index = bp;
+
+    SimulationWorkload sim(index, createSearchSteps(10), 4);
+
+    EXPECT_EQ(sim.getNumClients(), 4);
+    EXPECT_EQ(sim.getNumSteps(), 10);
+    EXPECT_EQ(sim.getLastResult().numOperations, 0);
+
+    SimulationWorkload copy(sim);
+    EXPECT_EQ(copy.getNumClients(), 4);
+    EXPECT_EQ(copy.getNumSteps(), 10);
+
+    delete index;
+}
+
+GTEST_TEST(simulationWorkloadTest, singleClient)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    BPTree* bp = new BPTree(disk, 8, 64, 1 << 14, true);
+    DBIndex* index = bp;
+
+    index->bulkloadEntries(100000);
+    const double searchTime = index->findPointEntries(static_cast<size_t>(1));
+
+    SimulationWorkload sim(index, createSearchSteps(10), 1);
+    const SimulationWorkload::SimulationResult result = sim.run();
+
+    // 1 client -> no concurrency, simulation is equal to sum of times
+    EXPECT_EQ(result.numClients, 1);
+    EXPECT_EQ(result.numOperations, 10);
+    EXPECT_NEAR(result.makespan, 10.0 * searchTime, 1e-9);
+    EXPECT_NEAR(result.avgLatency, searchTime, 1e-9);
+    EXPECT_NEAR(result.maxLatency, searchTime, 1e-9);
+    EXPECT_NEAR(result.throughput, 1.0 / searchTime, 1e-3);
+    EXPECT_NEAR(result.deviceUtilization, 1.0, 1e-9);
+
+    EXPECT_EQ(sim.getLastResult().numOperations, 10);
+
+    delete index;
+}
+
+GTEST_TEST(simulationWorkloadTest, concurrentClients)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    BPTree* bp = new BPTree(disk, 8, 64, 1 << 14, true);
+    DBIndex* index = bp;
+
+    index->bulkloadEntries(100000);
+
+    SimulationWorkload serial(index, createSearchSteps(10), 1);
+    SimulationWorkload contended(index, createSearchSteps(10), 8);
+    SimulationWorkload parallel(index, createSearchSteps(10), 8, 8);
+
+    const SimulationWorkload::SimulationResult serialResult = serial.run();
+    const SimulationWorkload::SimulationResult contendedResult = contended.run();
+    const SimulationWorkload::SimulationResult parallelResult = parallel.run();
+
+    EXPECT_EQ(contendedResult.numOperations, 80);
+    EXPECT_EQ(parallelResult.numOperations, 80);
+
+    // single server: clients wait in queue, throughput does not grow
+    EXPECT_NEAR(contendedResult.throughput, serialResult.throughput, serialResult.throughput * 1e-6);
+    EXPECT_GT(contendedResult.avgLatency, serialResult.avgLatency);
+    EXPECT_GE(contendedResult.p99Latency, contendedResult.p50Latency);
+
+    // 8 servers: throughput scales with clients
+    EXPECT_NEAR(parallelResult.throughput, 8.0 * serialResult.throughput, serialResult.throughput * 1e-3);
+    EXPECT_NEAR(parallelResult.avgLatency, serialResult.avgLatency, serialResult.avgLatency * 1e-6);
+
+    delete index;
+}
+
+GTEST_TEST(simulationWorkloadTest, backgroundJobs)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    BPTree* bp = new BPTree(disk, 8, 64, 1 << 14, true);
+    DBIndex* index = bp;
+
+    index->bulkloadEntries(100000);
+    const double searchTime = index->findPointEntries(static_cast<size_t>(1));
+
+    SimulationWorkload sim(index, createSearchSteps(10), 1, 1);
+
+    // every request produces background work as long as itself
+    sim.setBackgroundJobSource([searchTime]() { return searchTime; });
+
+    const SimulationWorkload::SimulationResult result = sim.run();
+
+    EXPECT_EQ(result.numOperations, 10);
+    EXPECT_EQ(result.numBackgroundJobs, 10);
+    EXPECT_NEAR(result.backgroundTime, 10.0 * searchTime, 1e-9);
+
+    // background work shares device, so foreground latency grows
+    EXPECT_GT(result.avgLatency, searchTime);
+    EXPECT_NEAR(result.makespan, 20.0 * searchTime, 1e-9);
+
+    delete index;
+}
+
+GTEST_TEST(simulationWorkloadTest, columnIndex)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    DSM* dsm = new DSM(disk, std::vector<size_t>{8, 8, 16, 32});
+    DBIndexColumn* index = dsm;
+
+    index->insertEntries(10000);
+
+    std::vector<WorkloadStep*> steps;
+    for (size_t i = 0; i < 5; ++i)
+        steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(1), std::vector<size_t>{0, 1}));
+
+    SimulationWorkload sim(index, steps, 2);
+    const SimulationWorkload::SimulationResult result = sim.run();
+
+    EXPECT_EQ(result.numOperations, 10);
+    EXPECT_GT(result.makespan, 0.0);
+
+    delete index;
+}
+
+GTEST_TEST(simulationWorkloadTest, noIndex)
+{
+    SimulationWorkload sim(static_cast<DBIndex*>(nullptr), createSearchSteps(1), 1);
+    const SimulationWorkload::SimulationResult result = sim.run();
+
+    EXPECT_EQ(result.numOperations, 0);
+    EXPECT_DOUBLE_EQ(result.makespan, 0.0);
+
+    EXPECT_EQ(sim.getLastResult().numClients, 1);
+    EXPECT_EQ(sim.getLastResult().numOperations, 0);
+}
+
+GTEST_TEST(simulationWorkloadTest, indexBackgroundCompaction)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t recordSize = keySize + dataSize;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize() * 10;
+    const size_t headTreeSize = nodeSize;
+    const size_t lvlRatio = 5;
+    const size_t numSteps = (headTreeSize / recordSize) * 10;
+
+    LSMTree* lsm = new LSMTree(disk, keySize, dataSize, nodeSize, headTreeSize, lvlRatio);
+    lsm->setBackgroundCompaction(1, 4);
+    DBIndex* index = lsm;
+
+    std::vector<WorkloadStep*> steps;
+    for (size_t i = 0; i < numSteps; ++i)
+        steps.push_back(new WorkloadStepInsert(static_cast<size_t>(1)));
+
+    // no user source, compactions are taken from index
+    SimulationWorkload sim(index, steps, 1, 1);
+    const SimulationWorkload::SimulationResult result = sim.run();
+
+    EXPECT_EQ(result.numOperations, numSteps);
+    EXPECT_GT(result.numBackgroundJobs, 0);
+    EXPECT_GT(result.backgroundTime, 0.0);
+    EXPECT_NEAR(result.backgroundTime, index->getCounter(IndexCounters::INDEX_COUNTER_RW_BACKGROUND_TOTAL_TIME).second, 1e-9);
+    EXPECT_GE(result.makespan, result.backgroundTime);
+
+    delete index;
+}
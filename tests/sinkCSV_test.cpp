@@ -0,0 +1,93 @@
+#include <workload/sink/sinkCSV.hpp>
+#include <workload/workload.hpp>
+#include <workload/workloadStep.hpp>
+#include <workload/workloadStepInsert.hpp>
+#include <workload/workloadStepBulkload.hpp>
+#include <workload/workloadStepDelete.hpp>
+#include <workload/workloadStepPSearch.hpp>
+#include <workload/workloadStepRSearch.hpp>
+#include <disk/diskSSD.hpp>
+#include <index/phantomIndex.hpp>
+#include <index/bptree.hpp>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <iostream>
+#include <cstdio>
+#include <filesystem>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(sinkCSVTest, interface)
+{
+    const std::string filePath = (std::filesystem::temp_directory_path() / "sinkCSVTest_interface.csv").string();
+
+    WorkloadSinkCSV sink(filePath.c_str());
+
+    EXPECT_EQ(sink.getFilePath(), filePath);
+    EXPECT_EQ(sink.getNumRows(), 0);
+
+    std::remove(filePath.c_str());
+}
+
+GTEST_TEST(sinkCSVTest, streamWorkload)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    Disk* disk2 = new DiskSSD_Samsung840();
+
+    DBIndex* index = new BPTree(disk, 8, 64, 1 << 14, true);
+    DBIndex* index2 = new PhantomIndex(disk2, true);
+
+    std::vector<WorkloadStep*> steps;
+    steps.push_back(new WorkloadStepInsert(100));
+    steps.push_back(new WorkloadStepBulkload(200));
+    steps.push_back(new WorkloadStepDelete(200));
+    steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(100)));
+    steps.push_back(new WorkloadStepRSearch(static_cast<size_t>(10), 100));
+
+    Workload w(std::vector<DBIndex*>{index, index2}, steps);
+
+    const std::string filePath = (std::filesystem::temp_directory_path() / "sinkCSVTest_streamWorkload.csv").string();
+
+    WorkloadSinkCSV sink(filePath.c_str(), ';');
+    w.addSink(&sink);
+    w.run();
+
+    EXPECT_EQ(sink.getNumRows(), w.getNumIndexes() * w.getNumSteps());
+
+    std::ifstream file(filePath);
+    std::string line;
+
+    const WorkloadCounters counters;
+    ASSERT_TRUE(static_cast<bool>(std::getline(file, line)));
+    EXPECT_EQ(line.find("Index;Step;" + counters.getCounterName(WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_TIME)), 0);
+
+    const size_t timeColumn = 2 + WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME;
+    const size_t numColumns = 2 + WorkloadCounters::WORKLOAD_COUNTER_D_MAX_ITERATOR + WorkloadCounters::WORKLOAD_COUNTER_L_MAX_ITERATOR;
+    const std::vector<std::string> indexesName = {std::string(index->getName()), std::string(index2->getName())};
+
+    for (size_t i = 0; i < w.getNumIndexes(); ++i)
+        for (size_t j = 0; j < w.getNumSteps(); ++j)
+        {
+            ASSERT_TRUE(static_cast<bool>(std::getline(file, line)));
+
+            std::vector<std::string> values;
+            std::istringstream lineStream(line);
+            std::string value;
+            while (std::getline(lineStream, value, ';'))
+                values.push_back(value);
+
+            ASSERT_EQ(values.size(), numColumns);
+            EXPECT_EQ(values[0], indexesName[i]);
+            EXPECT_EQ(std::stoul(values[1]), j + 1);
+            EXPECT_DOUBLE_EQ(std::stod(values[timeColumn]), w.getStepCounters(i, j).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME));
+        }
+
+    EXPECT_FALSE(static_cast<bool>(std::getline(file, line)));
+
+    file.close();
+    std::remove(filePath.c_str());
+
+    delete index;
+    delete index2;
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+#include <workload/sink/sinkColumnar.hpp>
+#include <workload/workload.hpp>
+#include <workload/workloadStep.hpp>
+#include <workload/workloadStepInsert.hpp>
+#include <workload/workloadStepBulkload.hpp>
+#include <workload/workloadStepDelete.hpp>
+#include <workload/workloadStepPSearch.hpp>
+#include <workload/workloadStepRSearch.hpp>
+#include <disk/diskSSD.hpp>
+#include <index/phantomIndex.hpp>
+#include <index/bptree.hpp>
+#include <string>
+#include <iostream>
+#include <cstdio>
+#include <filesystem>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(sinkColumnarTest, interface)
+{
+    const std::string filePath = (std::filesystem::temp_directory_path() / "sinkColumnarTest_interface.bin").string();
+
+    WorkloadSinkColumnar sink(filePath.c_str(), 16);
+
+    EXPECT_EQ(sink.getFilePath(), filePath);
+    EXPECT_EQ(sink.getRowGroupSize(), 16);
+    EXPECT_EQ(sink.getNumRows(), 0);
+
+    WorkloadSinkColumnar sink2(filePath.c_str(), 0);
+    EXPECT_EQ(sink2.getRowGroupSize(), 1);
+
+    std::remove(filePath.c_str());
+}
+
+GTEST_TEST(sinkColumnarTest, streamWorkload)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    Disk* disk2 = new DiskSSD_Samsung840();
+
+    DBIndex* index = new BPTree(disk, 8, 64, 1 << 14, true);
+    DBIndex* index2 = new PhantomIndex(disk2, true);
+
+    std::vector<WorkloadStep*> steps;
+    steps.push_back(new WorkloadStepInsert(100));
+    steps.push_back(new WorkloadStepBulkload(200));
+    steps.push_back(new WorkloadStepDelete(200));
+    steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(100)));
+    steps.push_back(new WorkloadStepRSearch(static_cast<size_t>(10), 100));
+
+    Workload w(std::vector<DBIndex*>{index, index2}, steps);
+
+    const std::string filePath = (std::filesystem::temp_directory_path() / "sinkColumnarTest_streamWorkload.bin").string();
+
+    // row group smaller than workload, so file has a few row groups
+    WorkloadSinkColumnar sink(filePath.c_str(), 3);
+    w.addSink(&sink);
+    w.run();
+
+    EXPECT_EQ(sink.getNumRows(), w.getNumIndexes() * w.getNumSteps());
+
+    const std::vector<std::string> indexesName = WorkloadSinkColumnar::readIndexesName(filePath.c_str());
+    ASSERT_EQ(indexesName.size(), 2);
+    EXPECT_EQ(indexesName[0], std::string(index->getName()));
+    EXPECT_EQ(indexesName[1], std::string(index2->getName()));
+
+    const WorkloadCounters counters;
+    const std::vector<std::string> columnsName = WorkloadSinkColumnar::readColumnsName(filePath.c_str());
+    ASSERT_EQ(columnsName.size(), 2 + WorkloadCounters::WORKLOAD_COUNTER_D_MAX_ITERATOR + WorkloadCounters::WORKLOAD_COUNTER_L_MAX_ITERATOR);
+    EXPECT_EQ(columnsName[0], std::string("Index"));
+    EXPECT_EQ(columnsName[1], std::string("Step"));
+    EXPECT_EQ(columnsName[2], counters.getCounterName(WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_TIME));
+
+    const std::vector<double> indexColumn = WorkloadSinkColumnar::readColumn(filePath.c_str(), "Index");
+    const std::vector<double> stepColumn = WorkloadSinkColumnar::readColumn(filePath.c_str(), "Step");
+    const std::vector<double> timeColumn = WorkloadSinkColumnar::readColumn(filePath.c_str(), counters.getCounterName(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME));
+    const std::vector<double> opsColumn = WorkloadSinkColumnar::readColumn(filePath.c_str(), counters.getCounterName(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_OPERATIONS));
+
+    ASSERT_EQ(indexColumn.size(), sink.getNumRows());
+    ASSERT_EQ(stepColumn.size(), sink.getNumRows());
+    ASSERT_EQ(timeColumn.size(), sink.getNumRows());
+    ASSERT_EQ(opsColumn.size(), sink.getNumRows());
+
+    for (size_t i = 0; i < w.getNumIndexes(); ++i)
+        for (size_t j = 0; j < w.getNumSteps(); ++j)
+        {
+            const size_t row = i * w.getNumSteps() + j;
+            EXPECT_DOUBLE_EQ(indexColumn[row], static_cast<double>(i));
+            EXPECT_DOUBLE_EQ(stepColumn[row], static_cast<double>(j + 1));
+            EXPECT_DOUBLE_EQ(timeColumn[row], w.getStepCounters(i, j).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME));
+            EXPECT_DOUBLE_EQ(opsColumn[row], static_cast<double>(w.getStepCounters(i, j).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_OPERATIONS)));
+        }
+
+    // unknown column and wrong file give nothing
+    EXPECT_EQ(WorkloadSinkColumnar::readColumn(filePath.c_str(), "NotAColumn").size(), 0);
+    EXPECT_EQ(WorkloadSinkColumnar::readColumn((std::filesystem::temp_directory_path() / "sinkColumnarTest_notExisting.bin").string().c_str(), "Index").size(), 0);
+
+    std::remove(filePath.c_str());
+
+    delete index;
+    delete index2;
+}
+
+GTEST_TEST(sinkColumnarTest, truncatedFile)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    DBIndex* index = new PhantomIndex(disk, true);
+
+    std::vector<WorkloadStep*> steps;
+    for (size_t i = 0; i < 10; ++i)
+        steps.push_back(new WorkloadStepInsert(100));
+
+    Workload w(std::vector<DBIndex*>{index}, steps);
+
+    const std::string filePath = (std::filesystem::temp_directory_path() / "sinkColumnarTest_truncatedFile.bin").string();
+    const std::string truncatedPath = (std::filesystem::temp_directory_path() / "sinkColumnarTest_truncatedFile_cut.bin").string();
+
+    WorkloadSinkColumnar sink(filePath.c_str(), 4);
+    w.addSink(&sink);
+    w.run();
+
+    ASSERT_EQ(WorkloadSinkColumnar::readColumn(filePath.c_str(), "Step").size(), 10);
+
+    const uintmax_t fileSize = std::filesystem::file_size(filePath);
+    const WorkloadCounters counters;
+    const std::string lastColumn = counters.getCounterName(WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS);
+    const uintmax_t footerSize = 4 + 8;
+    const uintmax_t lastRowGroupSize = 4 + 2 * 8 * (2 + WorkloadCounters::WORKLOAD_COUNTER_D_MAX_ITERATOR + WorkloadCounters::WORKLOAD_COUNTER_L_MAX_ITERATOR);
+
+    // cut footer, cut inside last row group (4 + 4 + 2 rows) and cut at row group boundary
+    for (const uintmax_t cut : {static_cast<uintmax_t>(1), footerSize + 4, footerSize + lastRowGroupSize})
+    {
+        std::filesystem::copy_file(filePath, truncatedPath, std::filesystem::copy_options::overwrite_existing);
+        std::filesystem::resize_file(truncatedPath, fileSize - cut);
+
+        EXPECT_EQ(WorkloadSinkColumnar::readColumn(truncatedPath.c_str(), "Step").size(), 0);
+        EXPECT_EQ(WorkloadSinkColumnar::readColumn(truncatedPath.c_str(), lastColumn).size(), 0);
+    }
+
+    std::remove(filePath.c_str());
+    std::remove(truncatedPath.c_str());
+
+    delete index;
+}
@@ -0,0 +1,140 @@
+#include <disk/staticDisk.hpp>
+#include <disk/diskSSD.hpp>
+#include <index/bptree.hpp>
+#include <string>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+static void staticDiskTestCompareCounters(const Disk& d1, const Disk& d2)
+{
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_TIME; id < MemoryCounters::MEMORY_COUNTER_D_MAX_ITERATOR; ++id)
+    {
+        EXPECT_DOUBLE_EQ(d1.getDiskCounter(id).second, d2.getDiskCounter(id).second);
+        EXPECT_DOUBLE_EQ(d1.getLowLevelController().getCounter(id).second, d2.getLowLevelController().getCounter(id).second);
+    }
+
+    for (auto id = MemoryCounters::MEMORY_COUNTER_RW_WRITE_TOTAL_BYTES; id < MemoryCounters::MEMORY_COUNTER_L_MAX_ITERATOR; ++id)
+    {
+        EXPECT_EQ(d1.getDiskCounter(id).second, d2.getDiskCounter(id).second);
+        EXPECT_EQ(d1.getLowLevelController().getCounter(id).second, d2.getLowLevelController().getCounter(id).second);
+    }
+
+    EXPECT_EQ(d1.getLowLevelController().getMemoryWearOut(), d2.getLowLevelController().getMemoryWearOut());
+}
+
+GTEST_TEST(staticDiskTest, interface)
+{
+    StaticDiskSSD_Samsung840 disk;
+
+    EXPECT_EQ(std::string(disk.getModel().getModelName()), std::string(MemoryModelSSD_Samsung840().getModelName()));
+    EXPECT_EQ(disk.getModel().getPageSize(), disk.getLowLevelController().getPageSize());
+    EXPECT_EQ(&disk.getController(), &disk.getLowLevelController());
+    EXPECT_EQ(&disk.getModel(), &disk.getLowLevelController().getMemoryModel());
+
+    Disk* disk2 = new StaticDiskSSD_IntelDCP4511();
+    delete disk2;
+
+    disk2 = new StaticDiskSSD_ToshibaVX500();
+    delete disk2;
+}
+
+GTEST_TEST(staticDiskTest, sameAsVirtualDisk)
+{
+    StaticDiskSSD_Samsung840 staticDisk;
+    DiskSSD_Samsung840 disk;
+    Disk& virtualStaticDisk = staticDisk;
+
+    const size_t pageSize = disk.getLowLevelController().getPageSize();
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        const uintptr_t addr = (i * 7919) % 1000 * pageSize + i;
+
+        // fast path and virtual path on the same object
+        if (i % 2 == 0)
+        {
+            EXPECT_DOUBLE_EQ(staticDisk.readBytes(addr, 100 + i), disk.readBytes(addr, 100 + i));
+            EXPECT_DOUBLE_EQ(staticDisk.writeBytes(addr, pageSize * (i % 5 + 1)), disk.writeBytes(addr, pageSize * (i % 5 + 1)));
+            EXPECT_DOUBLE_EQ(staticDisk.overwriteBytes(addr, 10 + i, 0.25), disk.overwriteBytes(addr, 10 + i, 0.25));
+        }
+        else
+        {
+            EXPECT_DOUBLE_EQ(virtualStaticDisk.readBytes(addr, 100 + i), disk.readBytes(addr, 100 + i));
+            EXPECT_DOUBLE_EQ(virtualStaticDisk.writeBytes(addr, pageSize * (i % 5 + 1)), disk.writeBytes(addr, pageSize * (i % 5 + 1)));
+            EXPECT_DOUBLE_EQ(virtualStaticDisk.overwriteBytes(addr, 10 + i), disk.overwriteBytes(addr, 10 + i));
+        }
+
+        if (i % 10 == 9)
+        {
+            EXPECT_DOUBLE_EQ(staticDisk.flushCache(), disk.flushCache());
+        }
+    }
+
+    staticDiskTestCompareCounters(staticDisk, disk);
+}
+
+GTEST_TEST(staticDiskTest, index)
+{
+    BPTree* staticIndex = new BPTree(new StaticDiskSSD_Samsung840(), 8, 64, 1 << 14, true);
+    BPTree* index = new BPTree(new DiskSSD_Samsung840(), 8, 64, 1 << 14, true);
+
+    EXPECT_DOUBLE_EQ(staticIndex->insertEntries(1000), index->insertEntries(1000));
+    EXPECT_DOUBLE_EQ(staticIndex->findPointEntries(static_cast<size_t>(100)), index->findPointEntries(static_cast<size_t>(100)));
+    EXPECT_DOUBLE_EQ(staticIndex->findRangeEntries(0.1, 10), index->findRangeEntries(0.1, 10));
+    EXPECT_DOUBLE_EQ(staticIndex->deleteEntries(100), index->deleteEntries(100));
+
+    staticDiskTestCompareCounters(staticIndex->getDisk(), index->getDisk());
+
+    delete staticIndex;
+    delete index;
+}
+
+GTEST_TEST(staticDiskTest, copy)
+{
+    StaticDiskSSD_Samsung840 disk;
+    const double readTime = 21.0 / 1000000.0;
+
+    EXPECT_DOUBLE_EQ(disk.readBytes(0, 100), readTime);
+    EXPECT_DOUBLE_EQ(disk.readBytes(10000, 100), readTime);
+
+    Disk* clone = disk.clone();
+    EXPECT_NE(dynamic_cast<StaticDiskSSD_Samsung840*>(clone), nullptr);
+    staticDiskTestCompareCounters(*clone, disk);
+
+    StaticDiskSSD_Samsung840 copy(disk);
+    staticDiskTestCompareCounters(copy, disk);
+    EXPECT_NE(&copy.getController(), &disk.getController());
+    EXPECT_EQ(&copy.getController(), &copy.getLowLevelController());
+
+    StaticDiskSSD_Samsung840 copy2;
+    copy2 = copy;
+    staticDiskTestCompareCounters(copy2, disk);
+    EXPECT_EQ(&copy2.getController(), &copy2.getLowLevelController());
+
+    // copies are independent
+    EXPECT_DOUBLE_EQ(copy2.readBytes(20000, 100), readTime);
+    EXPECT_EQ(copy2.getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 3);
+    EXPECT_EQ(disk.getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 2);
+
+    delete clone;
+}
+
+GTEST_TEST(staticDiskTest, move)
+{
+    StaticDiskSSD_Samsung840 disk;
+    const double readTime = 21.0 / 1000000.0;
+
+    EXPECT_DOUBLE_EQ(disk.readBytes(0, 100), readTime);
+    EXPECT_DOUBLE_EQ(disk.readBytes(10000, 100), readTime);
+
+    StaticDiskSSD_Samsung840 moved(std::move(disk));
+    EXPECT_EQ(moved.getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 2);
+    EXPECT_EQ(&moved.getController(), &moved.getLowLevelController());
+
+    StaticDiskSSD_Samsung840 moved2;
+    moved2 = std::move(moved);
+    EXPECT_EQ(moved2.getDiskCounter(MemoryCounters::MEMORY_COUNTER_RW_READ_TOTAL_OPERATIONS).second, 2);
+    EXPECT_EQ(&moved2.getController(), &moved2.getLowLevelController());
+    EXPECT_DOUBLE_EQ(moved2.readBytes(20000, 100), readTime);
+}
\ No newline at end of file
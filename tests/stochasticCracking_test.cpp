@@ -0,0 +1,301 @@
+#include <adaptiveMerging/stochasticCracking.hpp>
+#include <disk/diskSSD.hpp>
+#include <disk/diskPCM.hpp>
+#include <string>
+#include <numeric>
+#include <iostream>
+#include <index/bptree.hpp>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(stochasticCracking, interfaceSSD)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t recordSize = keySize + dataSize;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize();
+    const size_t minPieceSize = disk->getLowLevelController().getBlockSize();
+    const size_t startingEntries = 1000000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* cracking = new StochasticCracking(index, startingEntries, minPieceSize);
+
+    // check how to get some statistics
+    EXPECT_EQ(std::string(cracking->getName()), std::string("StochasticCracking"));
+    EXPECT_EQ(cracking->getDisk().getLowLevelController().getMemoryWearOut(), 0);
+
+    for (auto id = IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME; id < IndexCounters::INDEX_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_DOUBLE_EQ(cracking->getCounter(id).second, 0.0);
+
+    for (auto id = IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < IndexCounters::INDEX_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(cracking->getCounter(id).second, 0L);
+
+    EXPECT_EQ(cracking->getNumEntries(), startingEntries);
+    EXPECT_EQ(cracking->getKeySize(), keySize);
+    EXPECT_EQ(cracking->getDataSize(), dataSize);
+    EXPECT_EQ(cracking->getRecordSize(), recordSize);
+    EXPECT_EQ(cracking->isBulkloadSupported(), false);
+
+    const StochasticCracking::CrackerColumnManager& manager = dynamic_cast<const StochasticCracking::CrackerColumnManager&>(dynamic_cast<StochasticCracking*>(cracking)->getMemoryManager());
+    EXPECT_EQ(manager.getNumEntries(), startingEntries);
+    EXPECT_EQ(manager.getPiecesRef().size(), 1);
+    EXPECT_EQ(manager.getNumCracks(), 0);
+    EXPECT_EQ(dynamic_cast<StochasticCracking*>(cracking)->getCrackerIndexSize(), 0);
+
+    DBIndex* copy = cracking->clone();
+    EXPECT_EQ(std::string(copy->getName()), std::string("StochasticCracking"));
+    EXPECT_EQ(copy->getNumEntries(), startingEntries);
+
+    delete copy;
+    delete cracking;
+}
+
+GTEST_TEST(stochasticCracking, singleFindRangeSSD)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize();
+    const size_t minPieceSize = disk->getLowLevelController().getBlockSize();
+    const size_t startingEntries = 1000000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* cracking = new StochasticCracking(index, startingEntries, minPieceSize);
+
+    EXPECT_GT(cracking->findRangeEntries(static_cast<size_t>(1)), 0.0);
+
+    // cracking is in place, nothing is inserted into index
+    EXPECT_DOUBLE_EQ(cracking->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, 0.0);
+    EXPECT_EQ(cracking->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS).second, 0);
+
+    EXPECT_GT(cracking->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_TOTAL_TIME).second, 0.0);
+    EXPECT_EQ(cracking->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_TOTAL_OPERATIONS).second, 1);
+
+    const StochasticCracking::CrackerColumnManager& manager = dynamic_cast<const StochasticCracking::CrackerColumnManager&>(dynamic_cast<StochasticCracking*>(cracking)->getMemoryManager());
+    EXPECT_GE(manager.getNumCracks(), 2);
+    EXPECT_LE(manager.getNumCracks(), 4);
+    EXPECT_EQ(dynamic_cast<StochasticCracking*>(cracking)->getCrackerIndexSize(), manager.getNumCracks() * (keySize + sizeof(uintptr_t)));
+
+    EXPECT_EQ(cracking->getNumEntries(), startingEntries);
+    EXPECT_EQ(manager.getNumEntries() + index->getNumEntries(), startingEntries);
+    EXPECT_EQ(std::accumulate(manager.getPiecesRef().begin(), manager.getPiecesRef().end(), static_cast<size_t>(0)), manager.getNumEntries());
+
+    delete cracking;
+}
+
+GTEST_TEST(stochasticCracking, fullFindRangeSSD)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize();
+    const size_t minPieceSize = disk->getLowLevelController().getBlockSize();
+    const size_t startingEntries = 100000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* cracking = new StochasticCracking(index, startingEntries, minPieceSize);
+
+    const StochasticCracking::CrackerColumnManager* manager = dynamic_cast<const StochasticCracking::CrackerColumnManager*>(&dynamic_cast<StochasticCracking*>(cracking)->getMemoryManager());
+
+    size_t lastCracks = 0;
+    while (manager->getNumEntries() > 0)
+    {
+        EXPECT_GT(cracking->findRangeEntries(0.01), 0.0);
+
+        EXPECT_EQ(cracking->getNumEntries(), startingEntries);
+        EXPECT_EQ(manager->getNumEntries() + index->getNumEntries(), startingEntries);
+        EXPECT_EQ(std::accumulate(manager->getPiecesRef().begin(), manager->getPiecesRef().end(), static_cast<size_t>(0)), manager->getNumEntries());
+
+        // cracker index never shrinks
+        EXPECT_GE(manager->getNumCracks(), lastCracks);
+        lastCracks = manager->getNumCracks();
+    }
+
+    EXPECT_EQ(index->getNumEntries(), startingEntries);
+    EXPECT_EQ(manager->getPiecesRef().size(), 0);
+    EXPECT_GT(dynamic_cast<StochasticCracking*>(cracking)->getCrackerIndexSize(), 0);
+
+    EXPECT_NE(cracking->getCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_TIME).second, 0.0);
+    EXPECT_NE(cracking->getCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_OPERATIONS).second, 0);
+
+    delete cracking;
+}
+
+GTEST_TEST(stochasticCracking, singleDeleteSSD)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize();
+    const size_t minPieceSize = disk->getLowLevelController().getBlockSize();
+    const size_t startingEntries = 1000000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* cracking = new StochasticCracking(index, startingEntries, minPieceSize);
+
+    EXPECT_GT(cracking->deleteEntries(), 0.0);
+
+    EXPECT_EQ(cracking->getNumEntries(), startingEntries - 1);
+    EXPECT_EQ(dynamic_cast<StochasticCracking*>(cracking)->getMemoryManager().getNumEntries(), startingEntries - 1);
+    EXPECT_EQ(index->getNumEntries(), 0);
+
+    EXPECT_GT(cracking->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_INVALIDATION_TOTAL_TIME).second, 0.0);
+    EXPECT_EQ(cracking->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_INVALIDATION_TOTAL_OPERATIONS).second, 1);
+
+    cracking->resetState();
+    EXPECT_EQ(dynamic_cast<StochasticCracking*>(cracking)->getMemoryManager().getNumEntries(), startingEntries);
+    EXPECT_EQ(dynamic_cast<const StochasticCracking::CrackerColumnManager&>(dynamic_cast<StochasticCracking*>(cracking)->getMemoryManager()).getPiecesRef().size(), 1);
+
+    delete cracking;
+}
+
+GTEST_TEST(stochasticCracking, interfacePCM)
+{
+    Disk* disk = new DiskPCM_DefaultModel();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t recordSize = keySize + dataSize;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize() * 10;
+    const size_t minPieceSize = disk->getLowLevelController().getPageSize() * 10 * 100;
+    const size_t startingEntries = 1000000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* cracking = new StochasticCracking(index, startingEntries, minPieceSize);
+
+    // check how to get some statistics
+    EXPECT_EQ(std::string(cracking->getName()), std::string("StochasticCracking"));
+    EXPECT_EQ(cracking->getDisk().getLowLevelController().getMemoryWearOut(), 0);
+
+    for (auto id = IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME; id < IndexCounters::INDEX_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_DOUBLE_EQ(cracking->getCounter(id).second, 0.0);
+
+    for (auto id = IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < IndexCounters::INDEX_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(cracking->getCounter(id).second, 0L);
+
+    EXPECT_EQ(cracking->getNumEntries(), startingEntries);
+    EXPECT_EQ(cracking->getKeySize(), keySize);
+    EXPECT_EQ(cracking->getDataSize(), dataSize);
+    EXPECT_EQ(cracking->getRecordSize(), recordSize);
+    EXPECT_EQ(cracking->isBulkloadSupported(), false);
+
+    const StochasticCracking::CrackerColumnManager& manager = dynamic_cast<const StochasticCracking::CrackerColumnManager&>(dynamic_cast<StochasticCracking*>(cracking)->getMemoryManager());
+    EXPECT_EQ(manager.getNumEntries(), startingEntries);
+    EXPECT_EQ(manager.getPiecesRef().size(), 1);
+    EXPECT_EQ(manager.getNumCracks(), 0);
+    EXPECT_EQ(dynamic_cast<StochasticCracking*>(cracking)->getCrackerIndexSize(), 0);
+
+    DBIndex* copy = cracking->clone();
+    EXPECT_EQ(std::string(copy->getName()), std::string("StochasticCracking"));
+    EXPECT_EQ(copy->getNumEntries(), startingEntries);
+
+    delete copy;
+    delete cracking;
+}
+
+GTEST_TEST(stochasticCracking, singleFindRangePCM)
+{
+    Disk* disk = new DiskPCM_DefaultModel();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize() * 10;
+    const size_t minPieceSize = disk->getLowLevelController().getPageSize() * 10 * 100;
+    const size_t startingEntries = 100000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* cracking = new StochasticCracking(index, startingEntries, minPieceSize);
+
+    EXPECT_GT(cracking->findRangeEntries(static_cast<size_t>(1)), 0.0);
+
+    // cracking is in place, nothing is inserted into index
+    EXPECT_DOUBLE_EQ(cracking->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_TIME).second, 0.0);
+    EXPECT_EQ(cracking->getCounter(IndexCounters::INDEX_COUNTER_RW_INSERT_TOTAL_OPERATIONS).second, 0);
+
+    EXPECT_GT(cracking->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_TOTAL_TIME).second, 0.0);
+    EXPECT_EQ(cracking->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_LOADING_TOTAL_OPERATIONS).second, 1);
+
+    const StochasticCracking::CrackerColumnManager& manager = dynamic_cast<const StochasticCracking::CrackerColumnManager&>(dynamic_cast<StochasticCracking*>(cracking)->getMemoryManager());
+    EXPECT_GE(manager.getNumCracks(), 2);
+    EXPECT_LE(manager.getNumCracks(), 4);
+    EXPECT_EQ(dynamic_cast<StochasticCracking*>(cracking)->getCrackerIndexSize(), manager.getNumCracks() * (keySize + sizeof(uintptr_t)));
+
+    EXPECT_EQ(cracking->getNumEntries(), startingEntries);
+    EXPECT_EQ(manager.getNumEntries() + index->getNumEntries(), startingEntries);
+    EXPECT_EQ(std::accumulate(manager.getPiecesRef().begin(), manager.getPiecesRef().end(), static_cast<size_t>(0)), manager.getNumEntries());
+
+    delete cracking;
+}
+
+GTEST_TEST(stochasticCracking, fullFindRangePCM)
+{
+    Disk* disk = new DiskPCM_DefaultModel();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize() * 10;
+    const size_t minPieceSize = disk->getLowLevelController().getPageSize() * 10 * 100;
+    const size_t startingEntries = 100000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* cracking = new StochasticCracking(index, startingEntries, minPieceSize);
+
+    const StochasticCracking::CrackerColumnManager* manager = dynamic_cast<const StochasticCracking::CrackerColumnManager*>(&dynamic_cast<StochasticCracking*>(cracking)->getMemoryManager());
+
+    size_t lastCracks = 0;
+    while (manager->getNumEntries() > 0)
+    {
+        EXPECT_GT(cracking->findRangeEntries(0.01), 0.0);
+
+        EXPECT_EQ(cracking->getNumEntries(), startingEntries);
+        EXPECT_EQ(manager->getNumEntries() + index->getNumEntries(), startingEntries);
+        EXPECT_EQ(std::accumulate(manager->getPiecesRef().begin(), manager->getPiecesRef().end(), static_cast<size_t>(0)), manager->getNumEntries());
+
+        // cracker index never shrinks
+        EXPECT_GE(manager->getNumCracks(), lastCracks);
+        lastCracks = manager->getNumCracks();
+    }
+
+    EXPECT_EQ(index->getNumEntries(), startingEntries);
+    EXPECT_EQ(manager->getPiecesRef().size(), 0);
+    EXPECT_GT(dynamic_cast<StochasticCracking*>(cracking)->getCrackerIndexSize(), 0);
+
+    EXPECT_NE(cracking->getCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_TIME).second, 0.0);
+    EXPECT_NE(cracking->getCounter(IndexCounters::INDEX_COUNTER_RW_RSEARCH_TOTAL_OPERATIONS).second, 0);
+
+    delete cracking;
+}
+
+GTEST_TEST(stochasticCracking, singleDeletePCM)
+{
+    Disk* disk = new DiskPCM_DefaultModel();
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t nodeSize = disk->getLowLevelController().getPageSize() * 10;
+    const size_t minPieceSize = disk->getLowLevelController().getPageSize() * 10 * 100;
+    const size_t startingEntries = 100000;
+
+    DBIndex* index = new BPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* cracking = new StochasticCracking(index, startingEntries, minPieceSize);
+
+    EXPECT_GT(cracking->deleteEntries(), 0.0);
+
+    EXPECT_EQ(cracking->getNumEntries(), startingEntries - 1);
+    EXPECT_EQ(dynamic_cast<StochasticCracking*>(cracking)->getMemoryManager().getNumEntries(), startingEntries - 1);
+    EXPECT_EQ(index->getNumEntries(), 0);
+
+    EXPECT_GT(cracking->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_INVALIDATION_TOTAL_TIME).second, 0.0);
+    EXPECT_EQ(cracking->getCounter(IndexCounters::INDEX_AM_COUNTER_RO_INVALIDATION_TOTAL_OPERATIONS).second, 1);
+
+    cracking->resetState();
+    EXPECT_EQ(dynamic_cast<StochasticCracking*>(cracking)->getMemoryManager().getNumEntries(), startingEntries);
+    EXPECT_EQ(dynamic_cast<const StochasticCracking::CrackerColumnManager&>(dynamic_cast<StochasticCracking*>(cracking)->getMemoryManager()).getPiecesRef().size(), 1);
+
+    delete cracking;
+}
@@ -1062,6 +1062,37 @@ GTEST_TEST(ubptreeBasicPCMTest, insertIntoRoot)
     delete index;
 }
 
+GTEST_TEST(ubptreeBasicPCMTest, differentialWrite)
+{
+    DiskPCM* disk = new DiskPCM_DefaultModel();
+    disk->setDifferentialWrite(MemoryModelPCM::DIFFERENTIAL_WRITE_DCW);
+
+    const size_t keySize = 8;
+    const size_t dataSize = 64;
+    const size_t recordSize = keySize + dataSize;
+    const size_t lineSize = disk->getLowLevelController().getPageSize();
+    const size_t nodeSize = lineSize * 8;
+    const size_t numOperations = nodeSize / recordSize - 1;
+    const double readTime = 50.0 / 1000000000.0;
+    const double writeTime = 1.0 / 1000000;
+
+    UBPTree* ubp = new UBPTree(disk, keySize, dataSize, nodeSize);
+    DBIndex* index = ubp;
+
+    // record goes into a gap of record with similar key (half of key bits are the same) and 1 bit of bitmap is set,
+    // so only small part of 3 lines is programmed
+    const double bitChangeRatio = (static_cast<double>(keySize) * 0.25 + static_cast<double>(dataSize) * 0.5 + 1.0 / 8.0) / static_cast<double>(3 * lineSize);
+    for (size_t i = 0; i < numOperations; ++i)
+    {
+        const double expectedTime = 2.0 * readTime + 3.0 * readTime + 3.0 * writeTime * bitChangeRatio;
+        EXPECT_DOUBLE_EQ(index->insertEntries(), expectedTime);
+
+        EXPECT_DOUBLE_EQ(disk->getPCMModel().getOverwriteBitChangeRatio(), bitChangeRatio);
+    }
+
+    delete index;
+}
+
 GTEST_TEST(ubptreeBasicPCMTest, insertIntoInner)
 {
     Disk* disk = new DiskPCM_DefaultModel();
@@ -0,0 +1,172 @@
+#include <observability/wearTracker.hpp>
+#include <string>
+#include <iostream>
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+GTEST_TEST(wearTrackerBasicTest, interface)
+{
+    WearTracker disabled;
+
+    EXPECT_FALSE(disabled.isEnabled());
+    EXPECT_EQ(disabled.getTrackedUnits(), 0);
+
+    disabled.wearNextUnits(10);
+    disabled.wearWrittenUnits(10);
+    EXPECT_EQ(disabled.getMaxWear(), 0);
+    EXPECT_DOUBLE_EQ(disabled.getGiniWear(), 0.0);
+    EXPECT_TRUE(std::isinf(disabled.estimateLifetime(100, 1.0)));
+
+    WearTracker tracker(100);
+
+    EXPECT_TRUE(tracker.isEnabled());
+    EXPECT_EQ(tracker.getNumUnits(), 100);
+    EXPECT_EQ(tracker.getSampleRate(), 1);
+    EXPECT_EQ(tracker.getTrackedUnits(), 100);
+    EXPECT_EQ(tracker.getWrittenUnits(), 0);
+    EXPECT_EQ(tracker.getMinWear(), 0);
+    EXPECT_EQ(tracker.getMaxWear(), 0);
+}
+
+GTEST_TEST(wearTrackerBasicTest, circularLog)
+{
+    WearTracker tracker(10);
+
+    tracker.wearNextUnits(4);
+    EXPECT_EQ(tracker.getWrittenUnits(), 4);
+    EXPECT_EQ(tracker.getUnitWear(0), 1);
+    EXPECT_EQ(tracker.getUnitWear(3), 1);
+    EXPECT_EQ(tracker.getUnitWear(4), 0);
+
+    // log wraps around
+    tracker.wearNextUnits(8);
+    EXPECT_EQ(tracker.getWrittenUnits(), 10);
+    EXPECT_EQ(tracker.getUnitWear(0), 2);
+    EXPECT_EQ(tracker.getUnitWear(1), 2);
+    EXPECT_EQ(tracker.getUnitWear(2), 1);
+    EXPECT_EQ(tracker.getUnitWear(9), 1);
+
+    // more than whole device
+    tracker.wearNextUnits(25);
+    EXPECT_EQ(tracker.getMinWear(), 3);
+    EXPECT_EQ(tracker.getMaxWear(), 4);
+
+    // writes without wear move log only
+    WearTracker flash(10);
+    flash.writeUnits(5);
+    EXPECT_EQ(flash.getWrittenUnits(), 5);
+    EXPECT_EQ(flash.getMaxWear(), 0);
+}
+
+GTEST_TEST(wearTrackerBasicTest, writtenUnits)
+{
+    WearTracker tracker(100);
+
+    // nothing is written, so overwrite behaves like write
+    tracker.wearWrittenUnits(2);
+    EXPECT_EQ(tracker.getWrittenUnits(), 2);
+
+    tracker.writeUnits(8);
+    EXPECT_EQ(tracker.getWrittenUnits(), 10);
+
+    for (size_t i = 0; i < 1000; ++i)
+        tracker.wearWrittenUnits(1);
+
+    // only written space is worn
+    for (size_t unit = 10; unit < 100; ++unit)
+        EXPECT_EQ(tracker.getUnitWear(unit), 0);
+
+    size_t sum = 0;
+    for (size_t unit = 0; unit < 10; ++unit)
+        sum += tracker.getUnitWear(unit);
+
+    EXPECT_EQ(sum, 1000 + 2);
+    EXPECT_GT(tracker.getGiniWear(), 0.8);
+}
+
+GTEST_TEST(wearTrackerBasicTest, summaries)
+{
+    WearTracker tracker(4);
+
+    // even wear
+    tracker.wearNextUnits(8);
+    EXPECT_EQ(tracker.getMinWear(), 2);
+    EXPECT_EQ(tracker.getMaxWear(), 2);
+    EXPECT_DOUBLE_EQ(tracker.getMeanWear(), 2.0);
+    EXPECT_DOUBLE_EQ(tracker.getStdDevWear(), 0.0);
+    EXPECT_DOUBLE_EQ(tracker.getGiniWear(), 0.0);
+
+    // 8 wears in 2s, so device with endurance 100 dies after 100s
+    EXPECT_DOUBLE_EQ(tracker.estimateLifetime(100, 2.0), 100.0);
+
+    // only 1 unit is worn
+    WearTracker hot(4);
+    hot.wearUnits(1, 1);
+    hot.wearUnits(1, 1);
+    EXPECT_EQ(hot.getMinWear(), 0);
+    EXPECT_EQ(hot.getMaxWear(), 2);
+    EXPECT_DOUBLE_EQ(hot.getMeanWear(), 0.5);
+    EXPECT_DOUBLE_EQ(hot.getStdDevWear(), std::sqrt(0.75));
+    EXPECT_DOUBLE_EQ(hot.getGiniWear(), 0.75);
+    EXPECT_DOUBLE_EQ(hot.estimateLifetime(100, 2.0), 100.0);
+}
+
+GTEST_TEST(wearTrackerBasicTest, sampling)
+{
+    WearTracker tracker(100, 10);
+
+    EXPECT_EQ(tracker.getSampleRate(), 10);
+    EXPECT_EQ(tracker.getTrackedUnits(), 10);
+
+    tracker.wearUnits(5, 10);
+    EXPECT_EQ(tracker.getUnitWear(10), 1);
+    EXPECT_EQ(tracker.getUnitWear(0), 0);
+    EXPECT_EQ(tracker.getUnitWear(11), 0);
+
+    // wrapped range
+    tracker.wearUnits(95, 10);
+    EXPECT_EQ(tracker.getUnitWear(0), 1);
+    EXPECT_EQ(tracker.getUnitWear(90), 0);
+
+    tracker.wearNextUnits(100);
+    EXPECT_EQ(tracker.getMinWear(), 1);
+    EXPECT_EQ(tracker.getMaxWear(), 2);
+
+    WearTracker zeroRate(10, 0);
+    EXPECT_EQ(zeroRate.getSampleRate(), 1);
+}
+
+GTEST_TEST(wearTrackerBasicTest, reset)
+{
+    WearTracker tracker(10);
+
+    tracker.wearNextUnits(15);
+    EXPECT_EQ(tracker.getMaxWear(), 2);
+
+    tracker.reset();
+    EXPECT_EQ(tracker.getMaxWear(), 0);
+    EXPECT_EQ(tracker.getWrittenUnits(), 0);
+    EXPECT_EQ(tracker.getNumUnits(), 10);
+
+    tracker.wearNextUnits(1);
+    EXPECT_EQ(tracker.getUnitWear(0), 1);
+}
+
+GTEST_TEST(wearTrackerBasicTest, copy)
+{
+    WearTracker tracker(10);
+    tracker.wearNextUnits(15);
+
+    WearTracker copy(tracker);
+    EXPECT_EQ(copy.getUnitsWear(), tracker.getUnitsWear());
+    EXPECT_EQ(copy.getWrittenUnits(), 10);
+
+    WearTracker copy2;
+    copy2 = copy;
+    EXPECT_EQ(copy2.getMaxWear(), 2);
+
+    WearTracker copy3(std::move(copy2));
+    EXPECT_EQ(copy3.getMaxWear(), 2);
+    EXPECT_EQ(copy3.toString(), tracker.toString());
+}
\ No newline at end of file
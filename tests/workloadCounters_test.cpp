@@ -1,5 +1,6 @@
 #include <observability/workloadCounters.hpp>
 #include <string>
+#include <sstream>
 #include <iostream>
 
 #include <gtest/gtest.h>
@@ -404,4 +405,41 @@ GTEST_TEST(workloadCountersBasicTest, resetCounter)
         EXPECT_EQ(workloadCounters.getCounterValue(id), 0L);
         EXPECT_EQ(workloadCounters.getCounter(id).second, 0L);
     }
+}
+
+GTEST_TEST(workloadCountersBasicTest, serialize)
+{
+    WorkloadCounters workloadCounters;
+
+    double valD = 1.25;
+    for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_TIME; id < WorkloadCounters::WORKLOAD_COUNTER_D_MAX_ITERATOR; ++id)
+    {
+        workloadCounters.pegCounter(id, valD);
+        valD += 0.1;
+    }
+
+    long valL = 3;
+    for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < WorkloadCounters::WORKLOAD_COUNTER_L_MAX_ITERATOR; ++id)
+    {
+        workloadCounters.pegCounter(id, valL);
+        valL += 7;
+    }
+
+    std::stringstream stream;
+    workloadCounters.serialize(stream);
+
+    WorkloadCounters restored;
+    restored.pegCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_TIME, 100.0);
+    EXPECT_TRUE(restored.deserialize(stream));
+
+    for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_TIME; id < WorkloadCounters::WORKLOAD_COUNTER_D_MAX_ITERATOR; ++id)
+        EXPECT_EQ(restored.getCounterValue(id), workloadCounters.getCounterValue(id));
+
+    for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < WorkloadCounters::WORKLOAD_COUNTER_L_MAX_ITERATOR; ++id)
+        EXPECT_EQ(restored.getCounterValue(id), workloadCounters.getCounterValue(id));
+
+    // broken stream does not change counters
+    std::stringstream broken(stream.str().substr(0, 16));
+    EXPECT_FALSE(restored.deserialize(broken));
+    EXPECT_EQ(restored.getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_TIME), 1.25);
 }
\ No newline at end of file
@@ -0,0 +1,214 @@
+#include <workload/workloadStepTrace.hpp>
+#include <workload/workload.hpp>
+#include <disk/diskSSD.hpp>
+#include <index/phantomIndex.hpp>
+#include <index/bptree.hpp>
+#include <index/dsm.hpp>
+#include <string>
+#include <fstream>
+#include <iostream>
+#include <filesystem>
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+static std::string tempPath(const std::string& fileName)
+{
+    return (std::filesystem::temp_directory_path() / fileName).string();
+}
+
+static void writeCsvTrace(const std::string& path)
+{
+    std::ofstream csv(path);
+
+    csv << "# op,key,rangeLength,timestamp\n";
+    csv << "BULKLOAD,0,1000,1\n";
+    csv << "BULKLOAD,0,500,2\n";
+    for (size_t i = 0; i < 10; ++i)
+        csv << "INSERT," << i << ",0," << 3 + i << "\n";
+
+    csv << "PSEARCH,1,0,20\n";
+    csv << "RSEARCH,1,10,21\n";
+    csv << "RSEARCH,1,10,22\n";
+    csv << "RSEARCH,1,20,23\n";
+    csv << "DELETE,1,0,24\n";
+    csv << "UNKNOWN,1,0,25\n";
+    csv << "\n";
+    csv << "I,7,0,26\n";
+}
+
+GTEST_TEST(workloadStepTraceTest, convertCsv)
+{
+    const std::string csvPath = tempPath("workloadStepTraceTest_convertCsv.csv");
+    const std::string tracePath = tempPath("workloadStepTraceTest_convertCsv.trace");
+
+    writeCsvTrace(csvPath);
+
+    EXPECT_EQ(WorkloadStepTrace::convertCsvToTrace(csvPath, tracePath), 18);
+
+    std::ifstream trace(tracePath, std::ios::binary);
+    WorkloadStepTrace::TraceHeader header;
+    trace.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    EXPECT_EQ(header.magic, WorkloadStepTrace::traceMagic);
+    EXPECT_EQ(header.numRecords, 18);
+
+    WorkloadStepTrace::TraceRecord record;
+    trace.read(reinterpret_cast<char*>(&record), sizeof(record));
+    EXPECT_EQ(record.opType, WorkloadStepTrace::TRACE_OPERATION_BULKLOAD);
+    EXPECT_EQ(record.rangeLength, 1000);
+    EXPECT_EQ(record.timestamp, 1);
+
+    EXPECT_EQ(WorkloadStepTrace::convertCsvToTrace(tempPath("workloadStepTraceTest_doesNotExist.csv"), tracePath), 0);
+
+    std::remove(csvPath.c_str());
+    std::remove(tracePath.c_str());
+}
+
+GTEST_TEST(workloadStepTraceTest, replayBatched)
+{
+    const std::string csvPath = tempPath("workloadStepTraceTest_replayBatched.csv");
+    const std::string tracePath = tempPath("workloadStepTraceTest_replayBatched.trace");
+
+    writeCsvTrace(csvPath);
+    EXPECT_EQ(WorkloadStepTrace::convertCsvToTrace(csvPath, tracePath), 18);
+
+    Disk* disk = new DiskSSD_Samsung840();
+    PhantomIndex* ph = new PhantomIndex(disk, true);
+    DBIndex* index = ph;
+
+    WorkloadStepTrace* w = new WorkloadStepTrace(index, tracePath);
+
+    w->executeStep();
+
+    // bulkload x2, insert x10, psearch, rsearch(10) x2, rsearch(20), delete, insert
+    EXPECT_EQ(w->getNumRecordsReplayed(), 18);
+    EXPECT_EQ(w->getNumBatches(), 7);
+
+    EXPECT_EQ(w->getCounters().getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_BULKLOAD_TOTAL_OPERATIONS), 1L);
+    EXPECT_EQ(w->getCounters().getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS), 11L);
+    EXPECT_EQ(w->getCounters().getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_PSEARCH_TOTAL_OPERATIONS), 1L);
+    EXPECT_EQ(w->getCounters().getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_RSEARCH_TOTAL_OPERATIONS), 3L);
+    EXPECT_EQ(w->getCounters().getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_DELETE_TOTAL_OPERATIONS), 1L);
+
+    EXPECT_EQ(index->getNumEntries(), 1500 + 11 - 1);
+
+    delete w;
+    delete index;
+
+    std::remove(csvPath.c_str());
+    std::remove(tracePath.c_str());
+}
+
+GTEST_TEST(workloadStepTraceTest, replayMaxBatch)
+{
+    const std::string csvPath = tempPath("workloadStepTraceTest_replayMaxBatch.csv");
+    const std::string tracePath = tempPath("workloadStepTraceTest_replayMaxBatch.trace");
+
+    writeCsvTrace(csvPath);
+    EXPECT_EQ(WorkloadStepTrace::convertCsvToTrace(csvPath, tracePath), 18);
+
+    Disk* disk = new DiskSSD_Samsung840();
+    BPTree* bp = new BPTree(disk, 8, 64, 1 << 14, true);
+    DBIndex* index = bp;
+
+    WorkloadStepTrace* w = new WorkloadStepTrace(index, tracePath, 4);
+
+    const double time = w->executeStep();
+
+    // 10 inserts are split into 4 + 4 + 2
+    EXPECT_EQ(w->getNumRecordsReplayed(), 18);
+    EXPECT_EQ(w->getNumBatches(), 9);
+    EXPECT_GT(time, 0.0);
+    EXPECT_EQ(w->getCounters().getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS), 11L);
+
+    delete w;
+    delete index;
+
+    std::remove(csvPath.c_str());
+    std::remove(tracePath.c_str());
+}
+
+GTEST_TEST(workloadStepTraceTest, replayColumn)
+{
+    const std::string csvPath = tempPath("workloadStepTraceTest_replayColumn.csv");
+    const std::string tracePath = tempPath("workloadStepTraceTest_replayColumn.trace");
+
+    writeCsvTrace(csvPath);
+    EXPECT_EQ(WorkloadStepTrace::convertCsvToTrace(csvPath, tracePath), 18);
+
+    Disk* disk = new DiskSSD_Samsung840();
+    DSM* dsm = new DSM(disk, std::vector<size_t>{8, 8, 16, 32});
+    DBIndexColumn* index = dsm;
+
+    WorkloadStepTrace* w = new WorkloadStepTrace(index, tracePath, std::vector<size_t>{0, 2});
+
+    const double time = w->executeStep();
+
+    EXPECT_EQ(w->getNumRecordsReplayed(), 18);
+    EXPECT_GT(time, 0.0);
+    EXPECT_EQ(w->getCounters().getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_RSEARCH_TOTAL_OPERATIONS), 3L);
+
+    delete w;
+    delete index;
+
+    std::remove(csvPath.c_str());
+    std::remove(tracePath.c_str());
+}
+
+GTEST_TEST(workloadStepTraceTest, wrongFile)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    PhantomIndex* ph = new PhantomIndex(disk, true);
+    DBIndex* index = ph;
+
+    WorkloadStepTrace* w = new WorkloadStepTrace(index, tempPath("workloadStepTraceTest_doesNotExist.trace"));
+
+    EXPECT_DOUBLE_EQ(w->executeStep(), 0.0);
+    EXPECT_EQ(w->getNumRecordsReplayed(), 0);
+
+    const std::string csvPath = tempPath("workloadStepTraceTest_wrongFile.csv");
+    std::ofstream csv(csvPath);
+    csv << "this is not binary trace, but it is long enough to have header\n";
+    csv.close();
+
+    WorkloadStepTrace* w2 = new WorkloadStepTrace(index, csvPath);
+    EXPECT_DOUBLE_EQ(w2->executeStep(), 0.0);
+    EXPECT_EQ(w2->getNumRecordsReplayed(), 0);
+
+    delete w;
+    delete w2;
+    delete index;
+
+    std::remove(csvPath.c_str());
+}
+
+GTEST_TEST(workloadStepTraceTest, workload)
+{
+    const std::string csvPath = tempPath("workloadStepTraceTest_workload.csv");
+    const std::string tracePath = tempPath("workloadStepTraceTest_workload.trace");
+
+    writeCsvTrace(csvPath);
+    EXPECT_EQ(WorkloadStepTrace::convertCsvToTrace(csvPath, tracePath), 18);
+
+    Disk* disk = new DiskSSD_Samsung840();
+    BPTree* bp = new BPTree(disk, 8, 64, 1 << 14, true);
+    DBIndex* index = bp;
+
+    std::vector<WorkloadStep*> steps;
+    std::vector<DBIndex*> indexes;
+
+    indexes.push_back(index);
+    steps.push_back(new WorkloadStepTrace(tracePath));
+
+    Workload w(indexes, steps);
+    w.run();
+
+    EXPECT_EQ(w.getAllStepCounters().size(), 1);
+    EXPECT_EQ(w.getAllStepCounters()[0][0].getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS), 11L);
+
+    delete index;
+
+    std::remove(csvPath.c_str());
+    std::remove(tracePath.c_str());
+}
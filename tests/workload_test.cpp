@@ -10,7 +10,10 @@
 #include <index/bptree.hpp>
 #include <index/dbIndexRawToColumnWrapper.hpp>
 #include <index/dsm.hpp>
+#include <index/lsmtree.hpp>
 #include <string>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 
 #include <gtest/gtest.h>
@@ -70,7 +73,7 @@ GTEST_TEST(workloadTestRaw, interface)
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -89,7 +92,7 @@ GTEST_TEST(workloadTestRaw, interface)
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
@@ -398,7 +401,7 @@ GTEST_TEST(workloadTestRaw, multiSteps)
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -417,7 +420,7 @@ GTEST_TEST(workloadTestRaw, multiSteps)
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
@@ -538,7 +541,7 @@ GTEST_TEST(workloadTestRaw, copy)
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -557,7 +560,7 @@ GTEST_TEST(workloadTestRaw, copy)
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
@@ -642,7 +645,7 @@ GTEST_TEST(workloadTestRaw, copy)
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -666,7 +669,7 @@ GTEST_TEST(workloadTestRaw, copy)
                 EXPECT_NE(copy.getTotalCounters(i).getCounterValue(id), 0);
                 EXPECT_NE(copy.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(copy.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(copy.getTotalCounters(i).getCounter(id).second, 0L);
@@ -747,7 +750,7 @@ GTEST_TEST(workloadTestRaw, copy)
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -766,7 +769,7 @@ GTEST_TEST(workloadTestRaw, copy)
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0L);
@@ -887,7 +890,7 @@ GTEST_TEST(workloadTestRaw, move)
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -906,7 +909,7 @@ GTEST_TEST(workloadTestRaw, move)
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
@@ -991,7 +994,7 @@ GTEST_TEST(workloadTestRaw, move)
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -1015,7 +1018,7 @@ GTEST_TEST(workloadTestRaw, move)
                 EXPECT_NE(copy.getTotalCounters(i).getCounterValue(id), 0);
                 EXPECT_NE(copy.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(copy.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(copy.getTotalCounters(i).getCounter(id).second, 0L);
@@ -1096,7 +1099,7 @@ GTEST_TEST(workloadTestRaw, move)
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -1115,7 +1118,7 @@ GTEST_TEST(workloadTestRaw, move)
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0L);
@@ -1249,7 +1252,7 @@ GTEST_TEST(workloadTestColumn, interface)
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -1268,7 +1271,7 @@ GTEST_TEST(workloadTestColumn, interface)
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
@@ -1575,7 +1578,7 @@ GTEST_TEST(workloadTestColumn, multiSteps)
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -1594,7 +1597,7 @@ GTEST_TEST(workloadTestColumn, multiSteps)
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
@@ -1715,7 +1718,7 @@ GTEST_TEST(workloadTestColumn, copy)
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -1734,7 +1737,7 @@ GTEST_TEST(workloadTestColumn, copy)
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
@@ -1819,7 +1822,7 @@ GTEST_TEST(workloadTestColumn, copy)
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -1843,7 +1846,7 @@ GTEST_TEST(workloadTestColumn, copy)
                 EXPECT_NE(copy.getTotalCounters(i).getCounterValue(id), 0);
                 EXPECT_NE(copy.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(copy.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(copy.getTotalCounters(i).getCounter(id).second, 0L);
@@ -1924,7 +1927,7 @@ GTEST_TEST(workloadTestColumn, copy)
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -1943,7 +1946,7 @@ GTEST_TEST(workloadTestColumn, copy)
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0L);
@@ -2064,7 +2067,7 @@ GTEST_TEST(workloadTestColumn, move)
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(w.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -2083,7 +2086,7 @@ GTEST_TEST(workloadTestColumn, move)
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(w.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(w.getTotalCounters(i).getCounter(id).second, 0L);
@@ -2168,7 +2171,7 @@ GTEST_TEST(workloadTestColumn, move)
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -2192,7 +2195,7 @@ GTEST_TEST(workloadTestColumn, move)
                 EXPECT_NE(copy.getTotalCounters(i).getCounterValue(id), 0);
                 EXPECT_NE(copy.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(copy.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(copy.getTotalCounters(i).getCounter(id).second, 0L);
@@ -2273,7 +2276,7 @@ GTEST_TEST(workloadTestColumn, move)
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0.0);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_TIME)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_TIME && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_TIME)
             {
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0.0);
                 EXPECT_DOUBLE_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0.0);
@@ -2292,7 +2295,7 @@ GTEST_TEST(workloadTestColumn, move)
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0L);
             }
-            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_TOTAL_OPERATIONS)
+            else if (id >= WorkloadCounters::WORKLOAD_AM_COUNTER_RW_INVALIDATION_TOTAL_OPERATIONS && id <= WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS)
             {
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounterValue(id), 0L);
                 EXPECT_EQ(copy2.getTotalCounters(i).getCounter(id).second, 0L);
@@ -2368,4 +2371,327 @@ GTEST_TEST(workloadTestColumn, move)
 
     delete index;
     delete index2;
-}
\ No newline at end of file
+}
+
+class WorkloadCheckpointTest : public Workload
+{
+public:
+    using Workload::Workload;
+
+    bool save(size_t completedIndexes) const noexcept(true)
+    {
+        return saveCheckpoint(completedIndexes);
+    }
+};
+
+static std::vector<DBIndex*> workloadCheckpointTestCreateIndexes()
+{
+    PhantomIndex* ph = new PhantomIndex(new DiskSSD_Samsung840(), true);
+    ph->insertEntries(1000);
+
+    BPTree* bp = new BPTree(new DiskSSD_Samsung840(), 8, 64, 1 << 14, true);
+    bp->insertEntries(1000);
+
+    return std::vector<DBIndex*>{ph, bp};
+}
+
+static std::vector<WorkloadStep*> workloadCheckpointTestCreateSteps(size_t numOperations)
+{
+    return std::vector<WorkloadStep*>{new WorkloadStepInsert(numOperations),
+                                      new WorkloadStepDelete(numOperations),
+                                      new WorkloadStepPSearch(numOperations),
+                                      new WorkloadStepRSearch(static_cast<size_t>(10), numOperations)};
+}
+
+static void workloadCheckpointTestCompare(const Workload& w1, const Workload& w2)
+{
+    ASSERT_EQ(w1.getAllTotalCounters().size(), w2.getAllTotalCounters().size());
+    ASSERT_EQ(w1.getAllStepCounters().size(), w2.getAllStepCounters().size());
+
+    for (size_t i = 0; i < w1.getAllTotalCounters().size(); ++i)
+    {
+        for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_TIME; id < WorkloadCounters::WORKLOAD_COUNTER_D_MAX_ITERATOR; ++id)
+            EXPECT_DOUBLE_EQ(w1.getTotalCounters(i).getCounterValue(id), w2.getTotalCounters(i).getCounterValue(id));
+
+        for (auto id = WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS; id < WorkloadCounters::WORKLOAD_COUNTER_L_MAX_ITERATOR; ++id)
+            EXPECT_EQ(w1.getTotalCounters(i).getCounterValue(id), w2.getTotalCounters(i).getCounterValue(id));
+    }
+
+    for (size_t i = 0; i < w1.getAllStepCounters().size(); ++i)
+    {
+        ASSERT_EQ(w1.getAllStepCounters()[i].size(), w2.getAllStepCounters()[i].size());
+        for (size_t j = 0; j < w1.getAllStepCounters()[i].size(); ++j)
+        {
+            EXPECT_DOUBLE_EQ(w1.getStepCounters(i, j).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME), w2.getStepCounters(i, j).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME));
+            EXPECT_EQ(w1.getStepCounters(i, j).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_OPERATIONS), w2.getStepCounters(i, j).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_OPERATIONS));
+        }
+    }
+}
+
+GTEST_TEST(workloadTestRaw, checkpoint)
+{
+    const std::string checkpointPath("./workloadTestRaw_checkpoint.ckpt");
+    std::remove(checkpointPath.c_str());
+
+    // reference without checkpoint
+    std::vector<DBIndex*> indexes = workloadCheckpointTestCreateIndexes();
+    Workload reference(indexes, workloadCheckpointTestCreateSteps(100));
+    reference.run();
+    for (auto index : indexes)
+        delete index;
+
+    // full run removes checkpoint
+    indexes = workloadCheckpointTestCreateIndexes();
+    Workload w(indexes, workloadCheckpointTestCreateSteps(100));
+    w.setCheckpointPath(checkpointPath);
+    EXPECT_EQ(w.getCheckpointPath(), checkpointPath);
+
+    w.run();
+    EXPECT_EQ(w.getNumRestoredIndexes(), 0);
+    EXPECT_FALSE(std::ifstream(checkpointPath).is_open());
+    workloadCheckpointTestCompare(reference, w);
+    for (auto index : indexes)
+        delete index;
+
+    // rerun of finished workload starts from the beginning
+    indexes = workloadCheckpointTestCreateIndexes();
+    Workload rerun(indexes, workloadCheckpointTestCreateSteps(100));
+    rerun.setCheckpointPath(checkpointPath);
+    rerun.run();
+    EXPECT_EQ(rerun.getNumRestoredIndexes(), 0);
+    workloadCheckpointTestCompare(reference, rerun);
+    for (auto index : indexes)
+        delete index;
+
+    // process killed during second index, only first index is in checkpoint
+    indexes = workloadCheckpointTestCreateIndexes();
+    WorkloadCheckpointTest killed(indexes, workloadCheckpointTestCreateSteps(100));
+    killed.setCheckpointPath(checkpointPath);
+    killed.run();
+    EXPECT_TRUE(killed.save(1));
+    for (auto index : indexes)
+        delete index;
+
+    indexes = workloadCheckpointTestCreateIndexes();
+    Workload resumed(indexes, workloadCheckpointTestCreateSteps(100));
+    resumed.setCheckpointPath(checkpointPath);
+    resumed.run();
+    EXPECT_EQ(resumed.getNumRestoredIndexes(), 1);
+    EXPECT_FALSE(std::ifstream(checkpointPath).is_open());
+    workloadCheckpointTestCompare(reference, resumed);
+    for (auto index : indexes)
+        delete index;
+
+    std::remove(checkpointPath.c_str());
+}
+
+/**
+ * @brief Save checkpoint of the first index of checkpoint workload with 100 operations per step, like after killed run
+ *
+ * @param[in] checkpointPath - path of checkpoint
+ */
+static void workloadCheckpointTestSaveKilled(const std::string& checkpointPath)
+{
+    std::vector<DBIndex*> indexes = workloadCheckpointTestCreateIndexes();
+    WorkloadCheckpointTest killed(indexes, workloadCheckpointTestCreateSteps(100));
+    killed.setCheckpointPath(checkpointPath);
+    killed.run();
+    killed.save(1);
+
+    for (auto index : indexes)
+        delete index;
+}
+
+GTEST_TEST(workloadTestRaw, checkpointOtherWorkload)
+{
+    const std::string checkpointPath("./workloadTestRaw_checkpointOtherWorkload.ckpt");
+    std::remove(checkpointPath.c_str());
+
+    // the same workload
+    workloadCheckpointTestSaveKilled(checkpointPath);
+    std::vector<DBIndex*> indexes = workloadCheckpointTestCreateIndexes();
+    Workload w(indexes, workloadCheckpointTestCreateSteps(100));
+    w.setCheckpointPath(checkpointPath);
+    w.run();
+    EXPECT_EQ(w.getNumRestoredIndexes(), 1);
+    for (auto index : indexes)
+        delete index;
+
+    // different steps
+    workloadCheckpointTestSaveKilled(checkpointPath);
+    indexes = workloadCheckpointTestCreateIndexes();
+    Workload otherSteps(indexes, workloadCheckpointTestCreateSteps(50));
+    otherSteps.setCheckpointPath(checkpointPath);
+    otherSteps.run();
+    EXPECT_EQ(otherSteps.getNumRestoredIndexes(), 0);
+    EXPECT_EQ(otherSteps.getTotalCounters(0).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS), 50);
+    for (auto index : indexes)
+        delete index;
+
+    // different indexes
+    workloadCheckpointTestSaveKilled(checkpointPath);
+    indexes = workloadCheckpointTestCreateIndexes();
+    std::swap(indexes[0], indexes[1]);
+    Workload otherIndexes(indexes, workloadCheckpointTestCreateSteps(100));
+    otherIndexes.setCheckpointPath(checkpointPath);
+    otherIndexes.run();
+    EXPECT_EQ(otherIndexes.getNumRestoredIndexes(), 0);
+    for (auto index : indexes)
+        delete index;
+
+    // the same index names, but different index state
+    workloadCheckpointTestSaveKilled(checkpointPath);
+    indexes = workloadCheckpointTestCreateIndexes();
+    indexes[0]->insertEntries(1);
+    Workload otherState(indexes, workloadCheckpointTestCreateSteps(100));
+    otherState.setCheckpointPath(checkpointPath);
+    otherState.run();
+    EXPECT_EQ(otherState.getNumRestoredIndexes(), 0);
+    for (auto index : indexes)
+        delete index;
+
+    // the same index names, but different disk
+    workloadCheckpointTestSaveKilled(checkpointPath);
+    indexes = workloadCheckpointTestCreateIndexes();
+    delete indexes[0];
+    indexes[0] = new PhantomIndex(new DiskSSD_IntelDCP4511(), true);
+    indexes[0]->insertEntries(1000);
+    Workload otherDisk(indexes, workloadCheckpointTestCreateSteps(100));
+    otherDisk.setCheckpointPath(checkpointPath);
+    otherDisk.run();
+    EXPECT_EQ(otherDisk.getNumRestoredIndexes(), 0);
+    for (auto index : indexes)
+        delete index;
+
+    // step counters not kept
+    workloadCheckpointTestSaveKilled(checkpointPath);
+    indexes = workloadCheckpointTestCreateIndexes();
+    Workload noSteps(indexes, workloadCheckpointTestCreateSteps(100));
+    noSteps.setKeepStepCounters(false);
+    noSteps.setCheckpointPath(checkpointPath);
+    noSteps.run();
+    EXPECT_EQ(noSteps.getNumRestoredIndexes(), 0);
+    for (auto index : indexes)
+        delete index;
+
+    std::remove(checkpointPath.c_str());
+}
+
+GTEST_TEST(workloadTestRaw, backgroundCounters)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+
+    LSMTree* lsm = new LSMTree(disk, 8, 64, disk->getLowLevelController().getPageSize(), disk->getLowLevelController().getPageSize(), 5);
+    lsm->setBackgroundCompaction(1, 1);
+
+    std::vector<DBIndex*> indexes;
+    indexes.push_back(lsm);
+
+    std::vector<WorkloadStep*> steps;
+    steps.push_back(new WorkloadStepInsert(10000));
+    steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(100)));
+
+    Workload w(indexes, steps);
+    w.run();
+
+    EXPECT_GT(w.getStepCounters(0, 0).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_TIME), 0.0);
+    EXPECT_GT(w.getStepCounters(0, 0).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_OPERATIONS), 0L);
+    EXPECT_GT(w.getStepCounters(0, 0).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_STALL_TOTAL_OPERATIONS), 0L);
+    EXPECT_DOUBLE_EQ(w.getStepCounters(0, 1).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_TIME), 0.0);
+    EXPECT_EQ(std::string(w.getTotalCounters(0).getCounter(WorkloadCounters::WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_TIME).first), std::string("WORKLOAD_COUNTER_RW_BACKGROUND_TOTAL_TIME"));
+
+    delete lsm;
+}
+
+class WorkloadSinkCountTest : public WorkloadSink
+{
+public:
+    size_t numBegins = 0;
+    size_t numSteps = 0;
+    size_t numEnds = 0;
+
+    void beginWorkload(const std::vector<std::string>& indexesName) noexcept(true) override
+    {
+        (void)indexesName;
+        ++numBegins;
+    }
+
+    void consumeStep(size_t index, size_t step, const WorkloadCounters& counters) noexcept(true) override
+    {
+        (void)index;
+        (void)step;
+        (void)counters;
+        ++numSteps;
+    }
+
+    void endWorkload() noexcept(true) override
+    {
+        ++numEnds;
+    }
+};
+
+GTEST_TEST(workloadTestRaw, copyWithoutSinks)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    DBIndex* index = new PhantomIndex(disk, true);
+
+    std::vector<WorkloadStep*> steps;
+    steps.push_back(new WorkloadStepInsert(100));
+    steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(10)));
+
+    WorkloadSinkCountTest sink;
+    Workload w(std::vector<DBIndex*>{index}, steps);
+    w.addSink(&sink);
+
+    // copy does not write to sink of original workload
+    Workload copy(w);
+    copy.run();
+    EXPECT_EQ(sink.numBegins, 0);
+    EXPECT_EQ(sink.numSteps, 0);
+    EXPECT_EQ(sink.numEnds, 0);
+
+    // assignment keeps own sinks
+    WorkloadSinkCountTest sink2;
+    Workload assigned;
+    assigned.addSink(&sink2);
+    assigned = w;
+    assigned.run();
+    EXPECT_EQ(sink.numSteps, 0);
+    EXPECT_EQ(sink2.numBegins, 1);
+    EXPECT_EQ(sink2.numSteps, 2);
+    EXPECT_EQ(sink2.numEnds, 1);
+
+    w.run();
+    EXPECT_EQ(sink.numBegins, 1);
+    EXPECT_EQ(sink.numSteps, 2);
+    EXPECT_EQ(sink.numEnds, 1);
+
+    delete index;
+}
+
+GTEST_TEST(workloadTestRaw, stepCountersNotKept)
+{
+    Disk* disk = new DiskSSD_Samsung840();
+    DBIndex* index = new PhantomIndex(disk, true);
+
+    std::vector<WorkloadStep*> steps;
+    steps.push_back(new WorkloadStepInsert(100));
+    steps.push_back(new WorkloadStepPSearch(static_cast<size_t>(10)));
+
+    Workload w(std::vector<DBIndex*>{index}, steps);
+    w.setKeepStepCounters(false);
+    w.run();
+
+    EXPECT_EQ(w.getTotalCounters(0).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS), 100);
+    EXPECT_EQ(w.getAllStepCounters().size(), 0);
+
+    // without step counters empty counters are returned
+    EXPECT_EQ(w.getStepCounters(0, 0).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS), 0);
+    EXPECT_DOUBLE_EQ(w.getStepCounters(0, 1).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_TOTAL_TIME), 0.0);
+
+    // out of range gives empty counters too
+    w.setKeepStepCounters(true);
+    EXPECT_EQ(w.getStepCounters(1, 0).getCounterValue(WorkloadCounters::WORKLOAD_COUNTER_RW_INSERT_TOTAL_OPERATIONS), 0);
+
+    delete index;
+}